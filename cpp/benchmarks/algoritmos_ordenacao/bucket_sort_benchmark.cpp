@@ -0,0 +1,59 @@
+/**
+ * @file bucket_sort_benchmark.cpp
+ * @brief Compara o bucket_sort (sequencial e o paralelo in-place) com o radix_sort e com std::sort
+ * em doubles e floats com distribuição uniforme, normal e exponencial.
+ *
+ * Uso: bucket_sort_benchmark [tamanho] [threads]
+ */
+
+#include "benchmark_util.hpp"
+#include "algoritmos_ordenacao/bucket_sort.hpp"
+#include "algoritmos_ordenacao/radix_sort.hpp"
+#include <algorithm>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+template <typename T>
+bool comparar(const std::string& nome, const std::vector<T>& original, unsigned threads) {
+    const std::size_t n = original.size();
+    std::vector<T> referencia = original;
+    imprimir_resultado("std::sort " + nome, medir_segundos([&] { std::sort(referencia.begin(), referencia.end()); }), n);
+    bool ok = true;
+    auto medir = [&](const std::string& algoritmo, auto ordenar) {
+        std::vector<T> v = original;
+        imprimir_resultado(algoritmo + " " + nome, medir_segundos([&] { ordenar(v); }), n);
+        ok = ok && v == referencia;
+    };
+    medir("radix_sort", [](std::vector<T>& v) { radix_sort(v); });
+    medir("bucket_sort", [](std::vector<T>& v) { bucket_sort(v); });
+    medir("bucket_sort_paralelo " + std::to_string(threads) + "T", [&](std::vector<T>& v) { bucket_sort_paralelo(v, threads); });
+    std::printf("\n");
+    return ok;
+}
+
+template <typename T, typename Distribuicao>
+std::vector<T> gerar(std::size_t n, Distribuicao distribuicao, std::mt19937_64& gerador) {
+    std::vector<T> v(n);
+    for (auto& x : v) x = distribuicao(gerador);
+    return v;
+}
+
+int main(int argc, char** argv) {
+    const std::size_t n = argumento(argc, argv, 1, 10000000);
+    const unsigned threads = static_cast<unsigned>(argumento(argc, argv, 2, std::max(1u, std::thread::hardware_concurrency())));
+    std::mt19937_64 gerador(42);
+    bool ok = true;
+
+    ok = comparar("uniforme (double)", gerar<double>(n, std::uniform_real_distribution<double>(0, 1), gerador), threads) && ok;
+    ok = comparar("normal (double)", gerar<double>(n, std::normal_distribution<double>(0, 1), gerador), threads) && ok;
+    ok = comparar("exponencial (double)", gerar<double>(n, std::exponential_distribution<double>(1), gerador), threads) && ok;
+    ok = comparar("uniforme (float)", gerar<float>(n, std::uniform_real_distribution<float>(-1e3f, 1e3f), gerador), threads) && ok;
+
+    if (!ok) {
+        std::printf("ERRO: o resultado difere do de std::sort\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,94 @@
+/**
+ * @file counting_sort_benchmark.cpp
+ * @brief Compara o counting_sort (sequencial e paralelo) com o radix_sort e com std::sort em
+ * chaves de faixa pequena: códigos de status HTTP (Zipf sobre ~60 valores), ids de shard (uniformes
+ * em [0, 1024)) e bytes; e, com carga, registros de 16 bytes ordenados pelo status contra
+ * std::stable_sort e radix_sort_por_chave.
+ *
+ * Uso: counting_sort_benchmark [tamanho] [threads]
+ */
+
+#include "benchmark_util.hpp"
+#include "algoritmos_ordenacao/counting_sort.hpp"
+#include "algoritmos_ordenacao/radix_sort.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct RegistroRequisicao {
+    std::uint16_t status;
+    std::uint16_t shard;
+    std::uint32_t latencia_us;
+    std::uint64_t id;
+
+    bool operator==(const RegistroRequisicao&) const = default;
+};
+
+template <typename T>
+bool comparar(const std::string& nome, const std::vector<T>& original, unsigned threads) {
+    const std::size_t n = original.size();
+    std::vector<T> referencia = original;
+    imprimir_resultado("std::sort " + nome, medir_segundos([&] { std::sort(referencia.begin(), referencia.end()); }), n);
+    bool ok = true;
+    auto medir = [&](const std::string& algoritmo, auto ordenar) {
+        std::vector<T> v = original;
+        imprimir_resultado(algoritmo + " " + nome, medir_segundos([&] { ordenar(v); }), n);
+        ok = ok && v == referencia;
+    };
+    medir("radix_sort", [](std::vector<T>& v) { radix_sort(v); });
+    medir("counting_sort", [](std::vector<T>& v) { counting_sort(v); });
+    medir("counting_sort_paralelo " + std::to_string(threads) + "T", [&](std::vector<T>& v) { counting_sort_paralelo(v, threads); });
+    std::printf("\n");
+    return ok;
+}
+
+int main(int argc, char** argv) {
+    const std::size_t n = argumento(argc, argv, 1, 20000000);
+    const unsigned threads = static_cast<unsigned>(argumento(argc, argv, 2, std::max(1u, std::thread::hardware_concurrency())));
+    std::mt19937_64 gerador(42);
+    bool ok = true;
+
+    // Status HTTP: poucos valores, muito desiguais (200 domina).
+    static const std::uint16_t CODIGOS[] = {200, 204, 301, 302, 304, 400, 401, 403, 404, 409, 429, 500, 502, 503, 504};
+    GeradorZipf zipf(std::size(CODIGOS), 0.99);
+    std::vector<std::uint16_t> status(n);
+    for (auto& x : status) x = CODIGOS[zipf(gerador)];
+    ok = comparar("status (uint16)", status, threads) && ok;
+
+    std::vector<std::uint32_t> shards(n);
+    for (auto& x : shards) x = static_cast<std::uint32_t>(gerador() % 1024);
+    ok = comparar("shard (uint32)", shards, threads) && ok;
+
+    std::vector<std::uint8_t> bytes(n);
+    for (auto& x : bytes) x = static_cast<std::uint8_t>(gerador());
+    ok = comparar("bytes (uint8)", bytes, threads) && ok;
+
+    // Registros com carga, ordenados de forma estável pelo status.
+    std::vector<RegistroRequisicao> registros(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        registros[i] = {status[i], static_cast<std::uint16_t>(shards[i]), static_cast<std::uint32_t>(gerador() % 100000), i};
+    }
+    auto por_status = [](const RegistroRequisicao& r) { return r.status; };
+    std::vector<RegistroRequisicao> referencia = registros;
+    imprimir_resultado("std::stable_sort registros 16B", medir_segundos([&] {
+        std::stable_sort(referencia.begin(), referencia.end(), [](const auto& a, const auto& b) { return a.status < b.status; });
+    }), n);
+    auto medir = [&](const std::string& nome, auto ordenar) {
+        std::vector<RegistroRequisicao> v = registros;
+        imprimir_resultado(nome, medir_segundos([&] { ordenar(v); }), n);
+        ok = ok && v == referencia;
+    };
+    medir("radix_sort_por_chave registros 16B", [&](auto& v) { radix_sort_por_chave(v, por_status); });
+    medir("counting_sort_por_chave registros 16B", [&](auto& v) { counting_sort_por_chave(v, por_status); });
+    medir("counting_sort_paralelo_por_chave " + std::to_string(threads) + "T",
+          [&](auto& v) { counting_sort_paralelo_por_chave(v, por_status, threads); });
+
+    if (!ok) {
+        std::printf("ERRO: o resultado difere do de std::sort\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,107 @@
+/**
+ * @file heapsort_benchmark.cpp
+ * @brief Compara o heapsort bottom-up 4-ário com o heapsort binário da biblioteca padrão
+ * (std::make_heap + std::sort_heap) em tempo e comparações por elemento; o partial_sort com
+ * std::partial_sort; e o AcumuladorTopK, alimentado em lotes, com uma std::priority_queue de k
+ * elementos ao extrair os 1000 maiores de um fluxo longo.
+ *
+ * Uso: heapsort_benchmark [tamanho] [tamanho do fluxo] [k]
+ */
+
+#include "benchmark_util.hpp"
+#include "algoritmos_ordenacao/heapsort.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <random>
+#include <string>
+#include <vector>
+
+int main(int argc, char** argv) {
+    const std::size_t n = argumento(argc, argv, 1, 10000000);
+    const std::size_t fluxo = argumento(argc, argv, 2, 100000000);
+    const std::size_t k = argumento(argc, argv, 3, 1000);
+    std::mt19937_64 gerador(42);
+    std::vector<std::int64_t> original(n);
+    for (auto& x : original) x = static_cast<std::int64_t>(gerador());
+    std::vector<std::int64_t> referencia = original;
+    std::sort(referencia.begin(), referencia.end());
+    bool ok = true;
+
+    // Mede o tempo com std::less e, numa segunda execução, conta as comparações.
+    auto medir = [&](const std::string& nome, auto ordenar) {
+        std::vector<std::int64_t> v = original;
+        imprimir_resultado(nome, medir_segundos([&] { ordenar(v, std::less<>()); }), n);
+        ok = ok && v == referencia;
+        std::size_t comparacoes = 0;
+        v = original;
+        ordenar(v, [&](std::int64_t a, std::int64_t b) {
+            ++comparacoes;
+            return a < b;
+        });
+        std::printf("%-40s %12.2f comparações/elemento\n", "", static_cast<double>(comparacoes) / n);
+    };
+    medir("std::make_heap + std::sort_heap", [](auto& v, auto comp) {
+        std::make_heap(v.begin(), v.end(), comp);
+        std::sort_heap(v.begin(), v.end(), comp);
+    });
+    medir("heapsort (bottom-up, 4-ário)", [](auto& v, auto comp) { heapsort(v.begin(), v.end(), comp); });
+    std::printf("\n");
+
+    // Os k menores em ordem, no mesmo vetor.
+    for (std::size_t m : {k, n / 10}) {
+        const auto meio = static_cast<std::ptrdiff_t>(m);
+        std::vector<std::int64_t> v = original;
+        imprimir_resultado("std::partial_sort k = " + std::to_string(m),
+                           medir_segundos([&] { std::partial_sort(v.begin(), v.begin() + meio, v.end()); }), n);
+        ok = ok && std::equal(v.begin(), v.begin() + meio, referencia.begin());
+        v = original;
+        imprimir_resultado("partial_sort k = " + std::to_string(m), medir_segundos([&] { partial_sort(v, m); }), n);
+        ok = ok && std::equal(v.begin(), v.begin() + meio, referencia.begin());
+    }
+    std::printf("\n");
+
+    // Fluxo de `fluxo` valores em lotes de 4096, gerados sob demanda; só k ficam em memória.
+    constexpr std::size_t TAMANHO_LOTE = 4096;
+    std::vector<std::int64_t> lote(TAMANHO_LOTE);
+    auto percorrer_fluxo = [&](auto consumir) {
+        std::mt19937_64 fonte(7);
+        for (std::size_t feitos = 0; feitos < fluxo; feitos += TAMANHO_LOTE) {
+            for (auto& x : lote) x = static_cast<std::int64_t>(fonte());
+            consumir(lote);
+        }
+    };
+    imprimir_resultado("só gerar o fluxo", medir_segundos([&] { percorrer_fluxo([](const auto& l) { nao_otimizar(l); }); }), fluxo);
+
+    std::vector<std::int64_t> esperado;
+    imprimir_resultado("std::priority_queue top " + std::to_string(k), medir_segundos([&] {
+        std::priority_queue<std::int64_t, std::vector<std::int64_t>, std::greater<>> fila;
+        percorrer_fluxo([&](const auto& l) {
+            for (std::int64_t x : l) {
+                if (fila.size() < k) {
+                    fila.push(x);
+                } else if (x > fila.top()) {
+                    fila.pop();
+                    fila.push(x);
+                }
+            }
+        });
+        for (; !fila.empty(); fila.pop()) esperado.push_back(fila.top());
+        std::reverse(esperado.begin(), esperado.end());
+    }), fluxo);
+
+    std::vector<std::int64_t> obtido;
+    imprimir_resultado("AcumuladorTopK top " + std::to_string(k), medir_segundos([&] {
+        AcumuladorTopK<std::int64_t> acumulador(k);
+        percorrer_fluxo([&](const auto& l) { acumulador.adicionar(l); });
+        obtido = acumulador.resultado();
+    }), fluxo);
+    ok = ok && obtido == esperado;
+
+    if (!ok) {
+        std::printf("ERRO: o resultado difere do esperado\n");
+        return 1;
+    }
+    return 0;
+}
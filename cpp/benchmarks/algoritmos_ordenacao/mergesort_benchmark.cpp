@@ -0,0 +1,89 @@
+/**
+ * @file mergesort_benchmark.cpp
+ * @brief Compara o mergesort sequencial e o paralelo com std::stable_sort para int64 e strings, e
+ * mede a vazão do mergesort_externo num arquivo binário de uint64 com pouca memória.
+ *
+ * Uso: mergesort_benchmark [tamanho] [threads] [registros_no_arquivo] [memoria_mb]
+ */
+
+#include "benchmark_util.hpp"
+#include "algoritmos_ordenacao/mergesort.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+template <typename T>
+bool comparar(const std::string& tipo, const std::vector<T>& original, unsigned threads) {
+    const std::size_t n = original.size();
+    std::vector<T> referencia = original;
+    imprimir_resultado("std::stable_sort " + tipo,
+                       medir_segundos([&] { std::stable_sort(referencia.begin(), referencia.end()); }), n);
+    bool ok = true;
+    auto medir = [&](const std::string& nome, auto ordenar) {
+        std::vector<T> v = original;
+        imprimir_resultado(nome + " " + tipo, medir_segundos([&] { ordenar(v); }), n);
+        ok = ok && v == referencia;
+    };
+    medir("mergesort", [](std::vector<T>& v) { mergesort(v); });
+    medir("mergesort_paralelo " + std::to_string(threads) + "t",
+          [&](std::vector<T>& v) { mergesort_paralelo(v, std::less<>(), threads); });
+    return ok;
+}
+
+int main(int argc, char** argv) {
+    const std::size_t n = argumento(argc, argv, 1, 1000000);
+    const unsigned threads = static_cast<unsigned>(argumento(argc, argv, 2, std::max(1u, std::thread::hardware_concurrency())));
+    const std::size_t registros_arquivo = argumento(argc, argv, 3, 20000000);
+    const std::size_t memoria_mb = argumento(argc, argv, 4, 16);
+    std::printf("hardware_concurrency = %u\n", std::thread::hardware_concurrency());
+
+    std::mt19937_64 gerador(42);
+    std::vector<std::int64_t> inteiros(n);
+    for (auto& x : inteiros) x = static_cast<std::int64_t>(gerador());
+    std::vector<std::string> strings(n / 4);
+    for (auto& s : strings) s = "evento-" + std::to_string(gerador() % 1000000);
+    bool ok = comparar("int64", inteiros, threads);
+    ok = comparar("string", strings, threads) && ok;
+
+    // Ordenação externa: arquivo de registros_arquivo * 8 bytes, com memoria_mb de memória.
+    const std::string entrada = (std::filesystem::temp_directory_path() / "mergesort_benchmark_entrada.bin").string();
+    const std::string saida = (std::filesystem::temp_directory_path() / "mergesort_benchmark_saida.bin").string();
+    {
+        std::ofstream arquivo(entrada, std::ios::binary);
+        std::vector<std::uint64_t> bloco(1 << 16);
+        for (std::size_t escritos = 0; escritos < registros_arquivo; escritos += bloco.size()) {
+            const std::size_t k = std::min(bloco.size(), registros_arquivo - escritos);
+            for (std::size_t i = 0; i < k; ++i) bloco[i] = gerador();
+            arquivo.write(reinterpret_cast<const char*>(bloco.data()), static_cast<std::streamsize>(k * sizeof(std::uint64_t)));
+        }
+    }
+    OpcoesOrdenacaoExterna opcoes;
+    opcoes.memoria_bytes = memoria_mb << 20;
+    opcoes.num_threads = threads;
+    const double s = medir_segundos([&] { mergesort_externo<std::uint64_t>(entrada, saida, opcoes); });
+    imprimir_resultado("mergesort_externo " + std::to_string(memoria_mb) + " MB", s, registros_arquivo);
+    std::printf("%-40s %12.1f MB/s\n", "", registros_arquivo * sizeof(std::uint64_t) / s / (1 << 20));
+
+    std::ifstream arquivo(saida, std::ios::binary);
+    std::uint64_t anterior = 0, x;
+    std::size_t lidos = 0;
+    while (arquivo.read(reinterpret_cast<char*>(&x), sizeof(x))) {
+        ok = ok && x >= anterior;
+        anterior = x;
+        ++lidos;
+    }
+    ok = ok && lidos == registros_arquivo;
+    std::filesystem::remove(entrada);
+    std::filesystem::remove(saida);
+
+    if (!ok) {
+        std::printf("ERRO: o resultado não está ordenado ou difere do de std::stable_sort\n");
+        return 1;
+    }
+    return 0;
+}
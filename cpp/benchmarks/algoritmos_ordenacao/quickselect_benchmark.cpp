@@ -0,0 +1,86 @@
+/**
+ * @file quickselect_benchmark.cpp
+ * @brief Compara o quickselect (Floyd-Rivest) com std::nth_element para a mediana e o p99, o
+ * multi_select dos percentis p50/p90/p99/p999 com quatro std::nth_element e com std::sort, e o
+ * quickselect_paralelo com o sequencial, em latências com distribuição exponencial. Também conta
+ * as comparações por elemento.
+ *
+ * Uso: quickselect_benchmark [tamanho] [threads]
+ */
+
+#include "benchmark_util.hpp"
+#include "algoritmos_ordenacao/quickselect.hpp"
+#include <algorithm>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+int main(int argc, char** argv) {
+    const std::size_t n = argumento(argc, argv, 1, 20000000);
+    const unsigned threads = static_cast<unsigned>(argumento(argc, argv, 2, std::max(1u, std::thread::hardware_concurrency())));
+    std::printf("hardware_concurrency = %u\n", std::thread::hardware_concurrency());
+
+    std::mt19937_64 gerador(42);
+    std::exponential_distribution<double> exponencial(0.01);
+    std::vector<double> latencias(n);
+    for (auto& x : latencias) x = exponencial(gerador);
+    const std::vector<std::size_t> percentis = {n / 2, n * 9 / 10, n * 99 / 100, n * 999 / 1000};
+
+    bool ok = true;
+    for (std::size_t k : {n / 2, n * 99 / 100}) {
+        const std::string nome = k == n / 2 ? " (mediana)" : " (p99)";
+        std::vector<double> v = latencias;
+        std::size_t comparacoes = 0;
+        auto contar = [&](double a, double b) {
+            ++comparacoes;
+            return a < b;
+        };
+        imprimir_resultado("std::nth_element" + nome, medir_segundos([&] {
+            std::nth_element(v.begin(), v.begin() + static_cast<std::ptrdiff_t>(k), v.end(), contar);
+        }), n);
+        std::printf("%-40s %12.2f comparações/elemento\n", "", static_cast<double>(comparacoes) / n);
+        const double esperado = v[k];
+
+        v = latencias;
+        comparacoes = 0;
+        double obtido = 0;
+        imprimir_resultado("quickselect" + nome, medir_segundos([&] { obtido = quickselect(v, k, contar); }), n);
+        std::printf("%-40s %12.2f comparações/elemento\n", "", static_cast<double>(comparacoes) / n);
+        ok = ok && obtido == esperado;
+
+        v = latencias;
+        imprimir_resultado("quickselect (std::less)" + nome, medir_segundos([&] { obtido = quickselect(v, k); }), n);
+        ok = ok && obtido == esperado;
+
+        v = latencias;
+        imprimir_resultado("quickselect_paralelo " + std::to_string(threads) + "t" + nome,
+                           medir_segundos([&] { obtido = quickselect_paralelo(v, k, std::less<>(), threads); }), n);
+        ok = ok && obtido == esperado;
+    }
+
+    std::vector<double> v = latencias;
+    std::vector<double> referencia;
+    imprimir_resultado("std::sort + 4 percentis", medir_segundos([&] {
+        std::sort(v.begin(), v.end());
+        for (std::size_t p : percentis) referencia.push_back(v[p]);
+    }), n);
+    v = latencias;
+    std::vector<double> por_nth;
+    imprimir_resultado("4x std::nth_element", medir_segundos([&] {
+        for (std::size_t p : percentis) {
+            std::nth_element(v.begin(), v.begin() + static_cast<std::ptrdiff_t>(p), v.end());
+            por_nth.push_back(v[p]);
+        }
+    }), n);
+    v = latencias;
+    std::vector<double> obtidos;
+    imprimir_resultado("multi_select p50/p90/p99/p999", medir_segundos([&] { obtidos = multi_select(v, percentis); }), n);
+    ok = ok && obtidos == referencia && por_nth == referencia;
+
+    if (!ok) {
+        std::printf("ERRO: o elemento selecionado difere do de std::nth_element\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,89 @@
+/**
+ * @file quicksort_benchmark.cpp
+ * @brief Compara o quicksort (com partição em blocos e com a partição de Hoare, forçada por um
+ * comparador próprio) com std::sort e com o Heapsort, em várias distribuições de int32, double e
+ * strings.
+ *
+ * Uso: quicksort_benchmark [tamanho]
+ */
+
+#include "benchmark_util.hpp"
+#include "algoritmos_ordenacao/heapsort.hpp"
+#include "algoritmos_ordenacao/quicksort.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+// Chaves na ordem da distribuição pedida; os tipos concretos são derivados delas.
+std::vector<std::uint64_t> gerar_chaves(const std::string& distribuicao, std::size_t n, std::mt19937_64& gerador) {
+    std::vector<std::uint64_t> v(n);
+    if (distribuicao == "aleatoria") {
+        for (auto& x : v) x = gerador();
+    } else if (distribuicao == "ordenada") {
+        std::iota(v.begin(), v.end(), 0);
+    } else if (distribuicao == "invertida") {
+        std::iota(v.rbegin(), v.rend(), 0);
+    } else if (distribuicao == "orgao") {
+        for (std::size_t i = 0; i < n; ++i) v[i] = std::min(i, n - 1 - i);
+    } else if (distribuicao == "poucos_distintos") {
+        for (auto& x : v) x = gerador() % 16;
+    } else if (distribuicao == "ordenada_com_ruido") {
+        std::iota(v.begin(), v.end(), 0);
+        for (std::size_t k = 0; k < n / 100; ++k) std::swap(v[gerador() % n], v[gerador() % n]);
+    }
+    return v;
+}
+
+template <typename T>
+T converter(std::uint64_t x) {
+    if constexpr (std::is_same_v<T, std::string>) {
+        return std::to_string(x);
+    } else {
+        return static_cast<T>(x);
+    }
+}
+
+template <typename T>
+bool comparar(const std::string& tipo, const std::string& distribuicao, std::size_t n, std::mt19937_64& gerador) {
+    std::vector<std::uint64_t> chaves = gerar_chaves(distribuicao, n, gerador);
+    std::vector<T> original(n);
+    for (std::size_t i = 0; i < n; ++i) original[i] = converter<T>(chaves[i]);
+
+    std::vector<T> referencia = original;
+    const std::string sufixo = " " + tipo + " " + distribuicao;
+    imprimir_resultado("std::sort" + sufixo, medir_segundos([&] { std::sort(referencia.begin(), referencia.end()); }), n);
+
+    bool ok = true;
+    auto medir = [&](const std::string& nome, auto ordenar) {
+        std::vector<T> v = original;
+        imprimir_resultado(nome + sufixo, medir_segundos([&] { ordenar(v); }), n);
+        ok = ok && v == referencia;
+    };
+    medir("quicksort", [](std::vector<T>& v) { quicksort(v); });
+    if constexpr (std::is_arithmetic_v<T>) {
+        // Um lambda não é std::less, então este caminho usa a partição com desvios.
+        medir("quicksort (Hoare)", [](std::vector<T>& v) { quicksort(v, [](const T& a, const T& b) { return a < b; }); });
+    }
+    medir("heapsort", [](std::vector<T>& v) { heapsort(v); });
+    std::printf("\n");
+    return ok;
+}
+
+int main(int argc, char** argv) {
+    const std::size_t n = argumento(argc, argv, 1, 1000000);
+    std::mt19937_64 gerador(42);
+    bool ok = true;
+    for (std::string distribuicao : {"aleatoria", "ordenada", "invertida", "orgao", "poucos_distintos", "ordenada_com_ruido"}) {
+        ok = comparar<std::int32_t>("int32", distribuicao, n, gerador) && ok;
+        ok = comparar<double>("double", distribuicao, n, gerador) && ok;
+        ok = comparar<std::string>("string", distribuicao, n / 4, gerador) && ok;
+    }
+    if (!ok) {
+        std::printf("ERRO: o resultado difere do de std::sort\n");
+        return 1;
+    }
+    return 0;
+}
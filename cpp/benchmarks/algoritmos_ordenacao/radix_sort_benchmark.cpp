@@ -0,0 +1,84 @@
+/**
+ * @file radix_sort_benchmark.cpp
+ * @brief Compara o radix_sort (dígitos de 8 e 11 bits, sequencial e paralelo) com std::sort
+ * para chaves uint32, int64, float e double uniformes, e para pares chave-valor.
+ *
+ * Os tamanhos vão de 10^6 até o máximo pedido, multiplicando por 10. Com 10^9 elementos de 64
+ * bits são necessários cerca de 24 GB (entrada, cópia de referência e área de trabalho).
+ *
+ * Uso: radix_sort_benchmark [tamanho_maximo] [threads]
+ */
+
+#include "benchmark_util.hpp"
+#include "algoritmos_ordenacao/radix_sort.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+template <typename T>
+std::vector<T> gerar(std::size_t n, std::mt19937_64& gerador) {
+    std::vector<T> v(n);
+    if constexpr (std::is_floating_point_v<T>) {
+        std::uniform_real_distribution<T> uniforme(-1e9, 1e9);
+        for (auto& x : v) x = uniforme(gerador);
+    } else {
+        for (auto& x : v) x = static_cast<T>(gerador());
+    }
+    return v;
+}
+
+template <typename T>
+bool comparar(const std::string& tipo, std::size_t n, unsigned threads, std::mt19937_64& gerador) {
+    const std::vector<T> original = gerar<T>(n, gerador);
+    std::vector<T> referencia = original;
+    bool ok = true;
+    imprimir_resultado("std::sort " + tipo, medir_segundos([&] { std::sort(referencia.begin(), referencia.end()); }), n);
+
+    auto medir = [&](const std::string& nome, auto ordenar) {
+        std::vector<T> v = original;
+        imprimir_resultado(nome + " " + tipo, medir_segundos([&] { ordenar(v); }), n);
+        ok = ok && v == referencia;
+    };
+    medir("radix_sort<8>", [](std::vector<T>& v) { radix_sort<T, 8>(v); });
+    medir("radix_sort<11>", [](std::vector<T>& v) { radix_sort<T, 11>(v); });
+    medir("radix_sort_paralelo " + std::to_string(threads) + "T", [&](std::vector<T>& v) { radix_sort_paralelo(v, threads); });
+    return ok;
+}
+
+int main(int argc, char** argv) {
+    const std::size_t maximo = argumento(argc, argv, 1, 10000000);
+    const unsigned threads = static_cast<unsigned>(argumento(argc, argv, 2, std::max(1u, std::thread::hardware_concurrency())));
+    std::mt19937_64 gerador(42);
+    bool ok = true;
+
+    for (std::size_t n = 1000000; n <= maximo; n *= 10) {
+        std::printf("\nn = %zu (ns/op por elemento):\n", n);
+        ok = comparar<std::uint32_t>("uint32", n, threads, gerador) && ok;
+        ok = comparar<std::int64_t>("int64", n, threads, gerador) && ok;
+        ok = comparar<float>("float", n, threads, gerador) && ok;
+        ok = comparar<double>("double", n, threads, gerador) && ok;
+
+        // Chave uint32 com valor uint32 em vetores separados, contra std::sort de pares.
+        std::vector<std::uint32_t> chaves(n), valores(n);
+        std::vector<std::pair<std::uint32_t, std::uint32_t>> pares(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            chaves[i] = static_cast<std::uint32_t>(gerador());
+            valores[i] = static_cast<std::uint32_t>(i);
+            pares[i] = {chaves[i], valores[i]};
+        }
+        imprimir_resultado("std::sort pares (chave, valor)", medir_segundos([&] {
+            std::sort(pares.begin(), pares.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+        }), n);
+        imprimir_resultado("radix_sort_com_valores", medir_segundos([&] { radix_sort_com_valores(chaves, valores); }), n);
+        for (std::size_t i = 0; i < n; ++i) ok = ok && chaves[i] == pares[i].first;
+    }
+
+    if (!ok) {
+        std::printf("ERRO: o radix_sort divergiu do std::sort\n");
+        return 1;
+    }
+    return 0;
+}
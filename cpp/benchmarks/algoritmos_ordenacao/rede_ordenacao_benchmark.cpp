@@ -0,0 +1,66 @@
+/**
+ * @file rede_ordenacao_benchmark.cpp
+ * @brief Compara, em muitos vetores pequenos (8 a 64 elementos) de int32, int64 e double
+ * aleatórios, a rede de ordenação com AVX2 e com SSE4.2, a inserção sem desvios, a inserção comum
+ * e std::sort. Os tempos são por vetor.
+ *
+ * Uso: rede_ordenacao_benchmark [total de elementos]
+ */
+
+#include "benchmark_util.hpp"
+#include "algoritmos_ordenacao/insertion_sort.hpp"
+#include "algoritmos_ordenacao/rede_ordenacao.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+template <typename T>
+bool comparar(const std::string& tipo, std::size_t n, std::size_t total, std::mt19937_64& gerador) {
+    const std::size_t vetores = total / n;
+    std::vector<T> original(vetores * n);
+    for (auto& x : original) x = static_cast<T>(static_cast<std::int64_t>(gerador()) >> 16);
+
+    std::vector<T> referencia = original;
+    const std::string sufixo = " " + tipo + " n=" + std::to_string(n);
+    imprimir_resultado("std::sort" + sufixo, medir_segundos([&] {
+        for (std::size_t i = 0; i < vetores; ++i) std::sort(referencia.begin() + i * n, referencia.begin() + (i + 1) * n);
+    }), vetores);
+
+    bool ok = true;
+    auto medir = [&](const std::string& nome, auto ordenar) {
+        std::vector<T> v = original;
+        imprimir_resultado(nome + sufixo, medir_segundos([&] {
+            for (std::size_t i = 0; i < vetores; ++i) ordenar(v.data() + i * n);
+        }), vetores);
+        ok = ok && v == referencia;
+    };
+    medir("insertion_sort", [n](T* p) { insertion_sort(p, p + n); });
+    medir("insertion_sort_sem_desvios", [n](T* p) { insertion_sort_sem_desvios(p, p + n); });
+    const ConjuntoInstrucoes disponivel = conjunto_instrucoes_disponivel();
+    if (disponivel != ConjuntoInstrucoes::Escalar) {
+        medir("ordenar_rede (SSE4.2)", [n](T* p) { ordenar_rede(p, n, ConjuntoInstrucoes::Sse42); });
+    }
+    if (disponivel == ConjuntoInstrucoes::Avx2) {
+        medir("ordenar_rede (AVX2)", [n](T* p) { ordenar_rede(p, n, ConjuntoInstrucoes::Avx2); });
+    }
+    std::printf("\n");
+    return ok;
+}
+
+int main(int argc, char** argv) {
+    const std::size_t total = argumento(argc, argv, 1, 1 << 22);
+    std::mt19937_64 gerador(42);
+    bool ok = true;
+    for (std::size_t n : {8, 12, 16, 24, 32, 48, 64}) {
+        ok = comparar<std::int32_t>("int32", n, total, gerador) && ok;
+        ok = comparar<std::int64_t>("int64", n, total, gerador) && ok;
+        ok = comparar<double>("double", n, total, gerador) && ok;
+    }
+    if (!ok) {
+        std::printf("ERRO: o resultado difere do de std::sort\n");
+        return 1;
+    }
+    return 0;
+}
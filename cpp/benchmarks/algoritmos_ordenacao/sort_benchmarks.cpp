@@ -0,0 +1,356 @@
+/**
+ * @file sort_benchmarks.cpp
+ * @brief Roda todos os algoritmos de algoritmos_ordenacao/ (mais std::sort e std::stable_sort
+ * como referência) sobre tamanhos de 10 até o máximo pedido, em potências de 10, nas distribuições
+ * uniforme, ordenada, invertida, órgão (sobe e desce), poucos distintos, Zipf e ordenada com ruído,
+ * para int32, int64, double, strings e registros de 16 bytes.
+ *
+ * Para cada combinação, imprime elementos por segundo e, para os algoritmos por comparação,
+ * comparações e movimentos por elemento, e confere que a saída está ordenada e é uma permutação
+ * da entrada. Com um arquivo de saída, grava também todas as medições em JSON, para acompanhar
+ * regressões entre versões. Termina com código 1 se alguma saída estiver errada.
+ *
+ * Tamanhos pequenos são ordenados em muitas cópias seguidas, para que o tempo medido não seja
+ * dominado pela resolução do relógio. As contagens usam um tipo instrumentado, com comparação
+ * por `operator<`: algoritmos que escolhem o caminho pelo tipo (partição em blocos do quicksort,
+ * redes de ordenação) são contados no caminho genérico.
+ *
+ * O `mergesort_externo` ordena um arquivo temporário com a entrada e lê o resultado de volta, de
+ * modo que o tempo inclui a E/S; roda só a partir de EXTERNO_TAMANHO_MINIMO elementos e sem
+ * contagens.
+ *
+ * Uso: sort_benchmarks [tamanho máximo] [arquivo JSON] [filtro de algoritmo]
+ */
+
+#include "benchmark_util.hpp"
+#include "algoritmos_ordenacao/bucket_sort.hpp"
+#include "algoritmos_ordenacao/counting_sort.hpp"
+#include "algoritmos_ordenacao/heapsort.hpp"
+#include "algoritmos_ordenacao/insertion_sort.hpp"
+#include "algoritmos_ordenacao/mergesort.hpp"
+#include "algoritmos_ordenacao/quicksort.hpp"
+#include "algoritmos_ordenacao/radix_sort.hpp"
+#include "algoritmos_ordenacao/rede_ordenacao.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Número aproximado de elementos ordenados por medição nos tamanhos pequenos (em várias cópias).
+constexpr std::size_t ELEMENTOS_POR_MEDICAO = std::size_t(1) << 18;
+// Acima deste tamanho, as contagens de comparações e movimentos não são feitas.
+constexpr std::size_t CONTAGEM_TAMANHO_MAXIMO = 1000000;
+// Acima deste tamanho, os algoritmos quadráticos não rodam.
+constexpr std::size_t QUADRATICO_TAMANHO_MAXIMO = 10000;
+// A inserção sem desvios faz n(n-1)/2 comparações mesmo em entradas ordenadas e é feita para
+// vetores pequenos; passa deste tamanho só para mostrar a curva quadrática.
+constexpr std::size_t SEM_DESVIOS_TAMANHO_MAXIMO = 1000;
+// Abaixo deste tamanho, o mergesort externo não roda: cada cópia custa a criação de arquivos, e as
+// milhares de cópias dos tamanhos pequenos mediriam só isso.
+constexpr std::size_t EXTERNO_TAMANHO_MINIMO = 10000;
+// Universo de valores da distribuição de Zipf (a construção do gerador é linear nele).
+constexpr std::uint64_t ZIPF_UNIVERSO_MAXIMO = std::uint64_t(1) << 20;
+
+// Registro de 16 bytes ordenado pela chave; a carga é a posição original.
+struct Registro16 {
+    std::uint64_t chave;
+    std::uint64_t carga;
+
+    friend bool operator<(const Registro16& a, const Registro16& b) { return a.chave < b.chave; }
+};
+
+std::atomic<std::size_t> comparacoes{0}, movimentos{0};
+
+// Envolve um valor e conta comparações e movimentos (cópias e moves, na construção e na atribuição).
+template <typename T>
+struct Instrumentado {
+    T valor{};
+
+    Instrumentado() = default;
+    explicit Instrumentado(const T& valor) : valor(valor) {}
+    Instrumentado(const Instrumentado& outro) : valor(outro.valor) { movimentos.fetch_add(1, std::memory_order_relaxed); }
+    Instrumentado(Instrumentado&& outro) noexcept : valor(std::move(outro.valor)) { movimentos.fetch_add(1, std::memory_order_relaxed); }
+    Instrumentado& operator=(const Instrumentado& outro) {
+        valor = outro.valor;
+        movimentos.fetch_add(1, std::memory_order_relaxed);
+        return *this;
+    }
+    Instrumentado& operator=(Instrumentado&& outro) noexcept {
+        valor = std::move(outro.valor);
+        movimentos.fetch_add(1, std::memory_order_relaxed);
+        return *this;
+    }
+    friend bool operator<(const Instrumentado& a, const Instrumentado& b) {
+        comparacoes.fetch_add(1, std::memory_order_relaxed);
+        return a.valor < b.valor;
+    }
+};
+
+template <typename T>
+struct Algoritmo {
+    std::string nome;
+    std::function<void(std::vector<T>&)> ordenar;
+    // Mesma ordenação sobre o tipo instrumentado; vazia quando o algoritmo não compara elementos.
+    std::function<void(std::vector<Instrumentado<T>>&)> contar;
+    std::size_t tamanho_maximo = static_cast<std::size_t>(-1);
+    std::size_t tamanho_minimo = 0;
+};
+
+// Os algoritmos por comparação, aplicáveis a qualquer tipo com operator<.
+template <typename E>
+void adicionar_por_comparacao(std::vector<std::pair<std::string, std::function<void(std::vector<E>&)>>>& lista) {
+    lista.emplace_back("std::sort", [](std::vector<E>& v) { std::sort(v.begin(), v.end()); });
+    lista.emplace_back("std::stable_sort", [](std::vector<E>& v) { std::stable_sort(v.begin(), v.end()); });
+    lista.emplace_back("quicksort", [](std::vector<E>& v) { quicksort(v); });
+    lista.emplace_back("quicksort_em_blocos", [](std::vector<E>& v) { quicksort_em_blocos(v.begin(), v.end()); });
+    lista.emplace_back("mergesort", [](std::vector<E>& v) { mergesort(v); });
+    lista.emplace_back("mergesort_paralelo", [](std::vector<E>& v) { mergesort_paralelo(v); });
+    lista.emplace_back("heapsort", [](std::vector<E>& v) { heapsort(v); });
+    lista.emplace_back("insertion_sort", [](std::vector<E>& v) { insertion_sort(v); });
+    lista.emplace_back("insertion_sort_sem_desvios", [](std::vector<E>& v) { insertion_sort_sem_desvios(v.begin(), v.end()); });
+}
+
+// Grava `v` no formato de mergesort_externo (linhas para strings, registros binários para os
+// demais tipos), ordena o arquivo e lê o resultado de volta. O tempo inclui toda a E/S.
+template <typename T>
+void ordenar_em_arquivo(std::vector<T>& v) {
+    namespace fs = std::filesystem;
+    const std::string caminho = (fs::temp_directory_path() / "sort_benchmarks_externo.dat").string();
+    {
+        std::ofstream arquivo(caminho, std::ios::binary | std::ios::trunc);
+        if constexpr (std::is_same_v<T, std::string>) {
+            for (const std::string& linha : v) arquivo << linha << '\n';
+        } else {
+            arquivo.write(reinterpret_cast<const char*>(v.data()), static_cast<std::streamsize>(v.size() * sizeof(T)));
+        }
+        if (!arquivo) throw std::runtime_error("Não foi possível gravar " + caminho);
+    }
+    // Um quarto dos dados por sequência inicial (com o mínimo de 1 MiB), para que os tamanhos
+    // grandes passem pela intercalação de várias sequências.
+    OpcoesOrdenacaoExterna opcoes;
+    opcoes.memoria_bytes = std::max<std::size_t>(std::size_t(1) << 20, v.size() * sizeof(T) / 4);
+    mergesort_externo<T>(caminho, caminho, opcoes);
+    {
+        std::ifstream arquivo(caminho, std::ios::binary);
+        if constexpr (std::is_same_v<T, std::string>) {
+            for (std::string& linha : v) std::getline(arquivo, linha);
+        } else {
+            arquivo.read(reinterpret_cast<char*>(v.data()), static_cast<std::streamsize>(v.size() * sizeof(T)));
+        }
+        if (!arquivo) throw std::runtime_error("Não foi possível ler " + caminho);
+    }
+    fs::remove(caminho);
+}
+
+template <typename T>
+std::vector<Algoritmo<T>> algoritmos() {
+    std::vector<std::pair<std::string, std::function<void(std::vector<T>&)>>> simples;
+    std::vector<std::pair<std::string, std::function<void(std::vector<Instrumentado<T>>&)>>> instrumentados;
+    adicionar_por_comparacao(simples);
+    adicionar_por_comparacao(instrumentados);
+    std::vector<Algoritmo<T>> lista;
+    for (std::size_t i = 0; i < simples.size(); ++i) {
+        lista.push_back({simples[i].first, simples[i].second, instrumentados[i].second});
+        if (simples[i].first == "insertion_sort") lista.back().tamanho_maximo = QUADRATICO_TAMANHO_MAXIMO;
+        if (simples[i].first == "insertion_sort_sem_desvios") lista.back().tamanho_maximo = SEM_DESVIOS_TAMANHO_MAXIMO;
+    }
+    // Sem contagem: o tipo instrumentado não é trivialmente copiável, então não vai para arquivo.
+    lista.push_back({"mergesort_externo", [](std::vector<T>& v) { ordenar_em_arquivo(v); }, {}});
+    lista.back().tamanho_minimo = EXTERNO_TAMANHO_MINIMO;
+
+    if constexpr (rede_suporta_v<T>) {
+        lista.push_back({"rede_ordenacao", [](std::vector<T>& v) { ordenar_rede(v.data(), v.size()); }, {}, REDE_ORDENACAO_MAXIMO});
+    }
+    if constexpr (std::is_arithmetic_v<T>) {
+        lista.push_back({"radix_sort", [](std::vector<T>& v) { radix_sort(v); }, {}});
+        lista.push_back({"radix_sort_paralelo", [](std::vector<T>& v) { radix_sort_paralelo(v); }, {}});
+    }
+    if constexpr (std::is_integral_v<T>) {
+        lista.push_back({"counting_sort", [](std::vector<T>& v) { counting_sort(v); }, {}});
+        lista.push_back({"counting_sort_paralelo", [](std::vector<T>& v) { counting_sort_paralelo(v); }, {}});
+    }
+    if constexpr (std::is_floating_point_v<T>) {
+        lista.push_back({"bucket_sort", [](std::vector<T>& v) { bucket_sort(v); }, {}});
+        lista.push_back({"bucket_sort_paralelo", [](std::vector<T>& v) { bucket_sort_paralelo(v); }, {}});
+    }
+    if constexpr (std::is_same_v<T, Registro16>) {
+        auto chave = [](const Registro16& r) { return r.chave; };
+        lista.push_back({"radix_sort_por_chave", [=](std::vector<T>& v) { radix_sort_por_chave(v, chave); }, {}});
+        lista.push_back({"radix_sort_paralelo_por_chave", [=](std::vector<T>& v) { radix_sort_paralelo_por_chave(v, chave); }, {}});
+        lista.push_back({"counting_sort_por_chave", [=](std::vector<T>& v) { counting_sort_por_chave(v, chave); }, {}});
+        lista.push_back({"counting_sort_paralelo_por_chave", [=](std::vector<T>& v) { counting_sort_paralelo_por_chave(v, chave); }, {}});
+    }
+    return lista;
+}
+
+// Chaves na ordem da distribuição pedida; os tipos concretos são derivados delas.
+std::vector<std::uint64_t> gerar_chaves(const std::string& distribuicao, std::size_t n, std::mt19937_64& gerador) {
+    std::vector<std::uint64_t> v(n);
+    if (distribuicao == "uniforme") {
+        for (auto& x : v) x = gerador();
+    } else if (distribuicao == "ordenada") {
+        std::iota(v.begin(), v.end(), 0);
+    } else if (distribuicao == "invertida") {
+        std::iota(v.rbegin(), v.rend(), 0);
+    } else if (distribuicao == "orgao") {
+        for (std::size_t i = 0; i < n; ++i) v[i] = std::min(i, n - 1 - i);
+    } else if (distribuicao == "poucos_distintos") {
+        for (auto& x : v) x = gerador() % 16;
+    } else if (distribuicao == "zipf") {
+        GeradorZipf zipf(std::min<std::uint64_t>(n, ZIPF_UNIVERSO_MAXIMO), 0.99);
+        for (auto& x : v) x = zipf(gerador);
+    } else if (distribuicao == "ordenada_com_ruido") {
+        std::iota(v.begin(), v.end(), 0);
+        for (std::size_t k = 0; k < n / 100 + 1; ++k) std::swap(v[gerador() % n], v[gerador() % n]);
+    }
+    return v;
+}
+
+template <typename T>
+T converter(std::uint64_t x, std::size_t posicao) {
+    if constexpr (std::is_same_v<T, std::string>) {
+        // Com zeros à esquerda, a ordem das strings é a ordem numérica das chaves.
+        char texto[21];
+        std::snprintf(texto, sizeof(texto), "%020llu", static_cast<unsigned long long>(x));
+        return texto;
+    } else if constexpr (std::is_same_v<T, Registro16>) {
+        return {x, posicao};
+    } else {
+        return static_cast<T>(x);
+    }
+}
+
+// Soma, independente da ordem, de um hash misturado de cada elemento: perder, duplicar ou
+// corromper um elemento muda a assinatura.
+template <typename T>
+std::uint64_t assinatura(const std::vector<T>& v) {
+    std::uint64_t soma = 0;
+    for (const T& x : v) {
+        std::uint64_t h;
+        if constexpr (std::is_same_v<T, Registro16>) {
+            h = x.chave * 0x9e3779b97f4a7c15ULL ^ x.carga;
+        } else {
+            h = std::hash<T>{}(x);
+        }
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        soma += h;
+    }
+    return soma;
+}
+
+struct Medicao {
+    std::string algoritmo, tipo, distribuicao;
+    std::size_t n;
+    double segundos, elementos_por_segundo;
+    double comparacoes_por_elemento = -1, movimentos_por_elemento = -1; // -1: não contado.
+};
+
+template <typename T>
+bool medir_tipo(const std::string& tipo, std::size_t tamanho_maximo, const std::string& filtro, std::vector<Medicao>& medicoes) {
+    bool ok = true;
+    std::mt19937_64 gerador(42);
+    for (std::string distribuicao : {"uniforme", "ordenada", "invertida", "orgao", "poucos_distintos", "zipf", "ordenada_com_ruido"}) {
+        for (std::size_t n = 10; n <= tamanho_maximo; n *= 10) {
+            const std::vector<std::uint64_t> chaves = gerar_chaves(distribuicao, n, gerador);
+            std::vector<T> original(n);
+            for (std::size_t i = 0; i < n; ++i) original[i] = converter<T>(chaves[i], i);
+            const std::uint64_t esperada = assinatura(original);
+            const std::size_t copias = std::max<std::size_t>(1, ELEMENTOS_POR_MEDICAO / n);
+
+            for (const Algoritmo<T>& algoritmo : algoritmos<T>()) {
+                if (n > algoritmo.tamanho_maximo || n < algoritmo.tamanho_minimo || algoritmo.nome.find(filtro) == std::string::npos) continue;
+                std::vector<std::vector<T>> v(copias, original);
+                double segundos;
+                try {
+                    segundos = medir_segundos([&] {
+                        for (auto& copia : v) algoritmo.ordenar(copia);
+                    });
+                } catch (const std::invalid_argument&) {
+                    continue; // Por exemplo, faixa de chaves grande demais para o counting sort.
+                }
+                for (const auto& copia : v) {
+                    if (!std::is_sorted(copia.begin(), copia.end()) || assinatura(copia) != esperada) {
+                        std::printf("ERRO: %s %s %s n = %zu: saída errada\n", algoritmo.nome.c_str(), tipo.c_str(),
+                                    distribuicao.c_str(), n);
+                        ok = false;
+                        break;
+                    }
+                }
+
+                const double total = static_cast<double>(n * copias);
+                Medicao medicao{algoritmo.nome, tipo, distribuicao, n, segundos / copias, total / segundos};
+                if (algoritmo.contar && n <= CONTAGEM_TAMANHO_MAXIMO) {
+                    // As cópias são iguais, então basta contar uma.
+                    std::vector<Instrumentado<T>> w;
+                    w.reserve(n);
+                    for (const T& x : original) w.emplace_back(x);
+                    comparacoes = 0;
+                    movimentos = 0;
+                    algoritmo.contar(w);
+                    medicao.comparacoes_por_elemento = static_cast<double>(comparacoes.load()) / n;
+                    medicao.movimentos_por_elemento = static_cast<double>(movimentos.load()) / n;
+                }
+
+                std::printf("%-34s %-8s %-20s %11zu %10.2f Melem/s", medicao.algoritmo.c_str(), tipo.c_str(), distribuicao.c_str(), n,
+                            medicao.elementos_por_segundo / 1e6);
+                if (medicao.comparacoes_por_elemento >= 0) {
+                    std::printf(" %8.2f comp/elem %8.2f mov/elem", medicao.comparacoes_por_elemento, medicao.movimentos_por_elemento);
+                }
+                std::printf("\n");
+                medicoes.push_back(medicao);
+            }
+        }
+    }
+    return ok;
+}
+
+void gravar_json(const std::string& caminho, const std::vector<Medicao>& medicoes) {
+    std::FILE* arquivo = std::fopen(caminho.c_str(), "w");
+    if (!arquivo) throw std::runtime_error("Não foi possível abrir " + caminho);
+    std::fprintf(arquivo, "[\n");
+    for (std::size_t i = 0; i < medicoes.size(); ++i) {
+        const Medicao& m = medicoes[i];
+        std::fprintf(arquivo,
+                     "  {\"algoritmo\": \"%s\", \"tipo\": \"%s\", \"distribuicao\": \"%s\", \"n\": %zu, \"segundos\": %.9g, "
+                     "\"elementos_por_segundo\": %.6g",
+                     m.algoritmo.c_str(), m.tipo.c_str(), m.distribuicao.c_str(), m.n, m.segundos, m.elementos_por_segundo);
+        if (m.comparacoes_por_elemento >= 0) {
+            std::fprintf(arquivo, ", \"comparacoes_por_elemento\": %.4f, \"movimentos_por_elemento\": %.4f", m.comparacoes_por_elemento,
+                         m.movimentos_por_elemento);
+        } else {
+            std::fprintf(arquivo, ", \"comparacoes_por_elemento\": null, \"movimentos_por_elemento\": null");
+        }
+        std::fprintf(arquivo, "}%s\n", i + 1 < medicoes.size() ? "," : "");
+    }
+    std::fprintf(arquivo, "]\n");
+    std::fclose(arquivo);
+}
+
+int main(int argc, char** argv) {
+    const std::size_t tamanho_maximo = argumento(argc, argv, 1, 1000000);
+    const std::string json = argc > 2 ? argv[2] : "";
+    const std::string filtro = argc > 3 ? argv[3] : "";
+    std::vector<Medicao> medicoes;
+    bool ok = true;
+    ok = medir_tipo<std::int32_t>("int32", tamanho_maximo, filtro, medicoes) && ok;
+    ok = medir_tipo<std::int64_t>("int64", tamanho_maximo, filtro, medicoes) && ok;
+    ok = medir_tipo<double>("double", tamanho_maximo, filtro, medicoes) && ok;
+    ok = medir_tipo<std::string>("string", tamanho_maximo, filtro, medicoes) && ok;
+    ok = medir_tipo<Registro16>("reg16", tamanho_maximo, filtro, medicoes) && ok;
+    if (!json.empty()) gravar_json(json, medicoes);
+
+    if (!ok) {
+        std::printf("ERRO: alguma saída não está ordenada\n");
+        return 1;
+    }
+    return 0;
+}
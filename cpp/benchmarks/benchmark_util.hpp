@@ -0,0 +1,102 @@
+#ifndef BENCHMARK_UTIL_HPP
+#define BENCHMARK_UTIL_HPP
+
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+
+/**
+ * @file benchmark_util.hpp
+ * @brief Utilitários compartilhados pelos executáveis da pasta benchmarks/.
+ *
+ * Cada arquivo .cpp em benchmarks/ gera um executável próprio (veja o CMakeLists.txt).
+ * Os números só fazem sentido em builds otimizados, por exemplo:
+ * `cmake -S . -B build -DCMAKE_BUILD_TYPE=Release`.
+ */
+
+/**
+ * @brief Executa `f` uma vez e retorna o tempo de parede em segundos.
+ */
+template <typename F>
+double medir_segundos(F&& f) {
+    auto inicio = std::chrono::steady_clock::now();
+    f();
+    auto fim = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(fim - inicio).count();
+}
+
+/**
+ * @brief Impede que o compilador descarte o cálculo que produziu `valor`.
+ *
+ * Uma barreira vazia em assembly que "lê" o endereço de `valor` e toda a memória, como o
+ * `benchmark::DoNotOptimize` do Google Benchmark; não guarda o endereço em lugar nenhum.
+ */
+template <typename T>
+void nao_otimizar(const T& valor) {
+#if defined(__GNUC__)
+    asm volatile("" : : "g"(&valor) : "memory");
+#else
+    static volatile unsigned char sumidouro;
+    sumidouro = *reinterpret_cast<const volatile unsigned char*>(&valor);
+#endif
+}
+
+/**
+ * @brief Lê o i-ésimo argumento da linha de comando como inteiro, ou retorna `padrao`.
+ */
+inline std::size_t argumento(int argc, char** argv, int i, std::size_t padrao) {
+    return (i < argc) ? static_cast<std::size_t>(std::strtoull(argv[i], nullptr, 10)) : padrao;
+}
+
+/**
+ * @brief Imprime uma linha no formato "nome | ns/op | ops".
+ */
+inline void imprimir_resultado(const std::string& nome, double segundos, std::size_t operacoes) {
+    std::printf("%-40s %12.1f ns/op %12zu ops\n", nome.c_str(), segundos * 1e9 / operacoes, operacoes);
+}
+
+/**
+ * @class GeradorZipf
+ * @brief Sorteia inteiros em [0, n) com distribuição de Zipf: o valor de posto r sai com
+ * probabilidade proporcional a 1 / (r + 1)^theta.
+ *
+ * Usa o método de Gray et al. ("Quickly Generating Billion-Record Synthetic Databases"), o mesmo
+ * do YCSB: O(n) na construção e O(1) por sorteio. O valor 0 é o mais frequente.
+ */
+class GeradorZipf {
+public:
+    explicit GeradorZipf(std::uint64_t n, double theta = 0.99) : n(n), theta(theta) {
+        zeta_n = zeta(n);
+        alfa = 1.0 / (1.0 - theta);
+        eta = (1.0 - std::pow(2.0 / n, 1.0 - theta)) / (1.0 - zeta(2) / zeta_n);
+        limite_1 = 1.0 + std::pow(0.5, theta);
+    }
+
+    template <typename Gerador>
+    std::uint64_t operator()(Gerador& gerador) {
+        double u = uniforme(gerador);
+        double uz = u * zeta_n;
+        if (uz < 1.0) return 0;
+        if (uz < limite_1) return 1;
+        auto r = static_cast<std::uint64_t>(n * std::pow(eta * u - eta + 1.0, alfa));
+        return r < n ? r : n - 1;
+    }
+
+private:
+    std::uint64_t n;
+    double theta, zeta_n, alfa, eta, limite_1;
+    std::uniform_real_distribution<double> uniforme{0.0, 1.0};
+
+    double zeta(std::uint64_t m) const {
+        double soma = 0;
+        for (std::uint64_t i = 1; i <= m; ++i) soma += 1.0 / std::pow(static_cast<double>(i), theta);
+        return soma;
+    }
+};
+
+#endif // BENCHMARK_UTIL_HPP
\ No newline at end of file
@@ -0,0 +1,77 @@
+/**
+ * @file b_tree_benchmark.cpp
+ * @brief Compara BPlusTree e ArvoreAVL em inserção, busca pontual e varredura de intervalo.
+ *
+ * Uso: b_tree_benchmark [n] [operacoes]
+ */
+
+#include "benchmark_util.hpp"
+#include "estruturas_dados/b_tree.hpp"
+#include "estruturas_dados/arvore_avl.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+int main(int argc, char** argv) {
+    const std::size_t n = argumento(argc, argv, 1, 1000000);
+    const std::size_t operacoes = argumento(argc, argv, 2, 2000000);
+    const std::int64_t largura_intervalo = 1000;
+
+    std::mt19937_64 gerador(42);
+    std::vector<std::int64_t> chaves(n);
+    for (auto& x : chaves) x = static_cast<std::int64_t>(gerador() % (4 * n));
+    std::vector<std::int64_t> consultas(operacoes);
+    for (auto& x : consultas) x = static_cast<std::int64_t>(gerador() % (4 * n));
+
+    std::printf("n = %zu\n", n);
+
+    ArvoreAVL<std::int64_t> avl;
+    BPlusTree<std::int64_t, std::int64_t> bpt;
+    imprimir_resultado("ArvoreAVL: inserir", medir_segundos([&] {
+        for (auto x : chaves) avl.inserir(x);
+    }), n);
+    imprimir_resultado("BPlusTree: inserir", medir_segundos([&] {
+        for (auto x : chaves) bpt.inserir(x, x);
+    }), n);
+
+    std::vector<std::pair<std::int64_t, std::int64_t>> ordenados;
+    for (auto it = avl.begin(); it != avl.end(); ++it) ordenados.push_back({*it, *it});
+    BPlusTree<std::int64_t, std::int64_t> carregada;
+    imprimir_resultado("BPlusTree: carregar_ordenado", medir_segundos([&] {
+        carregada = BPlusTree<std::int64_t, std::int64_t>::carregar_ordenado(ordenados);
+    }), ordenados.size());
+
+    std::size_t achados_avl = 0, achados_bpt = 0, achados_carregada = 0;
+    imprimir_resultado("ArvoreAVL: buscar", medir_segundos([&] {
+        for (auto x : consultas) achados_avl += avl.buscar(x);
+    }), operacoes);
+    imprimir_resultado("BPlusTree: contem", medir_segundos([&] {
+        for (auto x : consultas) achados_bpt += bpt.contem(x);
+    }), operacoes);
+    imprimir_resultado("BPlusTree (carga em lote): contem", medir_segundos([&] {
+        for (auto x : consultas) achados_carregada += carregada.contem(x);
+    }), operacoes);
+
+    // Varreduras: soma as chaves em [x, x + largura_intervalo].
+    const std::size_t varreduras = std::max<std::size_t>(1, operacoes / 100);
+    std::int64_t soma_avl = 0, soma_bpt = 0;
+    imprimir_resultado("ArvoreAVL: varredura de intervalo", medir_segundos([&] {
+        for (std::size_t i = 0; i < varreduras; ++i) {
+            std::int64_t fim = consultas[i] + largura_intervalo;
+            for (auto it = avl.lower_bound(consultas[i]); it != avl.end() && *it <= fim; ++it) soma_avl += *it;
+        }
+    }), varreduras);
+    imprimir_resultado("BPlusTree: varredura de intervalo", medir_segundos([&] {
+        for (std::size_t i = 0; i < varreduras; ++i) {
+            bpt.percorrer_intervalo(consultas[i], consultas[i] + largura_intervalo,
+                                    [&](std::int64_t chave, std::int64_t) { soma_bpt += chave; });
+        }
+    }), varreduras);
+
+    if (achados_avl != achados_bpt || achados_avl != achados_carregada || soma_avl != soma_bpt) {
+        std::printf("ERRO: as estruturas divergiram\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,115 @@
+/**
+ * @file b_tree_disco_benchmark.cpp
+ * @brief Mede a BTreeEmDisco em inserção, busca pontual e varredura de intervalo, com o cache de
+ * páginas do sistema frio (arquivo recém-descartado do cache) e quente.
+ *
+ * O cache frio é obtido com posix_fadvise(POSIX_FADV_DONTNEED) depois de fechar o índice; em
+ * alguns sistemas de arquivos isso é apenas uma sugestão, então os números frios são um limite
+ * otimista.
+ *
+ * Uso: b_tree_disco_benchmark [n] [consultas] [arquivo]
+ */
+
+#include "benchmark_util.hpp"
+#include "estruturas_dados/b_tree.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+
+static void descartar_cache_do_arquivo(const std::string& caminho) {
+    int descritor = open(caminho.c_str(), O_RDONLY);
+    if (descritor < 0) return;
+#ifdef POSIX_FADV_DONTNEED
+    posix_fadvise(descritor, 0, 0, POSIX_FADV_DONTNEED);
+#endif
+    close(descritor);
+}
+
+int main(int argc, char** argv) {
+    const std::size_t n = argumento(argc, argv, 1, 2000000);
+    const std::size_t consultas = argumento(argc, argv, 2, 200000);
+    const std::string caminho = (argc > 3) ? argv[3] : "b_tree_disco_benchmark.db";
+    const std::size_t confirmar_a_cada = 100000;
+
+    std::mt19937_64 gerador(42);
+    std::vector<std::int64_t> chaves(n);
+    for (auto& x : chaves) x = static_cast<std::int64_t>(gerador() % (4 * n));
+    std::vector<std::int64_t> alvos(consultas);
+    for (auto& x : alvos) x = static_cast<std::int64_t>(gerador() % (4 * n));
+
+    unlink(caminho.c_str());
+    std::printf("n = %zu, arquivo = %s\n", n, caminho.c_str());
+    {
+        BTreeEmDisco arvore(caminho);
+        imprimir_resultado("inserir (confirmando a cada 1e5)", medir_segundos([&] {
+            for (std::size_t i = 0; i < n; ++i) {
+                arvore.inserir(chaves[i], static_cast<std::int64_t>(i));
+                if ((i + 1) % confirmar_a_cada == 0) arvore.confirmar();
+            }
+            arvore.confirmar();
+        }), n);
+        std::printf("altura = %d, paginas = %llu\n", arvore.altura(),
+                    static_cast<unsigned long long>(arvore.paginas_usadas()));
+    }
+
+    std::size_t achados[3] = {0, 0, 0};
+    descartar_cache_do_arquivo(caminho);
+    {
+        BTreeEmDisco arvore(caminho);
+        std::int64_t valor = 0;
+        imprimir_resultado("buscar (cache frio)", medir_segundos([&] {
+            for (auto x : alvos) achados[0] += arvore.buscar(x, valor);
+        }), consultas);
+        imprimir_resultado("buscar (cache quente)", medir_segundos([&] {
+            for (auto x : alvos) achados[1] += arvore.buscar(x, valor);
+        }), consultas);
+    }
+
+    descartar_cache_do_arquivo(caminho);
+    {
+        BTreeEmDisco arvore(caminho);
+        std::size_t fixadas = 0;
+        double segundos = medir_segundos([&] { fixadas = arvore.fixar_paginas_quentes(arvore.altura() - 1); });
+        std::printf("%zu paginas internas fixadas em %.1f ms\n", fixadas, segundos * 1e3);
+        std::int64_t valor = 0;
+        imprimir_resultado("buscar (frio, internas fixadas)", medir_segundos([&] {
+            for (auto x : alvos) achados[2] += arvore.buscar(x, valor);
+        }), consultas);
+    }
+
+    const std::size_t varreduras = std::max<std::size_t>(1, consultas / 100);
+    const std::int64_t largura = 4000; // Cerca de 1000 chaves por varredura
+    std::int64_t somas[2] = {0, 0};
+    descartar_cache_do_arquivo(caminho);
+    {
+        BTreeEmDisco arvore(caminho);
+        for (int passada = 0; passada < 2; ++passada) {
+            imprimir_resultado(passada == 0 ? "varredura de intervalo (frio)" : "varredura de intervalo (quente)",
+                               medir_segundos([&] {
+                for (std::size_t i = 0; i < varreduras; ++i) {
+                    arvore.percorrer_intervalo(alvos[i], alvos[i] + largura,
+                                               [&](std::int64_t chave, std::int64_t) { somas[passada] += chave; });
+                }
+            }), varreduras);
+        }
+    }
+    unlink(caminho.c_str());
+
+    if (achados[0] != achados[1] || achados[0] != achados[2] || somas[0] != somas[1]) {
+        std::printf("ERRO: as passadas divergiram\n");
+        return 1;
+    }
+    return 0;
+}
+#else
+int main() {
+    std::printf("b_tree_disco_benchmark requer mmap (POSIX).\n");
+    return 0;
+}
+#endif
@@ -0,0 +1,60 @@
+/**
+ * @file fenwick_tree_benchmark.cpp
+ * @brief Compara FenwickTree e SegmentTreeMonoide<MonoideSoma> em construção, atualização
+ * pontual e soma de intervalo.
+ *
+ * Uso: fenwick_tree_benchmark [n] [operacoes]
+ */
+
+#include "benchmark_util.hpp"
+#include "estruturas_dados/fenwick_tree.hpp"
+#include "estruturas_dados/segment_tree.hpp"
+#include <random>
+#include <vector>
+
+int main(int argc, char** argv) {
+    const std::size_t n = argumento(argc, argv, 1, 1000000);
+    const std::size_t operacoes = argumento(argc, argv, 2, 5000000);
+
+    std::mt19937 gerador(42);
+    std::vector<long long> arr(n);
+    for (auto& x : arr) x = gerador() % 1000;
+    std::vector<int> indices(operacoes), fins(operacoes);
+    for (std::size_t i = 0; i < operacoes; ++i) {
+        int a = gerador() % n, b = gerador() % n;
+        indices[i] = std::min(a, b);
+        fins[i] = std::max(a, b);
+    }
+
+    std::printf("n = %zu\n", n);
+
+    FenwickTree<long long>* ft = nullptr;
+    SegmentTreeMonoide<MonoideSoma<long long>>* st = nullptr;
+    imprimir_resultado("FenwickTree: construcao", medir_segundos([&] { ft = new FenwickTree<long long>(arr); }), n);
+    imprimir_resultado("SegmentTreeMonoide: construcao", medir_segundos([&] {
+        st = new SegmentTreeMonoide<MonoideSoma<long long>>(arr);
+    }), n);
+
+    imprimir_resultado("FenwickTree: add", medir_segundos([&] {
+        for (std::size_t i = 0; i < operacoes; ++i) ft->add(indices[i], 1);
+    }), operacoes);
+    imprimir_resultado("SegmentTreeMonoide: update", medir_segundos([&] {
+        for (std::size_t i = 0; i < operacoes; ++i) st->update(indices[i], st->get(indices[i]) + 1);
+    }), operacoes);
+
+    long long soma = 0;
+    imprimir_resultado("FenwickTree: range_sum", medir_segundos([&] {
+        for (std::size_t i = 0; i < operacoes; ++i) soma += ft->range_sum(indices[i], fins[i]);
+    }), operacoes);
+    imprimir_resultado("SegmentTreeMonoide: query", medir_segundos([&] {
+        for (std::size_t i = 0; i < operacoes; ++i) soma -= st->query(indices[i], fins[i]);
+    }), operacoes);
+
+    if (soma != 0) {
+        std::printf("ERRO: as estruturas divergiram\n");
+        return 1;
+    }
+    delete ft;
+    delete st;
+    return 0;
+}
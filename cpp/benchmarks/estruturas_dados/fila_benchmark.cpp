@@ -0,0 +1,182 @@
+/**
+ * @file fila_benchmark.cpp
+ * @brief Mede a vazão das filas de fila.hpp com vários números de produtores e consumidores,
+ * com e sem operações em lote, contra um std::queue protegido por std::mutex, e a latência de
+ * ida e volta (ping-pong) entre duas threads.
+ *
+ * Uso: fila_benchmark [elementos_por_produtor] [idas_e_voltas]
+ */
+
+#include "benchmark_util.hpp"
+#include "estruturas_dados/fila.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+const std::size_t CAPACIDADE = 1024;
+const std::size_t LOTE = 32;
+
+class FilaComMutex {
+public:
+    explicit FilaComMutex(std::size_t cap) : capacidade(cap) {}
+    bool push(std::uint64_t x) {
+        std::lock_guard<std::mutex> trava(mutex);
+        if (fila.size() == capacidade) return false;
+        fila.push(x);
+        return true;
+    }
+    bool pop(std::uint64_t& x) {
+        std::lock_guard<std::mutex> trava(mutex);
+        if (fila.empty()) return false;
+        x = fila.front();
+        fila.pop();
+        return true;
+    }
+
+private:
+    std::mutex mutex;
+    std::queue<std::uint64_t> fila;
+    std::size_t capacidade;
+};
+
+// Insere e retira 'lote' elementos por vez; com lote = 1 usa push/pop simples.
+template <typename Fila>
+std::size_t inserir(Fila& fila, const std::uint64_t* itens, std::size_t n, std::size_t lote) {
+    if constexpr (requires { fila.push_lote(itens, n); }) {
+        if (lote > 1) return fila.push_lote(itens, std::min(n, lote));
+    }
+    return fila.push(itens[0]) ? 1 : 0;
+}
+
+template <typename Fila>
+std::size_t retirar(Fila& fila, std::uint64_t* saida, std::size_t lote) {
+    if constexpr (requires { fila.pop_lote(saida, lote); }) {
+        if (lote > 1) return fila.pop_lote(saida, lote);
+    }
+    return fila.pop(saida[0]) ? 1 : 0;
+}
+
+// Retorna a soma dos elementos consumidos, para conferência.
+template <typename Fila>
+std::uint64_t transferir(Fila& fila, int produtores, int consumidores, std::size_t por_produtor, std::size_t lote) {
+    std::atomic<std::size_t> restantes{produtores * por_produtor};
+    std::atomic<std::uint64_t> soma{0};
+    std::vector<std::thread> threads;
+    for (int p = 0; p < produtores; ++p) {
+        threads.emplace_back([&, p] {
+            std::vector<std::uint64_t> itens(lote);
+            for (std::size_t i = 0; i < por_produtor;) {
+                std::size_t k = std::min(lote, por_produtor - i);
+                for (std::size_t j = 0; j < k; ++j) itens[j] = p * por_produtor + i + j;
+                std::size_t inseridos = inserir(fila, itens.data(), k, lote);
+                if (inseridos == 0) std::this_thread::yield();
+                i += inseridos;
+            }
+        });
+    }
+    for (int c = 0; c < consumidores; ++c) {
+        threads.emplace_back([&] {
+            std::vector<std::uint64_t> saida(lote);
+            std::uint64_t local = 0;
+            if constexpr (requires { fila.fechar(); }) {
+                // A fila bloqueante dorme quando vazia e é fechada depois dos produtores.
+                while (fila.pop(saida[0])) local += saida[0];
+                soma += local;
+                return;
+            }
+            while (restantes.load(std::memory_order_relaxed) > 0) {
+                std::size_t k = retirar(fila, saida.data(), lote);
+                if (k == 0) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                for (std::size_t j = 0; j < k; ++j) local += saida[j];
+                restantes.fetch_sub(k, std::memory_order_relaxed);
+            }
+            soma += local;
+        });
+    }
+    for (int p = 0; p < produtores; ++p) threads[p].join();
+    if constexpr (requires { fila.fechar(); }) fila.fechar();
+    for (std::size_t t = produtores; t < threads.size(); ++t) threads[t].join();
+    return soma.load();
+}
+
+// Vai e volta um valor entre duas threads por duas filas; retorna o tempo total.
+template <typename Fila>
+double ping_pong(std::size_t idas) {
+    Fila ida(CAPACIDADE), volta(CAPACIDADE);
+    // Retorna false só se a fila bloqueante for fechada, o que este teste nunca faz.
+    auto esperar_pop = [](Fila& f, std::uint64_t& x) {
+        if constexpr (requires { f.fechar(); }) {
+            return f.pop(x); // A fila bloqueante dorme em vez de girar
+        } else {
+            while (!f.pop(x)) std::this_thread::yield();
+            return true;
+        }
+    };
+    return medir_segundos([&] {
+        std::thread eco([&] {
+            std::uint64_t x = 0;
+            for (std::size_t i = 0; i < idas && esperar_pop(ida, x); ++i) {
+                volta.push(x + 1);
+            }
+        });
+        std::uint64_t x = 0;
+        for (std::size_t i = 0; i < idas; ++i) {
+            ida.push(x);
+            if (!esperar_pop(volta, x)) break;
+        }
+        eco.join();
+        nao_otimizar(x);
+    });
+}
+
+int main(int argc, char** argv) {
+    const std::size_t por_produtor = argumento(argc, argv, 1, 1000000);
+    const std::size_t idas = argumento(argc, argv, 2, 100000);
+    std::printf("capacidade = %zu, lote = %zu, hardware_concurrency = %u\n", CAPACIDADE, LOTE,
+                std::thread::hardware_concurrency());
+
+    bool ok = true;
+    auto medir = [&](const std::string& nome, auto& fila, int p, int c, std::size_t lote) {
+        std::uint64_t soma = 0;
+        double s = medir_segundos([&] { soma = transferir(fila, p, c, por_produtor, lote); });
+        std::size_t total = p * por_produtor;
+        imprimir_resultado(nome + " " + std::to_string(p) + "P/" + std::to_string(c) + "C", s, total);
+        ok = ok && soma == static_cast<std::uint64_t>(total) * (total - 1) / 2;
+    };
+
+    {
+        FilaSPSC<std::uint64_t> spsc(CAPACIDADE), spsc_lote(CAPACIDADE);
+        medir("FilaSPSC", spsc, 1, 1, 1);
+        medir("FilaSPSC em lotes", spsc_lote, 1, 1, LOTE);
+    }
+    for (auto [p, c] : {std::pair{1, 1}, {2, 2}, {4, 4}, {1, 4}, {4, 1}}) {
+        FilaMPMC<std::uint64_t> mpmc(CAPACIDADE), mpmc_lote(CAPACIDADE);
+        FilaBloqueante<std::uint64_t> bloqueante(CAPACIDADE);
+        FilaComMutex com_mutex(CAPACIDADE);
+        medir("FilaMPMC", mpmc, p, c, 1);
+        medir("FilaMPMC em lotes", mpmc_lote, p, c, LOTE);
+        medir("FilaBloqueante", bloqueante, p, c, 1);
+        medir("std::queue + mutex", com_mutex, p, c, 1);
+    }
+
+    std::printf("\nping-pong (ida e volta):\n");
+    imprimir_resultado("FilaSPSC", ping_pong<FilaSPSC<std::uint64_t>>(idas), idas);
+    imprimir_resultado("FilaMPMC", ping_pong<FilaMPMC<std::uint64_t>>(idas), idas);
+    imprimir_resultado("FilaBloqueante (atomic wait)", ping_pong<FilaBloqueante<std::uint64_t>>(idas), idas);
+    imprimir_resultado("std::queue + mutex", ping_pong<FilaComMutex>(idas), idas);
+
+    if (!ok) {
+        std::printf("ERRO: a soma dos elementos consumidos não confere\n");
+        return 1;
+    }
+    return 0;
+}
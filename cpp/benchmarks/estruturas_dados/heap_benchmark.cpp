@@ -0,0 +1,172 @@
+/**
+ * @file heap_benchmark.cpp
+ * @brief Compara filas de prioridade como a fila do Dijkstra e de uma Prim com decrease-key em um
+ * grafo aleatório esparso não direcionado: std::priority_queue com entradas duplicadas (a versão
+ * antiga de `dijkstra()`), HeapIndexado com aridades 2, 4 e 8 e PairingHeap.
+ *
+ * Uso: heap_benchmark [vertices] [grau_medio]
+ */
+
+#include "benchmark_util.hpp"
+#include "algoritmos_grafos/dijkstra.hpp"
+#include "estruturas_dados/heap.hpp"
+#include <functional>
+#include <limits>
+#include <queue>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+const long long INF = std::numeric_limits<long long>::max();
+
+// Cada algoritmo é escrito uma vez e recebe três operações sobre a fila: inserir ou melhorar a
+// chave de um vértice, retirar o vértice mínimo (ou -1 se a fila acabou) e nada mais.
+
+class FilaComDuplicatas {
+public:
+    explicit FilaComDuplicatas(int) {}
+    void melhorar(int v, long long chave, const std::vector<long long>&) { fila.push({chave, v}); }
+    int retirar(const std::vector<long long>& chaves) {
+        while (!fila.empty()) {
+            auto [chave, v] = fila.top();
+            fila.pop();
+            if (chave == chaves[v]) return v; // Descarta entradas obsoletas
+        }
+        return -1;
+    }
+
+private:
+    using Par = std::pair<long long, int>;
+    std::priority_queue<Par, std::vector<Par>, std::greater<Par>> fila;
+};
+
+template <int Aridade>
+class FilaIndexada {
+public:
+    explicit FilaIndexada(int n) : heap(n) {}
+    void melhorar(int v, long long chave, const std::vector<long long>&) {
+        if (heap.contem(v)) heap.decrease_key(v, chave);
+        else heap.push(v, chave);
+    }
+    int retirar(const std::vector<long long>&) { return heap.empty() ? -1 : heap.pop(); }
+
+private:
+    HeapIndexado<long long, Aridade> heap;
+};
+
+class FilaPairing {
+public:
+    explicit FilaPairing(int n) : handles(n), presente(n, false) {}
+    void melhorar(int v, long long chave, const std::vector<long long>&) {
+        if (presente[v]) {
+            heap.decrease_key(handles[v], {chave, v});
+        } else {
+            handles[v] = heap.push({chave, v});
+            presente[v] = true;
+        }
+    }
+    int retirar(const std::vector<long long>&) {
+        if (heap.empty()) return -1;
+        int v = heap.top().second;
+        heap.pop();
+        presente[v] = false;
+        return v;
+    }
+
+private:
+    PairingHeap<std::pair<long long, int>> heap;
+    std::vector<PairingHeap<std::pair<long long, int>>::Handle> handles;
+    std::vector<bool> presente;
+};
+
+template <typename Fila>
+std::vector<long long> dijkstra_com(const GrafoPonderado& grafo, int origem) {
+    std::vector<long long> dist(grafo.size(), INF);
+    std::vector<bool> finalizado(grafo.size(), false);
+    Fila fila(grafo.size());
+    dist[origem] = 0;
+    fila.melhorar(origem, 0, dist);
+    for (int u; (u = fila.retirar(dist)) != -1;) {
+        finalizado[u] = true;
+        for (auto [v, peso] : grafo[u]) {
+            if (!finalizado[v] && dist[u] + peso < dist[v]) {
+                dist[v] = dist[u] + peso;
+                fila.melhorar(v, dist[v], dist);
+            }
+        }
+    }
+    return dist;
+}
+
+// Prim sobre a componente da origem; retorna o peso total da árvore geradora mínima.
+template <typename Fila>
+long long prim_com(const GrafoPonderado& grafo, int origem) {
+    std::vector<long long> chave(grafo.size(), INF);
+    std::vector<bool> na_arvore(grafo.size(), false);
+    Fila fila(grafo.size());
+    chave[origem] = 0;
+    fila.melhorar(origem, 0, chave);
+    long long total = 0;
+    for (int u; (u = fila.retirar(chave)) != -1;) {
+        na_arvore[u] = true;
+        total += chave[u];
+        for (auto [v, peso] : grafo[u]) {
+            if (!na_arvore[v] && peso < chave[v]) {
+                chave[v] = peso;
+                fila.melhorar(v, peso, chave);
+            }
+        }
+    }
+    return total;
+}
+
+int main(int argc, char** argv) {
+    const int V = static_cast<int>(argumento(argc, argv, 1, 1000000));
+    const int grau = static_cast<int>(argumento(argc, argv, 2, 8));
+
+    std::mt19937 gerador(37);
+    GrafoPonderado grafo(V);
+    for (long long i = 0; i < static_cast<long long>(V) * grau / 2; ++i) {
+        int u = gerador() % V, v = gerador() % V, peso = 1 + gerador() % 1000;
+        grafo[u].push_back({v, peso});
+        grafo[v].push_back({u, peso});
+    }
+    std::printf("vertices = %d, arestas = %lld\n", V, static_cast<long long>(V) * grau / 2);
+
+    std::vector<long long> referencia;
+    double t = medir_segundos([&] { referencia = dijkstra(grafo, 0); });
+    imprimir_resultado("dijkstra()", t, V);
+
+    bool ok = true;
+    auto medir_dijkstra = [&](const std::string& nome, auto funcao) {
+        std::vector<long long> dist;
+        double s = medir_segundos([&] { dist = funcao(grafo, 0); });
+        imprimir_resultado("Dijkstra: " + nome, s, V);
+        ok = ok && dist == referencia;
+    };
+    medir_dijkstra("priority_queue com duplicatas", dijkstra_com<FilaComDuplicatas>);
+    medir_dijkstra("HeapIndexado d = 2", dijkstra_com<FilaIndexada<2>>);
+    medir_dijkstra("HeapIndexado d = 4", dijkstra_com<FilaIndexada<4>>);
+    medir_dijkstra("HeapIndexado d = 8", dijkstra_com<FilaIndexada<8>>);
+    medir_dijkstra("PairingHeap", dijkstra_com<FilaPairing>);
+
+    long long peso_referencia = prim_com<FilaComDuplicatas>(grafo, 0);
+    auto medir_prim = [&](const std::string& nome, auto funcao) {
+        long long peso = 0;
+        double s = medir_segundos([&] { peso = funcao(grafo, 0); });
+        imprimir_resultado("Prim: " + nome, s, V);
+        ok = ok && peso == peso_referencia;
+    };
+    medir_prim("priority_queue com duplicatas", prim_com<FilaComDuplicatas>);
+    medir_prim("HeapIndexado d = 2", prim_com<FilaIndexada<2>>);
+    medir_prim("HeapIndexado d = 4", prim_com<FilaIndexada<4>>);
+    medir_prim("HeapIndexado d = 8", prim_com<FilaIndexada<8>>);
+    medir_prim("PairingHeap", prim_com<FilaPairing>);
+
+    if (!ok) {
+        std::printf("ERRO: as filas produziram resultados diferentes\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,88 @@
+/**
+ * @file kd_tree_benchmark.cpp
+ * @brief Mede a construção da KDTree e as consultas de k vizinhos e por raio sobre uma nuvem de
+ * pontos 3D uniforme: consultas individuais, lotes com 1, 2, 4 e 8 threads e, para uma amostra
+ * das consultas, a busca exaustiva como referência.
+ *
+ * Uso: kd_tree_benchmark [pontos] [consultas] [k]
+ */
+
+#include "benchmark_util.hpp"
+#include "estruturas_dados/kd_tree.hpp"
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using Arvore = KDTree<float, 3>;
+
+static float forca_bruta_k_esima(const std::vector<Arvore::Ponto>& pontos, const Arvore::Ponto& q, std::size_t k) {
+    std::vector<float> dist(pontos.size());
+    for (std::size_t i = 0; i < pontos.size(); ++i) {
+        float soma = 0;
+        for (int d = 0; d < 3; ++d) soma += (pontos[i][d] - q[d]) * (pontos[i][d] - q[d]);
+        dist[i] = soma;
+    }
+    std::nth_element(dist.begin(), dist.begin() + (k - 1), dist.end());
+    return dist[k - 1];
+}
+
+int main(int argc, char** argv) {
+    const std::size_t n = argumento(argc, argv, 1, 1000000);
+    const std::size_t num_consultas = argumento(argc, argv, 2, 200000);
+    const std::size_t k = argumento(argc, argv, 3, 8);
+
+    std::mt19937 gerador(42);
+    std::uniform_real_distribution<float> uniforme(0.0f, 1.0f);
+    std::vector<Arvore::Ponto> pontos(n), consultas(num_consultas);
+    for (auto& p : pontos) p = {uniforme(gerador), uniforme(gerador), uniforme(gerador)};
+    for (auto& p : consultas) p = {uniforme(gerador), uniforme(gerador), uniforme(gerador)};
+    // Raio com cerca de k pontos esperados dentro da esfera.
+    const float raio = std::cbrt(3.0f * k / (4.0f * 3.14159265f * n));
+
+    std::printf("pontos = %zu, consultas = %zu, k = %zu, hardware_concurrency = %u\n", n, num_consultas, k,
+                std::thread::hardware_concurrency());
+
+    std::unique_ptr<Arvore> arvore;
+    double t = medir_segundos([&] { arvore = std::make_unique<Arvore>(pontos); });
+    imprimir_resultado("KDTree: construção (por ponto)", t, n);
+
+    std::size_t soma = 0;
+    t = medir_segundos([&] {
+        for (const auto& q : consultas) soma += arvore->k_vizinhos(q, static_cast<int>(k)).back().indice;
+    });
+    nao_otimizar(soma);
+    imprimir_resultado("KDTree: k_vizinhos individual", t, num_consultas);
+
+    t = medir_segundos([&] {
+        for (const auto& q : consultas) soma += arvore->vizinhos_no_raio(q, raio).size();
+    });
+    nao_otimizar(soma);
+    imprimir_resultado("KDTree: vizinhos_no_raio individual", t, num_consultas);
+
+    std::vector<Arvore::Vizinho> lote;
+    for (unsigned threads : {1u, 2u, 4u, 8u}) {
+        t = medir_segundos([&] { lote = arvore->k_vizinhos_lote(consultas, static_cast<int>(k), threads); });
+        imprimir_resultado("KDTree: k_vizinhos_lote " + std::to_string(threads) + " threads", t, num_consultas);
+        t = medir_segundos([&] { nao_otimizar(arvore->vizinhos_no_raio_lote(consultas, raio, threads)); });
+        imprimir_resultado("KDTree: vizinhos_no_raio_lote " + std::to_string(threads) + " threads", t, num_consultas);
+    }
+
+    // A busca exaustiva é lenta demais para todas as consultas; usa uma amostra e confere os resultados.
+    const std::size_t amostra = std::min<std::size_t>(num_consultas, 200);
+    std::vector<float> referencia(amostra);
+    t = medir_segundos([&] {
+        for (std::size_t i = 0; i < amostra; ++i) referencia[i] = forca_bruta_k_esima(pontos, consultas[i], k);
+    });
+    imprimir_resultado("Força bruta: k_vizinhos", t, amostra);
+    for (std::size_t i = 0; i < amostra; ++i) {
+        if (lote[i * k + k - 1].distancia2 != referencia[i]) {
+            std::printf("ERRO: k-ésima distância da consulta %zu difere da força bruta\n", i);
+            return 1;
+        }
+    }
+    return 0;
+}
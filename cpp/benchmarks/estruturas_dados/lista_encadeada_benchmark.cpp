@@ -0,0 +1,138 @@
+/**
+ * @file lista_encadeada_benchmark.cpp
+ * @brief Compara as listas desenroladas (ListaEncadeadaSimples e ListaEncadeadaDupla) com
+ * std::list, std::forward_list e std::vector em inserção ordenada, percurso e splice.
+ *
+ * No percurso, a std::list aparece duas vezes: com os nós alocados em sequência (melhor caso) e
+ * depois de um `sort`, que religa os nós e deixa a ordem da lista espalhada pela memória, como
+ * acontece quando ela é construída por inserções ordenadas.
+ *
+ * Uso: lista_encadeada_benchmark [insercoes_ordenadas] [elementos_percorridos]
+ */
+
+#include "benchmark_util.hpp"
+#include "estruturas_dados/lista_encadeada_dupla.hpp"
+#include "estruturas_dados/lista_encadeada_simples.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <forward_list>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using Simples = ListaEncadeadaSimples<std::int64_t>;
+using Dupla = ListaEncadeadaDupla<std::int64_t>;
+
+template <typename Lista>
+void inserir_ordenado(Lista& lista, std::int64_t x) {
+    if constexpr (requires { lista.inserir_ordenado(x); }) {
+        lista.inserir_ordenado(x);
+    } else if constexpr (requires { lista.before_begin(); }) {
+        auto anterior = lista.before_begin();
+        for (auto it = lista.begin(); it != lista.end() && !(x < *it); ++it) anterior = it;
+        lista.insert_after(anterior, x);
+    } else if constexpr (requires { lista.reserve(1); }) {
+        lista.insert(std::upper_bound(lista.begin(), lista.end(), x), x);
+    } else {
+        lista.insert(std::find_if(lista.begin(), lista.end(), [x](std::int64_t y) { return x < y; }), x);
+    }
+}
+
+template <typename Lista>
+std::int64_t somar(const Lista& lista) {
+    std::int64_t soma = 0;
+    for (std::int64_t x : lista) soma += x;
+    return soma;
+}
+
+int main(int argc, char** argv) {
+    const std::size_t insercoes = argumento(argc, argv, 1, 20000);
+    const std::size_t elementos = argumento(argc, argv, 2, 1000000);
+    std::mt19937_64 gerador(39);
+    bool ok = true;
+
+    std::printf("inserção ordenada (%zu elementos aleatórios):\n", insercoes);
+    std::vector<std::int64_t> valores(insercoes);
+    for (auto& v : valores) v = static_cast<std::int64_t>(gerador() % 1000000);
+    std::vector<std::int64_t> esperado = valores;
+    std::sort(esperado.begin(), esperado.end());
+    auto medir_insercao = [&](const std::string& nome, auto lista) {
+        double s = medir_segundos([&] {
+            for (std::int64_t x : valores) inserir_ordenado(lista, x);
+        });
+        imprimir_resultado(nome, s, insercoes);
+        ok = ok && std::equal(lista.begin(), lista.end(), esperado.begin(), esperado.end());
+    };
+    medir_insercao("ListaEncadeadaSimples", Simples());
+    medir_insercao("ListaEncadeadaDupla", Dupla());
+    medir_insercao("std::forward_list", std::forward_list<std::int64_t>());
+    medir_insercao("std::list", std::list<std::int64_t>());
+    medir_insercao("std::vector (upper_bound + insert)", std::vector<std::int64_t>());
+
+    std::printf("\npercurso (%zu elementos, 10 passadas):\n", elementos);
+    std::vector<std::int64_t> grandes(elementos);
+    for (auto& v : grandes) v = static_cast<std::int64_t>(gerador() % 1000000);
+    Simples simples;
+    Dupla dupla;
+    std::list<std::int64_t> sequencial, espalhada(grandes.begin(), grandes.end());
+    std::vector<std::int64_t> vetor = grandes;
+    std::sort(vetor.begin(), vetor.end());
+    espalhada.sort();
+    for (std::int64_t x : vetor) {
+        simples.push_back(x);
+        dupla.push_back(x);
+        sequencial.push_back(x);
+    }
+    const std::int64_t soma_esperada = somar(vetor);
+    auto medir_percurso = [&](const std::string& nome, const auto& lista) {
+        std::int64_t soma = 0;
+        double s = medir_segundos([&] {
+            for (int passada = 0; passada < 10; ++passada) soma = somar(lista);
+        });
+        nao_otimizar(soma);
+        imprimir_resultado(nome, s, 10 * elementos);
+        ok = ok && soma == soma_esperada;
+    };
+    medir_percurso("ListaEncadeadaSimples", simples);
+    medir_percurso("ListaEncadeadaDupla", dupla);
+    medir_percurso("std::list (nós em sequência)", sequencial);
+    medir_percurso("std::list (nós espalhados)", espalhada);
+    medir_percurso("std::vector", vetor);
+    std::printf("nós por elemento: %.4f (B = %d)\n",
+                double(simples.pool_de_nos()->nos_em_uso()) / elementos, elementos_por_no_padrao<std::int64_t>());
+
+    // Junta 1000 listas de 1000 elementos em uma, no meio dela.
+    std::printf("\nsplice (1000 listas de 1000 elementos):\n");
+    {
+        auto pool = std::make_shared<Dupla::Pool>();
+        std::vector<Dupla> partes;
+        std::vector<std::list<std::int64_t>> partes_std(1000);
+        for (int p = 0; p < 1000; ++p) {
+            partes.emplace_back(pool);
+            for (int i = 0; i < 1000; ++i) {
+                partes.back().push_back(i);
+                partes_std[p].push_back(i);
+            }
+        }
+        Dupla destino(pool);
+        std::list<std::int64_t> destino_std;
+        double s = medir_segundos([&] {
+            for (auto& parte : partes) destino.splice(std::next(destino.begin(), destino.vazia() ? 0 : 1), parte);
+        });
+        imprimir_resultado("ListaEncadeadaDupla::splice", s, partes.size());
+        s = medir_segundos([&] {
+            for (auto& parte : partes_std) destino_std.splice(std::next(destino_std.begin(), destino_std.empty() ? 0 : 1), parte);
+        });
+        imprimir_resultado("std::list::splice", s, partes_std.size());
+        ok = ok && destino.tamanho() == 1000000 && somar(destino) == somar(destino_std);
+    }
+
+    if (!ok) {
+        std::printf("ERRO: as listas não conferem com a referência\n");
+        return 1;
+    }
+    return 0;
+}
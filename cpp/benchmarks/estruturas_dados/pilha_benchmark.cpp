@@ -0,0 +1,84 @@
+/**
+ * @file pilha_benchmark.cpp
+ * @brief Compara a PilhaConcorrente com um std::stack protegido por std::mutex, com 1, 2, 4 e 8
+ * threads alternando empilhamentos e desempilhamentos.
+ *
+ * Uso: pilha_benchmark [pares_por_thread]
+ */
+
+#include "benchmark_util.hpp"
+#include "estruturas_dados/pilha.hpp"
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <stack>
+#include <string>
+#include <thread>
+#include <vector>
+
+class PilhaComMutex {
+public:
+    void push(std::uint64_t x) {
+        std::lock_guard<std::mutex> trava(mutex);
+        pilha.push(x);
+    }
+    bool pop(std::uint64_t& x) {
+        std::lock_guard<std::mutex> trava(mutex);
+        if (pilha.empty()) return false;
+        x = pilha.top();
+        pilha.pop();
+        return true;
+    }
+
+private:
+    std::mutex mutex;
+    std::stack<std::uint64_t> pilha;
+};
+
+// Cada thread faz 'pares' empilhamentos, cada um seguido de um desempilhamento. Retorna a
+// soma de tudo o que foi desempilhado, incluindo o que restou no final.
+template <typename Pilha>
+std::uint64_t executar(Pilha& pilha, int threads, std::size_t pares) {
+    std::atomic<std::uint64_t> soma{0};
+    std::vector<std::thread> trabalhadoras;
+    for (int t = 0; t < threads; ++t) {
+        trabalhadoras.emplace_back([&, t] {
+            std::uint64_t local = 0, x;
+            for (std::size_t i = 0; i < pares; ++i) {
+                pilha.push(t * pares + i);
+                if (pilha.pop(x)) local += x;
+            }
+            soma += local;
+        });
+    }
+    for (auto& th : trabalhadoras) th.join();
+    std::uint64_t x, resto = 0;
+    while (pilha.pop(x)) resto += x;
+    return soma.load() + resto;
+}
+
+int main(int argc, char** argv) {
+    const std::size_t pares = argumento(argc, argv, 1, 1000000);
+    std::printf("hardware_concurrency = %u\n", std::thread::hardware_concurrency());
+
+    bool ok = true;
+    for (int threads : {1, 2, 4, 8}) {
+        std::uint64_t total = threads * pares;
+        std::uint64_t esperado = total * (total - 1) / 2;
+        PilhaConcorrente<std::uint64_t> sem_lock;
+        PilhaComMutex com_mutex;
+        std::uint64_t soma = 0;
+
+        double s = medir_segundos([&] { soma = executar(sem_lock, threads, pares); });
+        imprimir_resultado("PilhaConcorrente: " + std::to_string(threads) + " threads", s, 2 * total);
+        ok = ok && soma == esperado;
+        s = medir_segundos([&] { soma = executar(com_mutex, threads, pares); });
+        imprimir_resultado("std::stack + mutex: " + std::to_string(threads) + " threads", s, 2 * total);
+        ok = ok && soma == esperado;
+    }
+    if (!ok) {
+        std::printf("ERRO: a soma dos elementos desempilhados não confere\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,81 @@
+/**
+ * @file skip_list_benchmark.cpp
+ * @brief Compara a SkipListConcorrente com um std::map protegido por std::mutex em uma carga mista
+ * (80% buscas, 10% inserções, 10% remoções) com 1, 2, 4 e 8 threads.
+ *
+ * Uso: skip_list_benchmark [chaves] [operacoes_por_thread]
+ */
+
+#include "benchmark_util.hpp"
+#include "estruturas_dados/skip_list.hpp"
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+class MapaComMutex {
+public:
+    bool inserir(std::int64_t chave, std::int64_t valor) {
+        std::lock_guard<std::mutex> trava(mutex);
+        return mapa.emplace(chave, valor).second;
+    }
+    bool remover(std::int64_t chave) {
+        std::lock_guard<std::mutex> trava(mutex);
+        return mapa.erase(chave) == 1;
+    }
+    bool contem(std::int64_t chave) const {
+        std::lock_guard<std::mutex> trava(mutex);
+        return mapa.count(chave) == 1;
+    }
+
+private:
+    mutable std::mutex mutex;
+    std::map<std::int64_t, std::int64_t> mapa;
+};
+
+template <typename Mapa>
+double executar(Mapa& mapa, int threads, std::size_t chaves, std::size_t operacoes) {
+    return medir_segundos([&] {
+        std::vector<std::thread> trabalhadoras;
+        for (int t = 0; t < threads; ++t) {
+            trabalhadoras.emplace_back([&, t] {
+                std::mt19937_64 gerador(1000 + t);
+                std::size_t achados = 0;
+                for (std::size_t i = 0; i < operacoes; ++i) {
+                    std::int64_t chave = static_cast<std::int64_t>(gerador() % chaves);
+                    unsigned sorteio = gerador() % 10;
+                    if (sorteio == 0) mapa.inserir(chave, chave);
+                    else if (sorteio == 1) mapa.remover(chave);
+                    else achados += mapa.contem(chave);
+                }
+                nao_otimizar(achados);
+            });
+        }
+        for (auto& th : trabalhadoras) th.join();
+    });
+}
+
+int main(int argc, char** argv) {
+    const std::size_t chaves = argumento(argc, argv, 1, 1000000);
+    const std::size_t operacoes = argumento(argc, argv, 2, 1000000);
+
+    std::printf("chaves = %zu, hardware_concurrency = %u\n", chaves, std::thread::hardware_concurrency());
+    for (int threads : {1, 2, 4, 8}) {
+        SkipListConcorrente<std::int64_t, std::int64_t> lista;
+        MapaComMutex mapa;
+        // Metade das chaves presentes, para que buscas, inserções e remoções acertem e errem.
+        for (std::size_t k = 0; k < chaves; k += 2) {
+            lista.inserir(static_cast<std::int64_t>(k), 0);
+            mapa.inserir(static_cast<std::int64_t>(k), 0);
+        }
+        std::size_t total = operacoes * threads;
+        imprimir_resultado("SkipListConcorrente: " + std::to_string(threads) + " threads",
+                           executar(lista, threads, chaves, operacoes), total);
+        imprimir_resultado("std::map + mutex: " + std::to_string(threads) + " threads",
+                           executar(mapa, threads, chaves, operacoes), total);
+    }
+    return 0;
+}
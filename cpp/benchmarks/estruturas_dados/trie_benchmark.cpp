@@ -0,0 +1,106 @@
+/**
+ * @file trie_benchmark.cpp
+ * @brief Mede memória por chave e tempo de consulta da RadixTrie e da TrieCongelada contra
+ * std::set<std::string>, com URLs sintéticas que compartilham domínios e caminhos.
+ *
+ * A memória do std::set é medida com um alocador que conta os bytes pedidos pelos nós e pelas
+ * strings (sem o overhead do malloc, o que favorece o std::set).
+ *
+ * Uso: trie_benchmark [n] [consultas]
+ */
+
+#include "benchmark_util.hpp"
+#include "estruturas_dados/trie.hpp"
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+static std::size_t bytes_alocados = 0;
+
+template <typename T>
+struct AlocadorContador {
+    using value_type = T;
+    AlocadorContador() = default;
+    template <typename U>
+    AlocadorContador(const AlocadorContador<U>&) {}
+    T* allocate(std::size_t n) {
+        bytes_alocados += n * sizeof(T);
+        return std::allocator<T>().allocate(n);
+    }
+    void deallocate(T* p, std::size_t n) {
+        bytes_alocados -= n * sizeof(T);
+        std::allocator<T>().deallocate(p, n);
+    }
+    template <typename U>
+    bool operator==(const AlocadorContador<U>&) const { return true; }
+};
+
+using StringContada = std::basic_string<char, std::char_traits<char>, AlocadorContador<char>>;
+
+int main(int argc, char** argv) {
+    const std::size_t n = argumento(argc, argv, 1, 1000000);
+    const std::size_t consultas = argumento(argc, argv, 2, 1000000);
+
+    const char* categorias[] = {"produtos", "noticias", "usuarios", "busca", "ajuda", "blog"};
+    std::mt19937 gerador(42);
+    std::vector<std::string> urls(n);
+    std::size_t bytes_chaves = 0;
+    for (auto& url : urls) {
+        url = "https://www.site" + std::to_string(gerador() % (n / 200 + 1)) + ".com/" +
+              categorias[gerador() % 6] + "/" + std::to_string(gerador() % 1000000);
+        bytes_chaves += url.size();
+    }
+    std::vector<std::string> alvos(consultas);
+    for (auto& alvo : alvos) alvo = urls[gerador() % n] + (gerador() % 2 ? "" : "?ref=x");
+
+    std::printf("n = %zu, comprimento medio = %.1f bytes\n", n, double(bytes_chaves) / n);
+
+    RadixTrie trie;
+    imprimir_resultado("RadixTrie: inserir", medir_segundos([&] {
+        for (std::size_t i = 0; i < n; ++i) trie.inserir(urls[i], static_cast<std::uint32_t>(i));
+    }), n);
+    TrieCongelada congelada;
+    imprimir_resultado("RadixTrie: congelar", medir_segundos([&] { congelada = trie.congelar(); }), trie.tamanho());
+
+    std::set<StringContada, std::less<>, AlocadorContador<StringContada>> conjunto;
+    imprimir_resultado("std::set<std::string>: inserir", medir_segundos([&] {
+        for (const auto& url : urls) conjunto.emplace(url.begin(), url.end());
+    }), n);
+
+    std::printf("%-40s %12.1f bytes/chave\n", "RadixTrie: memoria", double(trie.memoria_bytes()) / trie.tamanho());
+    std::printf("%-40s %12.1f bytes/chave\n", "TrieCongelada: memoria", double(congelada.memoria_bytes()) / congelada.tamanho());
+    std::printf("%-40s %12.1f bytes/chave\n", "std::set<std::string>: memoria", double(bytes_alocados) / conjunto.size());
+
+    std::size_t achados[3] = {0, 0, 0};
+    imprimir_resultado("RadixTrie: contem", medir_segundos([&] {
+        for (const auto& alvo : alvos) achados[0] += trie.contem(alvo);
+    }), consultas);
+    imprimir_resultado("TrieCongelada: contem", medir_segundos([&] {
+        for (const auto& alvo : alvos) achados[1] += congelada.contem(alvo);
+    }), consultas);
+    imprimir_resultado("std::set<std::string>: count", medir_segundos([&] {
+        for (const auto& alvo : alvos) achados[2] += conjunto.count(std::string_view(alvo));
+    }), consultas);
+
+    long long soma_lpm = 0;
+    imprimir_resultado("TrieCongelada: longest_prefix_match", medir_segundos([&] {
+        for (const auto& alvo : alvos) soma_lpm += congelada.longest_prefix_match(alvo);
+    }), consultas);
+    nao_otimizar(soma_lpm);
+
+    const std::size_t buscas_top = std::max<std::size_t>(1, consultas / 100);
+    std::size_t total_sugestoes = 0;
+    imprimir_resultado("TrieCongelada: top_k(10) por dominio", medir_segundos([&] {
+        for (std::size_t i = 0; i < buscas_top; ++i) {
+            total_sugestoes += congelada.top_k(std::string_view(alvos[i]).substr(0, 20), 10).size();
+        }
+    }), buscas_top);
+    nao_otimizar(total_sugestoes);
+
+    if (achados[0] != achados[1] || achados[0] != achados[2]) {
+        std::printf("ERRO: as estruturas divergiram\n");
+        return 1;
+    }
+    return 0;
+}
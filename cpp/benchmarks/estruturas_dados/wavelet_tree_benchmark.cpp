@@ -0,0 +1,74 @@
+/**
+ * @file wavelet_tree_benchmark.cpp
+ * @brief Compara WaveletMatrix, MergeSortTree e a abordagem ingênua (ordenar o subarray a cada
+ * consulta) para k-ésimo menor e contagem de menores em intervalos.
+ *
+ * Uso: wavelet_tree_benchmark [n] [consultas] [consultas_ingenuas]
+ */
+
+#include "benchmark_util.hpp"
+#include "estruturas_dados/merge_sort_tree.hpp"
+#include "estruturas_dados/wavelet_tree.hpp"
+#include <algorithm>
+#include <random>
+#include <vector>
+
+int main(int argc, char** argv) {
+    const std::size_t n = argumento(argc, argv, 1, 1000000);
+    const std::size_t consultas = argumento(argc, argv, 2, 1000000);
+    const std::size_t consultas_ingenuas = argumento(argc, argv, 3, 200);
+
+    std::mt19937 gerador(12345);
+    std::vector<int> arr(n);
+    for (auto& x : arr) x = static_cast<int>(gerador() % 1000000000);
+
+    struct Consulta { int l, r, k, x; };
+    std::vector<Consulta> qs(consultas);
+    for (auto& q : qs) {
+        q.l = gerador() % n;
+        q.r = gerador() % n;
+        if (q.l > q.r) std::swap(q.l, q.r);
+        q.k = gerador() % (q.r - q.l + 1);
+        q.x = static_cast<int>(gerador() % 1000000000);
+    }
+
+    std::printf("n = %zu\n", n);
+
+    WaveletMatrix<int>* wm = nullptr;
+    imprimir_resultado("WaveletMatrix: construcao", medir_segundos([&] { wm = new WaveletMatrix<int>(arr); }), n);
+    MergeSortTree<int>* mst = nullptr;
+    imprimir_resultado("MergeSortTree: construcao", medir_segundos([&] { mst = new MergeSortTree<int>(arr); }), n);
+
+    long long soma = 0;
+    imprimir_resultado("WaveletMatrix: k_esimo_menor", medir_segundos([&] {
+        for (const auto& q : qs) soma += wm->k_esimo_menor(q.l, q.r, q.k);
+    }), consultas);
+    imprimir_resultado("WaveletMatrix: contar_menores", medir_segundos([&] {
+        for (const auto& q : qs) soma += wm->contar_menores(q.l, q.r, q.x);
+    }), consultas);
+    imprimir_resultado("WaveletMatrix: contar_distintos", medir_segundos([&] {
+        for (const auto& q : qs) soma += wm->contar_distintos(q.l, q.r);
+    }), consultas);
+    imprimir_resultado("MergeSortTree: k_esimo_menor", medir_segundos([&] {
+        for (const auto& q : qs) soma += mst->k_esimo_menor(q.l, q.r, q.k);
+    }), consultas);
+    imprimir_resultado("MergeSortTree: contar_menores", medir_segundos([&] {
+        for (const auto& q : qs) soma += mst->contar_menores(q.l, q.r, q.x);
+    }), consultas);
+
+    const std::size_t ingenuas = std::min(consultas, consultas_ingenuas);
+    std::vector<int> sub;
+    imprimir_resultado("Ingenuo (ordenar subarray): k_esimo", medir_segundos([&] {
+        for (std::size_t i = 0; i < ingenuas; ++i) {
+            const auto& q = qs[i];
+            sub.assign(arr.begin() + q.l, arr.begin() + q.r + 1);
+            std::sort(sub.begin(), sub.end());
+            soma += sub[q.k];
+        }
+    }), ingenuas);
+
+    nao_otimizar(soma);
+    delete wm;
+    delete mst;
+    return 0;
+}
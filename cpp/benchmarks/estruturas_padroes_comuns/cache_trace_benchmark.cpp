@@ -0,0 +1,96 @@
+/**
+ * @file cache_trace_benchmark.cpp
+ * @brief Reproduz sequências de acesso (traces) no LRUCache e no CacheWTinyLFU e compara a taxa
+ * de acerto e o tempo por acesso. Cada acesso é uma busca seguida de inserção em caso de falha.
+ *
+ * Traces sintéticos:
+ * - zipf: Zipf (theta = 0.9) sobre 1M chaves.
+ * - zipf + varreduras: o mesmo, intercalado com varreduras de chaves únicas, como as de um
+ *   processamento em lote noturno.
+ * - laço: percorre repetidamente 1.25 vezes a capacidade em chaves, o pior caso do LRU.
+ *
+ * Com um arquivo, reproduz também o trace dele: uma chave inteira por linha.
+ *
+ * Uso: cache_trace_benchmark [capacidade] [acessos] [arquivo_de_trace]
+ */
+
+#include "benchmark_util.hpp"
+#include "estruturas_padroes_comuns/lru_cache.hpp"
+#include <cstdint>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+using Chave = std::uint64_t;
+
+template <typename Cache>
+void reproduzir(const std::string& nome, const std::vector<Chave>& trace, std::size_t capacidade, bool& ok) {
+    Cache cache(capacidade);
+    std::uint64_t acertos = 0, errados = 0;
+    double s = medir_segundos([&] {
+        Chave v;
+        for (Chave chave : trace) {
+            if (cache.buscar(chave, v)) {
+                ++acertos;
+                errados += v != ~chave;
+            } else {
+                cache.inserir(chave, ~chave);
+            }
+        }
+    });
+    imprimir_resultado(nome, s, trace.size());
+    std::printf("%-40s %11.2f%% acertos\n", "", 100.0 * acertos / trace.size());
+    ok = ok && errados == 0 && acertos == cache.estatisticas().acertos;
+}
+
+void comparar(const std::string& titulo, const std::vector<Chave>& trace, std::size_t capacidade, bool& ok) {
+    std::printf("\n%s (%zu acessos, capacidade %zu):\n", titulo.c_str(), trace.size(), capacidade);
+    reproduzir<LRUCache<Chave, Chave>>("LRU", trace, capacidade, ok);
+    reproduzir<CacheWTinyLFU<Chave, Chave>>("W-TinyLFU", trace, capacidade, ok);
+}
+
+int main(int argc, char** argv) {
+    const std::size_t capacidade = argumento(argc, argv, 1, 50000);
+    const std::size_t acessos = argumento(argc, argv, 2, 4000000);
+    const std::size_t universo = 1000000;
+    std::mt19937_64 gerador(41);
+    GeradorZipf zipf(universo, 0.9);
+    bool ok = true;
+
+    std::vector<Chave> trace(acessos);
+    for (auto& k : trace) k = zipf(gerador);
+    comparar("zipf", trace, capacidade, ok);
+
+    // A cada 4 * capacidade acessos, uma varredura de 2 * capacidade chaves que nunca se repetem.
+    std::vector<Chave> com_varreduras;
+    Chave proxima_unica = universo;
+    for (std::size_t i = 0; i < acessos; ++i) {
+        com_varreduras.push_back(trace[i]);
+        if ((i + 1) % (4 * capacidade) == 0) {
+            for (std::size_t j = 0; j < 2 * capacidade; ++j) com_varreduras.push_back(proxima_unica++);
+        }
+    }
+    comparar("zipf + varreduras", com_varreduras, capacidade, ok);
+
+    std::vector<Chave> laco(acessos);
+    for (std::size_t i = 0; i < acessos; ++i) laco[i] = i % (capacidade + capacidade / 4);
+    comparar("laço", laco, capacidade, ok);
+
+    if (argc > 3) {
+        std::ifstream arquivo(argv[3]);
+        std::vector<Chave> do_arquivo;
+        for (Chave k; arquivo >> k;) do_arquivo.push_back(k);
+        if (do_arquivo.empty()) {
+            std::printf("ERRO: não foi possível ler chaves de %s\n", argv[3]);
+            return 1;
+        }
+        comparar(argv[3], do_arquivo, capacidade, ok);
+    }
+
+    if (!ok) {
+        std::printf("ERRO: o cache devolveu um valor incorreto ou contou acertos errado\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,145 @@
+/**
+ * @file lru_cache_benchmark.cpp
+ * @brief Mede o LRUCache e o LRUCacheConcorrente com chaves em distribuição de Zipf, como um
+ * cache de leitura na frente de um backend: cada falha é seguida da inserção da chave.
+ *
+ * Compara com um LRU clássico de std::list + std::unordered_map (uma alocação por entrada) e,
+ * com várias threads, com o LRUCache inteiro atrás de um único std::mutex.
+ *
+ * Uso: lru_cache_benchmark [operacoes_por_thread] [chaves_distintas] [capacidade]
+ */
+
+#include "benchmark_util.hpp"
+#include "estruturas_padroes_comuns/lru_cache.hpp"
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using Chave = std::uint64_t;
+using Valor = std::uint64_t;
+
+class LRUListaEMapa {
+public:
+    explicit LRUListaEMapa(std::size_t capacidade) : capacidade(capacidade) {}
+
+    bool buscar(Chave chave, Valor& valor) {
+        auto it = mapa.find(chave);
+        if (it == mapa.end()) return false;
+        ordem.splice(ordem.begin(), ordem, it->second);
+        valor = it->second->second;
+        return true;
+    }
+
+    void inserir(Chave chave, Valor valor) {
+        auto it = mapa.find(chave);
+        if (it != mapa.end()) ordem.erase(it->second);
+        ordem.emplace_front(chave, valor);
+        mapa[chave] = ordem.begin();
+        if (ordem.size() > capacidade) {
+            mapa.erase(ordem.back().first);
+            ordem.pop_back();
+        }
+    }
+
+private:
+    std::size_t capacidade;
+    std::list<std::pair<Chave, Valor>> ordem;
+    std::unordered_map<Chave, std::list<std::pair<Chave, Valor>>::iterator> mapa;
+};
+
+template <typename Cache>
+class ComMutex {
+public:
+    explicit ComMutex(std::size_t capacidade) : cache(capacidade) {}
+    bool buscar(Chave chave, Valor& valor) {
+        std::lock_guard<std::mutex> trava(mutex);
+        return cache.buscar(chave, valor);
+    }
+    void inserir(Chave chave, Valor valor) {
+        std::lock_guard<std::mutex> trava(mutex);
+        cache.inserir(chave, valor);
+    }
+
+private:
+    std::mutex mutex;
+    Cache cache;
+};
+
+// Cada thread percorre a sua própria sequência de chaves pré-sorteada. Retorna o número de
+// acertos; valores errados são contados em 'erros'.
+template <typename Cache>
+std::uint64_t executar(Cache& cache, const std::vector<std::vector<Chave>>& sequencias, std::uint64_t& erros) {
+    std::atomic<std::uint64_t> acertos{0}, incorretos{0};
+    std::vector<std::thread> threads;
+    for (const auto& sequencia : sequencias) {
+        threads.emplace_back([&] {
+            std::uint64_t local = 0, ruins = 0;
+            Valor v;
+            for (Chave chave : sequencia) {
+                if (cache.buscar(chave, v)) {
+                    ++local;
+                    ruins += v != chave * 7;
+                } else {
+                    cache.inserir(chave, chave * 7);
+                }
+            }
+            acertos += local;
+            incorretos += ruins;
+        });
+    }
+    for (auto& t : threads) t.join();
+    erros += incorretos.load();
+    return acertos.load();
+}
+
+int main(int argc, char** argv) {
+    const std::size_t por_thread = argumento(argc, argv, 1, 2000000);
+    const std::size_t chaves = argumento(argc, argv, 2, 1000000);
+    const std::size_t capacidade = argumento(argc, argv, 3, 100000);
+    std::printf("chaves = %zu, capacidade = %zu, hardware_concurrency = %u\n", chaves, capacidade,
+                std::thread::hardware_concurrency());
+
+    std::uint64_t erros = 0;
+    for (double theta : {0.8, 0.99}) {
+        GeradorZipf zipf(chaves, theta);
+        std::printf("\nZipf theta = %.2f\n", theta);
+        for (int threads : {1, 2, 4, 8}) {
+            std::vector<std::vector<Chave>> sequencias(threads);
+            std::mt19937_64 gerador(threads);
+            for (auto& s : sequencias) {
+                s.resize(por_thread);
+                for (auto& k : s) k = zipf(gerador);
+            }
+            const std::size_t total = threads * por_thread;
+            auto medir = [&](const std::string& nome, auto& cache) {
+                std::uint64_t acertos = 0;
+                double s = medir_segundos([&] { acertos = executar(cache, sequencias, erros); });
+                imprimir_resultado(nome + " " + std::to_string(threads) + "T", s, total);
+                std::printf("%-40s %11.2f%% acertos\n", "", 100.0 * acertos / total);
+            };
+            if (threads == 1) {
+                LRUCache<Chave, Valor> simples(capacidade);
+                LRUListaEMapa classico(capacidade);
+                medir("LRUCache", simples);
+                medir("std::list + unordered_map", classico);
+            }
+            LRUCacheConcorrente<Chave, Valor> concorrente(capacidade);
+            ComMutex<LRUCache<Chave, Valor>> com_mutex(capacidade);
+            ComMutex<LRUListaEMapa> classico_com_mutex(capacidade);
+            medir("LRUCacheConcorrente", concorrente);
+            medir("LRUCache + mutex", com_mutex);
+            medir("std::list + unordered_map + mutex", classico_com_mutex);
+        }
+    }
+    if (erros) {
+        std::printf("ERRO: %llu leituras devolveram um valor incorreto\n", static_cast<unsigned long long>(erros));
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,100 @@
+/**
+ * @file rabin_karp_benchmark.cpp
+ * @brief Mede o Rabin-Karp sobre um log sintético: um padrão contra std::string::find e
+ * std::boyer_moore_horspool_searcher; muitos padrões de mesmo comprimento numa passada contra
+ * uma busca por padrão; e o RabinKarpFluxo alimentado em pedaços de 64 KB contra o texto inteiro.
+ *
+ * Uso: rabin_karp_benchmark [tamanho do texto] [número de padrões]
+ */
+
+#include "benchmark_util.hpp"
+#include "manipulacao_strings/rabin_karp.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Linhas de log com poucos formatos e ids aleatórios: muito texto repetido, como num log real.
+std::string gerar_log(std::size_t tamanho, std::mt19937_64& gerador) {
+    static const char* NIVEIS[] = {"INFO", "WARN", "ERROR", "DEBUG"};
+    static const char* MENSAGENS[] = {"request served", "cache miss", "upstream timeout", "retrying connection", "user login"};
+    std::string texto;
+    texto.reserve(tamanho + 128);
+    char linha[128];
+    while (texto.size() < tamanho) {
+        std::snprintf(linha, sizeof(linha), "2024-05-01T12:%02u:%02u %s req=%016llx %s\n", static_cast<unsigned>(gerador() % 60),
+                      static_cast<unsigned>(gerador() % 60), NIVEIS[gerador() % 4], static_cast<unsigned long long>(gerador()),
+                      MENSAGENS[gerador() % 5]);
+        texto += linha;
+    }
+    texto.resize(tamanho);
+    return texto;
+}
+
+int main(int argc, char** argv) {
+    const std::size_t n = argumento(argc, argv, 1, 100000000);
+    const std::size_t k = argumento(argc, argv, 2, 1000);
+    std::mt19937_64 gerador(42);
+    const std::string texto = gerar_log(n, gerador);
+    bool ok = true;
+
+    // Um padrão: um id de requisição que aparece uma vez.
+    const std::string padrao = texto.substr(texto.find("req=", n / 2) + 4, 16);
+    std::vector<int> obtido;
+    imprimir_resultado("rabin_karp (1 padrão)", medir_segundos([&] { obtido = rabin_karp(texto, padrao); }), n);
+    std::vector<int> esperado;
+    imprimir_resultado("std::string::find", medir_segundos([&] {
+        for (std::size_t i = texto.find(padrao); i != std::string::npos; i = texto.find(padrao, i + 1)) esperado.push_back(static_cast<int>(i));
+    }), n);
+    ok = ok && obtido == esperado;
+    std::size_t contagem = 0;
+    imprimir_resultado("std::boyer_moore_horspool_searcher", medir_segundos([&] {
+        std::boyer_moore_horspool_searcher buscador(padrao.begin(), padrao.end());
+        for (auto i = std::search(texto.begin(), texto.end(), buscador); i != texto.end();
+             i = std::search(i + 1, texto.end(), buscador)) {
+            ++contagem;
+        }
+    }), n);
+    ok = ok && contagem == esperado.size();
+    std::printf("\n");
+
+    // k ids de requisição (16 caracteres): metade tirada do texto, metade inexistente.
+    std::vector<std::string> padroes;
+    for (std::size_t i = 0; i < k; ++i) {
+        const std::size_t id = texto.find("req=", gerador() % (n / 2)) + 4;
+        padroes.push_back(i % 2 ? texto.substr(id, 16) : std::to_string(gerador()).substr(0, 16));
+        padroes.back().resize(16, '0');
+    }
+    std::vector<OcorrenciaPadrao> multiplo;
+    imprimir_resultado("rabin_karp_multiplo (" + std::to_string(k) + " padrões)",
+                       medir_segundos([&] { multiplo = rabin_karp_multiplo(texto, padroes); }), n);
+    std::printf("%-40s %12zu ocorrências\n", "", multiplo.size());
+    // Um padrão por vez, em só 10 padrões, e extrapolado para k.
+    const std::size_t amostra = std::min<std::size_t>(k, 10);
+    std::size_t encontrados = 0;
+    const double segundos = medir_segundos([&] {
+        for (std::size_t i = 0; i < amostra; ++i) encontrados += rabin_karp(texto, padroes[i]).size();
+    });
+    imprimir_resultado("rabin_karp por padrão (extrapolado)", segundos * k / amostra, n);
+    ok = ok && encontrados == static_cast<std::size_t>(std::count_if(multiplo.begin(), multiplo.end(),
+                                                                     [&](const OcorrenciaPadrao& o) { return o.padrao < amostra; }));
+    std::printf("\n");
+
+    // O mesmo texto como fluxo, em pedaços de 64 KB.
+    constexpr std::size_t TAMANHO_PEDACO = 64 * 1024;
+    std::vector<OcorrenciaPadrao> em_pedacos;
+    imprimir_resultado("RabinKarpFluxo, pedaços de 64 KB", medir_segundos([&] {
+        RabinKarpFluxo fluxo(padroes);
+        for (std::size_t i = 0; i < n; i += TAMANHO_PEDACO) fluxo.alimentar(std::string_view(texto).substr(i, TAMANHO_PEDACO), em_pedacos);
+    }), n);
+    ok = ok && em_pedacos == multiplo;
+
+    if (!ok) {
+        std::printf("ERRO: as buscas encontraram ocorrências diferentes\n");
+        return 1;
+    }
+    return 0;
+}
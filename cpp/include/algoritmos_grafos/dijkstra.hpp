@@ -25,7 +25,8 @@ using GrafoPonderado = std::vector<std::vector<ArestaPonderada>>;
  * ele "relaxa" a aresta, ou seja, verifica se o caminho para `v` através de `u` é mais
  * curto do que o caminho conhecido anteriormente para `v`.
  *
- * Esta implementação utiliza uma fila de prioridade (min-heap) para obter uma performance eficiente.
+ * Esta implementação utiliza um heap 4-ário indexado (`HeapIndexado`) com decrease-key, de modo
+ * que cada vértice ocupa no máximo uma posição na fila.
  *
  * @warning O algoritmo de Dijkstra só funciona corretamente para grafos com **pesos de aresta não-negativos**.
  *
@@ -38,7 +39,7 @@ using GrafoPonderado = std::vector<std::vector<ArestaPonderada>>;
  *
  * @complexity
  * - Time: O(E log V), onde E é o número de arestas e V é o número de vértices.
- * - Space: O(V + E), para armazenar o grafo, o vetor de distâncias e a fila de prioridade.
+ * - Space: O(V + E), para armazenar o grafo; o vetor de distâncias e o heap ocupam O(V).
  */
 std::vector<long long> dijkstra(const GrafoPonderado& grafo, int origem);
 
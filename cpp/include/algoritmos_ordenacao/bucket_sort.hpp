@@ -0,0 +1,406 @@
+#ifndef BUCKET_SORT_HPP
+#define BUCKET_SORT_HPP
+
+#include "algoritmos_ordenacao/counting_sort.hpp"
+#include "algoritmos_ordenacao/quicksort.hpp"
+#include <algorithm>
+#include <atomic>
+#include <barrier>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @file bucket_sort.hpp
+ * @brief Contém a implementação do Bucket Sort para `float` e `double` (pensado para chaves
+ * distribuídas de forma aproximadamente uniforme): sequencial, com partição in-place "American
+ * flag" e número de baldes adaptado ao tamanho de cada intervalo, e paralelo, com a distribuição
+ * in-place em blocos do IPS⁴o (In-place Parallel Super Scalar Samplesort).
+ *
+ * @note Como estas são funções de template, toda a implementação está neste arquivo de cabeçalho.
+ */
+
+// Número médio de elementos por balde que o número de baldes busca: baldes desse tamanho cabem
+// nas redes de ordenação de rede_ordenacao.hpp.
+constexpr std::size_t BUCKET_SORT_ELEMENTOS_POR_BALDE = 32;
+// Mais baldes que isso espalham as escritas da partição por linhas de cache demais.
+constexpr std::size_t BUCKET_SORT_MAXIMO_BALDES = 4096;
+// Intervalos até este tamanho vão para o quicksort (que usa as redes nos pedaços pequenos).
+constexpr std::size_t BUCKET_SORT_LIMIAR_QUICKSORT = 256;
+// Níveis de recursão antes de desistir de distribuições muito distorcidas e usar o quicksort.
+constexpr int BUCKET_SORT_PROFUNDIDADE_MAXIMA = 6;
+// Baldes da distribuição paralela e tamanho, em bytes, dos blocos que ela move.
+constexpr std::size_t BUCKET_SORT_BALDES_PARALELO = 256;
+constexpr std::size_t BUCKET_SORT_BYTES_BLOCO = 2048;
+
+/**
+ * @struct ClassificadorBaldes
+ * @brief Leva x em [minimo, maximo] ao balde floor((x - minimo) * baldes / (maximo - minimo)),
+ * limitado ao último (o próprio máximo, e arredondamentos para cima).
+ */
+template <typename T>
+struct ClassificadorBaldes {
+    T minimo;
+    T escala;
+    std::size_t ultimo;
+
+    std::size_t operator()(T x) const { return std::min(static_cast<std::size_t>((x - minimo) * escala), ultimo); }
+};
+
+/**
+ * @brief Monta o classificador de `baldes` baldes para [minimo, maximo]. Retorna false se a
+ * divisão não for representável (intervalo infinito ou pequeno demais), caso em que os elementos
+ * devem ser ordenados por comparação.
+ */
+template <typename T>
+bool montar_classificador(T minimo, T maximo, std::size_t baldes, ClassificadorBaldes<T>& classificador) {
+    const T largura = maximo - minimo;
+    const T escala = static_cast<T>(baldes) / largura;
+    if (!std::isfinite(largura) || !std::isfinite(escala)) return false;
+    classificador = {minimo, escala, baldes - 1};
+    return true;
+}
+
+/**
+ * @brief Verifica, antes de qualquer ordenação, que [a, a + n) não tem NaN: um NaN não tem lugar
+ * numa ordem e quebraria a ordem fraca estrita que o quicksort dos pedaços pequenos exige.
+ * @throws std::invalid_argument se houver um NaN.
+ */
+template <typename T>
+void verificar_sem_nan(const T* a, std::size_t n) {
+    bool nan = false;
+    for (std::size_t i = 0; i < n; ++i) {
+        nan |= a[i] != a[i]; // Sem desvio, para que o laço seja vetorizado
+    }
+    if (nan) throw std::invalid_argument("O bucket sort não ordena NaN.");
+}
+
+/**
+ * @brief Mínimo e máximo de [a, a + n), n > 0, sem NaN.
+ */
+template <typename T>
+std::pair<T, T> extremos(const T* a, std::size_t n) {
+    T minimo = a[0], maximo = a[0];
+    for (std::size_t i = 0; i < n; ++i) {
+        minimo = std::min(minimo, a[i]);
+        maximo = std::max(maximo, a[i]);
+    }
+    return {minimo, maximo};
+}
+
+/**
+ * @brief Partição "American flag": leva cada elemento de [a, a + n) ao seu balde sem área
+ * auxiliar. `limites[b]` é o início do balde b na saída e `limites[baldes]` == n.
+ *
+ * Cada elemento fora do lugar é retirado e colocado na próxima posição livre do seu balde, de onde
+ * sai o elemento seguinte a ser colocado, até o ciclo voltar ao balde de partida.
+ */
+template <typename T, typename Classificador>
+void particionar_bandeira_americana(T* a, const Classificador& balde, const std::vector<std::size_t>& limites) {
+    const std::size_t baldes = limites.size() - 1;
+    std::vector<std::size_t> proximo(limites.begin(), limites.end() - 1);
+    for (std::size_t b = 0; b < baldes; ++b) {
+        while (proximo[b] < limites[b + 1]) {
+            T x = a[proximo[b]];
+            std::size_t destino = balde(x);
+            while (destino != b) {
+                std::swap(x, a[proximo[destino]++]);
+                destino = balde(x);
+            }
+            a[proximo[b]++] = x;
+        }
+    }
+}
+
+/**
+ * @brief Núcleo sequencial: distribui [a, a + n) em cerca de n / BUCKET_SORT_ELEMENTOS_POR_BALDE
+ * baldes de mesma largura entre o mínimo e o máximo do intervalo e ordena cada balde da mesma
+ * forma, com o mínimo e o máximo dele. Como cada nível se ajusta à faixa dos seus elementos,
+ * distribuições distorcidas só custam níveis a mais, até BUCKET_SORT_PROFUNDIDADE_MAXIMA.
+ */
+template <typename T>
+void bucket_sort_recursivo(T* a, std::size_t n, int profundidade) {
+    std::less<> comp;
+    if (n <= BUCKET_SORT_LIMIAR_QUICKSORT || profundidade == 0) {
+        quicksort(a, a + n, comp);
+        return;
+    }
+    auto [minimo, maximo] = extremos(a, n);
+    if (!(minimo < maximo)) return; // Todos iguais (ou só zeros de sinais diferentes)
+
+    const std::size_t baldes = std::clamp(n / BUCKET_SORT_ELEMENTOS_POR_BALDE, std::size_t(2), BUCKET_SORT_MAXIMO_BALDES);
+    ClassificadorBaldes<T> balde;
+    if (!montar_classificador(minimo, maximo, baldes, balde)) {
+        quicksort(a, a + n, comp);
+        return;
+    }
+    std::vector<std::size_t> limites(baldes + 1, 0);
+    for (std::size_t i = 0; i < n; ++i) ++limites[balde(a[i]) + 1];
+    for (std::size_t b = 0; b < baldes; ++b) limites[b + 1] += limites[b];
+    particionar_bandeira_americana(a, balde, limites);
+    for (std::size_t b = 0; b < baldes; ++b) {
+        bucket_sort_recursivo(a + limites[b], limites[b + 1] - limites[b], profundidade - 1);
+    }
+}
+
+/**
+ * @brief Núcleo paralelo, no estilo do IPS⁴o: distribui [a, a + n) em BUCKET_SORT_BALDES_PARALELO
+ * baldes com O(p k B) de memória extra (k baldes, blocos de B elementos) e ordena os baldes.
+ *
+ * 1. Classificação local: cada thread percorre a sua faixa (alinhada a blocos) e acumula cada
+ *    elemento no buffer do seu balde; um buffer cheio é escrito de volta, como um bloco, no início
+ *    da própria faixa, que a leitura já liberou.
+ * 2. Permutação de blocos: cada balde recebe as posições de bloco a partir do seu início
+ *    arredondado para cima, e os blocos são trocados até cada um estar na faixa do seu balde. É a
+ *    única etapa sequencial; ela move blocos inteiros, n / B cópias de B elementos.
+ * 3. Limpeza: as pontas de cada balde que não formam um bloco inteiro recebem os restos dos
+ *    buffers e a parte do último bloco do balde anterior que invadiu o seguinte (guardada antes
+ *    de qualquer escrita). Um bloco que passaria do fim do vetor fica num buffer de transbordo.
+ * 4. Os baldes pequenos são ordenados em paralelo, cada um por uma thread, com
+ *    `bucket_sort_recursivo`; os que têm mais de n / p elementos voltam a este núcleo com todas as
+ *    threads.
+ */
+template <typename T>
+void bucket_sort_paralelo_intervalo(T* a, std::size_t n, unsigned num_threads, int profundidade) {
+    // Abaixo disso por thread, dividir o trabalho custa mais do que rende.
+    constexpr std::size_t MINIMO_POR_THREAD = std::size_t(1) << 16;
+    constexpr std::size_t B = std::max<std::size_t>(1, BUCKET_SORT_BYTES_BLOCO / sizeof(T));
+    constexpr std::uint32_t VAZIO = std::numeric_limits<std::uint32_t>::max();
+
+    num_threads = static_cast<unsigned>(std::clamp<std::size_t>(n / MINIMO_POR_THREAD, 1, num_threads));
+    if (num_threads == 1 || profundidade == 0) {
+        bucket_sort_recursivo(a, n, profundidade);
+        return;
+    }
+
+    const std::size_t baldes = std::clamp(n / BUCKET_SORT_ELEMENTOS_POR_BALDE, std::size_t(2), BUCKET_SORT_BALDES_PARALELO);
+    const std::size_t blocos = n / B; // Posições de bloco inteiras; a de índice `blocos` é o transbordo.
+    std::vector<std::size_t> faixas(num_threads + 1);
+    for (unsigned t = 0; t < num_threads; ++t) faixas[t] = B * (blocos * t / num_threads);
+    faixas[num_threads] = n;
+
+    std::vector<std::pair<T, T>> extremos_por_thread(num_threads);
+    ClassificadorBaldes<T> balde;
+    bool por_comparacao = false, todos_iguais = false;
+
+    std::vector<std::vector<T>> buffers(num_threads, std::vector<T>(baldes * B));
+    HistogramasPorThread ocupados(num_threads, baldes); // Elementos em cada buffer
+    HistogramasPorThread completos(num_threads, baldes); // Blocos escritos por cada thread
+    std::vector<std::uint32_t> rotulos(blocos + 1, VAZIO);
+    std::vector<T> transbordo(B), em_maos(B);
+    std::vector<std::size_t> limites(baldes + 1), primeiro_bloco(baldes + 1), fim_blocos(baldes);
+    std::vector<std::size_t> fora_do_lugar(blocos + 1), inicio_fora(baldes + 1), cursor(baldes), buraco(baldes);
+    std::vector<T> invasores(baldes * B);
+    std::vector<std::size_t> quantos_invasores(baldes);
+    std::atomic<std::size_t> proximo_balde{0};
+
+    auto posicao = [&](std::size_t bloco) { return bloco == blocos ? transbordo.data() : a + bloco * B; };
+
+    // Etapa 2, feita por uma thread só entre a classificação e a limpeza.
+    auto permutar_blocos = [&]() noexcept {
+        std::size_t soma = 0;
+        for (std::size_t b = 0; b < baldes; ++b) {
+            limites[b] = soma;
+            std::size_t meus_blocos = 0;
+            for (unsigned t = 0; t < num_threads; ++t) {
+                meus_blocos += completos[t][b];
+                soma += completos[t][b] * B + ocupados[t][b];
+            }
+            primeiro_bloco[b] = (limites[b] + B - 1) / B;
+            fim_blocos[b] = primeiro_bloco[b] + meus_blocos;
+        }
+        limites[baldes] = n;
+
+        // Blocos fora da faixa do seu balde, agrupados por balde (como no counting sort).
+        std::fill(inicio_fora.begin(), inicio_fora.end(), 0);
+        auto fora = [&](std::size_t s) {
+            return rotulos[s] != VAZIO && (s < primeiro_bloco[rotulos[s]] || s >= fim_blocos[rotulos[s]]);
+        };
+        for (std::size_t s = 0; s < blocos; ++s) {
+            if (fora(s)) ++inicio_fora[rotulos[s] + 1];
+        }
+        for (std::size_t b = 0; b < baldes; ++b) inicio_fora[b + 1] += inicio_fora[b];
+        std::copy(inicio_fora.begin(), inicio_fora.end() - 1, cursor.begin());
+        for (std::size_t s = 0; s < blocos; ++s) {
+            if (fora(s)) fora_do_lugar[cursor[rotulos[s]]++] = s;
+        }
+
+        // Cada buraco (posição sem um bloco do próprio balde) da faixa de b é preenchido: um bloco
+        // alheio é levado, em cadeia, para um buraco da faixa do seu balde; depois, um bloco de b
+        // que estava fora do lugar é trazido.
+        std::copy(primeiro_bloco.begin(), primeiro_bloco.end() - 1, buraco.begin());
+        auto proximo_buraco = [&](std::size_t c) {
+            while (rotulos[buraco[c]] == c) ++buraco[c];
+            return buraco[c]++;
+        };
+        for (std::size_t b = 0; b < baldes; ++b) {
+            while (true) {
+                while (buraco[b] < fim_blocos[b] && rotulos[buraco[b]] == b) ++buraco[b];
+                if (buraco[b] == fim_blocos[b]) break;
+                const std::size_t s = buraco[b];
+                if (rotulos[s] != VAZIO) {
+                    std::uint32_t c = rotulos[s];
+                    std::copy(posicao(s), posicao(s) + B, em_maos.data());
+                    rotulos[s] = VAZIO;
+                    while (true) {
+                        const std::size_t destino = proximo_buraco(c);
+                        const std::uint32_t desalojado = rotulos[destino];
+                        if (desalojado == VAZIO) {
+                            std::copy(em_maos.begin(), em_maos.end(), posicao(destino));
+                        } else {
+                            std::swap_ranges(em_maos.begin(), em_maos.end(), posicao(destino));
+                        }
+                        rotulos[destino] = c;
+                        if (desalojado == VAZIO) break;
+                        c = desalojado;
+                    }
+                    continue;
+                }
+                // Fora da faixa, só há blocos nas posições originais; os já movidos são pulados.
+                std::size_t origem;
+                do {
+                    origem = fora_do_lugar[--cursor[b]];
+                } while (rotulos[origem] != b);
+                std::copy(posicao(origem), posicao(origem) + B, posicao(s));
+                rotulos[origem] = VAZIO;
+                rotulos[s] = static_cast<std::uint32_t>(b);
+                ++buraco[b];
+            }
+        }
+        // O bloco de transbordo começa dentro do vetor: a parte que cabe vai para o lugar, e o
+        // resto é lido do transbordo na limpeza.
+        if (rotulos[blocos] != VAZIO) std::copy(transbordo.begin(), transbordo.begin() + (n - blocos * B), a + blocos * B);
+    };
+
+    std::barrier sincronizar_extremos(static_cast<std::ptrdiff_t>(num_threads), [&]() noexcept {
+        T minimo = extremos_por_thread[0].first, maximo = extremos_por_thread[0].second;
+        for (unsigned t = 0; t < num_threads; ++t) {
+            minimo = std::min(minimo, extremos_por_thread[t].first);
+            maximo = std::max(maximo, extremos_por_thread[t].second);
+        }
+        todos_iguais = !(minimo < maximo);
+        por_comparacao = !todos_iguais && !montar_classificador(minimo, maximo, baldes, balde);
+    });
+    std::barrier sincronizar_permutacao(static_cast<std::ptrdiff_t>(num_threads), permutar_blocos);
+    std::barrier sincronizar(static_cast<std::ptrdiff_t>(num_threads));
+
+    auto trabalhar = [&](unsigned id) {
+        const std::size_t inicio = faixas[id], fim = faixas[id + 1];
+        extremos_por_thread[id] = extremos(a + inicio, fim - inicio);
+        sincronizar_extremos.arrive_and_wait();
+        if (todos_iguais || por_comparacao) return;
+
+        // 1. Classificação local.
+        T* buffer = buffers[id].data();
+        std::size_t* ocupado = ocupados[id];
+        std::size_t* escritos = completos[id];
+        std::size_t escrita = inicio;
+        for (std::size_t i = inicio; i < fim; ++i) {
+            const std::size_t b = balde(a[i]);
+            buffer[b * B + ocupado[b]++] = a[i];
+            if (ocupado[b] == B) {
+                std::copy(buffer + b * B, buffer + (b + 1) * B, a + escrita);
+                rotulos[escrita / B] = static_cast<std::uint32_t>(b);
+                escrita += B;
+                ++escritos[b];
+                ocupado[b] = 0;
+            }
+        }
+        sincronizar_permutacao.arrive_and_wait();
+
+        // 3. Limpeza: primeiro todos guardam o que o último bloco de cada balde invadiu do
+        // seguinte (ou do transbordo), depois preenchem as pontas.
+        for (std::size_t b = id; b < baldes; b += num_threads) {
+            const std::size_t de = std::max(limites[b + 1], primeiro_bloco[b] * B), ate = fim_blocos[b] * B;
+            for (std::size_t i = de; i < ate; ++i) {
+                invasores[b * B + quantos_invasores[b]++] = i < blocos * B ? a[i] : transbordo[i - blocos * B];
+            }
+        }
+        sincronizar.arrive_and_wait();
+        for (std::size_t b = id; b < baldes; b += num_threads) {
+            const std::size_t comeco = limites[b], final = limites[b + 1];
+            const std::size_t blocos_inicio = std::min(primeiro_bloco[b] * B, final);
+            const std::size_t blocos_fim = std::max(std::min(fim_blocos[b] * B, final), blocos_inicio);
+            // Posições livres: [comeco, blocos_inicio) e [blocos_fim, final).
+            std::size_t livre = comeco;
+            auto colocar = [&](const T& x) {
+                if (livre == blocos_inicio) livre = blocos_fim;
+                a[livre++] = x;
+            };
+            for (std::size_t j = 0; j < quantos_invasores[b]; ++j) colocar(invasores[b * B + j]);
+            for (unsigned t = 0; t < num_threads; ++t) {
+                const T* resto = buffers[t].data() + b * B;
+                for (std::size_t j = 0; j < ocupados[t][b]; ++j) colocar(resto[j]);
+            }
+        }
+        sincronizar.arrive_and_wait();
+
+        // 4. Os baldes pequenos, distribuídos dinamicamente entre as threads.
+        for (std::size_t b = proximo_balde++; b < baldes; b = proximo_balde++) {
+            const std::size_t tamanho = limites[b + 1] - limites[b];
+            if (tamanho <= n / num_threads) bucket_sort_recursivo(a + limites[b], tamanho, profundidade - 1);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (unsigned id = 1; id < num_threads; ++id) threads.emplace_back(trabalhar, id);
+    trabalhar(0);
+    for (auto& t : threads) t.join();
+
+    if (todos_iguais) return;
+    if (por_comparacao) {
+        std::less<> comp;
+        quicksort(a, a + n, comp);
+        return;
+    }
+    for (std::size_t b = 0; b < baldes; ++b) {
+        const std::size_t tamanho = limites[b + 1] - limites[b];
+        if (tamanho > n / num_threads) bucket_sort_paralelo_intervalo(a + limites[b], tamanho, num_threads, profundidade - 1);
+    }
+}
+
+/**
+ * @brief Ordena um vetor de `float` ou `double` com Bucket Sort.
+ *
+ * Os baldes têm a mesma largura entre o mínimo e o máximo; a partição é in-place ("American
+ * flag") e cada balde é ordenado recursivamente com a sua própria faixa, ou pelo quicksort quando
+ * pequeno. Não é estável (e -0.0 e +0.0 caem no mesmo balde, em qualquer ordem).
+ *
+ * @param v O vetor a ser ordenado.
+ * @throws std::invalid_argument se houver NaN.
+ *
+ * @complexity
+ * - Time: O(n) esperado para chaves uniformes; O(n log n) no pior caso (distribuições distorcidas
+ *   terminam no quicksort depois de BUCKET_SORT_PROFUNDIDADE_MAXIMA níveis).
+ * - Space: O(n / BUCKET_SORT_ELEMENTOS_POR_BALDE) por nível de recursão.
+ */
+template <typename T>
+void bucket_sort(std::vector<T>& v) {
+    static_assert(std::is_floating_point_v<T>, "O bucket sort ordena apenas float e double.");
+    verificar_sem_nan(v.data(), v.size());
+    bucket_sort_recursivo(v.data(), v.size(), BUCKET_SORT_PROFUNDIDADE_MAXIMA);
+}
+
+/**
+ * @brief Versão de `bucket_sort` com várias threads e distribuição in-place em blocos (IPS⁴o).
+ * @param num_threads Número de threads; 0 usa `std::thread::hardware_concurrency()`. Vetores
+ * pequenos demais para dividir são ordenados na thread chamadora.
+ * @throws std::invalid_argument se houver NaN.
+ * @complexity Time: O(n / p + n / B) esperado para chaves uniformes; Space: O(p k B + n / B)
+ */
+template <typename T>
+void bucket_sort_paralelo(std::vector<T>& v, unsigned num_threads = 0) {
+    static_assert(std::is_floating_point_v<T>, "O bucket sort ordena apenas float e double.");
+    verificar_sem_nan(v.data(), v.size());
+    if (num_threads == 0) num_threads = std::max(1u, std::thread::hardware_concurrency());
+    bucket_sort_paralelo_intervalo(v.data(), v.size(), num_threads, BUCKET_SORT_PROFUNDIDADE_MAXIMA);
+}
+
+#endif // BUCKET_SORT_HPP
@@ -0,0 +1,239 @@
+#ifndef COUNTING_SORT_HPP
+#define COUNTING_SORT_HPP
+
+#include "algoritmos_ordenacao/radix_sort.hpp"
+#include <algorithm>
+#include <barrier>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @file counting_sort.hpp
+ * @brief Contém a implementação do Counting Sort (ordenação por contagem) para chaves inteiras
+ * de faixa pequena (códigos de status, ids de shard...), sequencial e com várias threads, com
+ * variantes para registros ordenados por uma chave e para pares chave-valor em vetores separados.
+ *
+ * @note Como estas são funções de template, toda a implementação está neste arquivo de cabeçalho.
+ */
+
+// Maior número de chaves distintas possíveis (máximo - mínimo + 1) aceito: 2^24 contadores por
+// thread já ocupam 128 MB. Para faixas maiores, use radix_sort.
+constexpr std::size_t COUNTING_SORT_FAIXA_MAXIMA = std::size_t(1) << 24;
+
+/**
+ * @class HistogramasPorThread
+ * @brief Um histograma de `baldes` contadores para cada thread, numa única alocação em que cada
+ * histograma começa numa linha de cache própria: threads diferentes nunca escrevem na mesma
+ * linha (sem falso compartilhamento), mesmo com poucos baldes.
+ */
+class HistogramasPorThread {
+public:
+    HistogramasPorThread(unsigned num_threads, std::size_t baldes)
+        : linhas_por_thread((baldes + CONTADORES_POR_LINHA - 1) / CONTADORES_POR_LINHA),
+          linhas(new Linha[num_threads * linhas_por_thread]()) {}
+
+    std::size_t* operator[](unsigned thread) { return linhas[thread * linhas_por_thread].contadores; }
+
+private:
+    static constexpr std::size_t CONTADORES_POR_LINHA = 64 / sizeof(std::size_t);
+    struct alignas(64) Linha {
+        std::size_t contadores[CONTADORES_POR_LINHA];
+    };
+
+    std::size_t linhas_por_thread;
+    std::unique_ptr<Linha[]> linhas;
+};
+
+/**
+ * @brief Núcleo: ordena `dados` de forma estável pela chave inteira `chave(elemento)`.
+ *
+ * 1. Cada thread acha o mínimo e o máximo do seu bloco contíguo e conta as chaves dele no seu
+ *    histograma.
+ * 2. A soma de prefixos sobre (chave, thread) é dividida entre as threads por faixas de chaves e
+ *    transforma cada contador na posição em que aquela thread escreve aquela chave.
+ * 3. Com `SoChaves` (o elemento é a própria chave, sem carga), não há o que mover: cada thread
+ *    reescreve uma fatia da saída a partir das contagens. Senão, cada thread espalha o seu bloco
+ *    numa área auxiliar, o que preserva a estabilidade, e a área é copiada de volta em paralelo.
+ *
+ * @throws std::invalid_argument se a faixa de chaves passar de COUNTING_SORT_FAIXA_MAXIMA.
+ */
+template <bool SoChaves, typename Elemento, typename Extrator, typename Carga = SemCarga>
+void counting_sort_nucleo(Elemento* dados, std::size_t n, Extrator chave, unsigned num_threads, Carga* carga = nullptr) {
+    using Chave = std::decay_t<decltype(chave(*dados))>;
+    static_assert(std::is_integral_v<Chave>, "O counting sort ordena apenas chaves inteiras.");
+    using Bits = typename ChaveRadix<Chave>::Bits;
+    constexpr bool COM_CARGA = !std::is_same_v<Carga, SemCarga>;
+    // Abaixo disso por thread, dividir o trabalho custa mais do que rende.
+    constexpr std::size_t MINIMO_POR_THREAD = std::size_t(1) << 16;
+
+    if (n < 2) return;
+    if (num_threads == 0) num_threads = std::max(1u, std::thread::hardware_concurrency());
+    num_threads = static_cast<unsigned>(std::clamp<std::size_t>(n / MINIMO_POR_THREAD, 1, num_threads));
+
+    // As chaves são comparadas e subtraídas já convertidas para sem sinal, na ordem de ChaveRadix.
+    auto codigo = [&](const Elemento& e) { return ChaveRadix<Chave>::codificar(chave(e)); };
+    std::vector<std::pair<Bits, Bits>> extremos(num_threads);
+    std::unique_ptr<HistogramasPorThread> histogramas;
+    std::unique_ptr<Elemento[]> aux;
+    std::unique_ptr<Carga[]> carga_aux;
+    Bits minimo = 0;
+    std::size_t faixa = 0;
+    bool faixa_grande = false;
+    std::exception_ptr erro;
+    std::vector<std::size_t> somas(num_threads);
+
+    // Decide a faixa e aloca os histogramas uma vez, quando todas as threads acharam os extremos.
+    std::barrier sincronizar_extremos(static_cast<std::ptrdiff_t>(num_threads), [&]() noexcept {
+        minimo = extremos[0].first;
+        Bits maximo = extremos[0].second;
+        for (const auto& [menor, maior] : extremos) {
+            minimo = std::min(minimo, menor);
+            maximo = std::max(maximo, maior);
+        }
+        faixa_grande = static_cast<std::size_t>(static_cast<Bits>(maximo - minimo)) >= COUNTING_SORT_FAIXA_MAXIMA;
+        if (faixa_grande) return;
+        faixa = static_cast<std::size_t>(static_cast<Bits>(maximo - minimo)) + 1;
+        try {
+            histogramas = std::make_unique<HistogramasPorThread>(num_threads, faixa);
+            if constexpr (!SoChaves) aux = std::make_unique_for_overwrite<Elemento[]>(n);
+            if constexpr (COM_CARGA) carga_aux = std::make_unique_for_overwrite<Carga[]>(n);
+        } catch (...) {
+            erro = std::current_exception();
+        }
+    });
+    std::barrier sincronizar(static_cast<std::ptrdiff_t>(num_threads));
+
+    auto trabalhar = [&](unsigned id) {
+        const std::size_t inicio = n * id / num_threads, fim = n * (id + 1) / num_threads;
+        Bits menor = codigo(dados[inicio]), maior = menor;
+        for (std::size_t i = inicio + 1; i < fim; ++i) {
+            Bits k = codigo(dados[i]);
+            menor = std::min(menor, k);
+            maior = std::max(maior, k);
+        }
+        extremos[id] = {menor, maior};
+        sincronizar_extremos.arrive_and_wait();
+        if (faixa_grande || erro) return;
+
+        std::size_t* minha = (*histogramas)[id];
+        for (std::size_t i = inicio; i < fim; ++i) ++minha[codigo(dados[i]) - minimo];
+        sincronizar.arrive_and_wait();
+
+        // Soma de prefixos: cada thread fica com uma faixa de chaves e, dentro de cada chave,
+        // percorre as threads em ordem, o que mantém a ordem original entre chaves iguais.
+        const std::size_t primeira_chave = faixa * id / num_threads, ultima_chave = faixa * (id + 1) / num_threads;
+        std::size_t soma = 0;
+        for (std::size_t b = primeira_chave; b < ultima_chave; ++b) {
+            for (unsigned t = 0; t < num_threads; ++t) soma += (*histogramas)[t][b];
+        }
+        somas[id] = soma;
+        sincronizar.arrive_and_wait();
+        std::size_t posicao = 0;
+        for (unsigned t = 0; t < id; ++t) posicao += somas[t];
+        for (std::size_t b = primeira_chave; b < ultima_chave; ++b) {
+            for (unsigned t = 0; t < num_threads; ++t) posicao += std::exchange((*histogramas)[t][b], posicao);
+        }
+        sincronizar.arrive_and_wait();
+
+        if constexpr (SoChaves) {
+            // O histograma da thread 0 agora tem o início de cada chave na saída: a primeira
+            // chave da fatia desta thread é a última que começa até o início da fatia.
+            const std::size_t* comecos = (*histogramas)[0];
+            const Bits sinal = ChaveRadix<Chave>::codificar(Chave(0)); // Desfaz a codificação.
+            std::size_t b = static_cast<std::size_t>(std::upper_bound(comecos, comecos + faixa, inicio) - comecos) - 1;
+            for (std::size_t i = inicio; i < fim; ++b) {
+                const std::size_t ate = std::min(fim, b + 1 < faixa ? comecos[b + 1] : n);
+                std::fill(dados + i, dados + ate, static_cast<Elemento>(static_cast<Bits>(static_cast<Bits>(minimo + b) ^ sinal)));
+                i = ate;
+            }
+        } else {
+            for (std::size_t i = inicio; i < fim; ++i) {
+                const std::size_t destino = minha[codigo(dados[i]) - minimo]++;
+                aux[destino] = std::move(dados[i]);
+                if constexpr (COM_CARGA) carga_aux[destino] = std::move(carga[i]);
+            }
+            sincronizar.arrive_and_wait();
+            std::move(aux.get() + inicio, aux.get() + fim, dados + inicio);
+            if constexpr (COM_CARGA) std::move(carga_aux.get() + inicio, carga_aux.get() + fim, carga + inicio);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (unsigned id = 1; id < num_threads; ++id) threads.emplace_back(trabalhar, id);
+    trabalhar(0);
+    for (auto& t : threads) t.join();
+    if (erro) std::rethrow_exception(erro);
+    if (faixa_grande) {
+        throw std::invalid_argument("A faixa de chaves é grande demais para o counting sort; use radix_sort.");
+    }
+}
+
+/**
+ * @brief Ordena um vetor de inteiros por contagem.
+ *
+ * Como elementos iguais são indistinguíveis, nada é movido: depois da contagem, o vetor é
+ * reescrito com cada chave repetida tantas vezes quantas apareceu.
+ *
+ * @param v O vetor a ser ordenado.
+ * @throws std::invalid_argument se máximo - mínimo + 1 passar de COUNTING_SORT_FAIXA_MAXIMA.
+ *
+ * @complexity
+ * - Time: O(n + k), onde k = máximo - mínimo + 1.
+ * - Space: O(k)
+ */
+template <typename T>
+void counting_sort(std::vector<T>& v) {
+    counting_sort_nucleo<true>(v.data(), v.size(), [](const T& x) { return x; }, 1);
+}
+
+/**
+ * @brief Ordena registros de forma estável pela chave inteira que `chave(registro)` retorna.
+ * @throws std::invalid_argument se a faixa de chaves passar de COUNTING_SORT_FAIXA_MAXIMA.
+ * @complexity Time: O(n + k); Space: O(n + k)
+ */
+template <typename T, typename Extrator>
+void counting_sort_por_chave(std::vector<T>& v, Extrator chave) {
+    counting_sort_nucleo<false>(v.data(), v.size(), chave, 1);
+}
+
+/**
+ * @brief Ordena `chaves` e aplica a mesma permutação, de forma estável, a `valores`.
+ * @throws std::invalid_argument se os vetores tiverem tamanhos diferentes ou se a faixa de chaves
+ * passar de COUNTING_SORT_FAIXA_MAXIMA.
+ * @complexity Time: O(n + k); Space: O(n + k)
+ */
+template <typename K, typename V>
+void counting_sort_com_valores(std::vector<K>& chaves, std::vector<V>& valores, unsigned num_threads = 1) {
+    if (chaves.size() != valores.size()) {
+        throw std::invalid_argument("Os vetores de chaves e de valores devem ter o mesmo tamanho.");
+    }
+    counting_sort_nucleo<false>(chaves.data(), chaves.size(), [](const K& x) { return x; }, num_threads, valores.data());
+}
+
+/**
+ * @brief Versão de `counting_sort` com várias threads.
+ * @param num_threads Número de threads; 0 usa `std::thread::hardware_concurrency()`. Vetores
+ * pequenos demais para dividir são ordenados na thread chamadora.
+ * @complexity Time: O(n / p + k); Space: O(p k)
+ */
+template <typename T>
+void counting_sort_paralelo(std::vector<T>& v, unsigned num_threads = 0) {
+    counting_sort_nucleo<true>(v.data(), v.size(), [](const T& x) { return x; }, num_threads);
+}
+
+/**
+ * @brief Versão de `counting_sort_por_chave` com várias threads.
+ */
+template <typename T, typename Extrator>
+void counting_sort_paralelo_por_chave(std::vector<T>& v, Extrator chave, unsigned num_threads = 0) {
+    counting_sort_nucleo<false>(v.data(), v.size(), chave, num_threads);
+}
+
+#endif // COUNTING_SORT_HPP
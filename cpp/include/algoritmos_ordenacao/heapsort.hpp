@@ -0,0 +1,285 @@
+#ifndef HEAPSORT_HPP
+#define HEAPSORT_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+/**
+ * @file heapsort.hpp
+ * @brief Contém a implementação do Heapsort bottom-up sobre um heap 4-ário de máximo, de uma
+ * ordenação parcial (os k menores em ordem) e de um acumulador que guarda os k maiores valores de
+ * um fluxo recebido em lotes.
+ *
+ * @note Como estas são funções de template, toda a implementação está neste arquivo de cabeçalho.
+ */
+
+// Número de filhos de cada nó. Os 4 filhos de um nó são vizinhos na memória (ocupam meia linha
+// de cache para inteiros de 64 bits), e o heap tem metade da altura de um heap binário.
+constexpr std::ptrdiff_t HEAPSORT_ARIDADE = 4;
+
+/**
+ * @brief Retorna a posição do maior dos filhos de `i` no heap [inicio, inicio + n), que deve ter
+ * pelo menos um filho. Com os 4 filhos presentes, é um torneio: duas comparações independentes e
+ * uma final, cujos resultados viram índices por aritmética, sem desvios a prever.
+ */
+template <typename Iterador, typename Comparador>
+std::ptrdiff_t heap_maior_filho(Iterador inicio, std::ptrdiff_t i, std::ptrdiff_t n, Comparador& comp) {
+    const std::ptrdiff_t primeiro = HEAPSORT_ARIDADE * i + 1;
+    if (primeiro + HEAPSORT_ARIDADE <= n) {
+#if defined(__GNUC__)
+        // Os 16 netos de i são contíguos e um grupo deles é o próximo nível da descida: pedi-los
+        // agora sobrepõe a falta de cache com as comparações deste nível.
+        if constexpr (std::contiguous_iterator<Iterador>) {
+            const std::ptrdiff_t netos = HEAPSORT_ARIDADE * primeiro + 1;
+            const std::ptrdiff_t ultimo_neto = netos + HEAPSORT_ARIDADE * HEAPSORT_ARIDADE - 1;
+            if (netos < n) __builtin_prefetch(std::to_address(inicio) + netos);
+            if (ultimo_neto < n) __builtin_prefetch(std::to_address(inicio) + ultimo_neto);
+        }
+#endif
+        const std::ptrdiff_t a = primeiro + comp(inicio[primeiro], inicio[primeiro + 1]);
+        const std::ptrdiff_t b = primeiro + 2 + comp(inicio[primeiro + 2], inicio[primeiro + 3]);
+        return a ^ ((a ^ b) & -static_cast<std::ptrdiff_t>(comp(inicio[a], inicio[b])));
+    }
+    std::ptrdiff_t maior = primeiro;
+    for (std::ptrdiff_t f = primeiro + 1; f < n; ++f) {
+        if (comp(inicio[maior], inicio[f])) maior = f;
+    }
+    return maior;
+}
+
+/**
+ * @brief Sobe `x` a partir da posição vazia `i` até a posição `topo`, descendo os ancestrais
+ * menores que ele.
+ */
+template <typename Iterador, typename T, typename Comparador>
+void heap_subir(Iterador inicio, std::ptrdiff_t i, std::ptrdiff_t topo, T x, Comparador& comp) {
+    while (i > topo) {
+        const std::ptrdiff_t pai = (i - 1) / HEAPSORT_ARIDADE;
+        if (!comp(inicio[pai], x)) break;
+        inicio[i] = std::move(inicio[pai]);
+        i = pai;
+    }
+    inicio[i] = std::move(x);
+}
+
+/**
+ * @brief Coloca `x` na posição vazia `i` do heap [inicio, inicio + n), com a descida bottom-up:
+ * o buraco desce até uma folha trazendo para cima sempre o maior filho, sem comparar com `x`, e
+ * só então `x` sobe até o seu lugar.
+ *
+ * Na fase de ordenação, `x` é o último elemento do heap, quase sempre pequeno, e o seu lugar fica
+ * perto das folhas: a subida custa uma ou duas comparações, enquanto a descida tradicional
+ * gastaria uma comparação a mais com `x` em cada nível.
+ */
+template <typename Iterador, typename T, typename Comparador>
+void heap_peneirar(Iterador inicio, std::ptrdiff_t i, std::ptrdiff_t n, T x, Comparador& comp) {
+    const std::ptrdiff_t topo = i;
+    while (HEAPSORT_ARIDADE * i + 1 < n) {
+        const std::ptrdiff_t filho = heap_maior_filho(inicio, i, n, comp);
+        inicio[i] = std::move(inicio[filho]);
+        i = filho;
+    }
+    heap_subir(inicio, i, topo, std::move(x), comp);
+}
+
+/**
+ * @brief Transforma [inicio, inicio + n) num heap de máximo (construção de Floyd, O(n)).
+ */
+template <typename Iterador, typename Comparador>
+void heap_construir(Iterador inicio, std::ptrdiff_t n, Comparador& comp) {
+    if (n < 2) return;
+    for (std::ptrdiff_t i = (n - 2) / HEAPSORT_ARIDADE + 1; i-- > 0;) {
+        heap_peneirar(inicio, i, n, std::move(inicio[i]), comp);
+    }
+}
+
+/**
+ * @brief Ordena um heap de máximo [inicio, inicio + n): a raiz vai para o fim e o último
+ * elemento é peneirado a partir da raiz.
+ */
+template <typename Iterador, typename Comparador>
+void heap_ordenar(Iterador inicio, std::ptrdiff_t n, Comparador& comp) {
+    for (std::ptrdiff_t ultimo = n - 1; ultimo > 0; --ultimo) {
+        auto x = std::move(inicio[ultimo]);
+        inicio[ultimo] = std::move(inicio[0]);
+        heap_peneirar(inicio, 0, ultimo, std::move(x), comp);
+    }
+}
+
+/**
+ * @brief Ordena o intervalo [inicio, fim) com Heapsort bottom-up num heap 4-ário.
+ *
+ * Não é estável, mas garante O(n log n) para qualquer entrada, por isso serve de rede de
+ * segurança para o quicksort quando as partições degeneram. Faz cerca de 1,5 n log2 n
+ * comparações, contra 2 n log2 n do heapsort binário tradicional, e metade dos níveis.
+ *
+ * @param inicio Iterador de acesso aleatório para o primeiro elemento.
+ * @param fim Iterador para a posição seguinte ao último elemento.
+ * @param comp Comparador "menor que".
+ *
+ * @complexity
+ * - Time: O(n log n) em todos os casos.
+ * - Space: O(1)
+ */
+template <typename Iterador, typename Comparador = std::less<>>
+void heapsort(Iterador inicio, Iterador fim, Comparador comp = {}) {
+    const std::ptrdiff_t n = fim - inicio;
+    heap_construir(inicio, n, comp);
+    heap_ordenar(inicio, n, comp);
+}
+
+/**
+ * @brief Ordena um vetor com Heapsort.
+ * @complexity Time: O(n log n); Space: O(1)
+ */
+template <typename T, typename Comparador = std::less<>>
+void heapsort(std::vector<T>& v, Comparador comp = {}) {
+    heapsort(v.begin(), v.end(), comp);
+}
+
+/**
+ * @brief Rearranja [inicio, fim) de modo que [inicio, meio) contenha, em ordem, os menores
+ * elementos do intervalo; a ordem de [meio, fim) é indefinida.
+ *
+ * Mantém um heap de máximo com os k = meio - inicio menores vistos até agora. Cada elemento do
+ * resto custa uma comparação com a raiz e, só se for menor, uma peneirada.
+ *
+ * @complexity
+ * - Time: O(n log k) no pior caso; O(n + k log k log(n / k)) em média para entradas aleatórias.
+ * - Space: O(1)
+ */
+template <typename Iterador, typename Comparador = std::less<>>
+void heapsort_parcial(Iterador inicio, Iterador meio, Iterador fim, Comparador comp = {}) {
+    const std::ptrdiff_t k = meio - inicio;
+    if (k == 0) return;
+    heap_construir(inicio, k, comp);
+    for (Iterador i = meio; i != fim; ++i) {
+        if (comp(*i, *inicio)) {
+            auto x = std::move(*i);
+            *i = std::move(*inicio);
+            heap_peneirar(inicio, 0, k, std::move(x), comp);
+        }
+    }
+    heap_ordenar(inicio, k, comp);
+}
+
+/**
+ * @brief Coloca em ordem, no início de `v`, os `k` menores elementos (segundo `comp`); com
+ * `k >= v.size()`, ordena o vetor inteiro.
+ * @complexity Time: O(n log k); Space: O(1)
+ */
+template <typename T, typename Comparador = std::less<>>
+void partial_sort(std::vector<T>& v, std::size_t k, Comparador comp = {}) {
+    heapsort_parcial(v.begin(), v.begin() + static_cast<std::ptrdiff_t>(std::min(k, v.size())), v.end(), comp);
+}
+
+/**
+ * @class AcumuladorTopK
+ * @brief Guarda os `k` maiores valores (segundo `comp`) de um fluxo recebido aos poucos, com
+ * memória O(k) independentemente do tamanho do fluxo.
+ *
+ * Os valores ficam num heap 4-ário de mínimo cuja raiz é o limiar de entrada: o menor dos k
+ * guardados. Depois que o heap enche, quase todo valor de um lote grande é descartado por uma
+ * única comparação com o limiar, num laço sem outras dependências.
+ *
+ * @tparam T Tipo dos valores.
+ * @tparam Comparador Comparador "menor que"; com `std::greater<>`, guarda os k menores.
+ */
+template <typename T, typename Comparador = std::less<>>
+class AcumuladorTopK {
+public:
+    /**
+     * @param k Quantos valores guardar; com 0, tudo é descartado.
+     * @param comp Comparador "menor que".
+     */
+    explicit AcumuladorTopK(std::size_t k, Comparador comp = {}) : k(k), maior{comp} {}
+
+    /**
+     * @brief Oferece um valor ao acumulador.
+     * @complexity Time: O(1) se descartado; O(log k) se guardado.
+     */
+    void adicionar(const T& x) {
+        if (heap.size() < k) {
+            heap.push_back(x);
+            heap_subir(heap.begin(), static_cast<std::ptrdiff_t>(heap.size()) - 1, 0, std::move(heap.back()), maior);
+        } else if (k > 0 && maior(x, heap[0])) {
+            substituir_raiz(x);
+        }
+    }
+
+    /**
+     * @brief Oferece todos os valores de [inicio, fim).
+     * @complexity Time: O(m) para m valores, mais O(log k) por valor guardado.
+     */
+    template <typename Iterador>
+    void adicionar(Iterador inicio, Iterador fim) {
+        while (inicio != fim && heap.size() < k) adicionar(*inicio++);
+        if (heap.empty()) return;
+        for (; inicio != fim; ++inicio) {
+            if (maior(*inicio, heap[0])) substituir_raiz(*inicio);
+        }
+    }
+
+    /**
+     * @brief Oferece todos os valores de um lote.
+     */
+    void adicionar(const std::vector<T>& lote) { adicionar(lote.begin(), lote.end()); }
+
+    /**
+     * @brief Retorna quantos valores estão guardados: min(k, valores oferecidos).
+     */
+    std::size_t tamanho() const { return heap.size(); }
+
+    /**
+     * @brief Retorna o limiar de entrada: o menor dos valores guardados. Enquanto o acumulador
+     * não está cheio, qualquer valor entra.
+     * @throws std::out_of_range se nenhum valor estiver guardado.
+     */
+    const T& limiar() const {
+        if (heap.empty()) throw std::out_of_range("O acumulador está vazio.");
+        return heap[0];
+    }
+
+    /**
+     * @brief Retorna os valores guardados, do maior para o menor, sem alterar o acumulador.
+     * @complexity Time: O(k log k); Space: O(k)
+     */
+    std::vector<T> resultado() const {
+        std::vector<T> ordenados = heap;
+        auto comp = maior;
+        heap_ordenar(ordenados.begin(), static_cast<std::ptrdiff_t>(ordenados.size()), comp);
+        return ordenados;
+    }
+
+private:
+    // Inverte o comparador: o heap de máximo de `maior` é um heap de mínimo de `comp`.
+    struct Inverso {
+        Comparador comp;
+        bool operator()(const T& a, const T& b) { return comp(b, a); }
+    };
+
+    void substituir_raiz(const T& x) { heap_peneirar(heap.begin(), 0, static_cast<std::ptrdiff_t>(heap.size()), x, maior); }
+
+    std::size_t k;
+    Inverso maior;
+    std::vector<T> heap;
+};
+
+/**
+ * @brief Retorna os `k` maiores elementos de `v` (segundo `comp`), do maior para o menor.
+ * @complexity Time: O(n log k); Space: O(k)
+ */
+template <typename T, typename Comparador = std::less<>>
+std::vector<T> top_k(const std::vector<T>& v, std::size_t k, Comparador comp = {}) {
+    AcumuladorTopK<T, Comparador> acumulador(k, comp);
+    acumulador.adicionar(v);
+    return acumulador.resultado();
+}
+
+#endif // HEAPSORT_HPP
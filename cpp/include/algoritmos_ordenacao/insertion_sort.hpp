@@ -0,0 +1,89 @@
+#ifndef INSERTION_SORT_HPP
+#define INSERTION_SORT_HPP
+
+#include <functional>
+#include <utility>
+#include <vector>
+
+/**
+ * @file insertion_sort.hpp
+ * @brief Contém a implementação do Insertion Sort (ordenação por inserção).
+ *
+ * @note Como estas são funções de template, toda a implementação está neste arquivo de cabeçalho.
+ */
+
+/**
+ * @brief Ordena o intervalo [inicio, fim) de forma estável por inserção.
+ *
+ * Cada elemento fora de ordem é retirado uma única vez e os maiores que ele são deslocados uma
+ * posição para a direita, em vez de trocados par a par.
+ *
+ * @param inicio Iterador de acesso aleatório para o primeiro elemento.
+ * @param fim Iterador para a posição seguinte ao último elemento.
+ * @param comp Comparador "menor que".
+ *
+ * @complexity
+ * - Time: O(n + I), onde I é o número de inversões; O(n^2) no pior caso.
+ * - Space: O(1)
+ */
+template <typename Iterador, typename Comparador = std::less<>>
+void insertion_sort(Iterador inicio, Iterador fim, Comparador comp = {}) {
+    if (inicio == fim) return;
+    for (Iterador atual = inicio + 1; atual != fim; ++atual) {
+        if (!comp(*atual, *(atual - 1))) continue;
+        auto x = std::move(*atual);
+        Iterador j = atual;
+        do {
+            *j = std::move(*(j - 1));
+            --j;
+        } while (j != inicio && comp(x, *(j - 1)));
+        *j = std::move(x);
+    }
+}
+
+/**
+ * @brief Ordena o intervalo [inicio, fim) de forma estável por inserção sem desvios dependentes
+ * dos dados.
+ *
+ * Em vez de parar ao encontrar a posição do elemento, cada inserção percorre todo o prefixo
+ * ordenado fazendo uma comparação-e-troca com seleção condicional (que o compilador transforma em
+ * cmov ou em mínimo/máximo). São sempre n(n-1)/2 comparações, mas nenhuma previsão de desvio
+ * errada, o que compensa em vetores pequenos (até uns 24 elementos) de dados aleatórios. Destinada
+ * a inteiros e comparadores baratos: com ponto flutuante o GCC mantém os desvios, e com tipos caros
+ * de copiar insertion_sort é melhor.
+ *
+ * @param inicio Iterador de acesso aleatório para o primeiro elemento.
+ * @param fim Iterador para a posição seguinte ao último elemento.
+ * @param comp Comparador "menor que".
+ *
+ * @complexity
+ * - Time: Θ(n^2)
+ * - Space: O(1)
+ */
+template <typename Iterador, typename Comparador = std::less<>>
+void insertion_sort_sem_desvios(Iterador inicio, Iterador fim, Comparador comp = {}) {
+    const auto n = fim - inicio;
+    for (decltype(fim - inicio) i = 1; i < n; ++i) {
+        // x "flutua" para a esquerda: em cada posição fica o maior entre x e o vizinho, e x segue
+        // com o menor. Só troca com vizinhos estritamente maiores, o que mantém a estabilidade.
+        auto x = inicio[i];
+        for (auto j = i; j > 0; --j) {
+            auto y = inicio[j - 1];
+            const bool menor = comp(x, y);
+            inicio[j] = menor ? y : x;
+            x = menor ? x : y;
+        }
+        inicio[0] = x;
+    }
+}
+
+/**
+ * @brief Ordena um vetor por inserção.
+ * @complexity Time: O(n^2) no pior caso, O(n) se já estiver ordenado; Space: O(1)
+ */
+template <typename T, typename Comparador = std::less<>>
+void insertion_sort(std::vector<T>& v, Comparador comp = {}) {
+    insertion_sort(v.begin(), v.end(), comp);
+}
+
+#endif // INSERTION_SORT_HPP
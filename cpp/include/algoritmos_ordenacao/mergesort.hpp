@@ -0,0 +1,569 @@
+#ifndef MERGESORT_HPP
+#define MERGESORT_HPP
+
+#include "algoritmos_ordenacao/rede_ordenacao.hpp"
+#include <algorithm>
+#include <barrier>
+#include <bit>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @file mergesort.hpp
+ * @brief Contém a implementação do Mergesort estável: sequencial, paralelo (blocos ordenados por
+ * thread e intercalação de várias vias com árvore de perdedores) e externo, para arquivos maiores
+ * que a memória.
+ *
+ * @note Como estas são funções de template, toda a implementação está neste arquivo de cabeçalho.
+ */
+
+// Abaixo deste tamanho, os trechos são ordenados por inserção.
+constexpr std::ptrdiff_t MERGESORT_LIMIAR_INSERCAO = 32;
+// Com inteiros que as redes de ordenação aceitam, os trechos de até este tamanho vão para elas.
+constexpr std::ptrdiff_t MERGESORT_LIMIAR_REDE = 64;
+
+/**
+ * @brief Núcleo sequencial: ordena [inicio, fim) de forma estável usando `buffer` (com espaço para
+ * metade do intervalo, arredondada para cima) como área de trabalho.
+ *
+ * Só a metade esquerda é copiada para o buffer antes de cada intercalação; a escrita nunca
+ * ultrapassa a leitura da metade direita, então o resultado pode ir direto para o lugar. Se as
+ * metades já estiverem em ordem, a intercalação é pulada, o que torna entradas ordenadas O(n).
+ */
+template <typename Iterador, typename T, typename Comparador>
+void mergesort_com_buffer(Iterador inicio, Iterador fim, T* buffer, Comparador& comp) {
+    // A rede não é estável, mas entre inteiros iguais isso não se nota; veja ordenar_pequeno_estavel.
+    constexpr std::ptrdiff_t LIMIAR =
+        rede_aplicavel_v<Iterador, Comparador> && std::is_integral_v<T> ? MERGESORT_LIMIAR_REDE : MERGESORT_LIMIAR_INSERCAO;
+    const std::ptrdiff_t n = fim - inicio;
+    if (n <= LIMIAR) {
+        ordenar_pequeno_estavel(inicio, fim, comp);
+        return;
+    }
+    Iterador meio = inicio + n / 2;
+    mergesort_com_buffer(inicio, meio, buffer, comp);
+    mergesort_com_buffer(meio, fim, buffer, comp);
+    if (!comp(*meio, *(meio - 1))) return;
+
+    T* esquerda = buffer;
+    T* fim_esquerda = std::move(inicio, meio, buffer);
+    Iterador direita = meio;
+    Iterador saida = inicio;
+    while (esquerda != fim_esquerda && direita != fim) {
+        // Nos empates, a esquerda vai primeiro: é isso que mantém a ordenação estável.
+        if (comp(*direita, *esquerda)) {
+            *saida = std::move(*direita);
+            ++direita;
+        } else {
+            *saida = std::move(*esquerda);
+            ++esquerda;
+        }
+        ++saida;
+    }
+    std::move(esquerda, fim_esquerda, saida);
+}
+
+/**
+ * @class ArvoreDePerdedores
+ * @brief Árvore de torneio para intercalar k sequências com cerca de log2(k) comparações por
+ * elemento.
+ *
+ * Cada nó interno guarda o perdedor da partida disputada ali e a raiz guarda o vencedor geral.
+ * Quando a fonte vencedora avança, só as partidas no caminho da sua folha até a raiz são refeitas,
+ * e cada uma compara contra um único perdedor guardado, sem olhar o irmão.
+ *
+ * @tparam Vence Função `bool(std::size_t a, std::size_t b)` que diz se o elemento atual da fonte
+ * `a` deve sair antes do da fonte `b`. Deve tratar fontes esgotadas como maiores que tudo e
+ * desempatar pelo índice para manter a estabilidade.
+ */
+template <typename Vence>
+class ArvoreDePerdedores {
+public:
+    ArvoreDePerdedores(std::size_t num_fontes, Vence vence)
+        : vence(std::move(vence)), num_fontes(num_fontes),
+          folhas(std::bit_ceil(std::max<std::size_t>(num_fontes, 1))), perdedores(folhas) {
+        perdedores[0] = construir(1);
+    }
+
+    /// Índice da fonte cujo elemento atual é o próximo da intercalação.
+    std::size_t vencedor() const {
+        return perdedores[0];
+    }
+
+    /// Refaz o torneio depois que a fonte vencedora avançou ou se esgotou. O(log k).
+    void reajustar() {
+        std::size_t atual = perdedores[0];
+        for (std::size_t no = (folhas + atual) / 2; no > 0; no /= 2) {
+            if (jogar(perdedores[no], atual)) std::swap(perdedores[no], atual);
+        }
+        perdedores[0] = atual;
+    }
+
+private:
+    Vence vence;
+    std::size_t num_fontes;
+    std::size_t folhas; // Potência de 2; as folhas além de num_fontes estão sempre vazias
+    std::vector<std::size_t> perdedores;
+
+    bool jogar(std::size_t a, std::size_t b) {
+        if (a >= num_fontes) return false;
+        if (b >= num_fontes) return true;
+        return vence(a, b);
+    }
+
+    std::size_t construir(std::size_t no) {
+        if (no >= folhas) return no - folhas;
+        std::size_t esquerdo = construir(2 * no);
+        std::size_t direito = construir(2 * no + 1);
+        if (jogar(esquerdo, direito)) {
+            perdedores[no] = direito;
+            return esquerdo;
+        }
+        perdedores[no] = esquerdo;
+        return direito;
+    }
+};
+
+/**
+ * @brief Intercala de forma estável as sequências ordenadas [fontes[i].first, fontes[i].second),
+ * movendo os elementos para `saida`. Nos empates, sai primeiro o elemento da fonte de menor índice.
+ * @return O iterador de saída depois do último elemento escrito.
+ */
+template <typename Iterador, typename Saida, typename Comparador>
+Saida intercalar_multiplas(std::vector<std::pair<Iterador, Iterador>> fontes, Saida saida, Comparador& comp) {
+    std::size_t restantes = 0;
+    for (const auto& [primeiro, ultimo] : fontes) restantes += static_cast<std::size_t>(ultimo - primeiro);
+    auto vence = [&](std::size_t a, std::size_t b) {
+        if (fontes[a].first == fontes[a].second) return false;
+        if (fontes[b].first == fontes[b].second) return true;
+        return comp(*fontes[a].first, *fontes[b].first) || (a < b && !comp(*fontes[b].first, *fontes[a].first));
+    };
+    ArvoreDePerdedores arvore(fontes.size(), vence);
+    for (; restantes > 0; --restantes) {
+        auto& fonte = fontes[arvore.vencedor()];
+        *saida = std::move(*fonte.first);
+        ++saida;
+        ++fonte.first;
+        arvore.reajustar();
+    }
+    return saida;
+}
+
+/**
+ * @brief Seleção em várias sequências ordenadas: acha, em cada uma, quantos dos seus elementos
+ * estão entre os `posto` primeiros da intercalação estável de todas.
+ *
+ * Generaliza a divisão pelo "merge path" para k sequências. A cada passo, o elemento do meio do
+ * maior intervalo ainda em aberto tem a sua posição na intercalação calculada por buscas binárias
+ * nas outras sequências, e isso estreita os intervalos de todas; cada passo reduz um intervalo à
+ * metade.
+ *
+ * @complexity Time: O(k^2 log^2 n) no pior caso, independente de `posto`.
+ */
+template <typename Iterador, typename Comparador>
+std::vector<std::size_t> dividir_sequencias(const std::vector<std::pair<Iterador, Iterador>>& sequencias,
+                                            std::size_t posto, Comparador& comp) {
+    const std::size_t k = sequencias.size();
+    std::vector<std::size_t> baixo(k, 0), alto(k), antes(k);
+    for (std::size_t i = 0; i < k; ++i) alto[i] = static_cast<std::size_t>(sequencias[i].second - sequencias[i].first);
+
+    while (true) {
+        std::size_t j = 0;
+        for (std::size_t i = 1; i < k; ++i) {
+            if (alto[i] - baixo[i] > alto[j] - baixo[j]) j = i;
+        }
+        if (alto[j] == baixo[j]) return baixo;
+
+        const std::size_t meio = baixo[j] + (alto[j] - baixo[j]) / 2;
+        const auto& pivo = sequencias[j].first[meio];
+        // Quantos elementos de cada sequência vêm antes do pivô na ordem estável: nas sequências
+        // anteriores, os iguais a ele vêm antes; nas posteriores, depois.
+        std::size_t soma = 0;
+        for (std::size_t i = 0; i < k; ++i) {
+            auto [primeiro, ultimo] = sequencias[i];
+            if (i < j) {
+                antes[i] = static_cast<std::size_t>(std::upper_bound(primeiro, ultimo, pivo, comp) - primeiro);
+            } else if (i > j) {
+                antes[i] = static_cast<std::size_t>(std::lower_bound(primeiro, ultimo, pivo, comp) - primeiro);
+            } else {
+                antes[i] = meio;
+            }
+            soma += antes[i];
+        }
+        if (soma == posto) return antes;
+        if (soma < posto) {
+            // O pivô e tudo o que vem antes dele estão entre os `posto` primeiros.
+            for (std::size_t i = 0; i < k; ++i) baixo[i] = std::max(baixo[i], antes[i]);
+            baixo[j] = meio + 1;
+        } else {
+            for (std::size_t i = 0; i < k; ++i) alto[i] = std::min(alto[i], antes[i]);
+        }
+    }
+}
+
+/**
+ * @brief Ordena o intervalo [inicio, fim) de forma estável com Mergesort.
+ *
+ * @param inicio Iterador de acesso aleatório para o primeiro elemento.
+ * @param fim Iterador para a posição seguinte ao último elemento.
+ * @param comp Comparador "menor que".
+ *
+ * @complexity
+ * - Time: O(n log n); O(n) para entradas já ordenadas.
+ * - Space: O(n), para a área de trabalho de n/2 elementos.
+ */
+template <typename Iterador, typename Comparador = std::less<>>
+void mergesort(Iterador inicio, Iterador fim, Comparador comp = {}) {
+    using T = typename std::iterator_traits<Iterador>::value_type;
+    const std::ptrdiff_t n = fim - inicio;
+    if (n < 2) return;
+    auto buffer = std::make_unique_for_overwrite<T[]>(static_cast<std::size_t>(n - n / 2));
+    mergesort_com_buffer(inicio, fim, buffer.get(), comp);
+}
+
+/**
+ * @brief Ordena um vetor de forma estável com Mergesort.
+ * @complexity Time: O(n log n); Space: O(n)
+ */
+template <typename T, typename Comparador = std::less<>>
+void mergesort(std::vector<T>& v, Comparador comp = {}) {
+    mergesort(v.begin(), v.end(), comp);
+}
+
+/**
+ * @brief Versão de `mergesort` com várias threads, também estável.
+ *
+ * 1. Cada thread ordena um bloco contíguo de n/p elementos.
+ * 2. Cada thread fica com uma fatia de n/p posições da saída; `dividir_sequencias` acha onde essa
+ *    fatia começa e termina em cada bloco, de modo que todas as threads intercalam a mesma
+ *    quantidade de elementos, qualquer que seja a distribuição dos dados.
+ * 3. Cada thread intercala as p subsequências da sua fatia com uma árvore de perdedores, numa
+ *    área auxiliar, e copia o resultado de volta.
+ *
+ * @param num_threads Número de threads; 0 usa `std::thread::hardware_concurrency()`. Vetores
+ * pequenos demais para dividir são ordenados na thread chamadora.
+ *
+ * @complexity Time: O((n log n) / p + n log p / p + p^3 log^2 n); Space: O(n)
+ */
+template <typename T, typename Comparador = std::less<>>
+void mergesort_paralelo(std::vector<T>& v, Comparador comp = {}, unsigned num_threads = 0) {
+    // Abaixo disso por thread, dividir o trabalho custa mais do que rende.
+    constexpr std::size_t MINIMO_POR_THREAD = std::size_t(1) << 14;
+    const std::size_t n = v.size();
+    if (num_threads == 0) num_threads = std::max(1u, std::thread::hardware_concurrency());
+    num_threads = static_cast<unsigned>(std::min<std::size_t>(num_threads, n / MINIMO_POR_THREAD));
+    if (num_threads <= 1) {
+        mergesort(v.begin(), v.end(), comp);
+        return;
+    }
+
+    T* dados = v.data();
+    auto aux = std::make_unique_for_overwrite<T[]>(n);
+    std::vector<std::size_t> limites(num_threads + 1);
+    for (unsigned t = 0; t <= num_threads; ++t) limites[t] = n * t / num_threads;
+    std::barrier sincronizar(num_threads);
+
+    auto trabalhar = [&](unsigned id) {
+        Comparador comp_local = comp;
+        mergesort_com_buffer(dados + limites[id], dados + limites[id + 1], aux.get() + limites[id], comp_local);
+        sincronizar.arrive_and_wait();
+
+        std::vector<std::pair<T*, T*>> blocos(num_threads);
+        for (unsigned t = 0; t < num_threads; ++t) blocos[t] = {dados + limites[t], dados + limites[t + 1]};
+        std::vector<std::size_t> de = dividir_sequencias(blocos, limites[id], comp_local);
+        std::vector<std::size_t> ate = dividir_sequencias(blocos, limites[id + 1], comp_local);
+        std::vector<std::pair<T*, T*>> fatia(num_threads);
+        for (unsigned t = 0; t < num_threads; ++t) fatia[t] = {blocos[t].first + de[t], blocos[t].first + ate[t]};
+        intercalar_multiplas(std::move(fatia), aux.get() + limites[id], comp_local);
+        sincronizar.arrive_and_wait();
+
+        std::move(aux.get() + limites[id], aux.get() + limites[id + 1], dados + limites[id]);
+    };
+
+    std::vector<std::thread> threads;
+    for (unsigned id = 1; id < num_threads; ++id) threads.emplace_back(trabalhar, id);
+    trabalhar(0);
+    for (auto& t : threads) t.join();
+}
+
+/**
+ * @struct OpcoesOrdenacaoExterna
+ * @brief Parâmetros de `mergesort_externo`.
+ */
+struct OpcoesOrdenacaoExterna {
+    /// Memória para cada sequência inicial: metade para os registros e metade para a área de
+    /// trabalho do Mergesort. Também é dividida entre os buffers de E/S da intercalação.
+    std::size_t memoria_bytes = std::size_t(256) << 20;
+    /// Máximo de sequências intercaladas de uma vez; havendo mais, a intercalação tem várias passadas.
+    std::size_t max_vias = 64;
+    /// Onde gravar as sequências intermediárias; vazio usa `std::filesystem::temp_directory_path()`.
+    std::string diretorio_temporario;
+    /// Threads para ordenar cada sequência na memória; 0 usa `std::thread::hardware_concurrency()`.
+    unsigned num_threads = 0;
+};
+
+/**
+ * @class LeitorDeSequencia
+ * @brief Lê registros de um arquivo em sequência, com um buffer grande.
+ *
+ * Com `T` trivialmente copiável, o arquivo é binário e cada registro ocupa sizeof(T) bytes; com
+ * `std::string`, o arquivo é texto e cada linha (sem o '\n') é um registro.
+ */
+template <typename T>
+class LeitorDeSequencia {
+    static_assert(std::is_same_v<T, std::string> || std::is_trivially_copyable_v<T>,
+                  "Os registros devem ser linhas (std::string) ou de um tipo trivialmente copiável.");
+
+public:
+    LeitorDeSequencia(const std::string& caminho, std::size_t bytes_buffer) : caminho(caminho) {
+        if constexpr (std::is_same_v<T, std::string>) {
+            buffer_texto.resize(bytes_buffer);
+            arquivo.rdbuf()->pubsetbuf(buffer_texto.data(), static_cast<std::streamsize>(buffer_texto.size()));
+        } else {
+            registros.resize(std::max<std::size_t>(1, bytes_buffer / sizeof(T)));
+        }
+        arquivo.open(caminho, std::ios::binary);
+        if (!arquivo) throw std::runtime_error("Não foi possível abrir o arquivo " + caminho + ".");
+    }
+
+    LeitorDeSequencia(const LeitorDeSequencia&) = delete;
+    LeitorDeSequencia& operator=(const LeitorDeSequencia&) = delete;
+
+    /// Avança para o próximo registro; retorna false no fim do arquivo.
+    bool proximo() {
+        if constexpr (std::is_same_v<T, std::string>) {
+            return static_cast<bool>(std::getline(arquivo, linha));
+        } else {
+            if (++posicao < quantidade) return true;
+            arquivo.read(reinterpret_cast<char*>(registros.data()),
+                         static_cast<std::streamsize>(registros.size() * sizeof(T)));
+            const auto lidos = static_cast<std::size_t>(arquivo.gcount());
+            if (lidos % sizeof(T) != 0) {
+                throw std::runtime_error("O arquivo " + caminho + " termina com um registro incompleto.");
+            }
+            quantidade = lidos / sizeof(T);
+            posicao = 0;
+            return quantidade > 0;
+        }
+    }
+
+    /// O registro atual; válido depois de `proximo()` retornar true.
+    T& atual() {
+        if constexpr (std::is_same_v<T, std::string>) {
+            return linha;
+        } else {
+            return registros[posicao];
+        }
+    }
+
+private:
+    std::string caminho;
+    std::ifstream arquivo;
+    std::vector<char> buffer_texto;
+    std::string linha;
+    std::vector<T> registros;
+    std::size_t posicao = 0;
+    std::size_t quantidade = 0;
+};
+
+/**
+ * @class EscritorDeSequencia
+ * @brief Grava registros em sequência no formato lido por `LeitorDeSequencia`, acumulando-os num
+ * buffer grande antes de cada escrita.
+ */
+template <typename T>
+class EscritorDeSequencia {
+public:
+    EscritorDeSequencia(const std::string& caminho, std::size_t bytes_buffer)
+        : caminho(caminho), arquivo(caminho, std::ios::binary | std::ios::trunc),
+          capacidade(std::max<std::size_t>(bytes_buffer, sizeof(T))) {
+        if (!arquivo) throw std::runtime_error("Não foi possível criar o arquivo " + caminho + ".");
+        buffer.reserve(capacidade);
+    }
+
+    EscritorDeSequencia(const EscritorDeSequencia&) = delete;
+    EscritorDeSequencia& operator=(const EscritorDeSequencia&) = delete;
+
+    void escrever(const T& registro) {
+        if constexpr (std::is_same_v<T, std::string>) {
+            buffer.append(registro);
+            buffer.push_back('\n');
+        } else {
+            buffer.append(reinterpret_cast<const char*>(&registro), sizeof(T));
+        }
+        if (buffer.size() >= capacidade) descarregar();
+    }
+
+    /// Grava o que resta no buffer e fecha o arquivo.
+    void fechar() {
+        descarregar();
+        arquivo.close();
+        if (!arquivo) throw std::runtime_error("Falha ao gravar o arquivo " + caminho + ".");
+    }
+
+private:
+    std::string caminho;
+    std::ofstream arquivo;
+    std::size_t capacidade;
+    std::string buffer;
+
+    void descarregar() {
+        arquivo.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        if (!arquivo) throw std::runtime_error("Falha ao gravar o arquivo " + caminho + ".");
+        buffer.clear();
+    }
+};
+
+/**
+ * @brief Intercala de forma estável os arquivos ordenados `entradas` em `saida`, com uma árvore
+ * de perdedores sobre leitores com buffer.
+ */
+template <typename T, typename Comparador>
+void intercalar_arquivos(const std::vector<std::string>& entradas, const std::string& saida, std::size_t bytes_buffer,
+                         Comparador& comp) {
+    const std::size_t k = entradas.size();
+    std::vector<std::unique_ptr<LeitorDeSequencia<T>>> leitores;
+    std::vector<char> ativo(k);
+    for (std::size_t i = 0; i < k; ++i) {
+        leitores.push_back(std::make_unique<LeitorDeSequencia<T>>(entradas[i], bytes_buffer));
+        ativo[i] = leitores[i]->proximo();
+    }
+    EscritorDeSequencia<T> escritor(saida, bytes_buffer);
+    auto vence = [&](std::size_t a, std::size_t b) {
+        if (!ativo[a]) return false;
+        if (!ativo[b]) return true;
+        const T& x = leitores[a]->atual();
+        const T& y = leitores[b]->atual();
+        return comp(x, y) || (a < b && !comp(y, x));
+    };
+    ArvoreDePerdedores arvore(k, vence);
+    for (std::size_t vencedor = arvore.vencedor(); vencedor < k && ativo[vencedor]; vencedor = arvore.vencedor()) {
+        escritor.escrever(leitores[vencedor]->atual());
+        ativo[vencedor] = leitores[vencedor]->proximo();
+        arvore.reajustar();
+    }
+    escritor.fechar();
+}
+
+/**
+ * @brief Ordena um arquivo maior que a memória de forma estável e grava o resultado em `saida`.
+ *
+ * 1. Lê a entrada em blocos de até `opcoes.memoria_bytes / 2` bytes, ordena cada bloco com
+ *    `mergesort_paralelo` e o grava como uma sequência ordenada num arquivo temporário.
+ * 2. Intercala as sequências, até `opcoes.max_vias` por vez, com leitura e escrita sequenciais
+ *    em buffers de `memoria_bytes / (max_vias + 1)` bytes. Se houver mais sequências que isso,
+ *    grupos consecutivos são intercalados em novas sequências, o que mantém a estabilidade, até
+ *    que reste uma única passada, que grava em `saida`.
+ *
+ * Por exemplo, 200 GB com 16 GB de memória geram cerca de 25 sequências, intercaladas numa só
+ * passada: a entrada é lida duas vezes e gravada duas vezes no total.
+ *
+ * @tparam T `std::string` para arquivos de texto (um registro por linha; a saída termina cada
+ * linha com '\n') ou um tipo trivialmente copiável para arquivos binários de registros fixos.
+ * @param entrada Caminho do arquivo a ordenar.
+ * @param saida Caminho do arquivo ordenado; pode ser o mesmo da entrada.
+ * @param opcoes Memória, número de vias, diretório temporário e threads.
+ * @param comp Comparador "menor que" entre registros.
+ *
+ * @throws std::invalid_argument se `opcoes.max_vias` for menor que 2.
+ * @throws std::runtime_error se algum arquivo não puder ser lido ou gravado. Os arquivos
+ * temporários são apagados também nesse caso.
+ *
+ * @complexity
+ * - Time: O(n log n) comparações; E/S de O(n * (1 + log_{max_vias}(n / M))) para M registros por
+ *   sequência.
+ * - Space: O(memoria_bytes) na memória e O(n) em disco.
+ */
+template <typename T, typename Comparador = std::less<>>
+void mergesort_externo(const std::string& entrada, const std::string& saida, const OpcoesOrdenacaoExterna& opcoes = {},
+                       Comparador comp = {}) {
+    if (opcoes.max_vias < 2) throw std::invalid_argument("A intercalação externa precisa de pelo menos 2 vias.");
+    namespace fs = std::filesystem;
+    const fs::path diretorio =
+        opcoes.diretorio_temporario.empty() ? fs::temp_directory_path() : fs::path(opcoes.diretorio_temporario);
+    const std::string prefixo = "mergesort_externo_" + std::to_string(std::random_device{}()) + "_";
+    const std::size_t bytes_buffer = std::max<std::size_t>(std::size_t(1) << 16, opcoes.memoria_bytes / (opcoes.max_vias + 1));
+
+    // Apaga os temporários que sobrarem, inclusive se uma exceção interromper a ordenação.
+    struct Temporarios {
+        std::vector<std::string> caminhos;
+        ~Temporarios() {
+            std::error_code erro;
+            for (const auto& caminho : caminhos) fs::remove(caminho, erro);
+        }
+    } temporarios;
+    auto novo_temporario = [&] {
+        temporarios.caminhos.push_back((diretorio / (prefixo + std::to_string(temporarios.caminhos.size()) + ".run")).string());
+        return temporarios.caminhos.back();
+    };
+
+    std::vector<std::string> sequencias;
+    {
+        LeitorDeSequencia<T> leitor(entrada, bytes_buffer);
+        // Cada registro conta pelo menos sizeof(T) bytes, o que limita o número de registros de um
+        // bloco. O vetor é reservado uma única vez com esse limite: se crescesse dobrando a
+        // capacidade, poderia ocupar até o dobro do orçamento. Numa entrada menor que o orçamento,
+        // o limite é o número de registros que cabem no arquivo (texto: ao menos o '\n' de cada).
+        std::size_t elementos_por_bloco = opcoes.memoria_bytes / 2 / sizeof(T) + 1;
+        std::error_code erro;
+        const std::uintmax_t bytes_entrada = fs::file_size(entrada, erro);
+        if (!erro) {
+            const std::uintmax_t registros_entrada =
+                std::is_same_v<T, std::string> ? bytes_entrada + 1 : bytes_entrada / sizeof(T);
+            elementos_por_bloco = static_cast<std::size_t>(
+                std::clamp<std::uintmax_t>(registros_entrada, 1, elementos_por_bloco));
+        }
+        std::vector<T> bloco;
+        bloco.reserve(elementos_por_bloco);
+        bool ha_registro = leitor.proximo();
+        while (ha_registro) {
+            bloco.clear();
+            std::size_t bytes = 0;
+            while (ha_registro && 2 * bytes < opcoes.memoria_bytes && bloco.size() < elementos_por_bloco) {
+                if constexpr (std::is_same_v<T, std::string>) {
+                    bytes += sizeof(std::string) + leitor.atual().size();
+                } else {
+                    bytes += sizeof(T);
+                }
+                bloco.push_back(std::move(leitor.atual()));
+                ha_registro = leitor.proximo();
+            }
+            mergesort_paralelo(bloco, comp, opcoes.num_threads);
+            sequencias.push_back(novo_temporario());
+            EscritorDeSequencia<T> escritor(sequencias.back(), bytes_buffer);
+            for (const T& registro : bloco) escritor.escrever(registro);
+            escritor.fechar();
+        }
+    }
+
+    while (sequencias.size() > opcoes.max_vias) {
+        std::vector<std::string> proximas;
+        for (std::size_t i = 0; i < sequencias.size(); i += opcoes.max_vias) {
+            std::vector<std::string> grupo(sequencias.begin() + i,
+                                           sequencias.begin() + std::min(i + opcoes.max_vias, sequencias.size()));
+            if (grupo.size() == 1) {
+                proximas.push_back(grupo[0]);
+                continue;
+            }
+            proximas.push_back(novo_temporario());
+            intercalar_arquivos<T>(grupo, proximas.back(), bytes_buffer, comp);
+            std::error_code erro;
+            for (const auto& caminho : grupo) fs::remove(caminho, erro);
+        }
+        sequencias = std::move(proximas);
+    }
+    intercalar_arquivos<T>(sequencias, saida, bytes_buffer, comp);
+}
+
+#endif // MERGESORT_HPP
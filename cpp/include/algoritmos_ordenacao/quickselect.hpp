@@ -0,0 +1,332 @@
+#ifndef QUICKSELECT_HPP
+#define QUICKSELECT_HPP
+
+#include "algoritmos_ordenacao/insertion_sort.hpp"
+#include <algorithm>
+#include <barrier>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * @file quickselect.hpp
+ * @brief Contém a seleção do k-ésimo menor elemento: Floyd-Rivest com pivôs escolhidos por
+ * amostragem, com a mediana das medianas como rede de segurança (introselect), seleção de vários
+ * postos de uma vez e uma versão com partição paralela para vetores grandes.
+ *
+ * @note Como estas são funções de template, toda a implementação está neste arquivo de cabeçalho.
+ */
+
+// Abaixo deste tamanho, o intervalo é simplesmente ordenado por inserção.
+constexpr std::ptrdiff_t QUICKSELECT_LIMIAR_INSERCAO = 16;
+// Acima deste tamanho, o Floyd-Rivest escolhe o pivô por uma seleção recursiva numa amostra.
+constexpr std::ptrdiff_t QUICKSELECT_LIMIAR_AMOSTRA = 600;
+// A partir deste tamanho, `quickselect_paralelo` divide as partições entre as threads.
+constexpr std::size_t QUICKSELECT_LIMIAR_PARALELO = 10000000;
+
+/**
+ * @brief Seleção determinística pela mediana das medianas (BFPRT): coloca em *k o elemento que
+ * estaria ali se [inicio, fim) fosse ordenado, com os menores antes e os maiores depois.
+ *
+ * As medianas dos grupos de 5 são levadas para o início do intervalo e a mediana delas, achada
+ * recursivamente, é o pivô; ele garante que cada partição descarta ao menos ~30% do intervalo.
+ *
+ * @complexity Time: O(n) no pior caso, com constante alta; Space: O(log n) de pilha.
+ */
+template <typename Iterador, typename Comparador>
+void selecao_linear(Iterador inicio, Iterador k, Iterador fim, Comparador& comp) {
+    while (fim - inicio > QUICKSELECT_LIMIAR_INSERCAO) {
+        const std::ptrdiff_t grupos = (fim - inicio) / 5;
+        for (std::ptrdiff_t g = 0; g < grupos; ++g) {
+            Iterador grupo = inicio + 5 * g;
+            insertion_sort(grupo, grupo + 5, comp);
+            std::iter_swap(inicio + g, grupo + 2);
+        }
+        Iterador mediana = inicio + grupos / 2;
+        selecao_linear(inicio, mediana, inicio + grupos, comp);
+
+        // Partição em três: menores, iguais e maiores que o pivô.
+        const auto pivo = *mediana;
+        Iterador fim_menores = std::partition(inicio, fim, [&](const auto& x) { return comp(x, pivo); });
+        Iterador fim_iguais = std::partition(fim_menores, fim, [&](const auto& x) { return !comp(pivo, x); });
+        if (k < fim_menores) {
+            fim = fim_menores;
+        } else if (k < fim_iguais) {
+            return;
+        } else {
+            inicio = fim_iguais;
+        }
+    }
+    insertion_sort(inicio, fim, comp);
+}
+
+/**
+ * @brief Núcleo do Floyd-Rivest sobre o intervalo de índices [esquerda, direita] (fechado).
+ *
+ * Em intervalos grandes, antes de particionar, seleciona recursivamente o k-ésimo de uma amostra
+ * de ~n^(2/3) elementos em volta de k. O pivô resultante fica, com alta probabilidade, a poucos
+ * elementos da posição k, e a partição seguinte descarta quase todo o intervalo: o número
+ * esperado de comparações é n + min(k, n - k) + o(n), contra ~3.4n do quickselect com pivô
+ * aleatório.
+ *
+ * @param orcamento Elementos que ainda podem ser percorridos em partições antes de desistir em
+ * favor de `selecao_linear`, o que limita o pior caso a O(n).
+ */
+template <typename Iterador, typename Comparador>
+void floyd_rivest(Iterador a, std::ptrdiff_t esquerda, std::ptrdiff_t direita, std::ptrdiff_t k, Comparador& comp,
+                  std::ptrdiff_t orcamento) {
+    while (direita > esquerda) {
+        const std::ptrdiff_t tamanho = direita - esquerda + 1;
+        if (tamanho <= QUICKSELECT_LIMIAR_INSERCAO) {
+            insertion_sort(a + esquerda, a + direita + 1, comp);
+            return;
+        }
+        orcamento -= tamanho;
+        if (orcamento < 0) {
+            selecao_linear(a + esquerda, a + k, a + direita + 1, comp);
+            return;
+        }
+        if (tamanho > QUICKSELECT_LIMIAR_AMOSTRA) {
+            const double n = static_cast<double>(tamanho);
+            const double i = static_cast<double>(k - esquerda + 1);
+            const double z = std::log(n);
+            const double s = 0.5 * std::exp(2.0 * z / 3.0);
+            const double sd = 0.5 * std::sqrt(z * s * (n - s) / n) * (i < n / 2 ? -1.0 : 1.0);
+            const auto nova_esquerda =
+                std::max(esquerda, static_cast<std::ptrdiff_t>(static_cast<double>(k) - i * s / n + sd));
+            const auto nova_direita =
+                std::min(direita, static_cast<std::ptrdiff_t>(static_cast<double>(k) + (n - i) * s / n + sd));
+            floyd_rivest(a, nova_esquerda, nova_direita, k, comp, 4 * (nova_direita - nova_esquerda + 1));
+        }
+
+        // Partição de Hoare em torno de t = a[k], com guardas nas duas pontas.
+        const auto t = a[k];
+        std::ptrdiff_t i = esquerda;
+        std::ptrdiff_t j = direita;
+        std::iter_swap(a + esquerda, a + k);
+        if (comp(t, a[direita])) std::iter_swap(a + direita, a + esquerda);
+        while (i < j) {
+            std::iter_swap(a + i, a + j);
+            ++i;
+            --j;
+            while (comp(a[i], t)) ++i;
+            while (comp(t, a[j])) --j;
+        }
+        // A primeira troca do laço levou o pivô para uma das pontas; na esquerda só pode haver o
+        // pivô ou um elemento menor que ele.
+        if (!comp(a[esquerda], t)) {
+            std::iter_swap(a + esquerda, a + j); // O pivô ficou na ponta esquerda
+        } else {
+            ++j;
+            std::iter_swap(a + j, a + direita); // O pivô ficou na ponta direita
+        }
+        if (j <= k) esquerda = j + 1;
+        if (k <= j) direita = j - 1;
+    }
+}
+
+/**
+ * @brief Reordena [inicio, fim) de modo que *k seja o elemento que estaria nessa posição se o
+ * intervalo fosse ordenado, com todos os anteriores não maiores e todos os posteriores não
+ * menores que ele (a mesma semântica de std::nth_element).
+ *
+ * Usa Floyd-Rivest; se as partições deixarem de reduzir o intervalo (entradas adversárias), troca
+ * para a mediana das medianas, de modo que o tempo é O(n) mesmo no pior caso.
+ *
+ * @param inicio Iterador de acesso aleatório para o primeiro elemento.
+ * @param k Posição a ser selecionada, em [inicio, fim).
+ * @param fim Iterador para a posição seguinte ao último elemento.
+ * @param comp Comparador "menor que".
+ *
+ * @complexity
+ * - Time: O(n) no pior caso; n + min(k, n - k) + o(n) comparações em média.
+ * - Space: O(log n) de pilha.
+ */
+template <typename Iterador, typename Comparador = std::less<>>
+void quickselect(Iterador inicio, Iterador k, Iterador fim, Comparador comp = {}) {
+    if (k >= fim || fim - inicio < 2) return;
+    floyd_rivest(inicio, 0, (fim - inicio) - 1, k - inicio, comp, 4 * (fim - inicio));
+}
+
+/**
+ * @brief Retorna o k-ésimo menor elemento de `v` (k a partir de 0), reordenando `v` como
+ * `quickselect(inicio, k, fim)`.
+ * @throws std::out_of_range se k >= v.size().
+ * @complexity Time: O(n); Space: O(log n)
+ */
+template <typename T, typename Comparador = std::less<>>
+T quickselect(std::vector<T>& v, std::size_t k, Comparador comp = {}) {
+    if (k >= v.size()) throw std::out_of_range("Posto fora do intervalo do vetor.");
+    quickselect(v.begin(), v.begin() + static_cast<std::ptrdiff_t>(k), v.end(), comp);
+    return v[k];
+}
+
+// Núcleo recursivo de `multi_select`; `deslocamento` é o posto do elemento em `inicio`.
+template <typename Iterador, typename IteradorPostos, typename Comparador>
+void multi_select_recursivo(Iterador inicio, Iterador fim, IteradorPostos primeiro_posto, IteradorPostos ultimo_posto,
+                            Comparador& comp, std::ptrdiff_t deslocamento) {
+    if (primeiro_posto == ultimo_posto || fim - inicio < 2) return;
+    IteradorPostos meio = primeiro_posto + (ultimo_posto - primeiro_posto) / 2;
+    Iterador k = inicio + (static_cast<std::ptrdiff_t>(*meio) - deslocamento);
+    quickselect(inicio, k, fim, comp);
+    multi_select_recursivo(inicio, k, primeiro_posto, meio, comp, deslocamento);
+    multi_select_recursivo(k + 1, fim, meio + 1, ultimo_posto, comp, deslocamento + (k + 1 - inicio));
+}
+
+/**
+ * @brief Coloca vários postos no lugar de uma vez: ao final, para cada p em [primeiro_posto,
+ * ultimo_posto) (em ordem crescente, sem repetições, relativos a `inicio`), *(inicio + p) é o
+ * elemento de posto p e o intervalo fica particionado entre postos consecutivos.
+ *
+ * Seleciona o posto do meio e desce recursivamente pelas duas metades com os postos de cada
+ * uma; cada nível da recursão percorre no máximo o intervalo inteiro uma vez.
+ *
+ * @complexity Time: O(n log m) para m postos; Space: O(log m) de pilha.
+ */
+template <typename Iterador, typename IteradorPostos, typename Comparador = std::less<>>
+void multi_select(Iterador inicio, Iterador fim, IteradorPostos primeiro_posto, IteradorPostos ultimo_posto,
+                  Comparador comp = {}) {
+    multi_select_recursivo(inicio, fim, primeiro_posto, ultimo_posto, comp, 0);
+}
+
+/**
+ * @brief Retorna os elementos de postos `postos` (em qualquer ordem, com repetições) de `v`, na
+ * ordem em que os postos foram pedidos, com uma única seleção múltipla. Útil para percentis: por
+ * exemplo, p50/p90/p99/p999 de n latências são os postos n/2, 9n/10, 99n/100 e 999n/1000.
+ *
+ * @throws std::out_of_range se algum posto for >= v.size().
+ * @complexity Time: O(n log m + m log m) para m postos; Space: O(m)
+ */
+template <typename T, typename Comparador = std::less<>>
+std::vector<T> multi_select(std::vector<T>& v, const std::vector<std::size_t>& postos, Comparador comp = {}) {
+    std::vector<std::size_t> ordenados = postos;
+    std::sort(ordenados.begin(), ordenados.end());
+    ordenados.erase(std::unique(ordenados.begin(), ordenados.end()), ordenados.end());
+    if (!ordenados.empty() && ordenados.back() >= v.size()) throw std::out_of_range("Posto fora do intervalo do vetor.");
+    multi_select(v.begin(), v.end(), ordenados.begin(), ordenados.end(), comp);
+    std::vector<T> resultado;
+    resultado.reserve(postos.size());
+    for (std::size_t p : postos) resultado.push_back(v[p]);
+    return resultado;
+}
+
+/**
+ * @brief Partição paralela e não estável de [dados, dados + n): os elementos com `pred` verdadeiro
+ * vão para o início. Retorna quantos são.
+ *
+ * 1. Cada thread particiona o seu bloco contíguo com std::partition.
+ * 2. Com m = total de verdadeiros, os falsos antes de m e os verdadeiros a partir de m estão fora
+ *    do lugar e existem na mesma quantidade. As duas listas de trechos fora do lugar são
+ *    percorridas em paralelo, e cada thread troca uma fatia igual dos pares.
+ */
+template <typename T, typename Predicado>
+std::size_t particionar_paralelo(T* dados, std::size_t n, Predicado pred, unsigned num_threads) {
+    std::vector<std::size_t> limites(num_threads + 1), verdadeiros(num_threads);
+    for (unsigned t = 0; t <= num_threads; ++t) limites[t] = n * t / num_threads;
+    std::barrier sincronizar(num_threads);
+    std::size_t total = 0;
+
+    // Trechos [inicio, fim) na ordem do vetor, e a posição do i-ésimo elemento da sua concatenação.
+    using Trechos = std::vector<std::pair<std::size_t, std::size_t>>;
+    auto posicao = [](const Trechos& trechos, std::size_t& trecho, std::size_t& pulados, std::size_t i) {
+        while (i - pulados >= trechos[trecho].second - trechos[trecho].first) {
+            pulados += trechos[trecho].second - trechos[trecho].first;
+            ++trecho;
+        }
+        return trechos[trecho].first + (i - pulados);
+    };
+
+    auto trabalhar = [&](unsigned id) {
+        T* inicio = dados + limites[id];
+        verdadeiros[id] = static_cast<std::size_t>(std::partition(inicio, dados + limites[id + 1], pred) - inicio);
+        sincronizar.arrive_and_wait();
+
+        std::size_t m = 0;
+        for (std::size_t c : verdadeiros) m += c;
+        if (id == 0) total = m;
+        Trechos falsos_a_esquerda, verdadeiros_a_direita;
+        std::size_t fora_do_lugar = 0;
+        for (unsigned t = 0; t < num_threads; ++t) {
+            const std::size_t corte = limites[t] + verdadeiros[t];
+            if (corte < m) {
+                falsos_a_esquerda.push_back({corte, std::min(limites[t + 1], m)});
+                fora_do_lugar += falsos_a_esquerda.back().second - corte;
+            }
+            if (corte > m) verdadeiros_a_direita.push_back({std::max(limites[t], m), corte});
+        }
+        const std::size_t de = fora_do_lugar * id / num_threads;
+        const std::size_t ate = fora_do_lugar * (id + 1) / num_threads;
+        std::size_t trecho_f = 0, pulados_f = 0, trecho_v = 0, pulados_v = 0;
+        for (std::size_t i = de; i < ate; ++i) {
+            std::swap(dados[posicao(falsos_a_esquerda, trecho_f, pulados_f, i)],
+                      dados[posicao(verdadeiros_a_direita, trecho_v, pulados_v, i)]);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (unsigned id = 1; id < num_threads; ++id) threads.emplace_back(trabalhar, id);
+    trabalhar(0);
+    for (auto& t : threads) t.join();
+    return total;
+}
+
+/**
+ * @brief Versão de `quickselect` para vetores grandes, com as partições divididas entre threads.
+ *
+ * Enquanto o intervalo restante tiver ao menos QUICKSELECT_LIMIAR_PARALELO elementos, sorteia uma
+ * amostra, escolhe nela dois pivôs que cercam o posto k com alta probabilidade (como no
+ * Floyd-Rivest) e faz duas partições paralelas, que deixam só os elementos entre os pivôs — em
+ * geral, uma fração mínima do vetor. O restante é resolvido por `quickselect`.
+ *
+ * @param num_threads Número de threads; 0 usa `std::thread::hardware_concurrency()`.
+ * @throws std::out_of_range se k >= v.size().
+ * @complexity Time: O(n / p) por partição, em geral duas; Space: O(n^(2/3)) para a amostra.
+ */
+template <typename T, typename Comparador = std::less<>>
+T quickselect_paralelo(std::vector<T>& v, std::size_t k, Comparador comp = {}, unsigned num_threads = 0) {
+    if (k >= v.size()) throw std::out_of_range("Posto fora do intervalo do vetor.");
+    if (num_threads == 0) num_threads = std::max(1u, std::thread::hardware_concurrency());
+    std::size_t esquerda = 0, direita = v.size();
+    std::mt19937_64 gerador(v.size());
+    while (num_threads > 1 && direita - esquerda >= QUICKSELECT_LIMIAR_PARALELO) {
+        const std::size_t n = direita - esquerda;
+        const double z = std::log(static_cast<double>(n));
+        const auto s = static_cast<std::size_t>(0.5 * std::exp(2.0 * z / 3.0));
+        std::vector<T> amostra(s);
+        for (auto& x : amostra) x = v[esquerda + gerador() % n];
+        // Posto de k na amostra, com uma folga de alguns desvios-padrão para cada lado.
+        const std::size_t posto = (k - esquerda) * s / n;
+        const auto folga = static_cast<std::size_t>(2.0 * std::sqrt(static_cast<double>(s)));
+        const T baixo = quickselect(amostra, posto > folga ? posto - folga : 0, comp);
+        const T alto = quickselect(amostra, std::min(s - 1, posto + folga), comp);
+
+        T* base = v.data() + esquerda;
+        const std::size_t menores =
+            particionar_paralelo(base, n, [&](const T& x) { return comp(x, baixo); }, num_threads);
+        if (k < esquerda + menores) {
+            direita = esquerda + menores;
+            continue;
+        }
+        const std::size_t ate_alto = particionar_paralelo(base + menores, n - menores,
+                                                          [&](const T& x) { return !comp(alto, x); }, num_threads);
+        if (k >= esquerda + menores + ate_alto) {
+            esquerda += menores + ate_alto;
+            continue;
+        }
+        const std::size_t nova_esquerda = esquerda + menores;
+        const std::size_t nova_direita = esquerda + menores + ate_alto;
+        if (nova_direita - nova_esquerda == n) break; // Nada descartado: muitos elementos iguais
+        esquerda = nova_esquerda;
+        direita = nova_direita;
+    }
+    quickselect(v.begin() + static_cast<std::ptrdiff_t>(esquerda), v.begin() + static_cast<std::ptrdiff_t>(k),
+                v.begin() + static_cast<std::ptrdiff_t>(direita), comp);
+    return v[k];
+}
+
+#endif // QUICKSELECT_HPP
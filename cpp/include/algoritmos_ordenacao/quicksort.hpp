@@ -0,0 +1,421 @@
+#ifndef QUICKSORT_HPP
+#define QUICKSORT_HPP
+
+#include "algoritmos_ordenacao/heapsort.hpp"
+#include "algoritmos_ordenacao/insertion_sort.hpp"
+#include "algoritmos_ordenacao/rede_ordenacao.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @file quicksort.hpp
+ * @brief Contém a implementação de um quicksort que derrota padrões (no estilo do pdqsort):
+ * introsort com pivô por mediana de 3 ou "ninther", partição em blocos sem desvios
+ * (BlockQuicksort), caminho rápido para elementos repetidos, detecção de trechos já ordenados e
+ * Heapsort como rede de segurança.
+ *
+ * @note Como estas são funções de template, toda a implementação está neste arquivo de cabeçalho.
+ */
+
+// Abaixo deste tamanho, a partição é ordenada por inserção.
+constexpr std::ptrdiff_t QUICKSORT_LIMIAR_INSERCAO = 24;
+// Abaixo deste tamanho, a partição é ordenada por uma rede de ordenação, quando o tipo permite.
+constexpr std::ptrdiff_t QUICKSORT_LIMIAR_REDE = 64;
+// Acima deste tamanho, o pivô é a mediana de três medianas de 3 (ninther), e não só uma.
+constexpr std::ptrdiff_t QUICKSORT_LIMIAR_NINTHER = 128;
+// Número de elementos que a partição em blocos classifica de uma vez em cada lado.
+constexpr std::size_t QUICKSORT_TAMANHO_BLOCO = 64;
+
+/**
+ * @brief Indica se a partição em blocos compensa: ela faz todas as comparações de um bloco
+ * antes de mover qualquer elemento, o que só vale a pena quando comparar é barato e não tem
+ * efeitos colaterais, isto é, com tipos aritméticos e std::less ou std::greater.
+ */
+template <typename T, typename Comparador>
+inline constexpr bool quicksort_particao_em_blocos_v =
+    std::is_arithmetic_v<T> &&
+    (std::is_same_v<Comparador, std::less<>> || std::is_same_v<Comparador, std::less<T>> ||
+     std::is_same_v<Comparador, std::greater<>> || std::is_same_v<Comparador, std::greater<T>>);
+
+/**
+ * @brief Inserção sem o teste de limite à esquerda: supõe que o elemento logo antes de `inicio`
+ * não é maior que nenhum do intervalo, o que vale para toda partição que não é a mais à esquerda.
+ */
+template <typename Iterador, typename Comparador>
+void insercao_sem_guarda(Iterador inicio, Iterador fim, Comparador& comp) {
+    if (inicio == fim) return;
+    for (Iterador atual = inicio + 1; atual != fim; ++atual) {
+        if (!comp(*atual, *(atual - 1))) continue;
+        auto x = std::move(*atual);
+        Iterador j = atual;
+        do {
+            *j = std::move(*(j - 1));
+            --j;
+        } while (comp(x, *(j - 1)));
+        *j = std::move(x);
+    }
+}
+
+/**
+ * @brief Tenta ordenar [inicio, fim) por inserção, desistindo depois de alguns deslocamentos.
+ * @return true se o intervalo ficou ordenado.
+ */
+template <typename Iterador, typename Comparador>
+bool insercao_parcial(Iterador inicio, Iterador fim, Comparador& comp) {
+    constexpr std::ptrdiff_t LIMITE_DESLOCAMENTOS = 8;
+    if (inicio == fim) return true;
+    std::ptrdiff_t deslocamentos = 0;
+    for (Iterador atual = inicio + 1; atual != fim; ++atual) {
+        if (!comp(*atual, *(atual - 1))) continue;
+        auto x = std::move(*atual);
+        Iterador j = atual;
+        do {
+            *j = std::move(*(j - 1));
+            --j;
+        } while (j != inicio && comp(x, *(j - 1)));
+        *j = std::move(x);
+        deslocamentos += atual - j;
+        if (deslocamentos > LIMITE_DESLOCAMENTOS) return false;
+    }
+    return true;
+}
+
+// Coloca *a, *b e *c em ordem.
+template <typename Iterador, typename Comparador>
+void ordenar3(Iterador a, Iterador b, Iterador c, Comparador& comp) {
+    if (comp(*b, *a)) std::iter_swap(a, b);
+    if (comp(*c, *b)) std::iter_swap(b, c);
+    if (comp(*b, *a)) std::iter_swap(a, b);
+}
+
+/**
+ * @brief Particiona [inicio, fim) em torno do pivô *inicio: os menores que ele à esquerda, os
+ * demais à direita. Supõe que há um elemento não menor que o pivô no intervalo (a escolha do pivô
+ * garante isso), o que dispensa testes de limite nos laços internos.
+ *
+ * @return A posição final do pivô e se o intervalo já estava particionado (nenhuma troca).
+ */
+template <typename Iterador, typename Comparador>
+std::pair<Iterador, bool> particionar_direita(Iterador inicio, Iterador fim, Comparador& comp) {
+    auto pivo = std::move(*inicio);
+    Iterador primeiro = inicio;
+    Iterador ultimo = fim;
+    while (comp(*++primeiro, pivo)) {}
+    // Se nenhum elemento à esquerda era menor, não há guarda à direita e é preciso testar o limite.
+    if (primeiro - 1 == inicio) {
+        while (primeiro < ultimo && !comp(*--ultimo, pivo)) {}
+    } else {
+        while (!comp(*--ultimo, pivo)) {}
+    }
+    const bool ja_particionado = primeiro >= ultimo;
+    while (primeiro < ultimo) {
+        std::iter_swap(primeiro, ultimo);
+        while (comp(*++primeiro, pivo)) {}
+        while (!comp(*--ultimo, pivo)) {}
+    }
+    Iterador posicao_pivo = primeiro - 1;
+    *inicio = std::move(*posicao_pivo);
+    *posicao_pivo = std::move(pivo);
+    return {posicao_pivo, ja_particionado};
+}
+
+/**
+ * @brief Troca os elementos fora do lugar marcados nos dois buffers de deslocamentos. Quando há
+ * tantos de um lado quanto do outro, usa trocas simples; senão, faz um único ciclo de movimentos,
+ * que custa cerca de metade.
+ */
+template <typename Iterador>
+void trocar_deslocamentos(Iterador base_esquerda, Iterador base_direita, const std::uint8_t* esquerda,
+                          const std::uint8_t* direita, std::size_t quantidade, bool usar_trocas) {
+    if (usar_trocas) {
+        for (std::size_t i = 0; i < quantidade; ++i) {
+            std::iter_swap(base_esquerda + esquerda[i], base_direita - direita[i]);
+        }
+    } else if (quantidade > 0) {
+        Iterador l = base_esquerda + esquerda[0];
+        Iterador r = base_direita - direita[0];
+        auto temporario = std::move(*l);
+        *l = std::move(*r);
+        for (std::size_t i = 1; i < quantidade; ++i) {
+            l = base_esquerda + esquerda[i];
+            *r = std::move(*l);
+            r = base_direita - direita[i];
+            *l = std::move(*r);
+        }
+        *r = std::move(temporario);
+    }
+}
+
+/**
+ * @brief Versão de `particionar_direita` com a partição em blocos do BlockQuicksort.
+ *
+ * Cada lado examina um bloco de até QUICKSORT_TAMANHO_BLOCO elementos e anota, num buffer de
+ * deslocamentos, os que estão do lado errado: a posição é sempre escrita e o contador avança
+ * pelo resultado da comparação, sem desvio condicional. Depois os pares anotados são trocados.
+ * Assim as comparações, imprevisíveis em dados aleatórios, não custam erros de previsão.
+ */
+template <typename Iterador, typename Comparador>
+std::pair<Iterador, bool> particionar_direita_em_blocos(Iterador inicio, Iterador fim, Comparador& comp) {
+    constexpr std::size_t BLOCO = QUICKSORT_TAMANHO_BLOCO;
+    auto pivo = std::move(*inicio);
+    Iterador primeiro = inicio;
+    Iterador ultimo = fim;
+    while (comp(*++primeiro, pivo)) {}
+    if (primeiro - 1 == inicio) {
+        while (primeiro < ultimo && !comp(*--ultimo, pivo)) {}
+    } else {
+        while (!comp(*--ultimo, pivo)) {}
+    }
+    const bool ja_particionado = primeiro >= ultimo;
+
+    if (!ja_particionado) {
+        std::iter_swap(primeiro, ultimo);
+        ++primeiro;
+
+        alignas(64) std::uint8_t deslocamentos_esquerda[BLOCO];
+        alignas(64) std::uint8_t deslocamentos_direita[BLOCO];
+        Iterador base_esquerda = primeiro;
+        Iterador base_direita = ultimo;
+        std::size_t num_esquerda = 0, num_direita = 0, inicio_esquerda = 0, inicio_direita = 0;
+
+        while (primeiro < ultimo) {
+            // Só o lado sem pendências examina um novo bloco; perto do fim, os blocos encolhem
+            // para cobrir exatamente o que falta.
+            const std::size_t desconhecidos = static_cast<std::size_t>(ultimo - primeiro);
+            const std::size_t fatia_esquerda =
+                num_esquerda == 0 ? (num_direita == 0 ? desconhecidos / 2 : desconhecidos) : 0;
+            const std::size_t fatia_direita = num_direita == 0 ? desconhecidos - fatia_esquerda : 0;
+
+            const std::size_t limite_esquerda = std::min(fatia_esquerda, BLOCO);
+            for (std::size_t i = 0; i < limite_esquerda; ++i) {
+                deslocamentos_esquerda[num_esquerda] = static_cast<std::uint8_t>(i);
+                num_esquerda += !comp(*primeiro, pivo);
+                ++primeiro;
+            }
+            const std::size_t limite_direita = std::min(fatia_direita, BLOCO);
+            for (std::size_t i = 1; i <= limite_direita; ++i) {
+                deslocamentos_direita[num_direita] = static_cast<std::uint8_t>(i);
+                num_direita += comp(*--ultimo, pivo);
+            }
+
+            const std::size_t quantidade = std::min(num_esquerda, num_direita);
+            trocar_deslocamentos(base_esquerda, base_direita, deslocamentos_esquerda + inicio_esquerda,
+                                 deslocamentos_direita + inicio_direita, quantidade, num_esquerda == num_direita);
+            num_esquerda -= quantidade;
+            num_direita -= quantidade;
+            inicio_esquerda += quantidade;
+            inicio_direita += quantidade;
+            if (num_esquerda == 0) {
+                inicio_esquerda = 0;
+                base_esquerda = primeiro;
+            }
+            if (num_direita == 0) {
+                inicio_direita = 0;
+                base_direita = ultimo;
+            }
+        }
+
+        // Sobraram pendências de um lado só: leva esses elementos para a fronteira.
+        if (num_esquerda > 0) {
+            const std::uint8_t* pendentes = deslocamentos_esquerda + inicio_esquerda;
+            while (num_esquerda--) std::iter_swap(base_esquerda + pendentes[num_esquerda], --ultimo);
+            primeiro = ultimo;
+        }
+        if (num_direita > 0) {
+            const std::uint8_t* pendentes = deslocamentos_direita + inicio_direita;
+            while (num_direita--) {
+                std::iter_swap(base_direita - pendentes[num_direita], primeiro);
+                ++primeiro;
+            }
+        }
+    }
+
+    Iterador posicao_pivo = primeiro - 1;
+    *inicio = std::move(*posicao_pivo);
+    *posicao_pivo = std::move(pivo);
+    return {posicao_pivo, ja_particionado};
+}
+
+/**
+ * @brief Particiona [inicio, fim) em torno do pivô *inicio deixando à esquerda os elementos
+ * iguais a ele e à direita os maiores. Usada quando o pivô é igual ao elemento logo antes do
+ * intervalo: como esse elemento é o pivô de uma partição anterior, nada ali é menor que o pivô, e
+ * os iguais ficam na posição final de uma vez.
+ *
+ * @return A posição final do pivô (o último dos iguais).
+ */
+template <typename Iterador, typename Comparador>
+Iterador particionar_esquerda(Iterador inicio, Iterador fim, Comparador& comp) {
+    auto pivo = std::move(*inicio);
+    Iterador primeiro = inicio;
+    Iterador ultimo = fim;
+    while (comp(pivo, *--ultimo)) {}
+    if (ultimo + 1 == fim) {
+        while (primeiro < ultimo && !comp(pivo, *++primeiro)) {}
+    } else {
+        while (!comp(pivo, *++primeiro)) {}
+    }
+    while (primeiro < ultimo) {
+        std::iter_swap(primeiro, ultimo);
+        while (comp(pivo, *--ultimo)) {}
+        while (!comp(pivo, *++primeiro)) {}
+    }
+    *inicio = std::move(*ultimo);
+    *ultimo = std::move(pivo);
+    return ultimo;
+}
+
+/**
+ * @brief Laço principal: particiona, recorre à esquerda e itera à direita.
+ *
+ * @param ruins_permitidas Quantas partições muito desequilibradas (um lado com menos de 1/8)
+ * ainda são toleradas antes de passar o intervalo ao Heapsort.
+ * @param mais_a_esquerda Se o intervalo começa no início do vetor; senão, o elemento anterior
+ * serve de guarda para a inserção e de referência para detectar pivôs repetidos.
+ */
+template <bool EmBlocos, typename Iterador, typename Comparador>
+void quicksort_laco(Iterador inicio, Iterador fim, Comparador& comp, int ruins_permitidas, bool mais_a_esquerda) {
+    constexpr bool USA_REDE = rede_aplicavel_v<Iterador, Comparador>;
+    while (true) {
+        const std::ptrdiff_t tamanho = fim - inicio;
+        if constexpr (USA_REDE) {
+            if (tamanho < QUICKSORT_LIMIAR_REDE) {
+                ordenar_pequeno(inicio, fim, comp);
+                return;
+            }
+        } else if (tamanho < QUICKSORT_LIMIAR_INSERCAO) {
+            if (mais_a_esquerda) {
+                insertion_sort(inicio, fim, comp);
+            } else {
+                insercao_sem_guarda(inicio, fim, comp);
+            }
+            return;
+        }
+
+        // O pivô fica em *inicio, e *(fim - 1) fica maior ou igual a ele.
+        const std::ptrdiff_t meio = tamanho / 2;
+        if (tamanho > QUICKSORT_LIMIAR_NINTHER) {
+            ordenar3(inicio, inicio + meio, fim - 1, comp);
+            ordenar3(inicio + 1, inicio + (meio - 1), fim - 2, comp);
+            ordenar3(inicio + 2, inicio + (meio + 1), fim - 3, comp);
+            ordenar3(inicio + (meio - 1), inicio + meio, inicio + (meio + 1), comp);
+            std::iter_swap(inicio, inicio + meio);
+        } else {
+            ordenar3(inicio + meio, inicio, fim - 1, comp);
+        }
+
+        // Pivô igual ao anterior: todos os iguais vão para a esquerda e não são mais olhados.
+        if (!mais_a_esquerda && !comp(*(inicio - 1), *inicio)) {
+            inicio = particionar_esquerda(inicio, fim, comp) + 1;
+            continue;
+        }
+
+        auto [posicao_pivo, ja_particionado] = EmBlocos ? particionar_direita_em_blocos(inicio, fim, comp)
+                                                        : particionar_direita(inicio, fim, comp);
+        const std::ptrdiff_t tamanho_esquerda = posicao_pivo - inicio;
+        const std::ptrdiff_t tamanho_direita = fim - (posicao_pivo + 1);
+
+        if (tamanho_esquerda < tamanho / 8 || tamanho_direita < tamanho / 8) {
+            if (--ruins_permitidas == 0) {
+                heapsort(inicio, fim, comp);
+                return;
+            }
+            // Embaralha alguns elementos de cada lado para quebrar o padrão que levou ao
+            // desequilíbrio antes de escolher os próximos pivôs.
+            if (tamanho_esquerda >= QUICKSORT_LIMIAR_INSERCAO) {
+                const std::ptrdiff_t q = tamanho_esquerda / 4;
+                std::iter_swap(inicio, inicio + q);
+                std::iter_swap(posicao_pivo - 1, posicao_pivo - q);
+                if (tamanho_esquerda > QUICKSORT_LIMIAR_NINTHER) {
+                    std::iter_swap(inicio + 1, inicio + (q + 1));
+                    std::iter_swap(inicio + 2, inicio + (q + 2));
+                    std::iter_swap(posicao_pivo - 2, posicao_pivo - (q + 1));
+                    std::iter_swap(posicao_pivo - 3, posicao_pivo - (q + 2));
+                }
+            }
+            if (tamanho_direita >= QUICKSORT_LIMIAR_INSERCAO) {
+                const std::ptrdiff_t q = tamanho_direita / 4;
+                std::iter_swap(posicao_pivo + 1, posicao_pivo + (1 + q));
+                std::iter_swap(fim - 1, fim - q);
+                if (tamanho_direita > QUICKSORT_LIMIAR_NINTHER) {
+                    std::iter_swap(posicao_pivo + 2, posicao_pivo + (2 + q));
+                    std::iter_swap(posicao_pivo + 3, posicao_pivo + (3 + q));
+                    std::iter_swap(fim - 2, fim - (1 + q));
+                    std::iter_swap(fim - 3, fim - (2 + q));
+                }
+            }
+        } else if (ja_particionado && insercao_parcial(inicio, posicao_pivo, comp) &&
+                   insercao_parcial(posicao_pivo + 1, fim, comp)) {
+            // Partição equilibrada sem nenhuma troca: provavelmente um trecho já (quase) ordenado.
+            return;
+        }
+
+        quicksort_laco<EmBlocos>(inicio, posicao_pivo, comp, ruins_permitidas, mais_a_esquerda);
+        inicio = posicao_pivo + 1;
+        mais_a_esquerda = false;
+    }
+}
+
+/**
+ * @brief Ordena o intervalo [inicio, fim) com o quicksort que derrota padrões.
+ *
+ * - Pivô: mediana de 3 (primeiro, meio, último) ou, acima de QUICKSORT_LIMIAR_NINTHER elementos,
+ *   a mediana de três medianas de 3.
+ * - Partição: em blocos, sem desvios, para tipos aritméticos com std::less/std::greater; com
+ *   desvios (Hoare) para os demais comparadores.
+ * - Elementos iguais: se o pivô é igual ao pivô anterior, os iguais a ele são separados de uma vez,
+ *   o que torna a ordenação O(n k) para k valores distintos.
+ * - Trechos ordenados: uma partição sem trocas dispara uma inserção limitada, que termina em O(n)
+ *   em entradas ordenadas ou quase.
+ * - Entradas adversárias: depois de log2(n) partições desequilibradas, o intervalo vai para o
+ *   Heapsort.
+ * - Partições com menos de QUICKSORT_LIMIAR_INSERCAO elementos são ordenadas por inserção; com
+ *   inteiros de 32 ou 64 bits, float ou double contíguos e std::less/std::greater, as com menos de
+ *   QUICKSORT_LIMIAR_REDE vão para uma rede de ordenação vetorizada (veja rede_ordenacao.hpp).
+ *
+ * Não é estável.
+ *
+ * @param inicio Iterador de acesso aleatório para o primeiro elemento.
+ * @param fim Iterador para a posição seguinte ao último elemento.
+ * @param comp Comparador "menor que" (ordem fraca estrita).
+ *
+ * @complexity
+ * - Time: O(n log n) no pior caso; O(n) para entradas ordenadas, invertidas ou todas iguais.
+ * - Space: O(log n) de pilha.
+ */
+template <typename Iterador, typename Comparador = std::less<>>
+void quicksort(Iterador inicio, Iterador fim, Comparador comp = {}) {
+    using T = typename std::iterator_traits<Iterador>::value_type;
+    if (fim - inicio < 2) return;
+    const int ruins_permitidas = std::bit_width(static_cast<std::size_t>(fim - inicio)) - 1;
+    quicksort_laco<quicksort_particao_em_blocos_v<T, Comparador>>(inicio, fim, comp, ruins_permitidas, true);
+}
+
+/**
+ * @brief Ordena um vetor com o quicksort que derrota padrões.
+ * @complexity Time: O(n log n); Space: O(log n)
+ */
+template <typename T, typename Comparador = std::less<>>
+void quicksort(std::vector<T>& v, Comparador comp = {}) {
+    quicksort(v.begin(), v.end(), comp);
+}
+
+/**
+ * @brief Como `quicksort`, mas sempre com a partição em blocos. Para comparadores próprios que
+ * sejam baratos e sem efeitos colaterais (por exemplo, comparar um campo inteiro de um registro).
+ */
+template <typename Iterador, typename Comparador = std::less<>>
+void quicksort_em_blocos(Iterador inicio, Iterador fim, Comparador comp = {}) {
+    if (fim - inicio < 2) return;
+    const int ruins_permitidas = std::bit_width(static_cast<std::size_t>(fim - inicio)) - 1;
+    quicksort_laco<true>(inicio, fim, comp, ruins_permitidas, true);
+}
+
+#endif // QUICKSORT_HPP
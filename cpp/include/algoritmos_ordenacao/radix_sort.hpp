@@ -0,0 +1,308 @@
+#ifndef RADIX_SORT_HPP
+#define RADIX_SORT_HPP
+
+#include <algorithm>
+#include <barrier>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @file radix_sort.hpp
+ * @brief Contém a implementação do Radix Sort LSD (dígito menos significativo primeiro) para
+ * chaves inteiras e de ponto flutuante, com variantes para registros ordenados por uma chave,
+ * para pares chave-valor em vetores separados e com várias threads.
+ *
+ * @note Como estas são funções de template, toda a implementação está neste arquivo de cabeçalho.
+ */
+
+/**
+ * @struct ChaveRadix
+ * @brief Converte uma chave em um inteiro sem sinal cuja ordem numérica é a ordem da chave.
+ *
+ * - Sem sinal: a própria chave.
+ * - Com sinal: inverte o bit de sinal, de modo que os negativos venham antes.
+ * - Ponto flutuante (IEEE 754): nos positivos, liga o bit de sinal; nos negativos, inverte
+ *   todos os bits, o que também inverte a ordem da magnitude. O resultado ordena -inf < negativos
+ *   < -0.0 < +0.0 < positivos < +inf, com os NaN de sinal negativo antes de tudo e os de sinal
+ *   positivo depois de tudo.
+ */
+template <typename T, typename = void>
+struct ChaveRadix;
+
+template <typename T>
+struct ChaveRadix<T, std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool>>> {
+    using Bits = std::make_unsigned_t<T>;
+
+    static Bits codificar(T x) {
+        constexpr Bits SINAL = std::is_signed_v<T> ? Bits(Bits(1) << (8 * sizeof(T) - 1)) : Bits(0);
+        return static_cast<Bits>(static_cast<Bits>(x) ^ SINAL);
+    }
+};
+
+template <typename T>
+struct ChaveRadix<T, std::enable_if_t<std::is_floating_point_v<T>>> {
+    static_assert(sizeof(T) == 4 || sizeof(T) == 8, "Apenas float e double são suportados.");
+    using Bits = std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>;
+
+    static Bits codificar(T x) {
+        Bits b = std::bit_cast<Bits>(x);
+        Bits sinal = b >> (8 * sizeof(T) - 1);
+        // Máscara só com o bit de sinal nos positivos, com todos os bits nos negativos.
+        Bits mascara = static_cast<Bits>(-sinal) | (Bits(1) << (8 * sizeof(T) - 1));
+        return b ^ mascara;
+    }
+};
+
+/**
+ * @brief Tamanho padrão do dígito: 8 bits para chaves de até 16 bits e 11 bits para as maiores,
+ * que assim precisam de 3 passadas (32 bits) ou 6 (64 bits) em vez de 4 ou 8.
+ */
+template <typename Chave>
+constexpr int bits_digito_padrao() {
+    return sizeof(Chave) <= 2 ? 8 : 11;
+}
+
+// Marca a ausência de um vetor de valores em radix_lsd.
+struct SemCarga {};
+
+/**
+ * @brief Núcleo sequencial: ordena `dados` de forma estável pela chave `chave(elemento)`,
+ * usando `aux` (com espaço para n elementos) como área de trabalho. Se `carga` não for nulo, os
+ * seus elementos acompanham os de `dados`.
+ *
+ * Um único percurso conta os dígitos de todas as posições; as posições em que todas as chaves
+ * têm o mesmo dígito (por exemplo, os bits altos de valores pequenos) são puladas.
+ */
+template <int BitsDigito, typename Elemento, typename Extrator, typename Carga = SemCarga>
+void radix_lsd(Elemento* dados, Elemento* aux, std::size_t n, Extrator chave, Carga* carga = nullptr,
+               Carga* carga_aux = nullptr) {
+    using Chave = std::decay_t<decltype(chave(*dados))>;
+    using Codificador = ChaveRadix<Chave>;
+    using Bits = typename Codificador::Bits;
+    constexpr bool COM_CARGA = !std::is_same_v<Carga, SemCarga>;
+    constexpr int NUM_DIGITOS = (8 * sizeof(Bits) + BitsDigito - 1) / BitsDigito;
+    constexpr std::size_t BALDES = std::size_t(1) << BitsDigito;
+    constexpr Bits MASCARA = static_cast<Bits>(BALDES - 1);
+
+    auto codigo = [&](const Elemento& e) { return Codificador::codificar(chave(e)); };
+
+    if (n < 64) {
+        // Inserção direta: mais rápida que montar os histogramas para poucos elementos.
+        for (std::size_t i = 1; i < n; ++i) {
+            Bits k = codigo(dados[i]);
+            if (!(k < codigo(dados[i - 1]))) continue;
+            Elemento x = std::move(dados[i]);
+            std::size_t j = i;
+            if constexpr (COM_CARGA) {
+                Carga c = std::move(carga[i]);
+                for (; j > 0 && k < codigo(dados[j - 1]); --j) {
+                    dados[j] = std::move(dados[j - 1]);
+                    carga[j] = std::move(carga[j - 1]);
+                }
+                carga[j] = std::move(c);
+            } else {
+                for (; j > 0 && k < codigo(dados[j - 1]); --j) dados[j] = std::move(dados[j - 1]);
+            }
+            dados[j] = std::move(x);
+        }
+        return;
+    }
+
+    std::vector<std::size_t> histogramas(NUM_DIGITOS * BALDES, 0);
+    for (std::size_t i = 0; i < n; ++i) {
+        Bits k = codigo(dados[i]);
+        for (int d = 0; d < NUM_DIGITOS; ++d) ++histogramas[d * BALDES + ((k >> (d * BitsDigito)) & MASCARA)];
+    }
+
+    Elemento* origem = dados;
+    Elemento* destino = aux;
+    Carga* carga_origem = carga;
+    Carga* carga_destino = carga_aux;
+    const Bits primeira = codigo(dados[0]);
+    for (int d = 0; d < NUM_DIGITOS; ++d) {
+        const int deslocamento = d * BitsDigito;
+        std::size_t* h = &histogramas[d * BALDES];
+        if (h[(primeira >> deslocamento) & MASCARA] == n) continue; // Dígito constante
+
+        std::size_t soma = 0;
+        for (std::size_t b = 0; b < BALDES; ++b) soma += std::exchange(h[b], soma);
+        for (std::size_t i = 0; i < n; ++i) {
+            std::size_t pos = h[(codigo(origem[i]) >> deslocamento) & MASCARA]++;
+            destino[pos] = std::move(origem[i]);
+            if constexpr (COM_CARGA) carga_destino[pos] = std::move(carga_origem[i]);
+        }
+        std::swap(origem, destino);
+        if constexpr (COM_CARGA) std::swap(carga_origem, carga_destino);
+    }
+    if (origem != dados) {
+        std::move(origem, origem + n, dados);
+        if constexpr (COM_CARGA) std::move(carga_origem, carga_origem + n, carga);
+    }
+}
+
+/**
+ * @brief Núcleo paralelo de `radix_lsd` (sem vetor de valores).
+ *
+ * Cada thread fica com um bloco contíguo do vetor. A cada passada, cada thread conta os dígitos
+ * do seu bloco em um histograma próprio; a soma de prefixos sobre (balde, thread) dá a cada
+ * thread a posição de escrita de cada balde, e as threads espalham os seus blocos sem
+ * sincronização, preservando a estabilidade. A primeira contagem cobre todos os dígitos e decide
+ * quais podem ser pulados.
+ */
+template <int BitsDigito, typename Elemento, typename Extrator>
+void radix_lsd_paralelo(Elemento* dados, std::size_t n, Extrator chave, unsigned num_threads) {
+    using Chave = std::decay_t<decltype(chave(*dados))>;
+    using Codificador = ChaveRadix<Chave>;
+    using Bits = typename Codificador::Bits;
+    constexpr int NUM_DIGITOS = (8 * sizeof(Bits) + BitsDigito - 1) / BitsDigito;
+    constexpr std::size_t BALDES = std::size_t(1) << BitsDigito;
+    constexpr Bits MASCARA = static_cast<Bits>(BALDES - 1);
+    // Abaixo disso por thread, dividir o trabalho custa mais do que rende.
+    constexpr std::size_t MINIMO_POR_THREAD = std::size_t(1) << 16;
+
+    if (num_threads == 0) num_threads = std::max(1u, std::thread::hardware_concurrency());
+    num_threads = static_cast<unsigned>(std::min<std::size_t>(num_threads, n / MINIMO_POR_THREAD));
+    auto aux = std::make_unique_for_overwrite<Elemento[]>(n);
+    if (num_threads <= 1) {
+        radix_lsd<BitsDigito>(dados, aux.get(), n, chave);
+        return;
+    }
+
+    auto codigo = [&](const Elemento& e) { return Codificador::codificar(chave(e)); };
+    // Um vetor por thread: os histogramas de threads diferentes não dividem linhas de cache.
+    std::vector<std::vector<std::size_t>> contagens(num_threads, std::vector<std::size_t>(NUM_DIGITOS * BALDES));
+    std::barrier sincronizar(static_cast<std::ptrdiff_t>(num_threads));
+    const Bits primeira = codigo(dados[0]);
+
+    auto trabalhar = [&](unsigned id) {
+        const std::size_t inicio = n * id / num_threads, fim = n * (id + 1) / num_threads;
+        std::vector<std::size_t>& minha = contagens[id];
+        for (std::size_t i = inicio; i < fim; ++i) {
+            Bits k = codigo(dados[i]);
+            for (int d = 0; d < NUM_DIGITOS; ++d) ++minha[d * BALDES + ((k >> (d * BitsDigito)) & MASCARA)];
+        }
+        sincronizar.arrive_and_wait();
+
+        // Todas as threads chegam às mesmas conclusões sobre quais dígitos pular.
+        bool ativo[NUM_DIGITOS];
+        for (int d = 0; d < NUM_DIGITOS; ++d) {
+            std::size_t b = (primeira >> (d * BitsDigito)) & MASCARA, total = 0;
+            for (unsigned t = 0; t < num_threads; ++t) total += contagens[t][d * BALDES + b];
+            ativo[d] = total != n;
+        }
+
+        Elemento* origem = dados;
+        Elemento* destino = aux.get();
+        bool primeira_passada = true;
+        std::vector<std::size_t> posicoes(BALDES);
+        for (int d = 0; d < NUM_DIGITOS; ++d) {
+            if (!ativo[d]) continue;
+            const int deslocamento = d * BitsDigito;
+            const std::size_t base = primeira_passada ? d * BALDES : 0;
+            if (!primeira_passada) {
+                // Os blocos mudaram de conteúdo: recontagem só deste dígito.
+                std::fill(minha.begin(), minha.begin() + BALDES, 0);
+                for (std::size_t i = inicio; i < fim; ++i) ++minha[(codigo(origem[i]) >> deslocamento) & MASCARA];
+                sincronizar.arrive_and_wait();
+            }
+            // Posição inicial de cada balde para esta thread: tudo dos baldes anteriores, mais o
+            // mesmo balde das threads anteriores.
+            std::size_t soma = 0;
+            for (std::size_t b = 0; b < BALDES; ++b) {
+                for (unsigned t = 0; t < num_threads; ++t) {
+                    if (t == id) posicoes[b] = soma;
+                    soma += contagens[t][base + b];
+                }
+            }
+            for (std::size_t i = inicio; i < fim; ++i) {
+                destino[posicoes[(codigo(origem[i]) >> deslocamento) & MASCARA]++] = std::move(origem[i]);
+            }
+            // Ninguém lê o destino nem reescreve as contagens antes de todos terminarem.
+            sincronizar.arrive_and_wait();
+            std::swap(origem, destino);
+            primeira_passada = false;
+        }
+        if (origem != dados) std::move(origem + inicio, origem + fim, dados + inicio);
+    };
+
+    std::vector<std::thread> threads;
+    for (unsigned id = 1; id < num_threads; ++id) threads.emplace_back(trabalhar, id);
+    trabalhar(0);
+    for (auto& t : threads) t.join();
+}
+
+/**
+ * @brief Ordena um vetor de inteiros, `float` ou `double` com Radix Sort LSD.
+ *
+ * Para ponto flutuante, a ordem é a de `ChaveRadix`: -0.0 vem antes de +0.0, e os NaN vão para as
+ * pontas conforme o bit de sinal.
+ *
+ * @tparam BitsDigito Bits por dígito (por exemplo, 8 ou 11).
+ * @param v O vetor a ser ordenado.
+ *
+ * @complexity
+ * - Time: O(n * w / BitsDigito + 2^BitsDigito), onde w é o número de bits da chave.
+ * - Space: O(n), para a área de trabalho.
+ */
+template <typename T, int BitsDigito = bits_digito_padrao<T>()>
+void radix_sort(std::vector<T>& v) {
+    auto aux = std::make_unique_for_overwrite<T[]>(v.size());
+    radix_lsd<BitsDigito>(v.data(), aux.get(), v.size(), [](const T& x) { return x; });
+}
+
+/**
+ * @brief Ordena registros de forma estável pela chave que `chave(registro)` retorna (inteiro,
+ * `float` ou `double`), movendo os registros inteiros a cada passada.
+ *
+ * @complexity Time: O(n * w / BitsDigito); Space: O(n)
+ */
+template <typename T, typename Extrator, int BitsDigito = bits_digito_padrao<std::decay_t<std::invoke_result_t<Extrator, const T&>>>()>
+void radix_sort_por_chave(std::vector<T>& v, Extrator chave) {
+    auto aux = std::make_unique_for_overwrite<T[]>(v.size());
+    radix_lsd<BitsDigito>(v.data(), aux.get(), v.size(), chave);
+}
+
+/**
+ * @brief Ordena `chaves` e aplica a mesma permutação, de forma estável, a `valores`.
+ * @throws std::invalid_argument se os vetores tiverem tamanhos diferentes.
+ * @complexity Time: O(n * w / BitsDigito); Space: O(n)
+ */
+template <typename K, typename V, int BitsDigito = bits_digito_padrao<K>()>
+void radix_sort_com_valores(std::vector<K>& chaves, std::vector<V>& valores) {
+    if (chaves.size() != valores.size()) {
+        throw std::invalid_argument("Os vetores de chaves e de valores devem ter o mesmo tamanho.");
+    }
+    const std::size_t n = chaves.size();
+    auto aux = std::make_unique_for_overwrite<K[]>(n);
+    std::vector<V> valores_aux(n);
+    radix_lsd<BitsDigito>(chaves.data(), aux.get(), n, [](const K& x) { return x; }, valores.data(),
+                          valores_aux.data());
+}
+
+/**
+ * @brief Versão de `radix_sort` com várias threads.
+ * @param num_threads Número de threads; 0 usa `std::thread::hardware_concurrency()`. Vetores
+ * pequenos demais para dividir são ordenados na thread chamadora.
+ * @complexity Time: O(n * w / (BitsDigito * p) + p * 2^BitsDigito) por passada; Space: O(n)
+ */
+template <typename T, int BitsDigito = bits_digito_padrao<T>()>
+void radix_sort_paralelo(std::vector<T>& v, unsigned num_threads = 0) {
+    radix_lsd_paralelo<BitsDigito>(v.data(), v.size(), [](const T& x) { return x; }, num_threads);
+}
+
+/**
+ * @brief Versão de `radix_sort_por_chave` com várias threads.
+ */
+template <typename T, typename Extrator, int BitsDigito = bits_digito_padrao<std::decay_t<std::invoke_result_t<Extrator, const T&>>>()>
+void radix_sort_paralelo_por_chave(std::vector<T>& v, Extrator chave, unsigned num_threads = 0) {
+    radix_lsd_paralelo<BitsDigito>(v.data(), v.size(), chave, num_threads);
+}
+
+#endif // RADIX_SORT_HPP
@@ -0,0 +1,437 @@
+#ifndef REDE_ORDENACAO_HPP
+#define REDE_ORDENACAO_HPP
+
+#include "algoritmos_ordenacao/insertion_sort.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) && !defined(__clang__)
+#define REDE_ORDENACAO_SIMD 1
+#include <immintrin.h>
+#else
+#define REDE_ORDENACAO_SIMD 0
+#endif
+
+/**
+ * @file rede_ordenacao.hpp
+ * @brief Contém redes de ordenação bitônicas vetorizadas (AVX2, com SSE4.2 como alternativa,
+ * escolhidas em tempo de execução) para vetores de até 64 inteiros de 32 ou 64 bits, `float` ou
+ * `double`, e a ordenação de vetores pequenos usada como caso base dos algoritmos de
+ * algoritmos_ordenacao/.
+ *
+ * Uma rede de ordenação é uma sequência fixa de comparações-e-trocas que não depende dos dados:
+ * não há desvios para o preditor errar, e cada comparação-e-troca vira um par mínimo/máximo que
+ * processa 4 ou 8 elementos por instrução. O vetor é completado até a próxima potência de 2 com o
+ * maior valor possível, carregado em registradores e ordenado ali.
+ *
+ * As funções com SIMD são compiladas com `__attribute__((target(...)))` e achatadas (`flatten`)
+ * para que a rede inteira seja gerada com as instruções do conjunto escolhido, sem exigir
+ * `-mavx2` no resto do programa. Fora do GCC em x86, `ordenar_rede` usa a inserção sem desvios.
+ *
+ * @note Como estas são funções de template, toda a implementação está neste arquivo de cabeçalho.
+ */
+
+/// Maior vetor que `ordenar_rede` aceita.
+constexpr std::size_t REDE_ORDENACAO_MAXIMO = 64;
+
+/**
+ * @enum ConjuntoInstrucoes
+ * @brief Implementação das redes: escalar (inserção sem desvios), SSE4.2 (registradores de 128
+ * bits) ou AVX2 (256 bits).
+ */
+enum class ConjuntoInstrucoes { Escalar, Sse42, Avx2 };
+
+/**
+ * @brief O melhor conjunto de instruções suportado pelo processador, detectado uma única vez.
+ */
+inline ConjuntoInstrucoes conjunto_instrucoes_disponivel() {
+#if REDE_ORDENACAO_SIMD
+    static const ConjuntoInstrucoes conjunto = __builtin_cpu_supports("avx2")     ? ConjuntoInstrucoes::Avx2
+                                               : __builtin_cpu_supports("sse4.2") ? ConjuntoInstrucoes::Sse42
+                                                                                  : ConjuntoInstrucoes::Escalar;
+    return conjunto;
+#else
+    return ConjuntoInstrucoes::Escalar;
+#endif
+}
+
+/**
+ * @struct ChaveRede
+ * @brief Bijeção entre `T` e um inteiro com sinal da mesma largura que preserva a ordem, para que
+ * a rede só precise de mínimo e máximo de inteiros com sinal.
+ *
+ * - Com sinal: o próprio valor.
+ * - Sem sinal: inverte o bit de sinal.
+ * - Ponto flutuante: nos negativos, inverte todos os bits menos o de sinal, o que inverte a ordem
+ *   da magnitude. A ordem resultante é a de std::less, exceto que -0.0 vem antes de +0.0 e os NaN
+ *   vão para as pontas conforme o bit de sinal.
+ */
+template <typename T>
+struct ChaveRede {
+    using Inteiro = std::conditional_t<sizeof(T) == 4, std::int32_t, std::int64_t>;
+
+    static Inteiro codificar(T x) {
+        if constexpr (std::is_floating_point_v<T>) {
+            Inteiro b = std::bit_cast<Inteiro>(x);
+            return b ^ ((b >> (8 * sizeof(T) - 1)) & std::numeric_limits<Inteiro>::max());
+        } else if constexpr (std::is_unsigned_v<T>) {
+            return std::bit_cast<Inteiro>(static_cast<T>(x ^ (T(1) << (8 * sizeof(T) - 1))));
+        } else {
+            return static_cast<Inteiro>(x);
+        }
+    }
+
+    static T decodificar(Inteiro i) {
+        if constexpr (std::is_floating_point_v<T>) {
+            return std::bit_cast<T>(i ^ ((i >> (8 * sizeof(T) - 1)) & std::numeric_limits<Inteiro>::max()));
+        } else if constexpr (std::is_unsigned_v<T>) {
+            return static_cast<T>(std::bit_cast<T>(i) ^ (T(1) << (8 * sizeof(T) - 1)));
+        } else {
+            return static_cast<T>(i);
+        }
+    }
+};
+
+/// Tipos que as redes ordenam: inteiros de 32 e 64 bits, `float` e `double`.
+template <typename T>
+inline constexpr bool rede_suporta_v =
+    (std::is_integral_v<T> || std::is_floating_point_v<T>) && !std::is_same_v<T, bool> &&
+    (sizeof(T) == 4 || sizeof(T) == 8);
+
+/**
+ * @brief Direção em que `Comparador` ordena `T` se for std::less (1) ou std::greater (-1); 0 para
+ * qualquer outro comparador, que as redes não sabem reproduzir.
+ */
+template <typename T, typename Comparador>
+inline constexpr int rede_direcao_v =
+    (std::is_same_v<Comparador, std::less<>> || std::is_same_v<Comparador, std::less<T>>)         ? 1
+    : (std::is_same_v<Comparador, std::greater<>> || std::is_same_v<Comparador, std::greater<T>>) ? -1
+                                                                                                    : 0;
+
+/**
+ * @brief Indica se `ordenar_pequeno` pode usar as redes em [inicio, fim): elementos contíguos de
+ * um tipo que elas ordenam, com std::less ou std::greater. Os algoritmos que chamam
+ * `ordenar_pequeno` usam isto para escolher casos base maiores.
+ */
+template <typename Iterador, typename Comparador>
+inline constexpr bool rede_aplicavel_v =
+    std::contiguous_iterator<Iterador> && rede_suporta_v<typename std::iterator_traits<Iterador>::value_type> &&
+    rede_direcao_v<typename std::iterator_traits<Iterador>::value_type, Comparador> != 0;
+
+#if REDE_ORDENACAO_SIMD
+
+// --- Operações de cada conjunto de instruções ---
+//
+// Todas recebem os registradores por referência: assim o código genérico da rede, que não tem o
+// atributo target, nunca passa vetores AVX por valor. `passo_interno<M, B>` compara cada posição
+// i com a posição i ^ M do mesmo registrador e deixa o máximo nas posições com o bit B ligado.
+
+struct RedeAvx2Int32 {
+    using Elemento = std::int32_t;
+    using Vetor = __m256i;
+    static constexpr int LARGURA = 8;
+
+    [[gnu::target("avx2")]] static void carregar(Vetor& v, const Elemento* p) {
+        v = _mm256_load_si256(reinterpret_cast<const __m256i*>(p));
+    }
+    [[gnu::target("avx2")]] static void guardar(Elemento* p, const Vetor& v) {
+        _mm256_store_si256(reinterpret_cast<__m256i*>(p), v);
+    }
+    [[gnu::target("avx2")]] static void comparar_trocar(Vetor& a, Vetor& b) {
+        Vetor menor = _mm256_min_epi32(a, b);
+        b = _mm256_max_epi32(a, b);
+        a = menor;
+    }
+    [[gnu::target("avx2")]] static void comparar_trocar_invertido(Vetor& a, Vetor& b) {
+        const __m256i inverter = _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+        Vetor b_invertido = _mm256_permutevar8x32_epi32(b, inverter);
+        Vetor maior = _mm256_max_epi32(a, b_invertido);
+        a = _mm256_min_epi32(a, b_invertido);
+        b = _mm256_permutevar8x32_epi32(maior, inverter);
+    }
+    template <int M, int B>
+    [[gnu::target("avx2")]] static void passo_interno(Vetor& v) {
+        Vetor parceiro;
+        if constexpr (M < 4) {
+            parceiro = _mm256_shuffle_epi32(v, (0 ^ M) | ((1 ^ M) << 2) | ((2 ^ M) << 4) | ((3 ^ M) << 6));
+        } else {
+            parceiro = _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(0 ^ M, 1 ^ M, 2 ^ M, 3 ^ M, 4 ^ M, 5 ^ M, 6 ^ M, 7 ^ M));
+        }
+        constexpr int MASCARA = ((0 & B) ? 1 : 0) | ((1 & B) ? 2 : 0) | ((2 & B) ? 4 : 0) | ((3 & B) ? 8 : 0) |
+                                ((4 & B) ? 16 : 0) | ((5 & B) ? 32 : 0) | ((6 & B) ? 64 : 0) | ((7 & B) ? 128 : 0);
+        v = _mm256_blend_epi32(_mm256_min_epi32(v, parceiro), _mm256_max_epi32(v, parceiro), MASCARA);
+    }
+};
+
+struct RedeAvx2Int64 {
+    using Elemento = std::int64_t;
+    using Vetor = __m256i;
+    static constexpr int LARGURA = 4;
+
+    [[gnu::target("avx2")]] static void carregar(Vetor& v, const Elemento* p) {
+        v = _mm256_load_si256(reinterpret_cast<const __m256i*>(p));
+    }
+    [[gnu::target("avx2")]] static void guardar(Elemento* p, const Vetor& v) {
+        _mm256_store_si256(reinterpret_cast<__m256i*>(p), v);
+    }
+    // Não há mínimo e máximo de 64 bits no AVX2: onde a > b, troca os dois com ou-exclusivo.
+    [[gnu::target("avx2")]] static void comparar_trocar(Vetor& a, Vetor& b) {
+        Vetor diferenca = _mm256_and_si256(_mm256_xor_si256(a, b), _mm256_cmpgt_epi64(a, b));
+        a = _mm256_xor_si256(a, diferenca);
+        b = _mm256_xor_si256(b, diferenca);
+    }
+    [[gnu::target("avx2")]] static void comparar_trocar_invertido(Vetor& a, Vetor& b) {
+        Vetor b_invertido = _mm256_permute4x64_epi64(b, 0x1B);
+        comparar_trocar(a, b_invertido);
+        b = _mm256_permute4x64_epi64(b_invertido, 0x1B);
+    }
+    // Cada posição fica com o parceiro quando ele deve ir para lá: se for menor, nas posições sem
+    // o bit B; se for maior, nas posições com o bit B.
+    template <int M, int B>
+    [[gnu::target("avx2")]] static void passo_interno(Vetor& v) {
+        Vetor parceiro = _mm256_permute4x64_epi64(v, (0 ^ M) | ((1 ^ M) << 2) | ((2 ^ M) << 4) | ((3 ^ M) << 6));
+        const __m256i posicoes_do_maior = _mm256_setr_epi64x((0 & B) ? -1 : 0, (1 & B) ? -1 : 0, (2 & B) ? -1 : 0, (3 & B) ? -1 : 0);
+        Vetor trocar = _mm256_xor_si256(_mm256_cmpgt_epi64(v, parceiro), posicoes_do_maior);
+        v = _mm256_xor_si256(v, _mm256_and_si256(_mm256_xor_si256(v, parceiro), trocar));
+    }
+};
+
+struct RedeSse42Int32 {
+    using Elemento = std::int32_t;
+    using Vetor = __m128i;
+    static constexpr int LARGURA = 4;
+
+    [[gnu::target("sse4.2")]] static void carregar(Vetor& v, const Elemento* p) {
+        v = _mm_load_si128(reinterpret_cast<const __m128i*>(p));
+    }
+    [[gnu::target("sse4.2")]] static void guardar(Elemento* p, const Vetor& v) {
+        _mm_store_si128(reinterpret_cast<__m128i*>(p), v);
+    }
+    [[gnu::target("sse4.2")]] static void comparar_trocar(Vetor& a, Vetor& b) {
+        Vetor menor = _mm_min_epi32(a, b);
+        b = _mm_max_epi32(a, b);
+        a = menor;
+    }
+    [[gnu::target("sse4.2")]] static void comparar_trocar_invertido(Vetor& a, Vetor& b) {
+        Vetor b_invertido = _mm_shuffle_epi32(b, 0x1B);
+        Vetor maior = _mm_max_epi32(a, b_invertido);
+        a = _mm_min_epi32(a, b_invertido);
+        b = _mm_shuffle_epi32(maior, 0x1B);
+    }
+    template <int M, int B>
+    [[gnu::target("sse4.2")]] static void passo_interno(Vetor& v) {
+        Vetor parceiro = _mm_shuffle_epi32(v, (0 ^ M) | ((1 ^ M) << 2) | ((2 ^ M) << 4) | ((3 ^ M) << 6));
+        constexpr int MASCARA = ((0 & B) ? 0x03 : 0) | ((1 & B) ? 0x0C : 0) | ((2 & B) ? 0x30 : 0) | ((3 & B) ? 0xC0 : 0);
+        v = _mm_blend_epi16(_mm_min_epi32(v, parceiro), _mm_max_epi32(v, parceiro), MASCARA);
+    }
+};
+
+struct RedeSse42Int64 {
+    using Elemento = std::int64_t;
+    using Vetor = __m128i;
+    static constexpr int LARGURA = 2;
+
+    [[gnu::target("sse4.2")]] static void carregar(Vetor& v, const Elemento* p) {
+        v = _mm_load_si128(reinterpret_cast<const __m128i*>(p));
+    }
+    [[gnu::target("sse4.2")]] static void guardar(Elemento* p, const Vetor& v) {
+        _mm_store_si128(reinterpret_cast<__m128i*>(p), v);
+    }
+    [[gnu::target("sse4.2")]] static void comparar_trocar(Vetor& a, Vetor& b) {
+        Vetor diferenca = _mm_and_si128(_mm_xor_si128(a, b), _mm_cmpgt_epi64(a, b));
+        a = _mm_xor_si128(a, diferenca);
+        b = _mm_xor_si128(b, diferenca);
+    }
+    [[gnu::target("sse4.2")]] static void comparar_trocar_invertido(Vetor& a, Vetor& b) {
+        Vetor b_invertido = _mm_shuffle_epi32(b, 0x4E);
+        comparar_trocar(a, b_invertido);
+        b = _mm_shuffle_epi32(b_invertido, 0x4E);
+    }
+    template <int M, int B>
+    [[gnu::target("sse4.2")]] static void passo_interno(Vetor& v) {
+        static_assert(M == 1 && B == 1, "Com duas posições por registrador, só há o passo de distância 1.");
+        Vetor parceiro = _mm_shuffle_epi32(v, 0x4E);
+        Vetor trocar = _mm_xor_si128(_mm_cmpgt_epi64(v, parceiro), _mm_set_epi64x(-1, 0));
+        v = _mm_xor_si128(v, _mm_and_si128(_mm_xor_si128(v, parceiro), trocar));
+    }
+};
+
+// --- A rede bitônica, genérica no conjunto de instruções ---
+//
+// Variante em que todas as comparações são crescentes: para cada tamanho de bloco K = 2, 4, ..., N,
+// um passo "espelho" compara a posição p de cada bloco com a posição K - 1 - p, e os passos
+// seguintes, de distância K/4, K/8, ..., 1, comparam p com p + J. Distâncias de pelo menos uma
+// largura de registrador comparam registradores inteiros; as menores embaralham posições dentro
+// de cada registrador.
+
+template <typename Operacoes, int N, int J>
+void rede_bitonica_limpar(typename Operacoes::Vetor* r) {
+    if constexpr (J >= 1) {
+        constexpr int W = Operacoes::LARGURA;
+        constexpr int R = N / W;
+        if constexpr (J >= W) {
+            constexpr int JR = J / W;
+            for (int i = 0; i < R; ++i) {
+                if ((i & JR) == 0) Operacoes::comparar_trocar(r[i], r[i + JR]);
+            }
+        } else {
+            for (int i = 0; i < R; ++i) Operacoes::template passo_interno<J, J>(r[i]);
+        }
+        rede_bitonica_limpar<Operacoes, N, J / 2>(r);
+    }
+}
+
+template <typename Operacoes, int N, int K>
+void rede_bitonica_fase(typename Operacoes::Vetor* r) {
+    constexpr int W = Operacoes::LARGURA;
+    constexpr int R = N / W;
+    if constexpr (K <= W) {
+        for (int i = 0; i < R; ++i) Operacoes::template passo_interno<K - 1, K / 2>(r[i]);
+    } else {
+        constexpr int KR = K / W;
+        for (int bloco = 0; bloco < R; bloco += KR) {
+            for (int q = 0; q < KR / 2; ++q) Operacoes::comparar_trocar_invertido(r[bloco + q], r[bloco + KR - 1 - q]);
+        }
+    }
+    rede_bitonica_limpar<Operacoes, N, K / 4>(r);
+    if constexpr (2 * K <= N) rede_bitonica_fase<Operacoes, N, 2 * K>(r);
+}
+
+template <typename Operacoes, int N>
+void rede_bitonica_registradores(typename Operacoes::Elemento* buffer) {
+    constexpr int R = N / Operacoes::LARGURA;
+    typename Operacoes::Vetor r[R];
+    for (int i = 0; i < R; ++i) Operacoes::carregar(r[i], buffer + i * Operacoes::LARGURA);
+    rede_bitonica_fase<Operacoes, N, 2>(r);
+    for (int i = 0; i < R; ++i) Operacoes::guardar(buffer + i * Operacoes::LARGURA, r[i]);
+}
+
+/**
+ * @brief Ordena `buffer`, com espaço para REDE_ORDENACAO_MAXIMO elementos alinhado a 32 bytes, do
+ * qual os `n` primeiros são válidos. O restante é preenchido com o maior valor.
+ */
+template <typename Operacoes>
+void rede_bitonica(typename Operacoes::Elemento* buffer, std::size_t n) {
+    using Elemento = typename Operacoes::Elemento;
+    constexpr std::size_t W = Operacoes::LARGURA;
+    const std::size_t tamanho = std::max(std::bit_ceil(n), W);
+    std::fill(buffer + n, buffer + tamanho, std::numeric_limits<Elemento>::max());
+    switch (tamanho) {
+    case 2: if constexpr (W <= 2) rede_bitonica_registradores<Operacoes, 2>(buffer); break;
+    case 4: if constexpr (W <= 4) rede_bitonica_registradores<Operacoes, 4>(buffer); break;
+    case 8: rede_bitonica_registradores<Operacoes, 8>(buffer); break;
+    case 16: rede_bitonica_registradores<Operacoes, 16>(buffer); break;
+    case 32: rede_bitonica_registradores<Operacoes, 32>(buffer); break;
+    default: rede_bitonica_registradores<Operacoes, 64>(buffer); break;
+    }
+}
+
+// Pontos de entrada por conjunto de instruções: `flatten` gera a rede inteira dentro de cada um.
+[[gnu::target("avx2"), gnu::flatten]] inline void rede_bitonica_avx2(std::int32_t* buffer, std::size_t n) {
+    rede_bitonica<RedeAvx2Int32>(buffer, n);
+}
+[[gnu::target("avx2"), gnu::flatten]] inline void rede_bitonica_avx2(std::int64_t* buffer, std::size_t n) {
+    rede_bitonica<RedeAvx2Int64>(buffer, n);
+}
+[[gnu::target("sse4.2"), gnu::flatten]] inline void rede_bitonica_sse42(std::int32_t* buffer, std::size_t n) {
+    rede_bitonica<RedeSse42Int32>(buffer, n);
+}
+[[gnu::target("sse4.2"), gnu::flatten]] inline void rede_bitonica_sse42(std::int64_t* buffer, std::size_t n) {
+    rede_bitonica<RedeSse42Int64>(buffer, n);
+}
+
+#endif // REDE_ORDENACAO_SIMD
+
+/**
+ * @brief Ordena os `n` elementos de `dados` em ordem crescente com uma rede de ordenação.
+ *
+ * Não é estável: para inteiros isso não se nota, mas -0.0 e +0.0 podem trocar de ordem (a rede
+ * coloca -0.0 antes).
+ *
+ * @param dados Os elementos a ordenar.
+ * @param n Quantidade de elementos, no máximo REDE_ORDENACAO_MAXIMO.
+ * @param conjunto Implementação a usar; por padrão, a melhor disponível. Um conjunto que o
+ * processador não suporta tem comportamento indefinido.
+ *
+ * @throws std::invalid_argument se n > REDE_ORDENACAO_MAXIMO.
+ *
+ * @complexity Time: O(N log^2 N) comparações para N = n arredondado para a potência de 2
+ * seguinte, feitas de 4 a 8 por instrução; Space: O(1)
+ */
+template <typename T>
+void ordenar_rede(T* dados, std::size_t n, ConjuntoInstrucoes conjunto = conjunto_instrucoes_disponivel()) {
+    static_assert(rede_suporta_v<T>, "As redes ordenam apenas inteiros de 32 ou 64 bits, float e double.");
+    if (n > REDE_ORDENACAO_MAXIMO) {
+        throw std::invalid_argument("A rede de ordenação aceita no máximo 64 elementos.");
+    }
+    if (n < 2) return;
+#if REDE_ORDENACAO_SIMD
+    if (conjunto != ConjuntoInstrucoes::Escalar) {
+        using Chave = ChaveRede<T>;
+        alignas(32) typename Chave::Inteiro buffer[REDE_ORDENACAO_MAXIMO];
+        for (std::size_t i = 0; i < n; ++i) buffer[i] = Chave::codificar(dados[i]);
+        if (conjunto == ConjuntoInstrucoes::Avx2) {
+            rede_bitonica_avx2(buffer, n);
+        } else {
+            rede_bitonica_sse42(buffer, n);
+        }
+        for (std::size_t i = 0; i < n; ++i) dados[i] = Chave::decodificar(buffer[i]);
+        return;
+    }
+#endif
+    insertion_sort_sem_desvios(dados, dados + n, std::less<>());
+}
+
+// Abaixo deste tamanho, a inserção sem desvios é mais rápida que completar e carregar a rede.
+constexpr std::ptrdiff_t REDE_ORDENACAO_MINIMO = 8;
+
+/**
+ * @brief Ordena um intervalo pequeno (o caso base dos algoritmos de divisão e conquista): com uma
+ * rede de ordenação quando o tipo, o comparador e o tamanho permitem, com inserção sem desvios
+ * para os demais inteiros e com inserção comum para o resto. Não é estável.
+ *
+ * A inserção sem desvios não é usada com ponto flutuante: o GCC não transforma a seleção
+ * condicional de `double` em cmov, e ela fica mais lenta que a inserção comum.
+ */
+template <typename Iterador, typename Comparador>
+void ordenar_pequeno(Iterador inicio, Iterador fim, Comparador& comp) {
+    using T = typename std::iterator_traits<Iterador>::value_type;
+    constexpr int DIRECAO = rede_direcao_v<T, Comparador>;
+    if constexpr (rede_aplicavel_v<Iterador, Comparador>) {
+        const std::ptrdiff_t n = fim - inicio;
+        if (n >= REDE_ORDENACAO_MINIMO && n <= static_cast<std::ptrdiff_t>(REDE_ORDENACAO_MAXIMO)) {
+            ordenar_rede(std::to_address(inicio), static_cast<std::size_t>(n));
+            if constexpr (DIRECAO < 0) std::reverse(inicio, fim);
+            return;
+        }
+    }
+    if constexpr (std::is_integral_v<T> && DIRECAO != 0) {
+        insertion_sort_sem_desvios(inicio, fim, comp);
+    } else {
+        insertion_sort(inicio, fim, comp);
+    }
+}
+
+/**
+ * @brief Como `ordenar_pequeno`, mas estável: a rede só é usada com inteiros, em que elementos
+ * iguais são indistinguíveis (com ponto flutuante, -0.0 e +0.0 poderiam trocar de lugar).
+ */
+template <typename Iterador, typename Comparador>
+void ordenar_pequeno_estavel(Iterador inicio, Iterador fim, Comparador& comp) {
+    using T = typename std::iterator_traits<Iterador>::value_type;
+    if constexpr (std::is_integral_v<T>) {
+        ordenar_pequeno(inicio, fim, comp);
+    } else {
+        insertion_sort(inicio, fim, comp);
+    }
+}
+
+#endif // REDE_ORDENACAO_HPP
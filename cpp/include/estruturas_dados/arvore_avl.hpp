@@ -2,13 +2,20 @@
 #define ARVORE_AVL_HPP
 
 #include <algorithm> // Para std::max
+#include <cstddef>   // Para std::size_t, std::ptrdiff_t
+#include <iterator>  // Para std::forward_iterator_tag
 #include <stdexcept> // Para std::runtime_error
+#include <utility>   // Para std::swap
 #include <vector>
 
 /**
  * @file arvore_avl.hpp
  * @brief Contém a implementação de uma Árvore AVL (Árvore de Busca Binária Autobalanceada).
  *
+ * Cada nó é aumentado com o tamanho da sua subárvore e com um ponteiro para o pai. O tamanho
+ * permite responder estatísticas de ordem (k-ésimo, rank, contagem em intervalo) em O(log n)
+ * e o ponteiro para o pai permite um iterador in-order que não aloca memória.
+ *
  * @note Como esta é uma classe de template, toda a implementação está neste arquivo de cabeçalho.
  */
 
@@ -19,44 +26,85 @@ private:
         Chave chave;
         Node* esquerda;
         Node* direita;
+        Node* pai;
         int altura;
+        std::size_t tamanho; // Número de nós na subárvore enraizada neste nó
 
-        Node(Chave c) : chave(c), esquerda(nullptr), direita(nullptr), altura(1) {}
+        Node(Chave c) : chave(c), esquerda(nullptr), direita(nullptr), pai(nullptr), altura(1), tamanho(1) {}
     };
 
     Node* raiz;
 
     // --- Funções Auxiliares ---
 
-    int altura(Node* n) {
+    static int altura(Node* n) {
         return (n == nullptr) ? 0 : n->altura;
     }
 
-    int obter_balanco(Node* n) {
+    static std::size_t tamanho(Node* n) {
+        return (n == nullptr) ? 0 : n->tamanho;
+    }
+
+    // Recalcula altura e tamanho de 'n' a partir dos filhos e corrige o ponteiro 'pai' deles.
+    static void atualizar(Node* n) {
+        n->altura = 1 + std::max(altura(n->esquerda), altura(n->direita));
+        n->tamanho = 1 + tamanho(n->esquerda) + tamanho(n->direita);
+        if (n->esquerda != nullptr) n->esquerda->pai = n;
+        if (n->direita != nullptr) n->direita->pai = n;
+    }
+
+    static int obter_balanco(Node* n) {
         if (n == nullptr) return 0;
         return altura(n->esquerda) - altura(n->direita);
     }
 
-    Node* rotacao_direita(Node* y) {
+    static Node* rotacao_direita(Node* y) {
         Node* x = y->esquerda;
         Node* T2 = x->direita;
         x->direita = y;
         y->esquerda = T2;
-        y->altura = std::max(altura(y->esquerda), altura(y->direita)) + 1;
-        x->altura = std::max(altura(x->esquerda), altura(x->direita)) + 1;
+        atualizar(y);
+        atualizar(x);
         return x;
     }
 
-    Node* rotacao_esquerda(Node* x) {
+    static Node* rotacao_esquerda(Node* x) {
         Node* y = x->direita;
         Node* T2 = y->esquerda;
         y->esquerda = x;
         x->direita = T2;
-        x->altura = std::max(altura(x->esquerda), altura(x->direita)) + 1;
-        y->altura = std::max(altura(y->esquerda), altura(y->direita)) + 1;
+        atualizar(x);
+        atualizar(y);
         return y;
     }
 
+    // Atualiza 'no' e aplica as rotações necessárias para restaurar a propriedade AVL.
+    static Node* balancear(Node* no) {
+        atualizar(no);
+        int balanco = obter_balanco(no);
+
+        // LL e LR
+        if (balanco > 1) {
+            if (obter_balanco(no->esquerda) >= 0) // LL
+                return rotacao_direita(no);
+            else { // LR
+                no->esquerda = rotacao_esquerda(no->esquerda);
+                return rotacao_direita(no);
+            }
+        }
+        // RR e RL
+        if (balanco < -1) {
+            if (obter_balanco(no->direita) <= 0) // RR
+                return rotacao_esquerda(no);
+            else { // RL
+                no->direita = rotacao_direita(no->direita);
+                return rotacao_esquerda(no);
+            }
+        }
+
+        return no;
+    }
+
     Node* inserir_helper(Node* no, Chave chave) {
         // 1. Inserção padrão de BST
         if (no == nullptr) return new Node(chave);
@@ -67,8 +115,8 @@ private:
         else
             return no; // Chaves duplicadas não são permitidas
 
-        // 2. Atualizar altura do nó ancestral
-        no->altura = 1 + std::max(altura(no->esquerda), altura(no->direita));
+        // 2. Atualizar altura e tamanho do nó ancestral
+        atualizar(no);
 
         // 3. Obter o fator de balanço e aplicar rotações se necessário
         int balanco = obter_balanco(no);
@@ -96,13 +144,20 @@ private:
         return no;
     }
 
-    Node* no_valor_minimo(Node* no) {
+    static Node* no_valor_minimo(Node* no) {
         Node* atual = no;
         while (atual->esquerda != nullptr)
             atual = atual->esquerda;
         return atual;
     }
 
+    static Node* no_valor_maximo(Node* no) {
+        Node* atual = no;
+        while (atual->direita != nullptr)
+            atual = atual->direita;
+        return atual;
+    }
+
     Node* remover_helper(Node* no_raiz, Chave chave) {
         // 1. Remoção padrão de BST
         if (no_raiz == nullptr) return no_raiz;
@@ -129,32 +184,141 @@ private:
 
         if (no_raiz == nullptr) return no_raiz;
 
-        // 2. Atualizar altura e rebalancear (similar à inserção)
-        no_raiz->altura = 1 + std::max(altura(no_raiz->esquerda), altura(no_raiz->direita));
-        int balanco = obter_balanco(no_raiz);
+        // 2. Atualizar altura e tamanho e rebalancear (similar à inserção)
+        return balancear(no_raiz);
+    }
 
-        // LL e LR
-        if (balanco > 1) {
-            if (obter_balanco(no_raiz->esquerda) >= 0) // LL
-                return rotacao_direita(no_raiz);
-            else { // LR
-                no_raiz->esquerda = rotacao_esquerda(no_raiz->esquerda);
-                return rotacao_direita(no_raiz);
+    // --- Junção e divisão (join-based AVL) ---
+
+    // Junta 'esq' < 'meio' < 'dir' quando 'esq' é mais alta que 'dir' por mais de 1 nível.
+    static Node* join_direita(Node* esq, Node* meio, Node* dir) {
+        Node* l = esq->esquerda;
+        Node* c = esq->direita;
+        if (altura(c) <= altura(dir) + 1) {
+            meio->esquerda = c;
+            meio->direita = dir;
+            atualizar(meio);
+            if (altura(meio) <= altura(l) + 1) {
+                esq->direita = meio;
+                atualizar(esq);
+                return esq;
             }
+            esq->direita = rotacao_direita(meio);
+            atualizar(esq);
+            return rotacao_esquerda(esq);
         }
-        // RR e RL
-        if (balanco < -1) {
-            if (obter_balanco(no_raiz->direita) <= 0) // RR
-                return rotacao_esquerda(no_raiz);
-            else { // RL
-                no_raiz->direita = rotacao_direita(no_raiz->direita);
-                return rotacao_esquerda(no_raiz);
+        Node* novo = join_direita(c, meio, dir);
+        esq->direita = novo;
+        atualizar(esq);
+        if (altura(novo) <= altura(l) + 1) return esq;
+        return rotacao_esquerda(esq);
+    }
+
+    // Simétrico de join_direita, para quando 'dir' é a árvore mais alta.
+    static Node* join_esquerda(Node* esq, Node* meio, Node* dir) {
+        Node* r = dir->direita;
+        Node* c = dir->esquerda;
+        if (altura(c) <= altura(esq) + 1) {
+            meio->esquerda = esq;
+            meio->direita = c;
+            atualizar(meio);
+            if (altura(meio) <= altura(r) + 1) {
+                dir->esquerda = meio;
+                atualizar(dir);
+                return dir;
             }
+            dir->esquerda = rotacao_esquerda(meio);
+            atualizar(dir);
+            return rotacao_direita(dir);
         }
+        Node* novo = join_esquerda(esq, meio, c);
+        dir->esquerda = novo;
+        atualizar(dir);
+        if (altura(novo) <= altura(r) + 1) return dir;
+        return rotacao_direita(dir);
+    }
+
+    // Junta duas árvores AVL e um nó avulso, com todas as chaves de 'esq' < 'meio' < 'dir'.
+    // Custo O(|altura(esq) - altura(dir)| + 1).
+    static Node* join_helper(Node* esq, Node* meio, Node* dir) {
+        if (altura(esq) > altura(dir) + 1) return join_direita(esq, meio, dir);
+        if (altura(dir) > altura(esq) + 1) return join_esquerda(esq, meio, dir);
+        meio->esquerda = esq;
+        meio->direita = dir;
+        atualizar(meio);
+        return meio;
+    }
 
-        return no_raiz;
+    // Desacopla o nó de menor chave de 'no' e o devolve em 'minimo'.
+    static Node* extrair_minimo(Node* no, Node*& minimo) {
+        if (no->esquerda == nullptr) {
+            minimo = no;
+            Node* direita = no->direita;
+            no->direita = nullptr;
+            atualizar(no);
+            return direita;
+        }
+        no->esquerda = extrair_minimo(no->esquerda, minimo);
+        return balancear(no);
+    }
+
+    // Junta duas árvores com todas as chaves de 'esq' menores que as de 'dir'.
+    static Node* join2_helper(Node* esq, Node* dir) {
+        if (esq == nullptr) return dir;
+        if (dir == nullptr) return esq;
+        Node* minimo = nullptr;
+        Node* resto = extrair_minimo(dir, minimo);
+        return join_helper(esq, minimo, resto);
+    }
+
+    // Divide 'no' em 'menores' (< chave) e 'maiores' (> chave).
+    // Retorna o nó com chave igual, desacoplado, ou nullptr se não existir.
+    static Node* split_helper(Node* no, const Chave& chave, Node*& menores, Node*& maiores) {
+        if (no == nullptr) {
+            menores = maiores = nullptr;
+            return nullptr;
+        }
+        Node* l = no->esquerda;
+        Node* r = no->direita;
+        no->esquerda = no->direita = nullptr;
+        if (chave < no->chave) {
+            Node* meio_dir = nullptr;
+            Node* igual = split_helper(l, chave, menores, meio_dir);
+            maiores = join_helper(meio_dir, no, r);
+            return igual;
+        }
+        if (chave > no->chave) {
+            Node* meio_esq = nullptr;
+            Node* igual = split_helper(r, chave, meio_esq, maiores);
+            menores = join_helper(l, no, meio_esq);
+            return igual;
+        }
+        menores = l;
+        maiores = r;
+        atualizar(no);
+        return no;
+    }
+
+    static Node* como_raiz(Node* no) {
+        if (no != nullptr) no->pai = nullptr;
+        return no;
+    }
+
+    // Conta as chaves menores que 'chave' (ou menores ou iguais, se 'inclusivo').
+    std::size_t contar_menores(const Chave& chave, bool inclusivo) const {
+        std::size_t contagem = 0;
+        Node* atual = raiz;
+        while (atual != nullptr) {
+            if (atual->chave < chave || (inclusivo && !(chave < atual->chave))) {
+                contagem += tamanho(atual->esquerda) + 1;
+                atual = atual->direita;
+            } else {
+                atual = atual->esquerda;
+            }
+        }
+        return contagem;
     }
-    
+
     void in_order_helper(Node* no, std::vector<Chave>& resultado) const {
         if (no != nullptr) {
             in_order_helper(no->esquerda, resultado);
@@ -163,7 +327,7 @@ private:
         }
     }
 
-    void destruir_arvore(Node* no) {
+    static void destruir_arvore(Node* no) {
         if (no != nullptr) {
             destruir_arvore(no->esquerda);
             destruir_arvore(no->direita);
@@ -171,18 +335,79 @@ private:
         }
     }
 
+    explicit ArvoreAVL(Node* r) : raiz(como_raiz(r)) {}
+
 public:
+    /**
+     * @class Iterador
+     * @brief Iterador in-order (crescente) somente leitura.
+     *
+     * Avança pelos ponteiros para o pai, sem pilha auxiliar e sem alocação. Um percurso
+     * completo custa O(n); um único incremento custa O(log n) no pior caso.
+     * Qualquer inserção ou remoção invalida os iteradores existentes.
+     */
+    class Iterador {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Chave;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Chave*;
+        using reference = const Chave&;
+
+        Iterador() : atual(nullptr) {}
+
+        reference operator*() const { return atual->chave; }
+        pointer operator->() const { return &atual->chave; }
+
+        Iterador& operator++() {
+            if (atual->direita != nullptr) {
+                atual = no_valor_minimo(atual->direita);
+            } else {
+                Node* filho = atual;
+                atual = atual->pai;
+                while (atual != nullptr && filho == atual->direita) {
+                    filho = atual;
+                    atual = atual->pai;
+                }
+            }
+            return *this;
+        }
+
+        Iterador operator++(int) {
+            Iterador copia = *this;
+            ++(*this);
+            return copia;
+        }
+
+        bool operator==(const Iterador& outro) const { return atual == outro.atual; }
+        bool operator!=(const Iterador& outro) const { return atual != outro.atual; }
+
+    private:
+        friend class ArvoreAVL;
+        explicit Iterador(Node* n) : atual(n) {}
+        Node* atual;
+    };
+
     ArvoreAVL() : raiz(nullptr) {}
     ~ArvoreAVL() { destruir_arvore(raiz); }
 
+    ArvoreAVL(const ArvoreAVL&) = delete;
+    ArvoreAVL& operator=(const ArvoreAVL&) = delete;
+
+    ArvoreAVL(ArvoreAVL&& outra) noexcept : raiz(outra.raiz) { outra.raiz = nullptr; }
+    ArvoreAVL& operator=(ArvoreAVL&& outra) noexcept {
+        std::swap(raiz, outra.raiz);
+        return *this;
+    }
+
     void inserir(Chave chave) {
-        raiz = inserir_helper(raiz, chave);
+        raiz = como_raiz(inserir_helper(raiz, chave));
     }
 
     void remover(Chave chave) {
-        raiz = remover_helper(raiz, chave);
+        raiz = como_raiz(remover_helper(raiz, chave));
     }
-    
+
     bool buscar(Chave chave) const {
         Node* atual = raiz;
         while (atual != nullptr) {
@@ -195,12 +420,151 @@ public:
         }
         return false;
     }
-    
+
     std::vector<Chave> in_order_traversal() const {
         std::vector<Chave> resultado;
         in_order_helper(raiz, resultado);
         return resultado;
     }
+
+    /**
+     * @brief Retorna o número de chaves armazenadas.
+     * @complexity Time: O(1)
+     */
+    std::size_t tamanho() const {
+        return tamanho(raiz);
+    }
+
+    /**
+     * @brief Retorna a k-ésima menor chave (base 0), de forma que `k_esimo(rank(x)) == x`.
+     * @throws std::out_of_range se k >= tamanho().
+     * @complexity Time: O(log n), Space: O(1)
+     */
+    const Chave& k_esimo(std::size_t k) const {
+        if (k >= tamanho(raiz)) {
+            throw std::out_of_range("k fora do intervalo da árvore.");
+        }
+        Node* atual = raiz;
+        while (true) {
+            std::size_t esq = tamanho(atual->esquerda);
+            if (k < esq) {
+                atual = atual->esquerda;
+            } else if (k == esq) {
+                return atual->chave;
+            } else {
+                k -= esq + 1;
+                atual = atual->direita;
+            }
+        }
+    }
+
+    /**
+     * @brief Retorna quantas chaves são estritamente menores que `chave`.
+     * @complexity Time: O(log n), Space: O(1)
+     */
+    std::size_t rank(const Chave& chave) const {
+        return contar_menores(chave, false);
+    }
+
+    /**
+     * @brief Conta as chaves no intervalo fechado [a, b]. Retorna 0 se a > b.
+     * @complexity Time: O(log n), Space: O(1)
+     */
+    std::size_t contar_intervalo(const Chave& a, const Chave& b) const {
+        if (b < a) return 0;
+        return contar_menores(b, true) - contar_menores(a, false);
+    }
+
+    Iterador begin() const {
+        return Iterador(raiz == nullptr ? nullptr : no_valor_minimo(raiz));
+    }
+
+    Iterador end() const {
+        return Iterador();
+    }
+
+    /**
+     * @brief Retorna um iterador para a primeira chave >= `chave`, ou end() se não houver.
+     * @complexity Time: O(log n), Space: O(1)
+     */
+    Iterador lower_bound(const Chave& chave) const {
+        Node* atual = raiz;
+        Node* candidato = nullptr;
+        while (atual != nullptr) {
+            if (atual->chave < chave) {
+                atual = atual->direita;
+            } else {
+                candidato = atual;
+                atual = atual->esquerda;
+            }
+        }
+        return Iterador(candidato);
+    }
+
+    /**
+     * @brief Divide a árvore em torno de `chave`.
+     *
+     * Após a chamada, esta árvore mantém apenas as chaves menores que `chave` e a árvore
+     * retornada contém todas as chaves maiores ou iguais a `chave`. Nenhum nó é copiado.
+     *
+     * @complexity Time: O(log n)
+     */
+    ArvoreAVL split(const Chave& chave) {
+        Node* menores = nullptr;
+        Node* maiores = nullptr;
+        Node* igual = split_helper(raiz, chave, menores, maiores);
+        if (igual != nullptr) {
+            maiores = join_helper(nullptr, igual, maiores);
+        }
+        raiz = como_raiz(menores);
+        return ArvoreAVL(maiores);
+    }
+
+    /**
+     * @brief Move todas as chaves de `outra` para esta árvore, deixando `outra` vazia.
+     *
+     * Exige que todas as chaves desta árvore sejam menores que todas as chaves de `outra`,
+     * que é exatamente o que `split` produz.
+     *
+     * @throws std::invalid_argument se os intervalos de chaves se sobrepuserem.
+     * @complexity Time: O(log n)
+     */
+    void join(ArvoreAVL& outra) {
+        if (raiz != nullptr && outra.raiz != nullptr &&
+            !(no_valor_maximo(raiz)->chave < no_valor_minimo(outra.raiz)->chave)) {
+            throw std::invalid_argument("As chaves de 'outra' devem ser maiores que todas as desta árvore.");
+        }
+        raiz = como_raiz(join2_helper(raiz, outra.raiz));
+        outra.raiz = nullptr;
+    }
+
+    /**
+     * @brief Remove todas as chaves no intervalo fechado [a, b].
+     *
+     * Usa dois `split` e um `join`, portanto a reestruturação custa O(log n); apenas a
+     * liberação dos k nós removidos é linear em k.
+     *
+     * @return O número de chaves removidas.
+     * @complexity Time: O(log n + k)
+     */
+    std::size_t remover_intervalo(const Chave& a, const Chave& b) {
+        if (b < a) return 0;
+        Node* menores = nullptr;
+        Node* resto = nullptr;
+        Node* igual_a = split_helper(raiz, a, menores, resto);
+
+        Node* meio = nullptr;
+        Node* maiores = nullptr;
+        Node* igual_b = split_helper(resto, b, meio, maiores);
+
+        std::size_t removidos = tamanho(meio) + (igual_a != nullptr) + (igual_b != nullptr);
+        destruir_arvore(meio);
+        delete igual_a;
+        delete igual_b;
+
+        raiz = como_raiz(join2_helper(menores, maiores));
+        return removidos;
+    }
 };
 
-#endif // ARVORE_AVL_HPP
\ No newline at end of file
+#endif // ARVORE_AVL_HPP
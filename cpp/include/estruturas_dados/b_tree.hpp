@@ -0,0 +1,922 @@
+#ifndef B_TREE_HPP
+#define B_TREE_HPP
+
+#include <vector>
+#include <bit>       // Para std::popcount
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+
+// Sem -mavx2, o caminho AVX2 da busca no nó é compilado à parte com `target("avx2")` e
+// escolhido em tempo de execução, como em rede_ordenacao.hpp.
+#if !defined(__AVX2__) && (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) && !defined(__clang__)
+#define B_TREE_AVX2_DINAMICO 1
+#define B_TREE_ALVO_AVX2 [[gnu::target("avx2")]]
+#else
+#define B_TREE_AVX2_DINAMICO 0
+#define B_TREE_ALVO_AVX2
+#endif
+
+/**
+ * @file b_tree.hpp
+ * @brief Contém a implementação de uma B+-tree em memória, com nós dimensionados em linhas de
+ * cache, busca dentro do nó com SIMD, folhas encadeadas para varreduras de intervalo e
+ * carga em lote (bulk loading) a partir de dados ordenados, e de uma B-tree persistente em
+ * arquivo, acessada por páginas mapeadas em memória (`BTreeEmDisco`).
+ *
+ * @note Como BPlusTree é uma classe de template, toda a sua implementação está neste arquivo
+ * de cabeçalho. A `BTreeEmDisco` não é template e é implementada em b_tree.cpp.
+ */
+
+// --- Busca dentro do nó ---
+//
+// Como as chaves de um nó estão ordenadas, a posição de x é simplesmente a quantidade de
+// chaves menores que x. Essa contagem não tem desvios dependentes dos dados e, para inteiros
+// com sinal de 32 e 64 bits, é feita com comparações SIMD de 4 ou 8 chaves por instrução.
+// Para os demais tipos, o laço escalar equivalente costuma ser vetorizado pelo compilador.
+//
+// Com AVX2 (habilitado na compilação ou, no GCC em x86, detectado em tempo de execução), as duas
+// larguras usam registradores de 256 bits. Sem AVX2, só `int32_t` tem caminho SSE2: a comparação
+// de inteiros de 64 bits com sinal (pcmpgtq) só existe a partir do SSE4.2, e `int64_t` fica no
+// laço escalar.
+
+/**
+ * @brief Se o processador suporta AVX2; detectado uma única vez.
+ */
+inline bool b_tree_avx2_disponivel() {
+#if defined(__AVX2__)
+    return true;
+#elif B_TREE_AVX2_DINAMICO
+    static const bool disponivel = __builtin_cpu_supports("avx2");
+    return disponivel;
+#else
+    return false;
+#endif
+}
+
+#if defined(__AVX2__) || B_TREE_AVX2_DINAMICO
+/**
+ * @brief Parte AVX2 de contar_chaves_menores: conta em blocos inteiros e devolve em `i` onde parou.
+ */
+template <typename Chave>
+B_TREE_ALVO_AVX2 int contar_chaves_menores_avx2(const Chave* chaves, int num, const Chave& x, int& i) {
+    int contagem = 0;
+    if constexpr (std::is_same_v<Chave, std::int32_t>) {
+        const __m256i alvo = _mm256_set1_epi32(x);
+        for (; i + 8 <= num; i += 8) {
+            __m256i bloco = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(chaves + i));
+            __m256i menores = _mm256_cmpgt_epi32(alvo, bloco);
+            contagem += std::popcount<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(menores)));
+        }
+    } else if constexpr (std::is_same_v<Chave, std::int64_t>) {
+        const __m256i alvo = _mm256_set1_epi64x(x);
+        for (; i + 4 <= num; i += 4) {
+            __m256i bloco = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(chaves + i));
+            __m256i menores = _mm256_cmpgt_epi64(alvo, bloco);
+            contagem += std::popcount<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(menores)));
+        }
+    }
+    return contagem;
+}
+
+/**
+ * @brief Parte AVX2 de contar_chaves_menores_ou_iguais: conta as chaves maiores que `x`.
+ */
+template <typename Chave>
+B_TREE_ALVO_AVX2 int contar_chaves_maiores_avx2(const Chave* chaves, int num, const Chave& x, int& i) {
+    int maiores = 0;
+    if constexpr (std::is_same_v<Chave, std::int32_t>) {
+        const __m256i alvo = _mm256_set1_epi32(x);
+        for (; i + 8 <= num; i += 8) {
+            __m256i bloco = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(chaves + i));
+            __m256i gt = _mm256_cmpgt_epi32(bloco, alvo);
+            maiores += std::popcount<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(gt)));
+        }
+    } else if constexpr (std::is_same_v<Chave, std::int64_t>) {
+        const __m256i alvo = _mm256_set1_epi64x(x);
+        for (; i + 4 <= num; i += 4) {
+            __m256i bloco = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(chaves + i));
+            __m256i gt = _mm256_cmpgt_epi64(bloco, alvo);
+            maiores += std::popcount<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(gt)));
+        }
+    }
+    return maiores;
+}
+#endif
+
+/**
+ * @brief Conta quantas das `num` primeiras chaves são menores que `x` (equivale a lower_bound).
+ */
+template <typename Chave>
+inline int contar_chaves_menores(const Chave* chaves, int num, const Chave& x) {
+    int i = 0;
+    int contagem = 0;
+#if defined(__AVX2__) || B_TREE_AVX2_DINAMICO
+    if constexpr (std::is_same_v<Chave, std::int32_t> || std::is_same_v<Chave, std::int64_t>) {
+        if (b_tree_avx2_disponivel()) contagem = contar_chaves_menores_avx2(chaves, num, x, i);
+    }
+#endif
+#if defined(__SSE2__) || defined(_M_X64)
+    if constexpr (std::is_same_v<Chave, std::int32_t>) {
+        const __m128i alvo = _mm_set1_epi32(x);
+        for (; i + 4 <= num; i += 4) {
+            __m128i bloco = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chaves + i));
+            __m128i menores = _mm_cmplt_epi32(bloco, alvo);
+            contagem += std::popcount<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(menores)));
+        }
+    }
+#endif
+    for (; i < num; ++i) {
+        contagem += chaves[i] < x;
+    }
+    return contagem;
+}
+
+/**
+ * @brief Conta quantas das `num` primeiras chaves são menores ou iguais a `x` (equivale a upper_bound).
+ */
+template <typename Chave>
+inline int contar_chaves_menores_ou_iguais(const Chave* chaves, int num, const Chave& x) {
+    int i = 0;
+    int maiores = 0;
+#if defined(__AVX2__) || B_TREE_AVX2_DINAMICO
+    if constexpr (std::is_same_v<Chave, std::int32_t> || std::is_same_v<Chave, std::int64_t>) {
+        if (b_tree_avx2_disponivel()) maiores = contar_chaves_maiores_avx2(chaves, num, x, i);
+    }
+#endif
+#if defined(__SSE2__) || defined(_M_X64)
+    if constexpr (std::is_same_v<Chave, std::int32_t>) {
+        const __m128i alvo = _mm_set1_epi32(x);
+        for (; i + 4 <= num; i += 4) {
+            __m128i bloco = _mm_loadu_si128(reinterpret_cast<const __m128i*>(chaves + i));
+            __m128i gt = _mm_cmpgt_epi32(bloco, alvo);
+            maiores += std::popcount<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(gt)));
+        }
+    }
+#endif
+    for (; i < num; ++i) {
+        maiores += x < chaves[i];
+    }
+    return num - maiores;
+}
+
+/**
+ * @class BPlusTree
+ * @brief B+-tree em memória que mapeia chaves únicas a valores.
+ *
+ * Todos os pares ficam nas folhas, que formam uma lista encadeada em ordem crescente; os nós
+ * internos guardam apenas chaves separadoras. Com dezenas de chaves por nó, a altura é de
+ * poucos níveis, e a busca em cada nível lê um bloco contíguo de chaves alinhado à linha de
+ * cache, em vez de um nó (e uma falta de cache) por comparação como na `ArvoreAVL`.
+ *
+ * Chaves e valores ficam em arrays separados dentro da folha, para que a busca toque apenas
+ * as linhas de cache das chaves.
+ *
+ * @tparam Chave Tipo da chave; precisa de `operator<`. `int32_t` e `int64_t` usam SIMD.
+ * @tparam Valor Tipo do valor associado.
+ * @tparam Capacidade Número máximo de chaves por nó. O padrão ocupa 256 bytes (4 linhas de cache) de chaves.
+ */
+template <typename Chave, typename Valor, int Capacidade = (256 / sizeof(Chave) < 8 ? 8 : 256 / sizeof(Chave))>
+class BPlusTree {
+    static_assert(Capacidade >= 4, "A capacidade do nó deve ser de pelo menos 4 chaves.");
+
+private:
+    static constexpr int MINIMO = Capacidade / 2; // Ocupação mínima de um nó que não é raiz
+
+    struct No {
+        bool folha;
+        int num; // Número de chaves em uso
+        explicit No(bool f) : folha(f), num(0) {}
+    };
+
+    struct Folha : No {
+        Folha* proxima;
+        alignas(64) Chave chaves[Capacidade];
+        Valor valores[Capacidade];
+        Folha() : No(true), proxima(nullptr) {}
+    };
+
+    struct Interno : No {
+        alignas(64) Chave chaves[Capacidade];
+        No* filhos[Capacidade + 1];
+        Interno() : No(false) {}
+    };
+
+    No* raiz;
+    std::size_t num_elementos;
+
+    static Folha* como_folha(No* no) { return static_cast<Folha*>(no); }
+    static Interno* como_interno(No* no) { return static_cast<Interno*>(no); }
+
+    static void destruir(No* no) {
+        if (no == nullptr) return;
+        if (no->folha) {
+            delete como_folha(no);
+        } else {
+            Interno* interno = como_interno(no);
+            for (int i = 0; i <= interno->num; ++i) destruir(interno->filhos[i]);
+            delete interno;
+        }
+    }
+
+    // Índice do filho que pode conter x: separadores menores ou iguais a x levam à direita.
+    static int indice_filho(const Interno* no, const Chave& x) {
+        return contar_chaves_menores_ou_iguais(no->chaves, no->num, x);
+    }
+
+    Folha* descer_ate_folha(const Chave& x) const {
+        No* atual = raiz;
+        while (!atual->folha) {
+            Interno* interno = como_interno(atual);
+            atual = interno->filhos[indice_filho(interno, x)];
+        }
+        return como_folha(atual);
+    }
+
+    // --- Inserção ---
+
+    struct Divisao {
+        No* novo = nullptr; // Irmão à direita criado pela divisão, ou nullptr
+        Chave separador{};  // Menor chave alcançável a partir de 'novo'
+    };
+
+    // Retorna true em 'inserido' se a chave era nova.
+    Divisao inserir_helper(No* no, const Chave& chave, const Valor& valor, bool& inserido) {
+        if (no->folha) {
+            Folha* folha = como_folha(no);
+            int pos = contar_chaves_menores(folha->chaves, folha->num, chave);
+            if (pos < folha->num && !(chave < folha->chaves[pos])) {
+                folha->valores[pos] = valor; // Chave existente: atualiza
+                inserido = false;
+                return {};
+            }
+            inserido = true;
+            if (folha->num < Capacidade) {
+                inserir_na_folha(folha, pos, chave, valor);
+                return {};
+            }
+            // Folha cheia: divide ao meio e insere na metade adequada.
+            Folha* nova = new Folha();
+            int metade = (Capacidade + 1) / 2;
+            for (int i = metade; i < Capacidade; ++i) {
+                nova->chaves[i - metade] = std::move(folha->chaves[i]);
+                nova->valores[i - metade] = std::move(folha->valores[i]);
+            }
+            nova->num = Capacidade - metade;
+            folha->num = metade;
+            nova->proxima = folha->proxima;
+            folha->proxima = nova;
+            if (pos < metade) {
+                inserir_na_folha(folha, pos, chave, valor);
+            } else {
+                inserir_na_folha(nova, pos - metade, chave, valor);
+            }
+            return {nova, nova->chaves[0]};
+        }
+
+        Interno* interno = como_interno(no);
+        int idx = indice_filho(interno, chave);
+        Divisao filha = inserir_helper(interno->filhos[idx], chave, valor, inserido);
+        if (filha.novo == nullptr) return {};
+
+        if (interno->num < Capacidade) {
+            inserir_no_interno(interno, idx, filha.separador, filha.novo);
+            return {};
+        }
+
+        // Nó interno cheio: monta a sequência com o novo separador e divide; a chave do meio sobe.
+        Chave chaves_tmp[Capacidade + 1];
+        No* filhos_tmp[Capacidade + 2];
+        for (int i = 0, j = 0; i <= Capacidade; ++i) {
+            chaves_tmp[i] = (i == idx) ? filha.separador : interno->chaves[j++];
+        }
+        for (int i = 0, j = 0; i <= Capacidade + 1; ++i) {
+            filhos_tmp[i] = (i == idx + 1) ? filha.novo : interno->filhos[j++];
+        }
+        int meio = (Capacidade + 1) / 2;
+        Interno* novo = new Interno();
+        interno->num = meio;
+        for (int i = 0; i < meio; ++i) interno->chaves[i] = chaves_tmp[i];
+        for (int i = 0; i <= meio; ++i) interno->filhos[i] = filhos_tmp[i];
+        novo->num = Capacidade - meio;
+        for (int i = 0; i < novo->num; ++i) novo->chaves[i] = chaves_tmp[meio + 1 + i];
+        for (int i = 0; i <= novo->num; ++i) novo->filhos[i] = filhos_tmp[meio + 1 + i];
+        return {novo, chaves_tmp[meio]};
+    }
+
+    static void inserir_na_folha(Folha* folha, int pos, const Chave& chave, const Valor& valor) {
+        for (int i = folha->num; i > pos; --i) {
+            folha->chaves[i] = std::move(folha->chaves[i - 1]);
+            folha->valores[i] = std::move(folha->valores[i - 1]);
+        }
+        folha->chaves[pos] = chave;
+        folha->valores[pos] = valor;
+        ++folha->num;
+    }
+
+    // Insere 'separador' na posição 'idx' e 'filho' logo à direita dele.
+    static void inserir_no_interno(Interno* no, int idx, const Chave& separador, No* filho) {
+        for (int i = no->num; i > idx; --i) {
+            no->chaves[i] = std::move(no->chaves[i - 1]);
+            no->filhos[i + 1] = no->filhos[i];
+        }
+        no->chaves[idx] = separador;
+        no->filhos[idx + 1] = filho;
+        ++no->num;
+    }
+
+    // --- Remoção ---
+
+    static void remover_da_folha(Folha* folha, int pos) {
+        for (int i = pos; i + 1 < folha->num; ++i) {
+            folha->chaves[i] = std::move(folha->chaves[i + 1]);
+            folha->valores[i] = std::move(folha->valores[i + 1]);
+        }
+        --folha->num;
+    }
+
+    // Remove a chave 'idx' e o filho 'idx + 1' de um nó interno.
+    static void remover_do_interno(Interno* no, int idx) {
+        for (int i = idx; i + 1 < no->num; ++i) {
+            no->chaves[i] = std::move(no->chaves[i + 1]);
+            no->filhos[i + 1] = no->filhos[i + 2];
+        }
+        --no->num;
+    }
+
+    // Restaura a ocupação mínima do filho 'idx' de 'pai', emprestando de um irmão ou fundindo.
+    static void corrigir_filho(Interno* pai, int idx) {
+        No* filho = pai->filhos[idx];
+        No* esq = idx > 0 ? pai->filhos[idx - 1] : nullptr;
+        No* dir = idx < pai->num ? pai->filhos[idx + 1] : nullptr;
+
+        if (filho->folha) {
+            Folha* f = como_folha(filho);
+            if (esq != nullptr && esq->num > MINIMO) {
+                Folha* e = como_folha(esq);
+                inserir_na_folha(f, 0, e->chaves[e->num - 1], e->valores[e->num - 1]);
+                --e->num;
+                pai->chaves[idx - 1] = f->chaves[0];
+            } else if (dir != nullptr && dir->num > MINIMO) {
+                Folha* d = como_folha(dir);
+                inserir_na_folha(f, f->num, d->chaves[0], d->valores[0]);
+                remover_da_folha(d, 0);
+                pai->chaves[idx] = d->chaves[0];
+            } else if (esq != nullptr) {
+                fundir_folhas(como_folha(esq), f);
+                remover_do_interno(pai, idx - 1);
+            } else {
+                fundir_folhas(f, como_folha(dir));
+                remover_do_interno(pai, idx);
+            }
+            return;
+        }
+
+        Interno* f = como_interno(filho);
+        if (esq != nullptr && esq->num > MINIMO) {
+            Interno* e = como_interno(esq);
+            // Rotação à direita: o separador desce para 'f' e a última chave de 'e' sobe.
+            f->filhos[f->num + 1] = f->filhos[f->num];
+            for (int i = f->num; i > 0; --i) {
+                f->chaves[i] = std::move(f->chaves[i - 1]);
+                f->filhos[i] = f->filhos[i - 1];
+            }
+            f->chaves[0] = pai->chaves[idx - 1];
+            f->filhos[0] = e->filhos[e->num];
+            ++f->num;
+            pai->chaves[idx - 1] = e->chaves[e->num - 1];
+            --e->num;
+        } else if (dir != nullptr && dir->num > MINIMO) {
+            Interno* d = como_interno(dir);
+            // Rotação à esquerda: o separador desce para 'f' e a primeira chave de 'd' sobe.
+            f->chaves[f->num] = pai->chaves[idx];
+            f->filhos[f->num + 1] = d->filhos[0];
+            ++f->num;
+            pai->chaves[idx] = d->chaves[0];
+            for (int i = 0; i + 1 < d->num; ++i) {
+                d->chaves[i] = std::move(d->chaves[i + 1]);
+                d->filhos[i] = d->filhos[i + 1];
+            }
+            d->filhos[d->num - 1] = d->filhos[d->num];
+            --d->num;
+        } else if (esq != nullptr) {
+            fundir_internos(como_interno(esq), pai->chaves[idx - 1], f);
+            remover_do_interno(pai, idx - 1);
+        } else {
+            fundir_internos(f, pai->chaves[idx], como_interno(dir));
+            remover_do_interno(pai, idx);
+        }
+    }
+
+    // Move todo o conteúdo de 'dir' para o fim de 'esq' e libera 'dir'.
+    static void fundir_folhas(Folha* esq, Folha* dir) {
+        for (int i = 0; i < dir->num; ++i) {
+            esq->chaves[esq->num + i] = std::move(dir->chaves[i]);
+            esq->valores[esq->num + i] = std::move(dir->valores[i]);
+        }
+        esq->num += dir->num;
+        esq->proxima = dir->proxima;
+        delete dir;
+    }
+
+    static void fundir_internos(Interno* esq, const Chave& separador, Interno* dir) {
+        esq->chaves[esq->num] = separador;
+        for (int i = 0; i < dir->num; ++i) {
+            esq->chaves[esq->num + 1 + i] = std::move(dir->chaves[i]);
+        }
+        for (int i = 0; i <= dir->num; ++i) {
+            esq->filhos[esq->num + 1 + i] = dir->filhos[i];
+        }
+        esq->num += dir->num + 1;
+        delete dir;
+    }
+
+    bool remover_helper(No* no, const Chave& chave) {
+        if (no->folha) {
+            Folha* folha = como_folha(no);
+            int pos = contar_chaves_menores(folha->chaves, folha->num, chave);
+            if (pos == folha->num || chave < folha->chaves[pos]) return false;
+            remover_da_folha(folha, pos);
+            return true;
+        }
+        Interno* interno = como_interno(no);
+        int idx = indice_filho(interno, chave);
+        if (!remover_helper(interno->filhos[idx], chave)) return false;
+        if (interno->filhos[idx]->num < MINIMO) corrigir_filho(interno, idx);
+        return true;
+    }
+
+    // --- Carga em lote ---
+
+    // Divide 'total' itens em grupos quase iguais com no máximo 'maximo' itens cada.
+    static std::vector<int> tamanhos_dos_grupos(std::size_t total, int maximo) {
+        std::size_t grupos = (total + maximo - 1) / maximo;
+        std::vector<int> tamanhos(grupos, static_cast<int>(total / grupos));
+        for (std::size_t i = 0; i < total % grupos; ++i) ++tamanhos[i];
+        return tamanhos;
+    }
+
+public:
+    /**
+     * @class Iterador
+     * @brief Iterador crescente sobre os pares, que segue o encadeamento das folhas.
+     * Qualquer inserção ou remoção invalida os iteradores existentes.
+     */
+    class Iterador {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::pair<const Chave&, const Valor&>;
+        using difference_type = std::ptrdiff_t;
+
+        Iterador() : folha(nullptr), pos(0) {}
+
+        const Chave& chave() const { return folha->chaves[pos]; }
+        const Valor& valor() const { return folha->valores[pos]; }
+        value_type operator*() const { return {folha->chaves[pos], folha->valores[pos]}; }
+
+        Iterador& operator++() {
+            if (++pos == folha->num) {
+                folha = folha->proxima;
+                pos = 0;
+            }
+            return *this;
+        }
+
+        bool operator==(const Iterador& outro) const { return folha == outro.folha && pos == outro.pos; }
+        bool operator!=(const Iterador& outro) const { return !(*this == outro); }
+
+    private:
+        friend class BPlusTree;
+        Iterador(Folha* f, int p) : folha(f), pos(p) {
+            // Posição após a última chave de uma folha corresponde ao início da próxima.
+            if (folha != nullptr && pos == folha->num) {
+                folha = folha->proxima;
+                pos = 0;
+            }
+        }
+        Folha* folha;
+        int pos;
+    };
+
+    BPlusTree() : raiz(new Folha()), num_elementos(0) {}
+    ~BPlusTree() { destruir(raiz); }
+
+    BPlusTree(const BPlusTree&) = delete;
+    BPlusTree& operator=(const BPlusTree&) = delete;
+
+    // Não é noexcept: a árvore movida recebe uma folha nova, para continuar utilizável, e essa
+    // alocação pode lançar std::bad_alloc. A atribuição por movimento só troca as raízes.
+    BPlusTree(BPlusTree&& outra) : raiz(outra.raiz), num_elementos(outra.num_elementos) {
+        outra.raiz = new Folha();
+        outra.num_elementos = 0;
+    }
+    BPlusTree& operator=(BPlusTree&& outra) noexcept {
+        std::swap(raiz, outra.raiz);
+        std::swap(num_elementos, outra.num_elementos);
+        return *this;
+    }
+
+    /**
+     * @brief Constrói a árvore de baixo para cima a partir de pares com chaves estritamente crescentes.
+     *
+     * Preenche as folhas sequencialmente e depois cada nível interno a partir do anterior, sem
+     * nenhuma divisão de nó. Os itens são distribuídos por igual entre os nós de cada nível, o que
+     * mantém todos eles acima da ocupação mínima.
+     *
+     * @throws std::invalid_argument se as chaves não estiverem estritamente ordenadas.
+     * @complexity Time: O(n)
+     */
+    static BPlusTree carregar_ordenado(const std::vector<std::pair<Chave, Valor>>& dados) {
+        for (std::size_t i = 1; i < dados.size(); ++i) {
+            if (!(dados[i - 1].first < dados[i].first)) {
+                throw std::invalid_argument("As chaves devem estar em ordem estritamente crescente.");
+            }
+        }
+        BPlusTree arvore;
+        if (dados.empty()) return arvore;
+        destruir(arvore.raiz);
+
+        // Nível das folhas.
+        std::vector<No*> nivel;
+        std::vector<Chave> menores; // Menor chave de cada nó do nível
+        std::size_t k = 0;
+        Folha* anterior = nullptr;
+        for (int tamanho : tamanhos_dos_grupos(dados.size(), Capacidade)) {
+            Folha* folha = new Folha();
+            for (int i = 0; i < tamanho; ++i, ++k) {
+                folha->chaves[i] = dados[k].first;
+                folha->valores[i] = dados[k].second;
+            }
+            folha->num = tamanho;
+            if (anterior != nullptr) anterior->proxima = folha;
+            anterior = folha;
+            nivel.push_back(folha);
+            menores.push_back(folha->chaves[0]);
+        }
+
+        // Níveis internos, até restar uma única raiz.
+        while (nivel.size() > 1) {
+            std::vector<No*> acima;
+            std::vector<Chave> menores_acima;
+            std::size_t j = 0;
+            for (int filhos : tamanhos_dos_grupos(nivel.size(), Capacidade + 1)) {
+                Interno* interno = new Interno();
+                for (int i = 0; i < filhos; ++i, ++j) {
+                    interno->filhos[i] = nivel[j];
+                    if (i > 0) interno->chaves[i - 1] = menores[j];
+                }
+                interno->num = filhos - 1;
+                acima.push_back(interno);
+                menores_acima.push_back(menores[j - filhos]);
+            }
+            nivel.swap(acima);
+            menores.swap(menores_acima);
+        }
+
+        arvore.raiz = nivel[0];
+        arvore.num_elementos = dados.size();
+        return arvore;
+    }
+
+    /**
+     * @brief Insere um par chave-valor. Se a chave já existir, o valor é atualizado.
+     * @complexity Time: O(B log_B n), onde B é a capacidade do nó.
+     */
+    void inserir(const Chave& chave, const Valor& valor) {
+        bool inserido = false;
+        Divisao divisao = inserir_helper(raiz, chave, valor, inserido);
+        if (divisao.novo != nullptr) {
+            Interno* nova_raiz = new Interno();
+            nova_raiz->num = 1;
+            nova_raiz->chaves[0] = divisao.separador;
+            nova_raiz->filhos[0] = raiz;
+            nova_raiz->filhos[1] = divisao.novo;
+            raiz = nova_raiz;
+        }
+        if (inserido) ++num_elementos;
+    }
+
+    /**
+     * @brief Busca o valor associado a uma chave.
+     * @param valor_encontrado Referência para armazenar o valor se a chave for encontrada.
+     * @return true se a chave foi encontrada, false caso contrário.
+     * @complexity Time: O(log_B n) nós visitados.
+     */
+    bool buscar(const Chave& chave, Valor& valor_encontrado) const {
+        Folha* folha = descer_ate_folha(chave);
+        int pos = contar_chaves_menores(folha->chaves, folha->num, chave);
+        if (pos == folha->num || chave < folha->chaves[pos]) return false;
+        valor_encontrado = folha->valores[pos];
+        return true;
+    }
+
+    bool contem(const Chave& chave) const {
+        Folha* folha = descer_ate_folha(chave);
+        int pos = contar_chaves_menores(folha->chaves, folha->num, chave);
+        return pos < folha->num && !(chave < folha->chaves[pos]);
+    }
+
+    /**
+     * @brief Remove uma chave, emprestando de irmãos ou fundindo nós que ficarem abaixo da ocupação mínima.
+     * @return true se a chave foi encontrada e removida.
+     * @complexity Time: O(B log_B n)
+     */
+    bool remover(const Chave& chave) {
+        if (!remover_helper(raiz, chave)) return false;
+        if (!raiz->folha && raiz->num == 0) {
+            Interno* antiga = como_interno(raiz);
+            raiz = antiga->filhos[0];
+            delete antiga;
+        }
+        --num_elementos;
+        return true;
+    }
+
+    /**
+     * @brief Retorna um iterador para o primeiro par com chave >= `chave`, ou end().
+     */
+    Iterador lower_bound(const Chave& chave) const {
+        Folha* folha = descer_ate_folha(chave);
+        return Iterador(folha, contar_chaves_menores(folha->chaves, folha->num, chave));
+    }
+
+    Iterador begin() const {
+        No* atual = raiz;
+        while (!atual->folha) atual = como_interno(atual)->filhos[0];
+        return Iterador(como_folha(atual), 0);
+    }
+
+    Iterador end() const {
+        return Iterador();
+    }
+
+    /**
+     * @brief Chama `visitar(chave, valor)` para cada par com chave em [a, b], em ordem crescente.
+     *
+     * Desce uma única vez até a folha de `a` e depois apenas segue o encadeamento das folhas,
+     * lendo chaves e valores contíguos.
+     *
+     * @complexity Time: O(log_B n + k), onde k é o número de pares visitados.
+     */
+    template <typename Funcao>
+    void percorrer_intervalo(const Chave& a, const Chave& b, Funcao&& visitar) const {
+        if (b < a) return;
+        Folha* folha = descer_ate_folha(a);
+        int pos = contar_chaves_menores(folha->chaves, folha->num, a);
+        while (folha != nullptr) {
+            for (; pos < folha->num; ++pos) {
+                if (b < folha->chaves[pos]) return;
+                visitar(folha->chaves[pos], folha->valores[pos]);
+            }
+            folha = folha->proxima;
+            pos = 0;
+        }
+    }
+
+    std::size_t tamanho() const {
+        return num_elementos;
+    }
+
+    /**
+     * @brief Retorna o número de níveis da árvore (1 quando a raiz é uma folha).
+     */
+    int altura() const {
+        int niveis = 1;
+        for (No* atual = raiz; !atual->folha; atual = como_interno(atual)->filhos[0]) ++niveis;
+        return niveis;
+    }
+};
+
+/**
+ * @class BTreeEmDisco
+ * @brief Índice ordenado de chaves e valores inteiros de 64 bits guardado em um arquivo, para
+ * conjuntos de dados maiores que a memória.
+ *
+ * O arquivo é dividido em páginas de `TAMANHO_PAGINA` bytes e mapeado com `mmap`, de modo que o
+ * cache de páginas do sistema operacional faz o papel de buffer pool. Cada página interna guarda
+ * até 255 chaves e 256 filhos, então uma consulta ou inserção toca O(log_B n) páginas, com B = 256.
+ *
+ * Layout e recuperação após queda:
+ * - As páginas 0 e 1 são duas cópias do superbloco (meta), cada uma com um número de geração e
+ *   uma soma de verificação. Na abertura, vale a meta válida de maior geração.
+ * - As alterações são feitas por cópia na escrita (copy-on-write): uma página da versão confirmada
+ *   nunca é sobrescrita; o caminho da raiz até a folha alterada é copiado para páginas novas, que
+ *   podem ser alteradas no lugar até a próxima confirmação.
+ * - `confirmar()` grava a lista de páginas livres, sincroniza os dados com o disco e só então
+ *   escreve a nova raiz na meta mais antiga. Uma queda em qualquer ponto deixa o arquivo com a
+ *   última versão confirmada.
+ * - Páginas liberadas durante uma transação só voltam a ser usadas depois da confirmação, pois
+ *   ainda pertencem à versão que seria recuperada após uma queda.
+ * - Fechar o índice sem `confirmar()` descarta a transação em andamento, como uma queda.
+ *
+ * Como as folhas são copiadas a cada alteração, elas não são encadeadas entre si (isso obrigaria
+ * a copiar também a folha anterior). As varreduras de intervalo usam um cursor com a pilha de
+ * páginas internas do caminho, o que continua tocando O(log_B n + k / B) páginas.
+ *
+ * @note Depende de `mmap` (POSIX). Em outras plataformas, o construtor lança std::runtime_error.
+ */
+class BTreeEmDisco {
+public:
+    using Chave = std::int64_t;
+    using Valor = std::int64_t;
+
+    static constexpr std::size_t TAMANHO_PAGINA = 4096;
+    static constexpr int CHAVES_POR_PAGINA = 255;
+
+private:
+    static constexpr std::uint32_t TIPO_FOLHA = 1;
+    static constexpr std::uint32_t TIPO_INTERNA = 2;
+
+    struct PaginaFolha {
+        std::uint32_t tipo;
+        std::uint32_t num;
+        Chave chaves[CHAVES_POR_PAGINA];
+        Valor valores[CHAVES_POR_PAGINA];
+    };
+
+    struct PaginaInterna {
+        std::uint32_t tipo;
+        std::uint32_t num;
+        Chave chaves[CHAVES_POR_PAGINA];
+        std::uint64_t filhos[CHAVES_POR_PAGINA + 1];
+    };
+
+    static_assert(sizeof(PaginaFolha) <= TAMANHO_PAGINA && sizeof(PaginaInterna) <= TAMANHO_PAGINA,
+                  "As páginas devem caber em TAMANHO_PAGINA bytes.");
+
+    struct ResultadoInsercao {
+        std::uint64_t pagina;        // Página que substitui a original (igual a ela se nada foi copiado)
+        std::uint64_t direita = 0;   // Irmã criada pela divisão, ou 0
+        Chave separador = 0;
+    };
+
+    int descritor;
+    unsigned char* base;           // Início do mapeamento
+    std::size_t tamanho_mapa;      // Bytes reservados no espaço de endereçamento
+    std::uint64_t paginas_arquivo; // Páginas alocadas no arquivo (pode exceder as usadas)
+
+    // Estado da versão atual (confirmada ou em andamento).
+    std::uint64_t geracao;
+    std::uint64_t raiz;
+    std::uint64_t num_paginas;     // Páginas em uso: [0, num_paginas)
+    std::uint64_t num_elementos;
+    int niveis;
+
+    // Alocação.
+    std::vector<std::uint64_t> disponiveis;        // Livres e seguras para reutilizar agora
+    std::vector<std::uint64_t> pendentes;          // Liberadas nesta transação; reutilizáveis após confirmar()
+    std::vector<std::uint64_t> novas;              // Alocadas nesta transação (alteráveis no lugar)
+    std::vector<bool> nova_na_transacao;
+    bool alterada;
+
+    // Páginas quentes fixadas em memória.
+    int niveis_fixados;
+    std::vector<std::uint64_t> paginas_fixadas;
+
+    unsigned char* endereco(std::uint64_t pagina) const {
+        return base + pagina * TAMANHO_PAGINA;
+    }
+    bool eh_folha(std::uint64_t pagina) const {
+        return reinterpret_cast<const PaginaFolha*>(endereco(pagina))->tipo == TIPO_FOLHA;
+    }
+    PaginaFolha* folha(std::uint64_t pagina) const {
+        return reinterpret_cast<PaginaFolha*>(endereco(pagina));
+    }
+    PaginaInterna* interna(std::uint64_t pagina) const {
+        return reinterpret_cast<PaginaInterna*>(endereco(pagina));
+    }
+    static int indice_filho(const PaginaInterna* p, Chave chave) {
+        return contar_chaves_menores_ou_iguais(p->chaves, static_cast<int>(p->num), chave);
+    }
+
+    void abrir(const std::string& caminho);
+    void inicializar_arquivo();
+    void ler_lista_livre(std::uint64_t primeira);
+    void garantir_paginas_no_arquivo(std::uint64_t paginas);
+    void sincronizar(std::vector<std::uint64_t> paginas);
+    std::uint64_t alocar();
+    std::uint64_t copiar_se_necessario(std::uint64_t pagina);
+    std::uint64_t gravar_lista_livre();
+    ResultadoInsercao inserir_helper(std::uint64_t pagina, Chave chave, Valor valor, bool& inserido);
+    void atualizar_paginas_fixadas();
+
+public:
+    /// Espaço de endereçamento reservado por padrão: 64 GiB, ou 1 GiB onde `size_t` tem 32 bits.
+    static constexpr std::uint64_t TAMANHO_MAPA_PADRAO =
+        SIZE_MAX >= (std::uint64_t(1) << 36) ? std::uint64_t(1) << 36 : std::uint64_t(1) << 30;
+
+    /**
+     * @brief Abre o índice em `caminho`, criando o arquivo se ele não existir ou estiver vazio.
+     * @param tamanho_maximo_mapa Espaço de endereçamento reservado para o arquivo. O mapeamento
+     * nunca muda de lugar, então ponteiros para páginas continuam válidos quando o arquivo cresce.
+     * @throws std::invalid_argument se `tamanho_maximo_mapa` não couber em `size_t`.
+     * @throws std::runtime_error se o arquivo não puder ser aberto, for menor que uma página ou
+     * não tiver uma meta válida. Um arquivo não vazio nunca é reinicializado.
+     */
+    explicit BTreeEmDisco(const std::string& caminho, std::uint64_t tamanho_maximo_mapa = TAMANHO_MAPA_PADRAO);
+
+    /**
+     * @brief Fecha o arquivo, descartando as alterações não confirmadas: o arquivo continua na
+     * versão da última chamada a `confirmar()`.
+     */
+    ~BTreeEmDisco();
+
+    BTreeEmDisco(const BTreeEmDisco&) = delete;
+    BTreeEmDisco& operator=(const BTreeEmDisco&) = delete;
+
+    /**
+     * @brief Insere um par chave-valor; se a chave já existir, o valor é atualizado.
+     * A alteração só é durável depois de `confirmar()`.
+     * @complexity Time: O(B log_B n), tocando O(log_B n) páginas.
+     */
+    void inserir(Chave chave, Valor valor);
+
+    /**
+     * @brief Busca o valor associado a uma chave. Vê também as alterações ainda não confirmadas.
+     * @complexity Time: O(log_B n) páginas lidas.
+     */
+    bool buscar(Chave chave, Valor& valor_encontrado) const;
+
+    /**
+     * @brief Torna duráveis as alterações feitas desde a última confirmação.
+     *
+     * Ordem das escritas: lista de páginas livres, sincronização de todas as páginas de dados e,
+     * por último, a meta com a nova raiz (também sincronizada). Sem alterações, não faz nada.
+     */
+    void confirmar();
+
+    /**
+     * @brief Fixa na memória (mlock) as páginas dos `niveis_superiores` níveis mais altos da árvore,
+     * que são lidas por toda consulta, e as mantém fixadas após cada confirmação.
+     * @return Número de páginas efetivamente fixadas; pode ser menor se o limite RLIMIT_MEMLOCK for atingido.
+     */
+    std::size_t fixar_paginas_quentes(int niveis_superiores);
+
+    /**
+     * @brief Chama `visitar(chave, valor)` para cada par com chave em [a, b], em ordem crescente.
+     * @complexity Time: O(log_B n + k), tocando O(log_B n + k / B) páginas.
+     */
+    template <typename Funcao>
+    void percorrer_intervalo(Chave a, Chave b, Funcao&& visitar) const {
+        if (b < a) return;
+        // Pilha do cursor: página interna do caminho e índice do filho atual nela.
+        std::vector<std::pair<const PaginaInterna*, std::uint32_t>> caminho;
+        std::uint64_t pagina = raiz;
+        while (!eh_folha(pagina)) {
+            const PaginaInterna* p = interna(pagina);
+            std::uint32_t i = indice_filho(p, a);
+            caminho.push_back({p, i});
+            pagina = p->filhos[i];
+        }
+        const PaginaFolha* f = folha(pagina);
+        std::uint32_t pos = contar_chaves_menores(f->chaves, static_cast<int>(f->num), a);
+        while (true) {
+            for (; pos < f->num; ++pos) {
+                if (b < f->chaves[pos]) return;
+                visitar(f->chaves[pos], f->valores[pos]);
+            }
+            // Sobe até o primeiro ancestral que ainda tem um filho à direita e desce pela esquerda.
+            while (!caminho.empty() && caminho.back().second == caminho.back().first->num) caminho.pop_back();
+            if (caminho.empty()) return;
+            pagina = caminho.back().first->filhos[++caminho.back().second];
+            while (!eh_folha(pagina)) {
+                caminho.push_back({interna(pagina), 0});
+                pagina = interna(pagina)->filhos[0];
+            }
+            f = folha(pagina);
+            pos = 0;
+        }
+    }
+
+    std::size_t tamanho() const {
+        return num_elementos;
+    }
+
+    int altura() const {
+        return niveis;
+    }
+
+    /**
+     * @brief Número de páginas em uso no arquivo, incluindo metas, livres e da lista livre.
+     */
+    std::uint64_t paginas_usadas() const {
+        return num_paginas;
+    }
+
+    /**
+     * @brief Número de páginas livres para reutilização (imediata ou após a próxima confirmação).
+     */
+    std::size_t paginas_livres() const {
+        return disponiveis.size() + pendentes.size();
+    }
+};
+
+#endif // B_TREE_HPP
@@ -0,0 +1,108 @@
+#ifndef COLETOR_EPOCAS_HPP
+#define COLETOR_EPOCAS_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @file coletor_epocas.hpp
+ * @brief Contém um coletor de memória baseado em épocas (epoch-based reclamation) para as
+ * estruturas de dados sem locks deste repositório.
+ *
+ * Em uma estrutura sem locks, um nó removido não pode ser liberado imediatamente: outra thread
+ * pode estar no meio de uma travessia e ainda ler seus campos. Com o coletor, toda operação roda
+ * dentro de uma `Guarda`, que anuncia a época global observada pela thread. Um nó retirado da
+ * estrutura é entregue a `aposentar()` e só é liberado quando a época global avançou duas vezes
+ * desde então, o que garante que nenhuma guarda ativa o alcançou.
+ */
+
+/**
+ * @brief Retorna um índice pequeno e único para a thread atual, em [0, ColetorEpocas::MAX_THREADS).
+ *
+ * O índice é devolvido quando a thread termina e pode ser reutilizado por outra.
+ * @throws std::runtime_error se houver mais de MAX_THREADS threads usando coletores ao mesmo tempo.
+ */
+int indice_da_thread();
+
+/**
+ * @class ColetorEpocas
+ * @brief Recuperação de memória por épocas, com uma entrada por thread em cada coletor.
+ *
+ * A época global só avança quando todas as threads dentro de uma guarda já observaram a época
+ * atual. Cada thread guarda os próprios nós aposentados, junto com a época em que foram
+ * aposentados, e os libera quando a época global estiver pelo menos duas à frente.
+ */
+class ColetorEpocas {
+public:
+    static constexpr int MAX_THREADS = 128;
+
+    /**
+     * @class Guarda
+     * @brief Seção crítica RAII: enquanto existir, nada que a thread possa alcançar é liberado.
+     * Guardas podem ser aninhadas na mesma thread.
+     */
+    class Guarda {
+    public:
+        Guarda(const Guarda&) = delete;
+        Guarda& operator=(const Guarda&) = delete;
+        ~Guarda() { coletor->sair(indice); }
+
+    private:
+        friend class ColetorEpocas;
+        Guarda(ColetorEpocas* c, int i) : coletor(c), indice(i) {}
+        ColetorEpocas* coletor;
+        int indice;
+    };
+
+    ColetorEpocas() = default;
+
+    /**
+     * @brief Libera tudo o que ainda estiver aposentado. Nenhuma guarda pode estar ativa.
+     */
+    ~ColetorEpocas();
+
+    ColetorEpocas(const ColetorEpocas&) = delete;
+    ColetorEpocas& operator=(const ColetorEpocas&) = delete;
+
+    /**
+     * @brief Entra em uma seção crítica. Não faz nenhum laço de espera.
+     */
+    Guarda proteger();
+
+    /**
+     * @brief Agenda a liberação de `ponteiro` com `destruir`. Deve ser chamado dentro de uma guarda,
+     * depois que o objeto foi desligado da estrutura.
+     */
+    void aposentar(void* ponteiro, void (*destruir)(void*));
+
+    /**
+     * @brief Número de objetos aposentados e ainda não liberados. Só deve ser chamado sem
+     * operações concorrentes.
+     */
+    std::size_t pendentes() const;
+
+private:
+    struct Aposentado {
+        void* ponteiro;
+        void (*destruir)(void*);
+        std::uint64_t epoca;
+    };
+
+    // Cada entrada ocupa sua própria linha de cache para que os anúncios não disputem a mesma linha.
+    struct alignas(64) EntradaThread {
+        std::atomic<std::uint64_t> anunciada{0}; // 2 * época + 1 se dentro de uma guarda, 0 se fora
+        int aninhamento = 0;
+        std::vector<Aposentado> limbo;
+    };
+
+    alignas(64) std::atomic<std::uint64_t> epoca_global{1};
+    std::atomic<int> maior_indice{0}; // Entradas em [0, maior_indice) já foram usadas
+    EntradaThread entradas[MAX_THREADS];
+
+    void sair(int indice);
+    void tentar_avancar();
+    void liberar_antigos(EntradaThread& entrada);
+};
+
+#endif // COLETOR_EPOCAS_HPP
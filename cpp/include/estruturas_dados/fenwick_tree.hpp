@@ -0,0 +1,322 @@
+#ifndef FENWICK_TREE_HPP
+#define FENWICK_TREE_HPP
+
+#include <vector>
+#include <bit>       // Para std::bit_floor
+#include <cstddef>   // Para std::size_t
+#include <stdexcept>
+
+/**
+ * @file fenwick_tree.hpp
+ * @brief Contém implementações da Fenwick Tree (Binary Indexed Tree): a versão clássica de
+ * somas de prefixo, uma versão com atualização e consulta em intervalo e uma versão 2D.
+ *
+ * Todas guardam a árvore em um único vetor plano, indexado internamente a partir de 1, onde a
+ * posição i é responsável pelo intervalo (i - lowbit(i), i], com lowbit(i) = i & -i. A interface
+ * pública usa índices base 0 e intervalos fechados, como a `SegmentTree`.
+ *
+ * @note Como estas são classes de template, toda a implementação está neste arquivo de cabeçalho.
+ */
+
+/**
+ * @class FenwickTree
+ * @brief Somas de prefixo com atualização pontual, mais leve que a `SegmentTree`: n + 1
+ * posições em vez de 2n a 4n, e laços de poucas instruções por nível.
+ */
+template <typename T>
+class FenwickTree {
+private:
+    std::vector<T> tree;
+    int n;
+
+    void verificar_indice(int index) const {
+        if (index < 0 || index >= n) {
+            throw std::out_of_range("Índice inválido.");
+        }
+    }
+
+public:
+    /**
+     * @brief Cria uma árvore com n elementos iguais a zero.
+     */
+    explicit FenwickTree(int tamanho = 0) : tree(tamanho + 1, T{}), n(tamanho) {}
+
+    /**
+     * @brief Constrói a árvore a partir de um vetor em O(n).
+     *
+     * Cada posição, depois de completa, repassa seu total apenas ao pai imediato (i + lowbit(i)),
+     * em vez de fazer n atualizações de O(log n).
+     */
+    explicit FenwickTree(const std::vector<T>& arr) : tree(arr.size() + 1, T{}), n(arr.size()) {
+        for (int i = 1; i <= n; ++i) {
+            tree[i] += arr[i - 1];
+            int pai = i + (i & -i);
+            if (pai <= n) tree[pai] += tree[i];
+        }
+    }
+
+    /**
+     * @brief Soma `delta` ao elemento em `index`.
+     * @complexity Time: O(log n)
+     */
+    void add(int index, const T& delta) {
+        verificar_indice(index);
+        for (int i = index + 1; i <= n; i += i & -i) {
+            tree[i] += delta;
+        }
+    }
+
+    /**
+     * @brief Retorna a soma dos elementos em [0, index]. Retorna zero para index = -1.
+     * @complexity Time: O(log n)
+     */
+    T prefix_sum(int index) const {
+        if (index < -1 || index >= n) {
+            throw std::out_of_range("Índice inválido.");
+        }
+        T soma{};
+        for (int i = index + 1; i > 0; i -= i & -i) {
+            soma += tree[i];
+        }
+        return soma;
+    }
+
+    /**
+     * @brief Retorna a soma dos elementos em [start, end].
+     * @complexity Time: O(log n)
+     */
+    T range_sum(int start, int end) const {
+        if (start < 0 || end >= n || start > end) {
+            throw std::out_of_range("Intervalo de consulta inválido.");
+        }
+        return prefix_sum(end) - prefix_sum(start - 1);
+    }
+
+    /**
+     * @brief Retorna o menor índice i tal que prefix_sum(i) >= alvo, ou size() se não existir.
+     *
+     * Desce pela árvore de cima para baixo (binary lifting), tentando saltos de potências de dois
+     * decrescentes, sem nenhuma busca binária sobre prefix_sum.
+     *
+     * @warning Exige que todos os elementos sejam não negativos (somas de prefixo monotônicas).
+     * @complexity Time: O(log n)
+     */
+    int lower_bound(T alvo) const {
+        if (n == 0) return 0;
+        int pos = 0;
+        for (int passo = std::bit_floor(static_cast<unsigned>(n)); passo > 0; passo >>= 1) {
+            if (pos + passo <= n && tree[pos + passo] < alvo) {
+                pos += passo;
+                alvo -= tree[pos];
+            }
+        }
+        return pos; // 'pos' é o maior prefixo (base 1) com soma < alvo, logo o índice base 0 seguinte
+    }
+
+    int size() const {
+        return n;
+    }
+};
+
+/**
+ * @class FenwickTreeIntervalo
+ * @brief Fenwick Tree com soma em intervalo e consulta de soma em intervalo, ambas em O(log n).
+ *
+ * Usa duas árvores. Somar d em [l, r] é registrado como diferenças em `b1` (d em l, -d em r + 1)
+ * e como correções em `b2`, de modo que a soma de prefixo até p é
+ * `prefixo(b1, p) * (p + 1) - prefixo(b2, p)`.
+ */
+template <typename T>
+class FenwickTreeIntervalo {
+private:
+    std::vector<T> b1; // Diferenças: prefixo(b1, p) é o valor acumulado somado ao elemento p
+    std::vector<T> b2; // Correções: d * l em l e -d * (r + 1) em r + 1
+    int n;
+
+    static void somar(std::vector<T>& arvore, int i, const T& delta) {
+        for (int k = i + 1; k < static_cast<int>(arvore.size()); k += k & -k) {
+            arvore[k] += delta;
+        }
+    }
+
+    static T prefixo(const std::vector<T>& arvore, int i) {
+        T soma{};
+        for (int k = i + 1; k > 0; k -= k & -k) {
+            soma += arvore[k];
+        }
+        return soma;
+    }
+
+    T prefix_sum(int index) const {
+        return prefixo(b1, index) * static_cast<T>(index + 1) - prefixo(b2, index);
+    }
+
+    void verificar_intervalo(int start, int end) const {
+        if (start < 0 || end >= n || start > end) {
+            throw std::out_of_range("Intervalo inválido.");
+        }
+    }
+
+public:
+    explicit FenwickTreeIntervalo(int tamanho = 0) : b1(tamanho + 1, T{}), b2(tamanho + 1, T{}), n(tamanho) {}
+
+    /**
+     * @brief Constrói a estrutura a partir de um vetor em O(n).
+     *
+     * O vetor inicial é tratado como a soma de cada elemento em um intervalo de tamanho 1, e as
+     * duas árvores são construídas de forma linear a partir dos vetores de diferenças.
+     */
+    explicit FenwickTreeIntervalo(const std::vector<T>& arr) : FenwickTreeIntervalo(static_cast<int>(arr.size())) {
+        for (int i = 0; i < n; ++i) {
+            // arr[i] em [i, i]: +arr[i] em i e -arr[i] em i + 1 nas duas árvores.
+            b1[i + 1] += arr[i];
+            b2[i + 1] += arr[i] * static_cast<T>(i);
+            if (i + 2 <= n) {
+                b1[i + 2] -= arr[i];
+                b2[i + 2] -= arr[i] * static_cast<T>(i + 1);
+            }
+        }
+        for (int i = 1; i <= n; ++i) {
+            int pai = i + (i & -i);
+            if (pai <= n) {
+                b1[pai] += b1[i];
+                b2[pai] += b2[i];
+            }
+        }
+    }
+
+    /**
+     * @brief Soma `delta` a todos os elementos de [start, end].
+     * @complexity Time: O(log n)
+     */
+    void add_range(int start, int end, const T& delta) {
+        verificar_intervalo(start, end);
+        somar(b1, start, delta);
+        somar(b2, start, delta * static_cast<T>(start));
+        if (end + 1 < n) {
+            somar(b1, end + 1, -delta);
+            somar(b2, end + 1, -delta * static_cast<T>(end + 1));
+        }
+    }
+
+    /**
+     * @brief Retorna a soma dos elementos em [start, end].
+     * @complexity Time: O(log n)
+     */
+    T range_sum(int start, int end) const {
+        verificar_intervalo(start, end);
+        return prefix_sum(end) - (start > 0 ? prefix_sum(start - 1) : T{});
+    }
+
+    /**
+     * @brief Retorna o valor atual do elemento em `index`.
+     * @complexity Time: O(log n)
+     */
+    T get(int index) const {
+        return range_sum(index, index);
+    }
+
+    int size() const {
+        return n;
+    }
+};
+
+/**
+ * @class FenwickTree2D
+ * @brief Fenwick Tree bidimensional para agregados em grades: soma pontual e soma de retângulos
+ * em O(log linhas * log colunas).
+ *
+ * A grade é guardada linha a linha em um único vetor de (linhas + 1) * (colunas + 1) posições.
+ */
+template <typename T>
+class FenwickTree2D {
+private:
+    std::vector<T> tree;
+    int linhas;
+    int colunas;
+
+    T& celula(int i, int j) {
+        return tree[static_cast<std::size_t>(i) * (colunas + 1) + j];
+    }
+
+    const T& celula(int i, int j) const {
+        return tree[static_cast<std::size_t>(i) * (colunas + 1) + j];
+    }
+
+    T prefixo(int linha, int coluna) const {
+        T soma{};
+        for (int i = linha + 1; i > 0; i -= i & -i) {
+            for (int j = coluna + 1; j > 0; j -= j & -j) {
+                soma += celula(i, j);
+            }
+        }
+        return soma;
+    }
+
+public:
+    FenwickTree2D(int num_linhas, int num_colunas)
+        : tree(static_cast<std::size_t>(num_linhas + 1) * (num_colunas + 1), T{}), linhas(num_linhas), colunas(num_colunas) {}
+
+    /**
+     * @brief Constrói a árvore a partir de uma grade em O(linhas * colunas).
+     *
+     * Aplica a construção linear da `FenwickTree` primeiro ao longo das colunas de cada linha e
+     * depois ao longo das linhas de cada coluna.
+     */
+    explicit FenwickTree2D(const std::vector<std::vector<T>>& grade)
+        : FenwickTree2D(static_cast<int>(grade.size()), grade.empty() ? 0 : static_cast<int>(grade[0].size())) {
+        for (int i = 1; i <= linhas; ++i) {
+            if (static_cast<int>(grade[i - 1].size()) != colunas) {
+                throw std::invalid_argument("Todas as linhas da grade devem ter o mesmo tamanho.");
+            }
+            for (int j = 1; j <= colunas; ++j) {
+                celula(i, j) += grade[i - 1][j - 1];
+                int pai = j + (j & -j);
+                if (pai <= colunas) celula(i, pai) += celula(i, j);
+            }
+        }
+        for (int i = 1; i <= linhas; ++i) {
+            int pai = i + (i & -i);
+            if (pai > linhas) continue;
+            for (int j = 1; j <= colunas; ++j) {
+                celula(pai, j) += celula(i, j);
+            }
+        }
+    }
+
+    /**
+     * @brief Soma `delta` à célula (linha, coluna).
+     * @complexity Time: O(log linhas * log colunas)
+     */
+    void add(int linha, int coluna, const T& delta) {
+        if (linha < 0 || linha >= linhas || coluna < 0 || coluna >= colunas) {
+            throw std::out_of_range("Célula inválida.");
+        }
+        for (int i = linha + 1; i <= linhas; i += i & -i) {
+            for (int j = coluna + 1; j <= colunas; j += j & -j) {
+                celula(i, j) += delta;
+            }
+        }
+    }
+
+    /**
+     * @brief Retorna a soma do retângulo com cantos (l1, c1) e (l2, c2), inclusivos.
+     * @complexity Time: O(log linhas * log colunas)
+     */
+    T range_sum(int l1, int c1, int l2, int c2) const {
+        if (l1 < 0 || c1 < 0 || l2 >= linhas || c2 >= colunas || l1 > l2 || c1 > c2) {
+            throw std::out_of_range("Retângulo de consulta inválido.");
+        }
+        return prefixo(l2, c2) - prefixo(l1 - 1, c2) - prefixo(l2, c1 - 1) + prefixo(l1 - 1, c1 - 1);
+    }
+
+    int num_linhas() const {
+        return linhas;
+    }
+
+    int num_colunas() const {
+        return colunas;
+    }
+};
+
+#endif // FENWICK_TREE_HPP
@@ -0,0 +1,427 @@
+#ifndef FILA_HPP
+#define FILA_HPP
+
+#include <algorithm> // Para std::min
+#include <atomic>
+#include <bit>       // Para std::bit_ceil
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @file fila.hpp
+ * @brief Contém filas limitadas sem locks para passar trabalho entre threads: um buffer circular
+ * para um produtor e um consumidor (`FilaSPSC`), uma fila para vários produtores e consumidores
+ * com números de sequência por posição (`FilaMPMC`) e um adaptador bloqueante (`FilaBloqueante`).
+ *
+ * As filas usam contadores de posição de 64 bits que só crescem; a posição no buffer é o
+ * contador módulo a capacidade, que é sempre arredondada para uma potência de dois.
+ *
+ * Os elementos precisam ser construíveis por padrão e atribuíveis por movimento, pois o buffer é
+ * alocado inteiro na construção.
+ *
+ * @note Como FilaSPSC, FilaMPMC e FilaBloqueante são classes de template, toda a sua
+ * implementação está neste arquivo de cabeçalho.
+ */
+
+inline std::size_t capacidade_da_fila(std::size_t capacidade) {
+    if (capacidade == 0) throw std::invalid_argument("A capacidade da fila deve ser positiva.");
+    return std::bit_ceil(capacidade);
+}
+
+/**
+ * @class FilaSPSC
+ * @brief Buffer circular limitado para exatamente uma thread produtora e uma consumidora.
+ *
+ * Os índices de escrita e de leitura ficam em linhas de cache separadas, cada uma junto com a
+ * cópia local que o seu dono guarda do índice do outro lado. O produtor só relê o índice de
+ * leitura quando a cópia indica fila cheia, e o consumidor só relê o de escrita quando a cópia
+ * indica fila vazia; no regime normal, cada operação não toca nenhuma linha de cache escrita
+ * pela outra thread além da posição do próprio elemento.
+ */
+template <typename T>
+class FilaSPSC {
+    static_assert(std::is_default_constructible_v<T> && std::is_move_assignable_v<T>,
+                  "Os elementos da fila precisam ser construíveis por padrão e atribuíveis por movimento.");
+
+private:
+    // Lidos por ambos, escritos só na construção.
+    const std::size_t mascara;
+    std::unique_ptr<T[]> buffer;
+
+    // Linha do produtor.
+    alignas(64) std::atomic<std::size_t> escrita{0};
+    std::size_t leitura_em_cache = 0;
+
+    // Linha do consumidor.
+    alignas(64) std::atomic<std::size_t> leitura{0};
+    std::size_t escrita_em_cache = 0;
+
+    // Número de posições livres vistas pelo produtor, relendo o índice de leitura se preciso.
+    std::size_t livres_para_escrita(std::size_t e, std::size_t desejadas) {
+        std::size_t livres = mascara + 1 - (e - leitura_em_cache);
+        if (livres < desejadas) {
+            leitura_em_cache = leitura.load(std::memory_order_acquire);
+            livres = mascara + 1 - (e - leitura_em_cache);
+        }
+        return livres;
+    }
+
+    std::size_t disponiveis_para_leitura(std::size_t l, std::size_t desejados) {
+        std::size_t disponiveis = escrita_em_cache - l;
+        if (disponiveis < desejados) {
+            escrita_em_cache = escrita.load(std::memory_order_acquire);
+            disponiveis = escrita_em_cache - l;
+        }
+        return disponiveis;
+    }
+
+    template <typename U>
+    bool push_generico(U&& valor) {
+        std::size_t e = escrita.load(std::memory_order_relaxed);
+        if (livres_para_escrita(e, 1) == 0) return false;
+        buffer[e & mascara] = std::forward<U>(valor);
+        escrita.store(e + 1, std::memory_order_release);
+        return true;
+    }
+
+public:
+    /**
+     * @brief Cria uma fila com capacidade para pelo menos `capacidade` elementos.
+     * @throws std::invalid_argument se a capacidade for zero.
+     */
+    explicit FilaSPSC(std::size_t capacidade)
+        : mascara(capacidade_da_fila(capacidade) - 1), buffer(new T[mascara + 1]) {}
+
+    FilaSPSC(const FilaSPSC&) = delete;
+    FilaSPSC& operator=(const FilaSPSC&) = delete;
+
+    /**
+     * @brief Insere um elemento. Só pode ser chamado pela thread produtora.
+     * @return false, sem mover o valor, se a fila estiver cheia.
+     */
+    bool push(const T& valor) { return push_generico(valor); }
+    bool push(T&& valor) { return push_generico(std::move(valor)); }
+
+    /**
+     * @brief Retira o elemento mais antigo. Só pode ser chamado pela thread consumidora.
+     * @return false se a fila estiver vazia.
+     */
+    bool pop(T& saida) {
+        std::size_t l = leitura.load(std::memory_order_relaxed);
+        if (disponiveis_para_leitura(l, 1) == 0) return false;
+        saida = std::move(buffer[l & mascara]);
+        leitura.store(l + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Copia até `quantidade` elementos de `itens` para a fila, publicando-os de uma vez.
+     * @return Quantos elementos couberam (um prefixo de `itens`).
+     */
+    std::size_t push_lote(const T* itens, std::size_t quantidade) {
+        std::size_t e = escrita.load(std::memory_order_relaxed);
+        std::size_t k = std::min(quantidade, livres_para_escrita(e, quantidade));
+        for (std::size_t i = 0; i < k; ++i) buffer[(e + i) & mascara] = itens[i];
+        escrita.store(e + k, std::memory_order_release);
+        return k;
+    }
+
+    /**
+     * @brief Retira até `maximo` elementos para `saida`, liberando as posições de uma vez.
+     * @return Quantos elementos foram retirados.
+     */
+    std::size_t pop_lote(T* saida, std::size_t maximo) {
+        std::size_t l = leitura.load(std::memory_order_relaxed);
+        std::size_t k = std::min(maximo, disponiveis_para_leitura(l, maximo));
+        for (std::size_t i = 0; i < k; ++i) saida[i] = std::move(buffer[(l + i) & mascara]);
+        leitura.store(l + k, std::memory_order_release);
+        return k;
+    }
+
+    /**
+     * @brief Número de elementos no momento da leitura; é só uma estimativa se houver operações concorrentes.
+     */
+    std::size_t tamanho_aproximado() const {
+        std::size_t l = leitura.load(std::memory_order_acquire);
+        return escrita.load(std::memory_order_acquire) - l;
+    }
+
+    std::size_t capacidade() const {
+        return mascara + 1;
+    }
+};
+
+/**
+ * @class FilaMPMC
+ * @brief Fila limitada para vários produtores e vários consumidores, no estilo de Dmitry Vyukov.
+ *
+ * Cada posição do buffer tem um número de sequência que diz de quem é a vez:
+ * - `sequencia == pos`: livre para o produtor que reservar a posição `pos`;
+ * - `sequencia == pos + 1`: preenchida, pronta para o consumidor da posição `pos`;
+ * - depois do consumo, passa a `pos + capacidade`, a vez do produtor da volta seguinte.
+ *
+ * Produtores e consumidores só disputam, por CAS, os contadores de reserva (cada um em sua
+ * própria linha de cache); a cópia do elemento acontece fora da disputa, e a sequência da
+ * posição é o único ponto de sincronização entre o produtor e o consumidor de um elemento.
+ */
+template <typename T>
+class FilaMPMC {
+    static_assert(std::is_default_constructible_v<T> && std::is_move_assignable_v<T>,
+                  "Os elementos da fila precisam ser construíveis por padrão e atribuíveis por movimento.");
+
+private:
+    struct Celula {
+        std::atomic<std::size_t> sequencia;
+        T valor;
+    };
+
+    const std::size_t mascara;
+    std::unique_ptr<Celula[]> celulas;
+    alignas(64) std::atomic<std::size_t> proxima_escrita{0};
+    alignas(64) std::atomic<std::size_t> proxima_leitura{0};
+
+    // Diferença com sinal entre a sequência da célula e a esperada.
+    static std::intptr_t diferenca(std::size_t sequencia, std::size_t esperada) {
+        return static_cast<std::intptr_t>(sequencia - esperada);
+    }
+
+    // Reserva até 'maximo' posições consecutivas a partir de 'contador'. 'deslocamento' é 0 para
+    // produtores (célula livre) e 1 para consumidores (célula preenchida). Retorna quantas posições
+    // foram reservadas e a primeira delas em 'pos'.
+    std::size_t reservar(std::atomic<std::size_t>& contador, std::size_t deslocamento, std::size_t maximo,
+                         std::size_t& pos) {
+        pos = contador.load(std::memory_order_relaxed);
+        for (;;) {
+            std::intptr_t dif = diferenca(
+                celulas[pos & mascara].sequencia.load(std::memory_order_acquire), pos + deslocamento);
+            if (dif < 0) return 0; // Cheia (produtor) ou vazia (consumidor)
+            if (dif > 0) {
+                pos = contador.load(std::memory_order_relaxed); // Outra thread já avançou o contador
+                continue;
+            }
+            // As células prontas depois da primeira podem ir no mesmo CAS. Enquanto o contador
+            // não muda, só quem as reservar pode alterá-las, então a verificação continua válida.
+            std::size_t k = 1;
+            while (k < maximo && k <= mascara &&
+                   celulas[(pos + k) & mascara].sequencia.load(std::memory_order_acquire) == pos + k + deslocamento) {
+                ++k;
+            }
+            if (contador.compare_exchange_weak(pos, pos + k, std::memory_order_relaxed)) return k;
+        }
+    }
+
+    template <typename U>
+    bool push_generico(U&& valor) {
+        std::size_t pos;
+        if (reservar(proxima_escrita, 0, 1, pos) == 0) return false;
+        Celula& c = celulas[pos & mascara];
+        c.valor = std::forward<U>(valor);
+        c.sequencia.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+public:
+    /**
+     * @brief Cria uma fila com capacidade para pelo menos `capacidade` elementos.
+     * @throws std::invalid_argument se a capacidade for zero.
+     */
+    explicit FilaMPMC(std::size_t capacidade)
+        : mascara(capacidade_da_fila(capacidade) - 1), celulas(new Celula[mascara + 1]) {
+        for (std::size_t i = 0; i <= mascara; ++i) celulas[i].sequencia.store(i, std::memory_order_relaxed);
+    }
+
+    FilaMPMC(const FilaMPMC&) = delete;
+    FilaMPMC& operator=(const FilaMPMC&) = delete;
+
+    /**
+     * @brief Insere um elemento.
+     * @return false, sem mover o valor, se a fila estiver cheia.
+     */
+    bool push(const T& valor) { return push_generico(valor); }
+    bool push(T&& valor) { return push_generico(std::move(valor)); }
+
+    /**
+     * @brief Retira o elemento mais antigo.
+     * @return false se a fila estiver vazia.
+     */
+    bool pop(T& saida) {
+        return pop_lote(&saida, 1) == 1;
+    }
+
+    /**
+     * @brief Insere até `quantidade` elementos de `itens` com um único CAS no contador de escrita.
+     *
+     * Os elementos de um lote ocupam posições consecutivas, então saem na mesma ordem e sem
+     * elementos de outros produtores entre eles.
+     *
+     * @return Quantos elementos foram inseridos (um prefixo de `itens`).
+     */
+    std::size_t push_lote(const T* itens, std::size_t quantidade) {
+        if (quantidade == 0) return 0;
+        std::size_t pos;
+        std::size_t k = reservar(proxima_escrita, 0, quantidade, pos);
+        for (std::size_t i = 0; i < k; ++i) {
+            Celula& c = celulas[(pos + i) & mascara];
+            c.valor = itens[i];
+            c.sequencia.store(pos + i + 1, std::memory_order_release);
+        }
+        return k;
+    }
+
+    /**
+     * @brief Retira até `maximo` elementos consecutivos com um único CAS no contador de leitura.
+     * @return Quantos elementos foram retirados.
+     */
+    std::size_t pop_lote(T* saida, std::size_t maximo) {
+        if (maximo == 0) return 0;
+        std::size_t pos;
+        std::size_t k = reservar(proxima_leitura, 1, maximo, pos);
+        for (std::size_t i = 0; i < k; ++i) {
+            Celula& c = celulas[(pos + i) & mascara];
+            saida[i] = std::move(c.valor);
+            c.sequencia.store(pos + i + mascara + 1, std::memory_order_release);
+        }
+        return k;
+    }
+
+    /**
+     * @brief Número de elementos reservados no momento da leitura; é só uma estimativa se houver
+     * operações concorrentes.
+     */
+    std::size_t tamanho_aproximado() const {
+        std::size_t l = proxima_leitura.load(std::memory_order_acquire);
+        std::size_t e = proxima_escrita.load(std::memory_order_acquire);
+        return e > l ? e - l : 0;
+    }
+
+    std::size_t capacidade() const {
+        return mascara + 1;
+    }
+};
+
+/**
+ * @class FilaBloqueante
+ * @brief Adaptador que faz `push` esperar enquanto a fila está cheia e `pop` esperar enquanto
+ * está vazia, dormindo com `std::atomic::wait` (um futex no Linux) em vez de girar.
+ *
+ * Cada lado tem um contador de eventos e um contador de anúncios. Quem espera lê o contador de
+ * eventos, tenta a operação de novo, anuncia que vai dormir e dorme até o contador mudar; quem
+ * produz o evento incrementa o contador e só faz a chamada de sistema de `notify` se houver
+ * anúncios, que ele zera. Como todas essas operações são seq_cst, ou quem notifica vê o
+ * anúncio, ou quem espera vê o contador já alterado e não dorme. Assim, um consumidor que
+ * esvazia a fila cheia acorda o produtor adormecido uma vez, e não uma vez por elemento.
+ *
+ * `fechar()` encerra a fila: os `push` seguintes falham, e os `pop` esvaziam o que restou e
+ * depois retornam false, o que permite encerrar os estágios de um pipeline em ordem. Deve ser
+ * chamado depois que os produtores terminaram; um `push` concorrente com o fechamento pode
+ * deixar o seu elemento na fila sem que nenhum `pop` o veja.
+ *
+ * @tparam T Tipo dos elementos.
+ * @tparam Fila Fila sem locks usada por baixo (`FilaMPMC<T>` ou, com uma thread de cada lado,
+ * `FilaSPSC<T>`).
+ */
+template <typename T, typename Fila = FilaMPMC<T>>
+class FilaBloqueante {
+private:
+    struct alignas(64) Sinal {
+        std::atomic<std::uint32_t> eventos{0};
+        std::atomic<std::uint32_t> esperando{0};
+
+        void avisar() {
+            eventos.fetch_add(1);
+            // Zera os anúncios ao acordar: enquanto as threads acordadas não voltam a rodar, os
+            // eventos seguintes não repetem a chamada de sistema.
+            if (esperando.load() > 0 && esperando.exchange(0) > 0) eventos.notify_all();
+        }
+        void avisar_todos() {
+            eventos.fetch_add(1);
+            eventos.notify_all();
+        }
+    };
+
+    Fila fila;
+    Sinal itens;   // Um elemento foi inserido
+    Sinal espacos; // Uma posição foi liberada
+    std::atomic<bool> fechada{false};
+
+    // Tenta 'operacao' até conseguir, dormindo em 'sinal' entre as tentativas. Retorna false se a
+    // fila for fechada antes.
+    template <typename Operacao>
+    bool esperar_por(Sinal& sinal, Operacao&& operacao) {
+        for (;;) {
+            if (operacao()) return true;
+            std::uint32_t visto = sinal.eventos.load();
+            if (operacao()) return true;
+            if (fechada.load()) return false;
+            sinal.esperando.fetch_add(1);
+            sinal.eventos.wait(visto);
+        }
+    }
+
+public:
+    explicit FilaBloqueante(std::size_t capacidade) : fila(capacidade) {}
+
+    FilaBloqueante(const FilaBloqueante&) = delete;
+    FilaBloqueante& operator=(const FilaBloqueante&) = delete;
+
+    /**
+     * @brief Insere um elemento, esperando se a fila estiver cheia.
+     * @return false se a fila foi fechada; nesse caso o valor não é inserido.
+     */
+    bool push(T valor) {
+        if (fechada.load()) return false;
+        if (!esperar_por(espacos, [&] { return fechada.load() ? false : fila.push(std::move(valor)); })) {
+            return false;
+        }
+        itens.avisar();
+        return true;
+    }
+
+    /**
+     * @brief Retira o elemento mais antigo, esperando se a fila estiver vazia.
+     * @return false se a fila foi fechada e não há mais elementos.
+     */
+    bool pop(T& saida) {
+        if (!esperar_por(itens, [&] { return fila.pop(saida); })) return false;
+        espacos.avisar();
+        return true;
+    }
+
+    /**
+     * @brief Tentativas sem espera, com a mesma semântica das filas sem locks.
+     */
+    bool try_push(T valor) {
+        if (fechada.load() || !fila.push(std::move(valor))) return false;
+        itens.avisar();
+        return true;
+    }
+
+    bool try_pop(T& saida) {
+        if (!fila.pop(saida)) return false;
+        espacos.avisar();
+        return true;
+    }
+
+    /**
+     * @brief Fecha a fila e acorda todas as threads esperando.
+     */
+    void fechar() {
+        fechada.store(true);
+        itens.avisar_todos();
+        espacos.avisar_todos();
+    }
+
+    bool esta_fechada() const {
+        return fechada.load();
+    }
+
+    std::size_t capacidade() const {
+        return fila.capacidade();
+    }
+};
+
+#endif // FILA_HPP
@@ -0,0 +1,472 @@
+#ifndef HEAP_HPP
+#define HEAP_HPP
+
+#include <algorithm> // Para std::min
+#include <cstddef>
+#include <functional> // Para std::less
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+/**
+ * @file heap.hpp
+ * @brief Contém filas de prioridade com diminuição de chave (decrease-key) para algoritmos de
+ * grafos: um heap d-ário indexado por identificadores inteiros e um pairing heap com handles.
+ *
+ * Nas duas estruturas, `Comparador(a, b)` verdadeiro significa que `a` sai antes de `b`. Com o
+ * padrão `std::less`, o topo é o menor elemento (ao contrário de `std::priority_queue`).
+ *
+ * @note Como HeapIndexado e PairingHeap são classes de template, toda a sua implementação está
+ * neste arquivo de cabeçalho.
+ */
+
+/**
+ * @class HeapIndexado
+ * @brief Heap d-ário sobre identificadores em [0, capacidade), com mapa de posições.
+ *
+ * Cada entrada do heap guarda a prioridade junto com o identificador, para que as comparações
+ * da descida não precisem de indireção; `posicao[id]` aponta a entrada de cada identificador
+ * presente (ou -1), o que permite `decrease_key` e `erase` em O(log_d n).
+ *
+ * Uma aridade maior que 2 deixa o heap mais raso: as subidas (as operações de `push` e
+ * `decrease_key`, as mais frequentes no Dijkstra) ficam mais curtas, e os d filhos comparados
+ * em cada nível da descida são contíguos na memória. Aridade 4 costuma ser o melhor equilíbrio.
+ *
+ * @tparam Prioridade Tipo da prioridade.
+ * @tparam Aridade Número de filhos de cada nó (d >= 2).
+ * @tparam Comparador Ordem estrita; o topo é o elemento que vem antes de todos os outros.
+ */
+template <typename Prioridade, int Aridade = 4, typename Comparador = std::less<Prioridade>>
+class HeapIndexado {
+    static_assert(Aridade >= 2, "A aridade do heap precisa ser pelo menos 2.");
+
+private:
+    struct Entrada {
+        Prioridade prioridade;
+        int id;
+    };
+
+    std::vector<Entrada> heap;
+    std::vector<int> posicao;
+    Comparador comp;
+
+    void colocar(std::size_t i, Entrada&& e) {
+        posicao[e.id] = static_cast<int>(i);
+        heap[i] = std::move(e);
+    }
+
+    // As duas funções deslocam o "buraco" em vez de trocar pares, com uma escrita por nível.
+    void subir(std::size_t i) {
+        Entrada e = std::move(heap[i]);
+        while (i > 0) {
+            std::size_t pai = (i - 1) / Aridade;
+            if (!comp(e.prioridade, heap[pai].prioridade)) break;
+            colocar(i, std::move(heap[pai]));
+            i = pai;
+        }
+        colocar(i, std::move(e));
+    }
+
+    void descer(std::size_t i) {
+        Entrada e = std::move(heap[i]);
+        const std::size_t n = heap.size();
+        for (;;) {
+            std::size_t primeiro = i * Aridade + 1;
+            if (primeiro >= n) break;
+            std::size_t ultimo = std::min(primeiro + Aridade, n);
+            std::size_t melhor = primeiro;
+            for (std::size_t c = primeiro + 1; c < ultimo; ++c) {
+                if (comp(heap[c].prioridade, heap[melhor].prioridade)) melhor = c;
+            }
+            if (!comp(heap[melhor].prioridade, e.prioridade)) break;
+            colocar(i, std::move(heap[melhor]));
+            i = melhor;
+        }
+        colocar(i, std::move(e));
+    }
+
+    void verificar_id(int id) const {
+        if (id < 0 || id >= static_cast<int>(posicao.size())) {
+            throw std::out_of_range("Identificador fora da capacidade do heap.");
+        }
+    }
+
+    void verificar_presente(int id) const {
+        verificar_id(id);
+        if (posicao[id] < 0) throw std::invalid_argument("O identificador não está no heap.");
+    }
+
+    void verificar_nao_vazio() const {
+        if (heap.empty()) throw std::out_of_range("O heap está vazio.");
+    }
+
+public:
+    /**
+     * @brief Cria um heap vazio que aceita os identificadores [0, capacidade).
+     */
+    explicit HeapIndexado(int capacidade = 0, Comparador c = Comparador())
+        : posicao(capacidade, -1), comp(std::move(c)) {
+        heap.reserve(capacidade);
+    }
+
+    /**
+     * @brief Cria um heap com os identificadores 0..n-1, onde o id i tem prioridade `prioridades[i]`.
+     *
+     * Usa a construção de Floyd: desce cada nó interno, do último ao primeiro.
+     *
+     * @complexity Time: O(n)
+     */
+    explicit HeapIndexado(const std::vector<Prioridade>& prioridades, Comparador c = Comparador())
+        : posicao(prioridades.size()), comp(std::move(c)) {
+        heap.reserve(prioridades.size());
+        for (std::size_t i = 0; i < prioridades.size(); ++i) {
+            heap.push_back({prioridades[i], static_cast<int>(i)});
+            posicao[i] = static_cast<int>(i);
+        }
+        if (heap.size() > 1) {
+            for (std::size_t i = (heap.size() - 2) / Aridade + 1; i-- > 0;) descer(i);
+        }
+    }
+
+    /**
+     * @brief Insere o identificador `id` com a prioridade dada.
+     * @throws std::out_of_range se o id estiver fora da capacidade.
+     * @throws std::invalid_argument se o id já estiver no heap.
+     * @complexity Time: O(log_d n)
+     */
+    void push(int id, const Prioridade& prioridade) {
+        verificar_id(id);
+        if (posicao[id] >= 0) throw std::invalid_argument("O identificador já está no heap.");
+        heap.push_back({prioridade, id});
+        subir(heap.size() - 1);
+    }
+
+    /**
+     * @brief Retorna o identificador do topo.
+     * @throws std::out_of_range se o heap estiver vazio.
+     */
+    int top() const {
+        verificar_nao_vazio();
+        return heap[0].id;
+    }
+
+    /**
+     * @brief Retorna a prioridade do topo.
+     * @throws std::out_of_range se o heap estiver vazio.
+     */
+    const Prioridade& top_prioridade() const {
+        verificar_nao_vazio();
+        return heap[0].prioridade;
+    }
+
+    /**
+     * @brief Remove o topo e retorna o seu identificador.
+     * @throws std::out_of_range se o heap estiver vazio.
+     * @complexity Time: O(d log_d n)
+     */
+    int pop() {
+        verificar_nao_vazio();
+        int id = heap[0].id;
+        posicao[id] = -1;
+        Entrada ultima = std::move(heap.back());
+        heap.pop_back();
+        if (!heap.empty()) {
+            heap[0] = std::move(ultima);
+            descer(0);
+        }
+        return id;
+    }
+
+    /**
+     * @brief Melhora (no sentido do comparador) a prioridade de um identificador presente.
+     * @throws std::invalid_argument se o id não estiver no heap ou se a nova prioridade for pior.
+     * @complexity Time: O(log_d n)
+     */
+    void decrease_key(int id, const Prioridade& nova) {
+        verificar_presente(id);
+        Entrada& e = heap[posicao[id]];
+        if (comp(e.prioridade, nova)) throw std::invalid_argument("A nova prioridade é pior que a atual.");
+        e.prioridade = nova;
+        subir(posicao[id]);
+    }
+
+    /**
+     * @brief Remove um identificador presente em qualquer posição do heap.
+     * @throws std::invalid_argument se o id não estiver no heap.
+     * @complexity Time: O(d log_d n)
+     */
+    void erase(int id) {
+        verificar_presente(id);
+        std::size_t i = posicao[id];
+        posicao[id] = -1;
+        Entrada ultima = std::move(heap.back());
+        heap.pop_back();
+        if (i == heap.size()) return;
+        heap[i] = std::move(ultima);
+        // A última entrada pode precisar tanto subir quanto descer a partir do buraco.
+        if (i > 0 && comp(heap[i].prioridade, heap[(i - 1) / Aridade].prioridade)) subir(i);
+        else descer(i);
+    }
+
+    bool contem(int id) const {
+        return id >= 0 && id < static_cast<int>(posicao.size()) && posicao[id] >= 0;
+    }
+
+    /**
+     * @brief Retorna a prioridade atual de um identificador presente.
+     * @throws std::invalid_argument se o id não estiver no heap.
+     */
+    const Prioridade& prioridade(int id) const {
+        verificar_presente(id);
+        return heap[posicao[id]].prioridade;
+    }
+
+    bool empty() const {
+        return heap.empty();
+    }
+
+    std::size_t size() const {
+        return heap.size();
+    }
+
+    int capacidade() const {
+        return static_cast<int>(posicao.size());
+    }
+};
+
+/**
+ * @class PairingHeap
+ * @brief Pairing heap com handles estáveis para `decrease_key` e `erase`.
+ *
+ * Cada nó aponta o primeiro filho, o próximo irmão e o nó anterior (o pai, se for o primeiro
+ * filho, ou o irmão anterior). `push`, `merge` e `decrease_key` apenas ligam árvores, em O(1);
+ * o trabalho fica para o `pop`, que combina os filhos da raiz em duas passadas (pares da
+ * esquerda para a direita e depois da direita para a esquerda), em O(log n) amortizado.
+ *
+ * Os nós removidos ficam em uma lista livre e são reaproveitados pelos próximos `push`.
+ *
+ * @tparam T Tipo dos elementos.
+ * @tparam Comparador Ordem estrita; o topo é o elemento que vem antes de todos os outros.
+ */
+template <typename T, typename Comparador = std::less<T>>
+class PairingHeap {
+private:
+    struct No {
+        T valor;
+        No* filho = nullptr;
+        No* irmao = nullptr;
+        No* anterior = nullptr;
+    };
+
+    No* raiz = nullptr;
+    No* livres = nullptr; // Lista de nós reaproveitáveis, encadeados por 'irmao'
+    std::size_t n = 0;
+    std::vector<No*> pares; // Buffer reutilizado pela combinação em duas passadas
+    Comparador comp;
+
+    // Liga duas raízes sem irmãos; a que perde vira o primeiro filho da outra.
+    No* ligar(No* a, No* b) {
+        if (comp(b->valor, a->valor)) std::swap(a, b);
+        b->irmao = a->filho;
+        if (a->filho) a->filho->anterior = b;
+        b->anterior = a;
+        a->filho = b;
+        return a;
+    }
+
+    // Desliga o nó (com sua subárvore) do pai e dos irmãos.
+    static void cortar(No* no) {
+        if (no->anterior->filho == no) no->anterior->filho = no->irmao;
+        else no->anterior->irmao = no->irmao;
+        if (no->irmao) no->irmao->anterior = no->anterior;
+        no->anterior = no->irmao = nullptr;
+    }
+
+    // Combina uma lista de irmãos em uma única árvore.
+    No* combinar(No* primeiro) {
+        if (!primeiro) return nullptr;
+        pares.clear();
+        while (primeiro) {
+            No* a = primeiro;
+            No* b = a->irmao;
+            a->anterior = a->irmao = nullptr;
+            if (!b) {
+                pares.push_back(a);
+                break;
+            }
+            primeiro = b->irmao;
+            b->anterior = b->irmao = nullptr;
+            pares.push_back(ligar(a, b));
+        }
+        No* resultado = pares.back();
+        for (std::size_t i = pares.size() - 1; i-- > 0;) resultado = ligar(pares[i], resultado);
+        return resultado;
+    }
+
+    No* novo_no(const T& valor) {
+        if (!livres) return new No{valor};
+        No* no = livres;
+        livres = no->irmao;
+        no->valor = valor;
+        no->filho = no->irmao = no->anterior = nullptr;
+        return no;
+    }
+
+    void liberar_no(No* no) {
+        no->irmao = livres;
+        livres = no;
+    }
+
+    void verificar_nao_vazio() const {
+        if (!raiz) throw std::out_of_range("O heap está vazio.");
+    }
+
+    void destruir() {
+        // Percorre sem recursão: os filhos de cada nó são anexados à lista que está sendo apagada.
+        No* pendentes = raiz;
+        while (pendentes) {
+            No* no = pendentes;
+            pendentes = no->irmao;
+            if (no->filho) {
+                No* ultimo = no->filho;
+                while (ultimo->irmao) ultimo = ultimo->irmao;
+                ultimo->irmao = pendentes;
+                pendentes = no->filho;
+            }
+            delete no;
+        }
+        while (livres) {
+            No* no = livres;
+            livres = no->irmao;
+            delete no;
+        }
+        raiz = nullptr;
+        n = 0;
+    }
+
+public:
+    /**
+     * @class Handle
+     * @brief Referência a um elemento inserido, válida até ele ser removido por `pop` ou `erase`.
+     */
+    class Handle {
+        No* no = nullptr;
+        friend class PairingHeap;
+        explicit Handle(No* p) : no(p) {}
+
+    public:
+        Handle() = default;
+        const T& valor() const { return no->valor; }
+        bool operator==(const Handle& outro) const { return no == outro.no; }
+    };
+
+    explicit PairingHeap(Comparador c = Comparador()) : comp(std::move(c)) {}
+
+    PairingHeap(const PairingHeap&) = delete;
+    PairingHeap& operator=(const PairingHeap&) = delete;
+
+    PairingHeap(PairingHeap&& outro) noexcept
+        : raiz(std::exchange(outro.raiz, nullptr)), livres(std::exchange(outro.livres, nullptr)),
+          n(std::exchange(outro.n, 0)), comp(std::move(outro.comp)) {}
+
+    PairingHeap& operator=(PairingHeap&& outro) noexcept {
+        if (this != &outro) {
+            destruir();
+            raiz = std::exchange(outro.raiz, nullptr);
+            livres = std::exchange(outro.livres, nullptr);
+            n = std::exchange(outro.n, 0);
+            comp = std::move(outro.comp);
+        }
+        return *this;
+    }
+
+    ~PairingHeap() {
+        destruir();
+    }
+
+    /**
+     * @brief Insere um elemento e retorna o seu handle.
+     * @complexity Time: O(1)
+     */
+    Handle push(const T& valor) {
+        No* no = novo_no(valor);
+        raiz = raiz ? ligar(raiz, no) : no;
+        ++n;
+        return Handle(no);
+    }
+
+    /**
+     * @brief Retorna o elemento do topo.
+     * @throws std::out_of_range se o heap estiver vazio.
+     */
+    const T& top() const {
+        verificar_nao_vazio();
+        return raiz->valor;
+    }
+
+    /**
+     * @brief Remove o elemento do topo.
+     * @throws std::out_of_range se o heap estiver vazio.
+     * @complexity Time: O(log n) amortizado.
+     */
+    void pop() {
+        verificar_nao_vazio();
+        No* antiga = raiz;
+        raiz = combinar(antiga->filho);
+        liberar_no(antiga);
+        --n;
+    }
+
+    /**
+     * @brief Melhora (no sentido do comparador) o valor de um elemento presente.
+     * @throws std::invalid_argument se o novo valor for pior que o atual.
+     * @complexity Time: O(1), com custo amortizado o(log n).
+     */
+    void decrease_key(Handle h, const T& novo) {
+        No* no = h.no;
+        if (comp(no->valor, novo)) throw std::invalid_argument("O novo valor é pior que o atual.");
+        no->valor = novo;
+        if (no == raiz) return;
+        cortar(no);
+        raiz = ligar(raiz, no);
+    }
+
+    /**
+     * @brief Remove um elemento presente em qualquer posição.
+     * @complexity Time: O(log n) amortizado.
+     */
+    void erase(Handle h) {
+        No* no = h.no;
+        if (no == raiz) {
+            pop();
+            return;
+        }
+        cortar(no);
+        No* filhos = combinar(no->filho);
+        if (filhos) raiz = ligar(raiz, filhos);
+        liberar_no(no);
+        --n;
+    }
+
+    /**
+     * @brief Move todos os elementos de `outro` para este heap. Os handles continuam válidos.
+     * @complexity Time: O(1)
+     */
+    void merge(PairingHeap& outro) {
+        if (this == &outro || !outro.raiz) return;
+        raiz = raiz ? ligar(raiz, outro.raiz) : outro.raiz;
+        n += outro.n;
+        outro.raiz = nullptr;
+        outro.n = 0;
+    }
+
+    bool empty() const {
+        return raiz == nullptr;
+    }
+
+    std::size_t size() const {
+        return n;
+    }
+};
+
+#endif // HEAP_HPP
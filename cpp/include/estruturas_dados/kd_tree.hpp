@@ -0,0 +1,381 @@
+#ifndef KD_TREE_HPP
+#define KD_TREE_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#if defined(__AVX__) || defined(__SSE2__) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+
+/**
+ * @file kd_tree.hpp
+ * @brief Contém a implementação de uma KD-tree estática, construída em lote, para consultas de
+ * k vizinhos mais próximos e de vizinhos dentro de um raio, individuais ou em lotes paralelos.
+ *
+ * @note Como KDTree é uma classe de template, toda a sua implementação está neste arquivo de
+ * cabeçalho.
+ */
+
+/**
+ * @class KDTree
+ * @brief KD-tree implícita sobre uma nuvem de pontos fixa, sem ponteiros entre nós.
+ *
+ * - Os nós formam uma árvore binária completa guardada em vetores indexados como um heap
+ *   (filhos de i em 2i + 1 e 2i + 2). Cada nó interno guarda só o valor e a dimensão de corte.
+ * - O nó que cobre [ini, fim) é cortado sempre na mediana, em meio = ini + (fim - ini) / 2,
+ *   escolhida com `std::nth_element` na dimensão de maior amplitude. Como o intervalo de
+ *   cada nó é recalculado durante a descida, não é preciso guardá-lo, e todas as folhas ficam
+ *   na mesma profundidade.
+ * - Cada folha é um balde de até `TamanhoBalde` pontos consecutivos. As coordenadas são
+ *   guardadas dimensão por dimensão (estrutura de vetores), de modo que as distâncias de um
+ *   balde inteiro são calculadas com instruções SIMD para `float` e `double`.
+ * - A busca acumula a distância da consulta à célula incrementalmente (Arya e Mount), trocando
+ *   só a parcela da dimensão de corte ao visitar o filho mais distante.
+ *
+ * As distâncias retornadas são euclidianas ao quadrado. Para coordenadas inteiras elas são
+ * calculadas em `long long`, então as diferenças ao quadrado somadas precisam caber em 63 bits.
+ *
+ * @tparam T Tipo escalar das coordenadas.
+ * @tparam D Número de dimensões, fixo em tempo de compilação para que os laços sejam desenrolados.
+ * @tparam TamanhoBalde Máximo de pontos por folha.
+ */
+template <typename T, int D, int TamanhoBalde = 16>
+class KDTree {
+    static_assert(std::is_arithmetic_v<T>, "As coordenadas precisam ser de um tipo aritmético.");
+    static_assert(D >= 1 && D <= 255, "O número de dimensões precisa estar em [1, 255].");
+    static_assert(TamanhoBalde >= 1, "Cada folha precisa comportar ao menos um ponto.");
+
+public:
+    using Ponto = std::array<T, D>;
+    using Distancia = std::conditional_t<std::is_floating_point_v<T>, T, long long>;
+
+    /**
+     * @brief Um resultado de consulta: o índice do ponto no vetor original e sua distância ao quadrado.
+     */
+    struct Vizinho {
+        Distancia distancia2;
+        std::size_t indice;
+    };
+
+private:
+    std::size_t n;
+    int niveis;                           // Profundidade das folhas (0 quando a raiz é uma folha)
+    std::vector<T> coordenadas;           // coordenadas[d * n + i] = coordenada d do i-ésimo ponto reordenado
+    std::vector<std::size_t> originais;   // Índice no vetor de entrada de cada ponto reordenado
+    std::vector<T> cortes;                // Valor de corte de cada nó interno
+    std::vector<std::uint8_t> dimensoes;  // Dimensão de corte de cada nó interno
+
+    struct Entrada {
+        Ponto ponto;
+        std::size_t indice;
+    };
+
+    // Ordem total dos resultados: distância e, nos empates, índice original. O heap dos k vizinhos
+    // usa a mesma ordem, para que os empates na fronteira do k-ésimo não dependam do percurso.
+    static bool menor_vizinho(const Vizinho& a, const Vizinho& b) {
+        return a.distancia2 < b.distancia2 || (a.distancia2 == b.distancia2 && a.indice < b.indice);
+    }
+
+    void construir(std::vector<Entrada>& entradas, std::size_t no, std::size_t ini, std::size_t fim, int nivel) {
+        if (nivel == niveis) return;
+
+        // Corta na dimensão em que os pontos do nó estão mais espalhados.
+        Ponto minimo = entradas[ini].ponto, maximo = entradas[ini].ponto;
+        for (std::size_t i = ini + 1; i < fim; ++i) {
+            for (int d = 0; d < D; ++d) {
+                minimo[d] = std::min(minimo[d], entradas[i].ponto[d]);
+                maximo[d] = std::max(maximo[d], entradas[i].ponto[d]);
+            }
+        }
+        int dim = 0;
+        for (int d = 1; d < D; ++d) {
+            if (maximo[d] - minimo[d] > maximo[dim] - minimo[dim]) dim = d;
+        }
+
+        std::size_t meio = ini + (fim - ini) / 2;
+        std::nth_element(entradas.begin() + ini, entradas.begin() + meio, entradas.begin() + fim,
+                         [dim](const Entrada& a, const Entrada& b) { return a.ponto[dim] < b.ponto[dim]; });
+        cortes[no] = entradas[meio].ponto[dim];
+        dimensoes[no] = static_cast<std::uint8_t>(dim);
+
+        construir(entradas, 2 * no + 1, ini, meio, nivel + 1);
+        construir(entradas, 2 * no + 2, meio, fim, nivel + 1);
+    }
+
+    /**
+     * @brief Preenche dist[j] com a distância ao quadrado entre q e o ponto ini + j, para j < num.
+     */
+    void distancias_balde(const Ponto& q, std::size_t ini, std::size_t num, Distancia* dist) const {
+        const T* base = coordenadas.data() + ini;
+        std::size_t j = 0;
+#if defined(__AVX__)
+        if constexpr (std::is_same_v<T, float>) {
+            for (; j + 8 <= num; j += 8) {
+                __m256 soma = _mm256_setzero_ps();
+                for (int d = 0; d < D; ++d) {
+                    __m256 diff = _mm256_sub_ps(_mm256_loadu_ps(base + d * n + j), _mm256_set1_ps(q[d]));
+                    soma = _mm256_add_ps(soma, _mm256_mul_ps(diff, diff));
+                }
+                _mm256_storeu_ps(dist + j, soma);
+            }
+        } else if constexpr (std::is_same_v<T, double>) {
+            for (; j + 4 <= num; j += 4) {
+                __m256d soma = _mm256_setzero_pd();
+                for (int d = 0; d < D; ++d) {
+                    __m256d diff = _mm256_sub_pd(_mm256_loadu_pd(base + d * n + j), _mm256_set1_pd(q[d]));
+                    soma = _mm256_add_pd(soma, _mm256_mul_pd(diff, diff));
+                }
+                _mm256_storeu_pd(dist + j, soma);
+            }
+        }
+#elif defined(__SSE2__) || defined(_M_X64)
+        if constexpr (std::is_same_v<T, float>) {
+            for (; j + 4 <= num; j += 4) {
+                __m128 soma = _mm_setzero_ps();
+                for (int d = 0; d < D; ++d) {
+                    __m128 diff = _mm_sub_ps(_mm_loadu_ps(base + d * n + j), _mm_set1_ps(q[d]));
+                    soma = _mm_add_ps(soma, _mm_mul_ps(diff, diff));
+                }
+                _mm_storeu_ps(dist + j, soma);
+            }
+        } else if constexpr (std::is_same_v<T, double>) {
+            for (; j + 2 <= num; j += 2) {
+                __m128d soma = _mm_setzero_pd();
+                for (int d = 0; d < D; ++d) {
+                    __m128d diff = _mm_sub_pd(_mm_loadu_pd(base + d * n + j), _mm_set1_pd(q[d]));
+                    soma = _mm_add_pd(soma, _mm_mul_pd(diff, diff));
+                }
+                _mm_storeu_pd(dist + j, soma);
+            }
+        }
+#endif
+        for (; j < num; ++j) {
+            Distancia soma = 0;
+            for (int d = 0; d < D; ++d) {
+                Distancia diff = static_cast<Distancia>(base[d * n + j]) - static_cast<Distancia>(q[d]);
+                soma += diff * diff;
+            }
+            dist[j] = soma;
+        }
+    }
+
+    // Estado de uma consulta. 'deslocamento[d]' é a distância (com sinal) da consulta à célula
+    // atual na dimensão d, e 'dist_celula' é a soma dos seus quadrados.
+    struct Busca {
+        Ponto q;
+        std::array<Distancia, D> deslocamento{};
+        std::vector<Vizinho>* resultado;
+        std::size_t k;       // 0 na busca por raio
+        Distancia limite;    // Raio ao quadrado, na busca por raio
+
+        // Distância abaixo da qual um ponto ainda entra no resultado.
+        Distancia pior() const {
+            if (k == 0) return limite;
+            return resultado->size() < k ? std::numeric_limits<Distancia>::max() : resultado->front().distancia2;
+        }
+
+        // Na busca por raio o limite é inclusivo; nos k vizinhos, com o heap cheio, o ponto precisa
+        // vir antes do pior na ordem (distância, índice).
+        bool aceita(Distancia dist, std::size_t indice) const {
+            if (k == 0) return dist <= limite;
+            return resultado->size() < k || menor_vizinho({dist, indice}, resultado->front());
+        }
+
+        void adicionar(Distancia dist, std::size_t indice) {
+            if (k == 0) {
+                resultado->push_back({dist, indice});
+            } else if (resultado->size() < k) {
+                resultado->push_back({dist, indice});
+                std::push_heap(resultado->begin(), resultado->end(), menor_vizinho);
+            } else {
+                std::pop_heap(resultado->begin(), resultado->end(), menor_vizinho);
+                resultado->back() = {dist, indice};
+                std::push_heap(resultado->begin(), resultado->end(), menor_vizinho);
+            }
+        }
+    };
+
+    void buscar(Busca& busca, std::size_t no, std::size_t ini, std::size_t fim, int nivel, Distancia dist_celula) const {
+        if (nivel == niveis) {
+            Distancia dist[TamanhoBalde];
+            std::size_t num = fim - ini;
+            distancias_balde(busca.q, ini, num, dist);
+            for (std::size_t j = 0; j < num; ++j) {
+                if (busca.aceita(dist[j], originais[ini + j])) busca.adicionar(dist[j], originais[ini + j]);
+            }
+            return;
+        }
+
+        int dim = dimensoes[no];
+        std::size_t meio = ini + (fim - ini) / 2;
+        Distancia diff = static_cast<Distancia>(busca.q[dim]) - static_cast<Distancia>(cortes[no]);
+        bool esquerda_primeiro = diff < 0;
+
+        if (esquerda_primeiro) buscar(busca, 2 * no + 1, ini, meio, nivel + 1, dist_celula);
+        else buscar(busca, 2 * no + 2, meio, fim, nivel + 1, dist_celula);
+
+        // O filho mais distante só é visitado se a sua célula ainda pode conter algum resultado.
+        Distancia anterior = busca.deslocamento[dim];
+        Distancia dist_longe = dist_celula - anterior * anterior + diff * diff;
+        // Inclusivo também nos k vizinhos: um ponto empatado com o pior pode ter índice menor.
+        if (!(dist_longe <= busca.pior())) return;
+        busca.deslocamento[dim] = diff;
+        if (esquerda_primeiro) buscar(busca, 2 * no + 2, meio, fim, nivel + 1, dist_longe);
+        else buscar(busca, 2 * no + 1, ini, meio, nivel + 1, dist_longe);
+        busca.deslocamento[dim] = anterior;
+    }
+
+    void k_vizinhos_em(const Ponto& q, std::size_t k, std::vector<Vizinho>& heap) const {
+        heap.clear();
+        if (k == 0 || n == 0) return;
+        Busca busca{q, {}, &heap, k, 0};
+        buscar(busca, 0, 0, n, 0, 0);
+        std::sort(heap.begin(), heap.end(), menor_vizinho);
+    }
+
+    void vizinhos_no_raio_em(const Ponto& q, Distancia raio2, std::vector<Vizinho>& resultado) const {
+        resultado.clear();
+        if (n == 0) return;
+        Busca busca{q, {}, &resultado, 0, raio2};
+        buscar(busca, 0, 0, n, 0, 0);
+        std::sort(resultado.begin(), resultado.end(), menor_vizinho);
+    }
+
+    // Distribui [0, total) entre as threads em blocos pegos de um contador atômico, para que
+    // consultas mais caras em regiões densas não deixem threads ociosas.
+    template <typename F>
+    static void executar_em_paralelo(std::size_t total, unsigned num_threads, F&& tarefa) {
+        constexpr std::size_t BLOCO = 64;
+        if (num_threads == 0) num_threads = std::max(1u, std::thread::hardware_concurrency());
+        num_threads = static_cast<unsigned>(std::min<std::size_t>(num_threads, (total + BLOCO - 1) / BLOCO));
+
+        std::atomic<std::size_t> proximo{0};
+        auto trabalhar = [&]() {
+            for (;;) {
+                std::size_t inicio = proximo.fetch_add(BLOCO, std::memory_order_relaxed);
+                if (inicio >= total) return;
+                tarefa(inicio, std::min(total, inicio + BLOCO));
+            }
+        };
+        std::vector<std::thread> threads;
+        for (unsigned t = 1; t < num_threads; ++t) threads.emplace_back(trabalhar);
+        trabalhar();
+        for (std::thread& th : threads) th.join();
+    }
+
+    static Distancia raio_ao_quadrado(T raio) {
+        if (raio < 0) throw std::invalid_argument("O raio não pode ser negativo.");
+        return static_cast<Distancia>(raio) * static_cast<Distancia>(raio);
+    }
+
+public:
+    /**
+     * @brief Constrói a árvore sobre uma cópia dos pontos.
+     * @complexity Time: O(n log n), Space: O(n)
+     */
+    explicit KDTree(const std::vector<Ponto>& pontos) : n(pontos.size()), niveis(0) {
+        // Folhas na profundidade L têm floor(n / 2^L) ou ceil(n / 2^L) pontos.
+        while (((n + (std::size_t(1) << niveis) - 1) >> niveis) > static_cast<std::size_t>(TamanhoBalde)) ++niveis;
+        std::size_t internos = (std::size_t(1) << niveis) - 1;
+        cortes.resize(internos);
+        dimensoes.resize(internos);
+
+        std::vector<Entrada> entradas(n);
+        for (std::size_t i = 0; i < n; ++i) entradas[i] = {pontos[i], i};
+        if (n > 0) construir(entradas, 0, 0, n, 0);
+
+        coordenadas.resize(static_cast<std::size_t>(D) * n);
+        originais.resize(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            for (int d = 0; d < D; ++d) coordenadas[d * n + i] = entradas[i].ponto[d];
+            originais[i] = entradas[i].indice;
+        }
+    }
+
+    /**
+     * @brief Retorna os k pontos mais próximos de q, do mais próximo ao mais distante (ou todos,
+     * se houver menos de k). Empates de distância são ordenados pelo índice original.
+     * @throws std::invalid_argument se k for negativo.
+     * @complexity Time: O(log n + k log k) em média para pontos bem distribuídos.
+     */
+    std::vector<Vizinho> k_vizinhos(const Ponto& q, int k) const {
+        if (k < 0) throw std::invalid_argument("k não pode ser negativo.");
+        std::vector<Vizinho> resultado;
+        resultado.reserve(std::min<std::size_t>(k, n));
+        k_vizinhos_em(q, k, resultado);
+        return resultado;
+    }
+
+    /**
+     * @brief Retorna todos os pontos a distância no máximo `raio` de q, do mais próximo ao mais distante.
+     * @throws std::invalid_argument se o raio for negativo.
+     */
+    std::vector<Vizinho> vizinhos_no_raio(const Ponto& q, T raio) const {
+        std::vector<Vizinho> resultado;
+        vizinhos_no_raio_em(q, raio_ao_quadrado(raio), resultado);
+        return resultado;
+    }
+
+    /**
+     * @brief Executa `k_vizinhos` para cada consulta, distribuindo as consultas entre threads.
+     *
+     * Para não alocar um vetor por consulta, o resultado é um único vetor com min(k, n) vizinhos
+     * por consulta: os da consulta i ficam nas posições [i * min(k, n), (i + 1) * min(k, n)).
+     *
+     * @param num_threads Número de threads; 0 usa `std::thread::hardware_concurrency()`.
+     * @throws std::invalid_argument se k for negativo.
+     */
+    std::vector<Vizinho> k_vizinhos_lote(const std::vector<Ponto>& consultas, int k, unsigned num_threads = 0) const {
+        if (k < 0) throw std::invalid_argument("k não pode ser negativo.");
+        std::size_t por_consulta = std::min<std::size_t>(k, n);
+        std::vector<Vizinho> resultado(consultas.size() * por_consulta);
+        if (por_consulta == 0) return resultado;
+
+        executar_em_paralelo(consultas.size(), num_threads, [&](std::size_t ini, std::size_t fim) {
+            std::vector<Vizinho> heap;
+            heap.reserve(por_consulta);
+            for (std::size_t i = ini; i < fim; ++i) {
+                k_vizinhos_em(consultas[i], por_consulta, heap);
+                std::copy(heap.begin(), heap.end(), resultado.begin() + i * por_consulta);
+            }
+        });
+        return resultado;
+    }
+
+    /**
+     * @brief Executa `vizinhos_no_raio` para cada consulta, distribuindo as consultas entre threads.
+     * @param num_threads Número de threads; 0 usa `std::thread::hardware_concurrency()`.
+     * @throws std::invalid_argument se o raio for negativo.
+     */
+    std::vector<std::vector<Vizinho>> vizinhos_no_raio_lote(const std::vector<Ponto>& consultas, T raio,
+                                                            unsigned num_threads = 0) const {
+        Distancia raio2 = raio_ao_quadrado(raio);
+        std::vector<std::vector<Vizinho>> resultado(consultas.size());
+        executar_em_paralelo(consultas.size(), num_threads, [&](std::size_t ini, std::size_t fim) {
+            for (std::size_t i = ini; i < fim; ++i) vizinhos_no_raio_em(consultas[i], raio2, resultado[i]);
+        });
+        return resultado;
+    }
+
+    std::size_t tamanho() const {
+        return n;
+    }
+
+    /**
+     * @brief Profundidade das folhas; a raiz está na profundidade 0.
+     */
+    int altura() const {
+        return niveis;
+    }
+};
+
+#endif // KD_TREE_HPP
@@ -0,0 +1,380 @@
+#ifndef LISTA_ENCADEADA_DUPLA_HPP
+#define LISTA_ENCADEADA_DUPLA_HPP
+
+#include "estruturas_dados/lista_encadeada_simples.hpp" // PoolDeNos e rotinas de arranjo
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @file lista_encadeada_dupla.hpp
+ * @brief Contém a implementação de uma lista duplamente encadeada desenrolada (unrolled linked
+ * list), com nós de pequenos arranjos de elementos vindos de um `PoolDeNos`.
+ *
+ * @note Como ListaEncadeadaDupla é uma classe de template, toda a sua implementação está neste
+ * arquivo de cabeçalho.
+ */
+
+/**
+ * @class ListaEncadeadaDupla
+ * @brief Lista duplamente encadeada circular com sentinela, em que cada nó guarda até `B`
+ * elementos contíguos.
+ *
+ * Percorrer a lista custa uma falta de cache a cada `B` elementos em vez de uma por elemento, e
+ * os nós vêm de um pool em blocos, então não há chamadas a `malloc` depois do aquecimento.
+ *
+ * - Inserir em um nó cheio o divide ao meio.
+ * - Um nó que fica com menos de B/4 elementos absorve o seguinte quando os dois cabem em um só.
+ * - Listas que compartilham o pool trocam nós inteiros em `splice`, sem mover elementos.
+ *
+ * @note Validade dos iteradores: uma inserção invalida apenas os iteradores para elementos do nó
+ * alterado, e uma remoção, os do nó alterado e do nó seguinte (que pode ser absorvido). `end()`
+ * nunca é invalidado.
+ *
+ * @tparam T Tipo dos elementos; precisa ser construível e atribuível por movimento.
+ * @tparam B Máximo de elementos por nó.
+ */
+template <typename T, int B = elementos_por_no_padrao<T>()>
+class ListaEncadeadaDupla {
+    static_assert(B >= 2, "Cada nó precisa comportar pelo menos dois elementos.");
+
+private:
+    // Parte comum aos nós e à sentinela, que não guarda elementos.
+    struct Elo {
+        Elo* anterior;
+        Elo* proximo;
+        int num = 0;
+    };
+
+    struct No : Elo {
+        alignas(T) unsigned char memoria[B * sizeof(T)];
+
+        T* elementos() { return std::launder(reinterpret_cast<T*>(memoria)); }
+    };
+
+public:
+    using Pool = PoolDeNos<No>;
+
+private:
+    static constexpr int MINIMO = B / 4 > 0 ? B / 4 : 1;
+
+    std::shared_ptr<Pool> pool;
+    Elo sentinela;
+    std::size_t n = 0;
+
+    static No* como_no(Elo* elo) { return static_cast<No*>(elo); }
+
+    static void ligar(Elo* a, Elo* b) {
+        a->proximo = b;
+        b->anterior = a;
+    }
+
+    // Insere um nó vazio antes de 'elo'.
+    No* novo_no_antes(Elo* elo) {
+        No* novo = new (pool->alocar()) No();
+        ligar(elo->anterior, novo);
+        ligar(novo, elo);
+        return novo;
+    }
+
+    // Desliga e libera um nó vazio.
+    void desligar(No* no) {
+        ligar(no->anterior, no->proximo);
+        no->~No();
+        pool->liberar(no);
+    }
+
+    // Move os elementos [i, num) de 'no' para um nó novo logo depois dele.
+    No* dividir(No* no, int i) {
+        No* novo = novo_no_antes(no->proximo);
+        arranjo_transferir(no->elementos(), no->num, i, novo->elementos(), novo->num);
+        return novo;
+    }
+
+    template <bool Constante>
+    class IteradorBase {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Constante, const T*, T*>;
+        using reference = std::conditional_t<Constante, const T&, T&>;
+
+        IteradorBase() = default;
+        // Um iterador mutável pode ser convertido em constante.
+        template <bool C = Constante, typename = std::enable_if_t<C>>
+        IteradorBase(const IteradorBase<false>& outro) : elo(outro.elo), i(outro.i) {}
+
+        reference operator*() const { return como_no(elo)->elementos()[i]; }
+        pointer operator->() const { return &**this; }
+
+        IteradorBase& operator++() {
+            if (++i >= elo->num) {
+                elo = elo->proximo;
+                i = 0;
+            }
+            return *this;
+        }
+
+        IteradorBase& operator--() {
+            if (i == 0) {
+                elo = elo->anterior;
+                i = elo->num;
+            }
+            --i;
+            return *this;
+        }
+
+        IteradorBase operator++(int) {
+            IteradorBase copia = *this;
+            ++*this;
+            return copia;
+        }
+
+        IteradorBase operator--(int) {
+            IteradorBase copia = *this;
+            --*this;
+            return copia;
+        }
+
+        bool operator==(const IteradorBase& outro) const { return elo == outro.elo && i == outro.i; }
+        bool operator!=(const IteradorBase& outro) const { return !(*this == outro); }
+
+    private:
+        friend class ListaEncadeadaDupla;
+        friend class IteradorBase<!Constante>;
+        IteradorBase(const Elo* e, int indice) : elo(const_cast<Elo*>(e)), i(indice) {}
+
+        Elo* elo = nullptr; // A sentinela em end()
+        int i = 0;
+    };
+
+public:
+    using Iterador = IteradorBase<false>;
+    using IteradorConst = IteradorBase<true>;
+
+    /**
+     * @brief Cria uma lista vazia. Listas criadas com o mesmo pool fazem splice sem mover elementos.
+     */
+    explicit ListaEncadeadaDupla(std::shared_ptr<Pool> p = std::make_shared<Pool>()) : pool(std::move(p)) {
+        ligar(&sentinela, &sentinela);
+    }
+
+    ListaEncadeadaDupla(const ListaEncadeadaDupla& outra) : ListaEncadeadaDupla() {
+        for (const T& x : outra) push_back(x);
+    }
+
+    ListaEncadeadaDupla(ListaEncadeadaDupla&& outra) noexcept : pool(outra.pool) {
+        ligar(&sentinela, &sentinela);
+        roubar_nos(outra);
+    }
+
+    ListaEncadeadaDupla& operator=(ListaEncadeadaDupla outra) {
+        limpar();
+        pool = outra.pool;
+        roubar_nos(outra);
+        return *this;
+    }
+
+    ~ListaEncadeadaDupla() {
+        limpar();
+    }
+
+    const std::shared_ptr<Pool>& pool_de_nos() const {
+        return pool;
+    }
+
+    Iterador begin() { return Iterador(sentinela.proximo, 0); }
+    Iterador end() { return Iterador(&sentinela, 0); }
+    IteradorConst begin() const { return IteradorConst(sentinela.proximo, 0); }
+    IteradorConst end() const { return IteradorConst(&sentinela, 0); }
+
+    T& front() { return como_no(sentinela.proximo)->elementos()[0]; }
+    const T& front() const { return como_no(sentinela.proximo)->elementos()[0]; }
+    T& back() { return como_no(sentinela.anterior)->elementos()[sentinela.anterior->num - 1]; }
+    const T& back() const { return como_no(sentinela.anterior)->elementos()[sentinela.anterior->num - 1]; }
+
+    /**
+     * @brief Insere `valor` antes de `pos` e retorna um iterador para ele.
+     *
+     * No início de um nó, prefere acrescentar ao fim do nó anterior, se houver espaço.
+     *
+     * @complexity Time: O(B)
+     */
+    template <typename U>
+    Iterador inserir(IteradorConst pos, U&& valor) {
+        Elo* elo = pos.elo;
+        int i = pos.i;
+        if (i == 0 && elo->anterior != &sentinela && elo->anterior->num < B) {
+            elo = elo->anterior;
+            i = elo->num;
+        } else if (elo == &sentinela || elo->num == B) {
+            if (elo == &sentinela || i == 0) {
+                elo = novo_no_antes(elo);
+                i = 0;
+            } else if (i > B / 2) {
+                elo = dividir(como_no(elo), B / 2);
+                i -= B / 2;
+            } else {
+                dividir(como_no(elo), B / 2);
+            }
+        }
+        No* no = como_no(elo);
+        arranjo_inserir(no->elementos(), no->num, i, std::forward<U>(valor));
+        ++n;
+        return Iterador(no, i);
+    }
+
+    void push_front(const T& valor) { inserir(begin(), valor); }
+    void push_front(T&& valor) { inserir(begin(), std::move(valor)); }
+    void push_back(const T& valor) { inserir(end(), valor); }
+    void push_back(T&& valor) { inserir(end(), std::move(valor)); }
+
+    /**
+     * @brief Remove o elemento em `pos` e retorna um iterador para o seguinte.
+     * @complexity Time: O(B)
+     */
+    Iterador remover(IteradorConst pos) {
+        No* no = como_no(pos.elo);
+        int i = pos.i;
+        arranjo_remover(no->elementos(), no->num, i);
+        --n;
+
+        if (no->num == 0) {
+            Elo* seguinte = no->proximo;
+            desligar(no);
+            return Iterador(seguinte, 0);
+        }
+        Elo* seguinte = no->proximo;
+        if (no->num < MINIMO && seguinte != &sentinela && no->num + seguinte->num <= B) {
+            No* s = como_no(seguinte);
+            arranjo_transferir(s->elementos(), s->num, 0, no->elementos(), no->num);
+            desligar(s);
+        }
+        if (i == no->num) return Iterador(no->proximo, 0);
+        return Iterador(no, i);
+    }
+
+    void pop_front() { remover(begin()); }
+    void pop_back() { remover(--end()); }
+
+    /**
+     * @brief Insere `valor` depois de todos os elementos que não são maiores que ele, mantendo a
+     * lista ordenada (e estável para elementos iguais).
+     *
+     * Pula nós inteiros comparando apenas o último elemento de cada um.
+     *
+     * @complexity Time: O(n / B + B)
+     */
+    template <typename Comparador = std::less<T>>
+    Iterador inserir_ordenado(const T& valor, Comparador comp = Comparador()) {
+        Elo* elo = sentinela.proximo;
+        while (elo != &sentinela && !comp(valor, como_no(elo)->elementos()[elo->num - 1])) elo = elo->proximo;
+        int i = 0;
+        if (elo != &sentinela) {
+            while (!comp(valor, como_no(elo)->elementos()[i])) ++i;
+        }
+        return inserir(IteradorConst(elo, i), valor);
+    }
+
+    /**
+     * @brief Move todos os elementos de `outra` para antes de `pos`, deixando `outra` vazia.
+     *
+     * Com o mesmo pool, apenas religa os nós (dividindo o nó de `pos` se ele estiver no meio de
+     * um nó), e os iteradores para os elementos de `outra` continuam válidos nesta lista. Com
+     * pools diferentes, os elementos são movidos um a um.
+     *
+     * @complexity Time: O(B) com o mesmo pool; O(tamanho de `outra`) caso contrário.
+     */
+    void splice(IteradorConst pos, ListaEncadeadaDupla& outra) {
+        if (&outra == this || outra.n == 0) return;
+        if (outra.pool != pool) {
+            // Cada inserção pode dividir o nó de `pos`: a posição seguinte é recalculada a partir
+            // do elemento inserido, o que também mantém a ordem de `outra`.
+            for (T& x : outra) pos = std::next(inserir(pos, std::move(x)));
+            outra.limpar();
+            return;
+        }
+        Elo* depois = separar(pos);
+        Elo* primeiro = outra.sentinela.proximo;
+        Elo* ultimo = outra.sentinela.anterior;
+        ligar(depois->anterior, primeiro);
+        ligar(ultimo, depois);
+        n += outra.n;
+        ligar(&outra.sentinela, &outra.sentinela);
+        outra.n = 0;
+    }
+
+    /**
+     * @brief Move os elementos [primeiro, ultimo) de `outra` para antes de `pos`.
+     *
+     * Os nós inteiros do intervalo são religados; só os elementos das pontas, que dividem um nó,
+     * são movidos. `outra` precisa ser uma lista diferente desta.
+     *
+     * @throws std::invalid_argument se `outra` for esta lista ou usar outro pool.
+     * @complexity Time: O(nós do intervalo + B)
+     */
+    void splice(IteradorConst pos, ListaEncadeadaDupla& outra, IteradorConst primeiro, IteradorConst ultimo) {
+        if (&outra == this || outra.pool != pool) throw std::invalid_argument("A origem precisa ser outra lista com o mesmo pool de nós.");
+        if (primeiro == ultimo) return;
+        Elo* depois = separar(pos);
+        // Separa o intervalo em nós próprios: [inicio, fim) na lista de origem.
+        Elo* fim = outra.separar(ultimo);
+        Elo* inicio = outra.separar(primeiro);
+
+        std::size_t movidos = 0;
+        for (Elo* e = inicio; e != fim; e = e->proximo) movidos += e->num;
+        Elo* ultimo_no = fim->anterior;
+        ligar(inicio->anterior, fim);
+        ligar(depois->anterior, inicio);
+        ligar(ultimo_no, depois);
+        outra.n -= movidos;
+        n += movidos;
+    }
+
+    /**
+     * @brief Remove todos os elementos, devolvendo os nós ao pool.
+     */
+    void limpar() {
+        while (sentinela.proximo != &sentinela) {
+            No* no = como_no(sentinela.proximo);
+            for (int k = 0; k < no->num; ++k) no->elementos()[k].~T();
+            no->num = 0;
+            desligar(no);
+        }
+        n = 0;
+    }
+
+    std::size_t tamanho() const {
+        return n;
+    }
+
+    bool vazia() const {
+        return n == 0;
+    }
+
+private:
+    // Garante que 'pos' esteja no início de um nó, dividindo-o se preciso, e retorna esse nó (ou
+    // a sentinela). Os elementos antes de 'pos' permanecem no nó original.
+    Elo* separar(IteradorConst pos) {
+        if (pos.elo == &sentinela || pos.i == 0) return pos.elo;
+        return dividir(como_no(pos.elo), pos.i);
+    }
+
+    // Assume que esta lista está vazia.
+    void roubar_nos(ListaEncadeadaDupla& outra) {
+        if (outra.n == 0) return;
+        ligar(&sentinela, outra.sentinela.proximo);
+        ligar(outra.sentinela.anterior, &sentinela);
+        n = outra.n;
+        ligar(&outra.sentinela, &outra.sentinela);
+        outra.n = 0;
+    }
+};
+
+#endif // LISTA_ENCADEADA_DUPLA_HPP
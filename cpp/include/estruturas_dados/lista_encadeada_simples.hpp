@@ -0,0 +1,481 @@
+#ifndef LISTA_ENCADEADA_SIMPLES_HPP
+#define LISTA_ENCADEADA_SIMPLES_HPP
+
+#include <cstddef>
+#include <functional> // Para std::less
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @file lista_encadeada_simples.hpp
+ * @brief Contém a implementação de uma lista simplesmente encadeada desenrolada (unrolled linked
+ * list), cujos nós guardam pequenos arranjos de elementos e vêm de um alocador em blocos
+ * (`PoolDeNos`), além das rotinas de arranjo compartilhadas com a `ListaEncadeadaDupla`.
+ *
+ * @note Como estas são classes de template, toda a implementação está neste arquivo de cabeçalho.
+ */
+
+/**
+ * @brief Número padrão de elementos por nó: cerca de 256 bytes de elementos, entre 4 e 64.
+ */
+template <typename T>
+constexpr int elementos_por_no_padrao() {
+    constexpr std::size_t n = 256 / sizeof(T);
+    return n < 4 ? 4 : (n > 64 ? 64 : static_cast<int>(n));
+}
+
+/**
+ * @class PoolDeNos
+ * @brief Alocador de nós de tamanho fixo em blocos (slabs), com lista livre.
+ *
+ * Os blocos crescem geometricamente (de 16 até 4096 nós) e só são devolvidos ao sistema na
+ * destruição do pool; um nó liberado volta para a lista livre e é o primeiro a ser reutilizado.
+ * Depois do aquecimento, inserções e remoções não chamam `malloc`.
+ *
+ * Listas que compartilham o mesmo pool podem trocar nós entre si: o splice religa os nós em
+ * O(B), independentemente do tamanho da lista movida. O pool não é sincronizado: todas as listas
+ * que o compartilham devem ser usadas pela mesma thread.
+ */
+template <typename No>
+class PoolDeNos {
+private:
+    union Bloco {
+        Bloco* proximo;
+        alignas(No) unsigned char memoria[sizeof(No)];
+    };
+
+    static constexpr std::size_t MAX_BLOCOS_POR_SLAB = 4096;
+
+    std::vector<std::unique_ptr<Bloco[]>> slabs;
+    Bloco* livres = nullptr;
+    std::size_t proximo_slab = 16;
+    std::size_t reservados = 0;
+    std::size_t em_uso = 0;
+
+    void crescer() {
+        slabs.emplace_back(new Bloco[proximo_slab]);
+        Bloco* slab = slabs.back().get();
+        for (std::size_t i = proximo_slab; i-- > 0;) {
+            slab[i].proximo = livres;
+            livres = &slab[i];
+        }
+        reservados += proximo_slab;
+        if (proximo_slab < MAX_BLOCOS_POR_SLAB) proximo_slab *= 2;
+    }
+
+public:
+    PoolDeNos() = default;
+    PoolDeNos(const PoolDeNos&) = delete;
+    PoolDeNos& operator=(const PoolDeNos&) = delete;
+
+    /**
+     * @brief Retorna memória não inicializada para um nó.
+     */
+    void* alocar() {
+        if (!livres) crescer();
+        Bloco* b = livres;
+        livres = b->proximo;
+        ++em_uso;
+        return b->memoria;
+    }
+
+    /**
+     * @brief Devolve a memória de um nó já destruído.
+     */
+    void liberar(void* memoria) {
+        Bloco* b = reinterpret_cast<Bloco*>(memoria);
+        b->proximo = livres;
+        livres = b;
+        --em_uso;
+    }
+
+    std::size_t nos_em_uso() const {
+        return em_uso;
+    }
+
+    std::size_t nos_reservados() const {
+        return reservados;
+    }
+};
+
+// --- Rotinas sobre o arranjo de elementos de um nó ---
+//
+// Cada nó guarda `num` elementos construídos nas primeiras posições de um arranjo de memória
+// crua. As rotinas abaixo mantêm esse invariante, movendo elementos em vez de copiá-los.
+
+/**
+ * @brief Constrói `valor` na posição `i` do arranjo com `num` elementos, deslocando os seguintes.
+ */
+template <typename T, typename U>
+void arranjo_inserir(T* elementos, int& num, int i, U&& valor) {
+    if (i == num) {
+        new (elementos + num) T(std::forward<U>(valor));
+    } else {
+        T temporario(std::forward<U>(valor)); // 'valor' pode ser um dos próprios elementos
+        new (elementos + num) T(std::move(elementos[num - 1]));
+        for (int k = num - 1; k > i; --k) elementos[k] = std::move(elementos[k - 1]);
+        elementos[i] = std::move(temporario);
+    }
+    ++num;
+}
+
+/**
+ * @brief Destrói o elemento da posição `i`, deslocando os seguintes.
+ */
+template <typename T>
+void arranjo_remover(T* elementos, int& num, int i) {
+    for (int k = i; k + 1 < num; ++k) elementos[k] = std::move(elementos[k + 1]);
+    elementos[--num].~T();
+}
+
+/**
+ * @brief Move os elementos [inicio, num_origem) da origem para o fim do destino.
+ */
+template <typename T>
+void arranjo_transferir(T* origem, int& num_origem, int inicio, T* destino, int& num_destino) {
+    for (int k = inicio; k < num_origem; ++k) {
+        new (destino + num_destino++) T(std::move(origem[k]));
+        origem[k].~T();
+    }
+    num_origem = inicio;
+}
+
+/**
+ * @class ListaEncadeadaSimples
+ * @brief Lista simplesmente encadeada desenrolada: cada nó guarda até `B` elementos contíguos.
+ *
+ * Em relação a uma lista com um elemento por nó, percorrer a lista custa uma falta de cache a
+ * cada `B` elementos, e a memória extra por elemento cai de um ponteiro mais o cabeçalho do
+ * `malloc` para cerca de um ponteiro a cada `B` elementos. Os nós vêm de um `PoolDeNos`.
+ *
+ * A interface segue a de `std::forward_list`: as inserções, remoções e splices acontecem
+ * *depois* de um iterador, de modo que o nó anterior é sempre conhecido e nós vazios são
+ * desligados em O(1). `antes_do_inicio()` representa a posição anterior ao primeiro elemento.
+ *
+ * - Inserir em um nó cheio o divide ao meio.
+ * - Um nó que fica com menos de B/4 elementos absorve o seguinte quando os dois cabem em um só.
+ *
+ * @note Validade dos iteradores: uma inserção invalida apenas os iteradores para elementos do nó
+ * alterado, e uma remoção, os do nó alterado e do nó seguinte (que pode ser absorvido). Os demais
+ * continuam válidos, assim como os endereços dos seus elementos.
+ *
+ * @tparam T Tipo dos elementos; precisa ser construível e atribuível por movimento.
+ * @tparam B Máximo de elementos por nó.
+ */
+template <typename T, int B = elementos_por_no_padrao<T>()>
+class ListaEncadeadaSimples {
+    static_assert(B >= 2, "Cada nó precisa comportar pelo menos dois elementos.");
+
+private:
+    struct No;
+
+    // Parte comum aos nós e à cabeça da lista, que não guarda elementos.
+    struct Elo {
+        No* proximo = nullptr;
+        int num = 0;
+    };
+
+    struct No : Elo {
+        alignas(T) unsigned char memoria[B * sizeof(T)];
+
+        T* elementos() { return std::launder(reinterpret_cast<T*>(memoria)); }
+    };
+
+public:
+    using Pool = PoolDeNos<No>;
+
+private:
+    static constexpr int MINIMO = B / 4 > 0 ? B / 4 : 1;
+
+    std::shared_ptr<Pool> pool;
+    Elo cabeca;              // cabeca.proximo é o primeiro nó
+    Elo* ultimo = &cabeca;   // Último nó, ou a cabeça se a lista estiver vazia
+    std::size_t n = 0;
+
+    // Insere um nó vazio depois de 'elo'.
+    No* novo_no_depois(Elo* elo) {
+        No* novo = new (pool->alocar()) No();
+        novo->proximo = elo->proximo;
+        elo->proximo = novo;
+        if (ultimo == elo) ultimo = novo;
+        return novo;
+    }
+
+    // Desliga e libera o nó seguinte a 'elo', que deve estar vazio.
+    void desligar_seguinte(Elo* elo) {
+        No* no = elo->proximo;
+        elo->proximo = no->proximo;
+        if (ultimo == no) ultimo = elo;
+        no->~No();
+        pool->liberar(no);
+    }
+
+    // Move os elementos [i, num) de 'no' para um nó novo logo depois dele.
+    No* dividir(No* no, int i) {
+        No* novo = novo_no_depois(no);
+        arranjo_transferir(no->elementos(), no->num, i, novo->elementos(), novo->num);
+        return novo;
+    }
+
+    template <bool Constante>
+    class IteradorBase {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Constante, const T*, T*>;
+        using reference = std::conditional_t<Constante, const T&, T&>;
+
+        IteradorBase() = default;
+        // Um iterador mutável pode ser convertido em constante.
+        template <bool C = Constante, typename = std::enable_if_t<C>>
+        IteradorBase(const IteradorBase<false>& outro) : elo(outro.elo), i(outro.i) {}
+
+        reference operator*() const { return static_cast<No*>(elo)->elementos()[i]; }
+        pointer operator->() const { return &**this; }
+
+        IteradorBase& operator++() {
+            // Na cabeça, i = -1 e num = 0, então o incremento leva ao primeiro nó.
+            if (++i >= elo->num) {
+                elo = elo->proximo;
+                i = 0;
+            }
+            return *this;
+        }
+
+        IteradorBase operator++(int) {
+            IteradorBase copia = *this;
+            ++*this;
+            return copia;
+        }
+
+        bool operator==(const IteradorBase& outro) const { return elo == outro.elo && i == outro.i; }
+        bool operator!=(const IteradorBase& outro) const { return !(*this == outro); }
+
+    private:
+        friend class ListaEncadeadaSimples;
+        friend class IteradorBase<!Constante>;
+        IteradorBase(const Elo* e, int indice) : elo(const_cast<Elo*>(e)), i(indice) {}
+
+        Elo* elo = nullptr; // Nulo em end()
+        int i = 0;
+    };
+
+public:
+    using Iterador = IteradorBase<false>;
+    using IteradorConst = IteradorBase<true>;
+
+    /**
+     * @brief Cria uma lista vazia. Listas criadas com o mesmo pool fazem splice em O(B).
+     */
+    explicit ListaEncadeadaSimples(std::shared_ptr<Pool> p = std::make_shared<Pool>()) : pool(std::move(p)) {}
+
+    ListaEncadeadaSimples(const ListaEncadeadaSimples& outra) : pool(std::make_shared<Pool>()) {
+        for (const T& x : outra) push_back(x);
+    }
+
+    ListaEncadeadaSimples(ListaEncadeadaSimples&& outra) noexcept : pool(outra.pool) {
+        trocar_nos(outra);
+    }
+
+    ListaEncadeadaSimples& operator=(ListaEncadeadaSimples outra) {
+        limpar();
+        pool = outra.pool;
+        trocar_nos(outra);
+        return *this;
+    }
+
+    ~ListaEncadeadaSimples() {
+        limpar();
+    }
+
+    const std::shared_ptr<Pool>& pool_de_nos() const {
+        return pool;
+    }
+
+    Iterador antes_do_inicio() { return Iterador(&cabeca, -1); }
+    Iterador begin() { return Iterador(cabeca.proximo, 0); }
+    Iterador end() { return Iterador(nullptr, 0); }
+    IteradorConst antes_do_inicio() const { return IteradorConst(&cabeca, -1); }
+    IteradorConst begin() const { return IteradorConst(cabeca.proximo, 0); }
+    IteradorConst end() const { return IteradorConst(nullptr, 0); }
+
+    T& front() { return cabeca.proximo->elementos()[0]; }
+    const T& front() const { return cabeca.proximo->elementos()[0]; }
+    T& back() { return static_cast<No*>(ultimo)->elementos()[ultimo->num - 1]; }
+    const T& back() const { return static_cast<No*>(ultimo)->elementos()[ultimo->num - 1]; }
+
+    /**
+     * @brief Insere `valor` logo depois de `pos` e retorna um iterador para ele.
+     * @complexity Time: O(B)
+     */
+    template <typename U>
+    Iterador inserir_apos(IteradorConst pos, U&& valor) {
+        Elo* elo = pos.elo;
+        No* no;
+        int i;
+        if (elo == &cabeca) {
+            // Início da lista: no primeiro nó, se houver espaço, ou em um nó novo antes dele.
+            no = cabeca.proximo;
+            if (!no || no->num == B) no = novo_no_depois(&cabeca);
+            i = 0;
+        } else {
+            no = static_cast<No*>(elo);
+            i = pos.i + 1;
+            if (no->num == B) {
+                No* novo = dividir(no, B / 2);
+                if (i > B / 2) {
+                    no = novo;
+                    i -= B / 2;
+                }
+            }
+        }
+        arranjo_inserir(no->elementos(), no->num, i, std::forward<U>(valor));
+        ++n;
+        return Iterador(no, i);
+    }
+
+    void push_front(const T& valor) { inserir_apos(antes_do_inicio(), valor); }
+    void push_front(T&& valor) { inserir_apos(antes_do_inicio(), std::move(valor)); }
+
+    /**
+     * @brief Insere no fim em O(1), acrescentando ao último nó ou a um nó novo.
+     */
+    void push_back(const T& valor) { emplace_fim(valor); }
+    void push_back(T&& valor) { emplace_fim(std::move(valor)); }
+
+    /**
+     * @brief Remove o elemento seguinte a `pos` e retorna um iterador para o que vinha depois dele.
+     * @complexity Time: O(B)
+     */
+    Iterador remover_apos(IteradorConst pos) {
+        Elo* anterior;
+        No* no;
+        int i;
+        if (pos.elo != &cabeca && pos.i + 1 < pos.elo->num) {
+            anterior = nullptr; // Não é usado: o nó ainda terá o elemento de 'pos'
+            no = static_cast<No*>(pos.elo);
+            i = pos.i + 1;
+        } else {
+            anterior = pos.elo;
+            no = anterior->proximo;
+            i = 0;
+        }
+        arranjo_remover(no->elementos(), no->num, i);
+        --n;
+
+        if (no->num == 0) {
+            desligar_seguinte(anterior);
+            return Iterador(anterior->proximo, 0);
+        }
+        No* seguinte = no->proximo;
+        if (no->num < MINIMO && seguinte && no->num + seguinte->num <= B) {
+            arranjo_transferir(seguinte->elementos(), seguinte->num, 0, no->elementos(), no->num);
+            desligar_seguinte(no);
+        }
+        if (i == no->num) return Iterador(no->proximo, 0);
+        return Iterador(no, i);
+    }
+
+    void pop_front() {
+        remover_apos(antes_do_inicio());
+    }
+
+    /**
+     * @brief Insere `valor` depois de todos os elementos que não são maiores que ele, mantendo a
+     * lista ordenada (e estável para elementos iguais).
+     *
+     * Pula nós inteiros comparando apenas o último elemento de cada um.
+     *
+     * @complexity Time: O(n / B + B)
+     */
+    template <typename Comparador = std::less<T>>
+    Iterador inserir_ordenado(const T& valor, Comparador comp = Comparador()) {
+        Elo* anterior = &cabeca;
+        No* no = cabeca.proximo;
+        while (no && !comp(valor, no->elementos()[no->num - 1])) {
+            anterior = no;
+            no = no->proximo;
+        }
+        if (!no) return inserir_apos(IteradorConst(anterior, anterior->num - 1), valor);
+        int i = 0;
+        while (!comp(valor, no->elementos()[i])) ++i;
+        // Depois do último elemento do nó anterior, se a posição for o início deste nó.
+        if (i == 0) return inserir_apos(IteradorConst(anterior, anterior->num - 1), valor);
+        return inserir_apos(IteradorConst(no, i - 1), valor);
+    }
+
+    /**
+     * @brief Move todos os elementos de `outra` para logo depois de `pos`, deixando `outra` vazia.
+     *
+     * Com o mesmo pool, apenas religa os nós (dividindo o nó de `pos` se ele estiver no meio de
+     * um nó), e os iteradores para os elementos de `outra` continuam válidos nesta lista. Com
+     * pools diferentes, os elementos são movidos um a um.
+     *
+     * @complexity Time: O(B) com o mesmo pool; O(tamanho de `outra`) caso contrário.
+     */
+    void splice_apos(IteradorConst pos, ListaEncadeadaSimples& outra) {
+        if (&outra == this || outra.n == 0) return;
+        if (outra.pool != pool) {
+            for (T& x : outra) pos = inserir_apos(pos, std::move(x));
+            outra.limpar();
+            return;
+        }
+
+        Elo* anterior = pos.elo;
+        if (anterior != &cabeca && pos.i + 1 < anterior->num) dividir(static_cast<No*>(anterior), pos.i + 1);
+        No* seguinte = anterior->proximo;
+
+        anterior->proximo = outra.cabeca.proximo;
+        outra.ultimo->proximo = seguinte;
+        if (ultimo == anterior) ultimo = outra.ultimo;
+        n += outra.n;
+
+        outra.cabeca.proximo = nullptr;
+        outra.ultimo = &outra.cabeca;
+        outra.n = 0;
+    }
+
+    /**
+     * @brief Remove todos os elementos, devolvendo os nós ao pool.
+     */
+    void limpar() {
+        while (cabeca.proximo) {
+            No* no = cabeca.proximo;
+            for (int k = 0; k < no->num; ++k) no->elementos()[k].~T();
+            no->num = 0;
+            desligar_seguinte(&cabeca);
+        }
+        n = 0;
+    }
+
+    std::size_t tamanho() const {
+        return n;
+    }
+
+    bool vazia() const {
+        return n == 0;
+    }
+
+private:
+    template <typename U>
+    void emplace_fim(U&& valor) {
+        No* no = (ultimo == &cabeca || ultimo->num == B) ? novo_no_depois(ultimo) : static_cast<No*>(ultimo);
+        arranjo_inserir(no->elementos(), no->num, no->num, std::forward<U>(valor));
+        ++n;
+    }
+
+    // Assume que esta lista está vazia.
+    void trocar_nos(ListaEncadeadaSimples& outra) {
+        cabeca.proximo = std::exchange(outra.cabeca.proximo, nullptr);
+        ultimo = (outra.ultimo == &outra.cabeca) ? &cabeca : outra.ultimo;
+        outra.ultimo = &outra.cabeca;
+        n = std::exchange(outra.n, 0);
+    }
+};
+
+#endif // LISTA_ENCADEADA_SIMPLES_HPP
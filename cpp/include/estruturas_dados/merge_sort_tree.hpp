@@ -0,0 +1,129 @@
+#ifndef MERGE_SORT_TREE_HPP
+#define MERGE_SORT_TREE_HPP
+
+#include <vector>
+#include <algorithm> // Para std::lower_bound
+#include <stdexcept>
+
+/**
+ * @file merge_sort_tree.hpp
+ * @brief Contém a implementação de uma Merge Sort Tree com cascateamento fracionário
+ * (fractional cascading) para contagem e k-ésimo menor em intervalos.
+ *
+ * @note Como esta é uma classe de template, toda a implementação está neste arquivo de cabeçalho.
+ */
+
+/**
+ * @class MergeSortTree
+ * @brief Segment Tree em que cada nó guarda a lista ordenada dos valores do seu segmento.
+ *
+ * É a alternativa mais simples à `WaveletMatrix`: não exige compressão de valores e aceita
+ * qualquer tipo com `operator<`, ao custo de O(n log n) de memória.
+ *
+ * Os nós de um mesmo nível particionam [0, n), então cada nível é guardado como um único
+ * vetor de n posições, sem alocação por nó. Com cascateamento fracionário, cada posição
+ * também guarda quantos dos elementos até ela vieram do filho esquerdo. Assim, basta uma
+ * busca binária na raiz: a posição de x em cada filho é obtida em O(1) a partir da do pai,
+ * e a contagem em [l, r] custa O(log n) em vez de O(log² n).
+ *
+ * @tparam T Tipo dos valores; precisa de `operator<`.
+ */
+template <typename T>
+class MergeSortTree {
+private:
+    // ordenados[d][start..end] é a lista ordenada do nó de profundidade d que cobre [start, end].
+    std::vector<std::vector<T>> ordenados;
+    // vindos_esq[d][start + i] = quantos dos i + 1 primeiros elementos do nó vieram do filho esquerdo.
+    std::vector<std::vector<int>> vindos_esq;
+    int n;
+
+    void build_helper(const std::vector<T>& arr, int d, int start, int end) {
+        if (start == end) {
+            ordenados[d][start] = arr[start];
+            return;
+        }
+        int mid = start + (end - start) / 2;
+        build_helper(arr, d + 1, start, mid);
+        build_helper(arr, d + 1, mid + 1, end);
+
+        // Intercala os filhos registrando a origem de cada elemento.
+        const std::vector<T>& filhos = ordenados[d + 1];
+        int i = start, j = mid + 1, k = start, da_esquerda = 0;
+        while (k <= end) {
+            if (j > end || (i <= mid && !(filhos[j] < filhos[i]))) {
+                ordenados[d][k] = filhos[i++];
+                ++da_esquerda;
+            } else {
+                ordenados[d][k] = filhos[j++];
+            }
+            vindos_esq[d][k++] = da_esquerda;
+        }
+    }
+
+    // 'pos' é o número de elementos do nó menores que x.
+    int contar_helper(int d, int start, int end, int l, int r, int pos) const {
+        if (r < start || end < l || pos == 0) return 0;
+        if (l <= start && end <= r) return pos;
+        int mid = start + (end - start) / 2;
+        int pos_esq = vindos_esq[d][start + pos - 1];
+        return contar_helper(d + 1, start, mid, l, r, pos_esq) +
+               contar_helper(d + 1, mid + 1, end, l, r, pos - pos_esq);
+    }
+
+    void verificar_intervalo(int l, int r) const {
+        if (l < 0 || r >= n || l > r) {
+            throw std::out_of_range("Intervalo de consulta inválido.");
+        }
+    }
+
+public:
+    /**
+     * @brief Constrói a árvore a partir de um array.
+     * @complexity Time: O(n log n), Space: O(n log n)
+     */
+    explicit MergeSortTree(const std::vector<T>& arr) : n(arr.size()) {
+        int profundidade = 1;
+        while ((1 << (profundidade - 1)) < n) ++profundidade;
+        ordenados.assign(profundidade, std::vector<T>(n));
+        vindos_esq.assign(profundidade, std::vector<int>(n));
+        if (n > 0) build_helper(arr, 0, 0, n - 1);
+    }
+
+    /**
+     * @brief Conta os valores estritamente menores que x em [l, r].
+     * @complexity Time: O(log n), com uma única busca binária.
+     */
+    int contar_menores(int l, int r, const T& x) const {
+        verificar_intervalo(l, r);
+        int pos = std::lower_bound(ordenados[0].begin(), ordenados[0].end(), x) - ordenados[0].begin();
+        return contar_helper(0, 0, n - 1, l, r, pos);
+    }
+
+    /**
+     * @brief Retorna o k-ésimo menor valor (base 0) em [l, r].
+     *
+     * Faz uma busca binária sobre a lista ordenada da raiz usando `contar_menores`.
+     *
+     * @complexity Time: O(log² n)
+     */
+    T k_esimo_menor(int l, int r, int k) const {
+        verificar_intervalo(l, r);
+        if (k < 0 || k > r - l) {
+            throw std::out_of_range("k fora do intervalo.");
+        }
+        // Maior posição p da raiz tal que menos de k + 1 valores do intervalo são menores que ordenados[0][p].
+        int lo = 0, hi = n - 1;
+        while (lo < hi) {
+            int mid = lo + (hi - lo + 1) / 2;
+            if (contar_helper(0, 0, n - 1, l, r, mid) <= k) lo = mid;
+            else hi = mid - 1;
+        }
+        return ordenados[0][lo];
+    }
+
+    int size() const {
+        return n;
+    }
+};
+
+#endif // MERGE_SORT_TREE_HPP
@@ -0,0 +1,109 @@
+#ifndef PILHA_HPP
+#define PILHA_HPP
+
+#include "estruturas_dados/coletor_epocas.hpp"
+#include <atomic>
+#include <utility>
+
+/**
+ * @file pilha.hpp
+ * @brief Contém a implementação de uma pilha concorrente sem locks (pilha de Treiber).
+ *
+ * @note Como PilhaConcorrente é uma classe de template, toda a sua implementação está neste
+ * arquivo de cabeçalho.
+ */
+
+/**
+ * @class PilhaConcorrente
+ * @brief Pilha ilimitada em que várias threads empilham e desempilham ao mesmo tempo, sem locks.
+ *
+ * O topo é um único ponteiro atômico: `push` liga o novo nó ao topo atual e tenta trocá-lo por
+ * CAS; `pop` tenta trocar o topo pelo seu sucessor.
+ *
+ * O `pop` ingênuo sofre do problema ABA: se, entre a leitura do topo A e o CAS, outra thread
+ * desempilhar A, liberar a memória e ela for reaproveitada por um novo nó empilhado no mesmo
+ * endereço, o CAS tem sucesso com um sucessor obsoleto. Aqui, os nós desempilhados são
+ * aposentados em um `ColetorEpocas` e só são liberados quando nenhuma thread que possa tê-los
+ * lido ainda está dentro de uma guarda, então um endereço lido nunca volta ao topo durante o
+ * `pop` que o leu. Isso dispensa ponteiros com contador de versão, que exigiriam CAS de 128 bits.
+ *
+ * @tparam T Tipo dos elementos; precisa ser construível por movimento.
+ */
+template <typename T>
+class PilhaConcorrente {
+private:
+    struct No {
+        T valor;
+        No* proximo;
+    };
+
+    alignas(64) std::atomic<No*> topo{nullptr};
+    ColetorEpocas coletor;
+
+    static void destruir_no(void* no) {
+        delete static_cast<No*>(no);
+    }
+
+    void empilhar(No* no) {
+        // Não lê nenhum outro nó, então dispensa a guarda.
+        no->proximo = topo.load(std::memory_order_relaxed);
+        while (!topo.compare_exchange_weak(no->proximo, no, std::memory_order_release, std::memory_order_relaxed)) {
+        }
+    }
+
+public:
+    PilhaConcorrente() = default;
+
+    PilhaConcorrente(const PilhaConcorrente&) = delete;
+    PilhaConcorrente& operator=(const PilhaConcorrente&) = delete;
+
+    /**
+     * @brief Libera todos os nós. Nenhuma outra thread pode estar usando a pilha.
+     */
+    ~PilhaConcorrente() {
+        No* no = topo.load(std::memory_order_relaxed);
+        while (no) {
+            No* proximo = no->proximo;
+            delete no;
+            no = proximo;
+        }
+    }
+
+    /**
+     * @brief Empilha um elemento.
+     * @complexity Time: O(1), mais as novas tentativas sob disputa.
+     */
+    void push(const T& valor) {
+        empilhar(new No{valor, nullptr});
+    }
+
+    void push(T&& valor) {
+        empilhar(new No{std::move(valor), nullptr});
+    }
+
+    /**
+     * @brief Desempilha o elemento do topo para `saida`.
+     * @return false se a pilha estiver vazia.
+     */
+    bool pop(T& saida) {
+        auto guarda = coletor.proteger();
+        No* atual = topo.load(std::memory_order_acquire);
+        while (atual && !topo.compare_exchange_weak(atual, atual->proximo, std::memory_order_acquire,
+                                                    std::memory_order_acquire)) {
+        }
+        if (!atual) return false;
+        // Só esta thread retirou o nó; as outras podem, no máximo, ainda ler o seu 'proximo'.
+        saida = std::move(atual->valor);
+        coletor.aposentar(atual, destruir_no);
+        return true;
+    }
+
+    /**
+     * @brief Indica se a pilha estava vazia no momento da leitura.
+     */
+    bool empty() const {
+        return topo.load(std::memory_order_acquire) == nullptr;
+    }
+};
+
+#endif // PILHA_HPP
@@ -4,10 +4,15 @@
 #include <vector>
 #include <functional> // Para std::plus, std::function
 #include <stdexcept>
+#include <algorithm>  // Para std::min, std::max, std::unique
+#include <bit>        // Para std::bit_ceil
+#include <limits>     // Para std::numeric_limits
+#include <utility>    // Para std::pair
 
 /**
  * @file segment_tree.hpp
- * @brief Contém a implementação de uma Segment Tree (Árvore de Segmentos) genérica.
+ * @brief Contém a implementação de uma Segment Tree (Árvore de Segmentos) genérica e de
+ * uma variante iterativa parametrizada por um monoide em tempo de compilação.
  *
  * @note Como esta é uma classe de template, toda a implementação está neste arquivo de cabeçalho.
  */
@@ -16,19 +21,18 @@ template <typename T>
 class SegmentTree {
 private:
     std::vector<T> tree;
-    const std::vector<T>& original_array;
     int n;
     std::function<T(T, T)> combiner; // Função para combinar nós (ex: soma, min, max)
     T identity_value;                // Valor identidade para a operação (ex: 0 para soma)
 
     // Constrói a árvore recursivamente
-    void build_helper(int node, int start, int end) {
+    void build_helper(const std::vector<T>& arr, int node, int start, int end) {
         if (start == end) {
-            tree[node] = original_array[start];
+            tree[node] = arr[start];
         } else {
             int mid = start + (end - start) / 2;
-            build_helper(2 * node, start, mid);
-            build_helper(2 * node + 1, mid + 1, end);
+            build_helper(arr, 2 * node, start, mid);
+            build_helper(arr, 2 * node + 1, mid + 1, end);
             tree[node] = combiner(tree[2 * node], tree[2 * node + 1]);
         }
     }
@@ -65,15 +69,15 @@ private:
 public:
     /**
      * @brief Construtor da Segment Tree.
-     * @param arr O vetor de dados original.
+     * @param arr O vetor de dados original. É apenas lido durante a construção.
      * @param comb A função de combinação (ex: `std::plus<T>()` para soma).
      * @param identity O valor identidade da operação de combinação (ex: 0 para soma).
      */
     SegmentTree(const std::vector<T>& arr, std::function<T(T, T)> comb, T identity)
-        : original_array(arr), n(arr.size()), combiner(comb), identity_value(identity) {
+        : n(arr.size()), combiner(comb), identity_value(identity) {
         if (n == 0) return;
         tree.resize(4 * n); // Tamanho seguro para a árvore
-        build_helper(1, 0, n - 1); // Nó raiz é o 1
+        build_helper(arr, 1, 0, n - 1); // Nó raiz é o 1
     }
 
     /**
@@ -102,4 +106,172 @@ public:
     }
 };
 
+// --- Monoides para a SegmentTreeMonoide ---
+//
+// Um monoide expõe o tipo `Valor`, o elemento neutro `identidade()` e a operação associativa
+// `combinar(a, b)`. Como tudo é resolvido em tempo de compilação, a combinação é inlinada.
+
+template <typename T>
+struct MonoideSoma {
+    using Valor = T;
+    static constexpr T identidade() { return T{}; }
+    static constexpr T combinar(const T& a, const T& b) { return a + b; }
+};
+
+template <typename T>
+struct MonoideMinimo {
+    using Valor = T;
+    static constexpr T identidade() { return std::numeric_limits<T>::max(); }
+    static constexpr T combinar(const T& a, const T& b) { return std::min(a, b); }
+};
+
+template <typename T>
+struct MonoideMaximo {
+    using Valor = T;
+    static constexpr T identidade() { return std::numeric_limits<T>::lowest(); }
+    static constexpr T combinar(const T& a, const T& b) { return std::max(a, b); }
+};
+
+/**
+ * @class SegmentTreeMonoide
+ * @brief Segment Tree iterativa (bottom-up) com a operação fixada por um monoide em tempo de compilação.
+ *
+ * As folhas ficam nas posições [tamanho_base, 2 * tamanho_base) de um único vetor, onde
+ * `tamanho_base` é a menor potência de dois >= n, e o pai do nó `i` é `i / 2`. Consultas e
+ * atualizações sobem ou descem a árvore com laços simples, sem recursão e sem chamadas
+ * indiretas, e a árvore é dona dos seus dados.
+ *
+ * A consulta preserva a ordem dos operandos, então monoides não comutativos também funcionam.
+ *
+ * @tparam Monoide Tipo com `Valor`, `identidade()` e `combinar(a, b)` (ex: `MonoideSoma<long long>`).
+ */
+template <typename Monoide>
+class SegmentTreeMonoide {
+public:
+    using Valor = typename Monoide::Valor;
+
+private:
+    std::vector<Valor> tree;
+    int n;
+    int tamanho_base; // Potência de dois onde começam as folhas
+
+    void recalcular(int node) {
+        tree[node] = Monoide::combinar(tree[2 * node], tree[2 * node + 1]);
+    }
+
+    void verificar_indice(int index) const {
+        if (index < 0 || index >= n) {
+            throw std::out_of_range("Índice inválido.");
+        }
+    }
+
+public:
+    /**
+     * @brief Cria uma árvore com `tamanho` elementos iguais à identidade do monoide.
+     */
+    explicit SegmentTreeMonoide(int tamanho = 0)
+        : n(tamanho), tamanho_base(tamanho > 0 ? static_cast<int>(std::bit_ceil(static_cast<unsigned>(tamanho))) : 1) {
+        tree.assign(2 * tamanho_base, Monoide::identidade());
+    }
+
+    /**
+     * @brief Constrói a árvore a partir de um vetor em O(n), preenchendo os nós internos de baixo para cima.
+     * @param arr O vetor de dados. É copiado para dentro da árvore.
+     */
+    explicit SegmentTreeMonoide(const std::vector<Valor>& arr) : SegmentTreeMonoide(static_cast<int>(arr.size())) {
+        std::copy(arr.begin(), arr.end(), tree.begin() + tamanho_base);
+        for (int node = tamanho_base - 1; node >= 1; --node) {
+            recalcular(node);
+        }
+    }
+
+    /**
+     * @brief Realiza uma consulta de agregação em um intervalo [start, end].
+     * @complexity Time: O(log n), Space: O(1)
+     */
+    Valor query(int start, int end) const {
+        if (start < 0 || end >= n || start > end) {
+            throw std::out_of_range("Intervalo de consulta inválido.");
+        }
+        Valor resultado_esq = Monoide::identidade();
+        Valor resultado_dir = Monoide::identidade();
+        int l = start + tamanho_base;
+        int r = end + tamanho_base + 1; // Intervalo semiaberto [l, r)
+        while (l < r) {
+            if (l & 1) resultado_esq = Monoide::combinar(resultado_esq, tree[l++]);
+            if (r & 1) resultado_dir = Monoide::combinar(tree[--r], resultado_dir);
+            l >>= 1;
+            r >>= 1;
+        }
+        return Monoide::combinar(resultado_esq, resultado_dir);
+    }
+
+    /**
+     * @brief Atualiza o valor de um elemento e recalcula seus ancestrais.
+     * @complexity Time: O(log n), Space: O(1)
+     */
+    void update(int index, const Valor& value) {
+        verificar_indice(index);
+        int node = index + tamanho_base;
+        tree[node] = value;
+        for (node >>= 1; node >= 1; node >>= 1) {
+            recalcular(node);
+        }
+    }
+
+    /**
+     * @brief Aplica várias atribuições pontuais de uma vez.
+     *
+     * Todas as folhas são escritas primeiro e os ancestrais são recalculados nível a nível,
+     * cada nó uma única vez, mesmo que seja compartilhado por várias atualizações. Se o mesmo
+     * índice aparecer mais de uma vez, prevalece a última ocorrência.
+     *
+     * @param atualizacoes Pares {índice, novo valor}.
+     * @throws std::out_of_range se algum índice for inválido; nesse caso nenhuma folha é
+     * alterada.
+     * @complexity Time: O(k log(n / k) + k log k) para k atualizações.
+     */
+    void update_many(const std::vector<std::pair<int, Valor>>& atualizacoes) {
+        // Todos os índices são validados antes da primeira escrita, para que uma exceção
+        // no meio do lote não deixe folhas alteradas com os ancestrais desatualizados.
+        for (const auto& atualizacao : atualizacoes) {
+            verificar_indice(atualizacao.first);
+        }
+        std::vector<int> nivel;
+        nivel.reserve(atualizacoes.size());
+        for (const auto& [index, value] : atualizacoes) {
+            tree[index + tamanho_base] = value;
+            nivel.push_back((index + tamanho_base) >> 1);
+        }
+        std::sort(nivel.begin(), nivel.end());
+        nivel.erase(std::unique(nivel.begin(), nivel.end()), nivel.end());
+
+        // Como os nós de um nível estão ordenados, os pais também ficam ordenados e as
+        // duplicatas são sempre adjacentes.
+        while (!nivel.empty() && nivel.front() >= 1) {
+            int escrita = 0;
+            for (int node : nivel) {
+                recalcular(node);
+                int pai = node >> 1;
+                if (escrita == 0 || nivel[escrita - 1] != pai) {
+                    nivel[escrita++] = pai;
+                }
+            }
+            nivel.resize(escrita);
+        }
+    }
+
+    /**
+     * @brief Retorna o valor atual do elemento no índice especificado.
+     */
+    const Valor& get(int index) const {
+        verificar_indice(index);
+        return tree[index + tamanho_base];
+    }
+
+    int size() const {
+        return n;
+    }
+};
+
 #endif // SEGMENT_TREE_HPP
\ No newline at end of file
@@ -0,0 +1,252 @@
+#ifndef SEGMENT_TREE_LAZY_HPP
+#define SEGMENT_TREE_LAZY_HPP
+
+#include <vector>
+#include <algorithm>   // Para std::copy
+#include <bit>         // Para std::bit_ceil, std::bit_width, std::countr_zero
+#include <optional>
+#include <stdexcept>
+#include <type_traits> // Para std::is_same_v
+#include "estruturas_dados/segment_tree.hpp" // Para os monoides
+
+/**
+ * @file segment_tree_lazy.hpp
+ * @brief Contém a implementação de uma Segment Tree com propagação preguiçosa (lazy propagation),
+ * que suporta atualizações em intervalo e consultas em intervalo em O(log n).
+ *
+ * @note Como esta é uma classe de template, toda a implementação está neste arquivo de cabeçalho.
+ */
+
+// --- Ações de atualização ---
+//
+// Uma ação expõe o tipo `Tag` (a atualização pendente), a tag neutra `identidade()`,
+// `compor(nova, antiga)`, que devolve a tag equivalente a aplicar `antiga` e depois `nova`,
+// e `aplicar(tag, valor, tamanho)`, que aplica a tag ao agregado de um segmento com
+// `tamanho` elementos.
+
+// Soma é o único monoide embutido cujo agregado depende do tamanho do segmento.
+template <typename Monoide>
+constexpr bool monoide_depende_do_tamanho = std::is_same_v<Monoide, MonoideSoma<typename Monoide::Valor>>;
+
+/**
+ * @brief Soma `delta` a todos os elementos do intervalo. Funciona com soma, mínimo e máximo.
+ */
+template <typename Monoide>
+struct AcaoSomar {
+    using Valor = typename Monoide::Valor;
+    using Tag = Valor;
+
+    static Tag identidade() { return Tag{}; }
+    static Tag compor(const Tag& nova, const Tag& antiga) { return nova + antiga; }
+    static Valor aplicar(const Tag& delta, const Valor& x, int tamanho) {
+        if constexpr (monoide_depende_do_tamanho<Monoide>) {
+            return x + delta * static_cast<Valor>(tamanho);
+        } else {
+            return x + delta;
+        }
+    }
+};
+
+/**
+ * @brief Atribui um valor a todos os elementos do intervalo. Funciona com soma, mínimo e máximo.
+ * A tag vazia (`std::nullopt`) representa "nenhuma atribuição pendente".
+ */
+template <typename Monoide>
+struct AcaoAtribuir {
+    using Valor = typename Monoide::Valor;
+    using Tag = std::optional<Valor>;
+
+    static Tag identidade() { return std::nullopt; }
+    static Tag compor(const Tag& nova, const Tag& antiga) { return nova.has_value() ? nova : antiga; }
+    static Valor aplicar(const Tag& v, const Valor& x, int tamanho) {
+        if (!v.has_value()) return x;
+        if constexpr (monoide_depende_do_tamanho<Monoide>) {
+            return *v * static_cast<Valor>(tamanho);
+        } else {
+            return *v;
+        }
+    }
+};
+
+/**
+ * @brief Aplica `x -> a * x + b` a todos os elementos do intervalo.
+ *
+ * Generaliza as duas ações anteriores: somar `d` é `{1, d}` e atribuir `v` é `{0, v}`, o que
+ * permite misturar os dois tipos de atualização na mesma árvore.
+ *
+ * @warning Com mínimo ou máximo, `a` deve ser não negativo (um fator negativo inverte a ordem).
+ */
+template <typename Monoide>
+struct AcaoAfim {
+    using Valor = typename Monoide::Valor;
+    struct Tag {
+        Valor a;
+        Valor b;
+    };
+
+    static Tag identidade() { return {Valor(1), Valor(0)}; }
+    static Tag compor(const Tag& nova, const Tag& antiga) {
+        // nova(antiga(x)) = nova.a * (antiga.a * x + antiga.b) + nova.b
+        return {nova.a * antiga.a, nova.a * antiga.b + nova.b};
+    }
+    static Valor aplicar(const Tag& f, const Valor& x, int tamanho) {
+        if constexpr (monoide_depende_do_tamanho<Monoide>) {
+            return f.a * x + f.b * static_cast<Valor>(tamanho);
+        } else {
+            return f.a * x + f.b;
+        }
+    }
+};
+
+/**
+ * @class SegmentTreeLazy
+ * @brief Segment Tree iterativa com atualizações em intervalo via propagação preguiçosa.
+ *
+ * Usa o mesmo layout bottom-up em potência de dois da `SegmentTreeMonoide`. Cada nó interno
+ * guarda, além do agregado, uma tag pendente que ainda não foi empurrada para os filhos.
+ * Antes de qualquer operação, as tags nos caminhos das duas bordas do intervalo são
+ * empurradas de cima para baixo; depois, os agregados desses caminhos são recalculados.
+ *
+ * @tparam Monoide O monoide dos valores (ex: `MonoideSoma<long long>`).
+ * @tparam Acao A ação de atualização (ex: `AcaoSomar<MonoideSoma<long long>>`).
+ */
+template <typename Monoide, typename Acao>
+class SegmentTreeLazy {
+public:
+    using Valor = typename Monoide::Valor;
+    using Tag = typename Acao::Tag;
+
+private:
+    std::vector<Valor> tree;
+    std::vector<Tag> lazy; // Só os nós internos [1, tamanho_base) têm tag
+    int n;
+    int tamanho_base;
+    int log_base; // log2(tamanho_base), a altura da árvore
+
+    // Número de folhas cobertas pelo nó.
+    int tamanho_no(int node) const {
+        return tamanho_base >> (std::bit_width(static_cast<unsigned>(node)) - 1);
+    }
+
+    void recalcular(int node) {
+        tree[node] = Monoide::combinar(tree[2 * node], tree[2 * node + 1]);
+    }
+
+    void aplicar_no(int node, const Tag& f) {
+        tree[node] = Acao::aplicar(f, tree[node], tamanho_no(node));
+        if (node < tamanho_base) lazy[node] = Acao::compor(f, lazy[node]);
+    }
+
+    void empurrar(int node) {
+        aplicar_no(2 * node, lazy[node]);
+        aplicar_no(2 * node + 1, lazy[node]);
+        lazy[node] = Acao::identidade();
+    }
+
+    // Empurra as tags dos ancestrais das bordas do intervalo semiaberto [l, r) (já em posições de folha).
+    void empurrar_bordas(int l, int r) {
+        for (int i = log_base; i >= 1; --i) {
+            if (((l >> i) << i) != l) empurrar(l >> i);
+            if (((r >> i) << i) != r) empurrar((r - 1) >> i);
+        }
+    }
+
+    void verificar_intervalo(int start, int end) const {
+        if (start < 0 || end >= n || start > end) {
+            throw std::out_of_range("Intervalo inválido.");
+        }
+    }
+
+    void verificar_indice(int index) const {
+        if (index < 0 || index >= n) {
+            throw std::out_of_range("Índice inválido.");
+        }
+    }
+
+public:
+    /**
+     * @brief Constrói a árvore a partir de um vetor em O(n).
+     * @param arr O vetor de dados. É copiado para dentro da árvore.
+     */
+    explicit SegmentTreeLazy(const std::vector<Valor>& arr) : n(arr.size()) {
+        tamanho_base = n > 0 ? static_cast<int>(std::bit_ceil(static_cast<unsigned>(n))) : 1;
+        log_base = std::countr_zero(static_cast<unsigned>(tamanho_base));
+        tree.assign(2 * tamanho_base, Monoide::identidade());
+        lazy.assign(tamanho_base, Acao::identidade());
+        std::copy(arr.begin(), arr.end(), tree.begin() + tamanho_base);
+        for (int node = tamanho_base - 1; node >= 1; --node) {
+            recalcular(node);
+        }
+    }
+
+    /**
+     * @brief Realiza uma consulta de agregação em um intervalo [start, end].
+     * @complexity Time: O(log n)
+     */
+    Valor query(int start, int end) {
+        verificar_intervalo(start, end);
+        int l = start + tamanho_base;
+        int r = end + tamanho_base + 1;
+        empurrar_bordas(l, r);
+
+        Valor resultado_esq = Monoide::identidade();
+        Valor resultado_dir = Monoide::identidade();
+        while (l < r) {
+            if (l & 1) resultado_esq = Monoide::combinar(resultado_esq, tree[l++]);
+            if (r & 1) resultado_dir = Monoide::combinar(tree[--r], resultado_dir);
+            l >>= 1;
+            r >>= 1;
+        }
+        return Monoide::combinar(resultado_esq, resultado_dir);
+    }
+
+    /**
+     * @brief Aplica a atualização `f` a todos os elementos do intervalo [start, end].
+     * @complexity Time: O(log n)
+     */
+    void apply(int start, int end, const Tag& f) {
+        verificar_intervalo(start, end);
+        const int l0 = start + tamanho_base;
+        const int r0 = end + tamanho_base + 1;
+        empurrar_bordas(l0, r0);
+
+        for (int l = l0, r = r0; l < r; l >>= 1, r >>= 1) {
+            if (l & 1) aplicar_no(l++, f);
+            if (r & 1) aplicar_no(--r, f);
+        }
+
+        for (int i = 1; i <= log_base; ++i) {
+            if (((l0 >> i) << i) != l0) recalcular(l0 >> i);
+            if (((r0 >> i) << i) != r0) recalcular((r0 - 1) >> i);
+        }
+    }
+
+    /**
+     * @brief Atribui `value` a um único elemento.
+     * @complexity Time: O(log n)
+     */
+    void update(int index, const Valor& value) {
+        verificar_indice(index);
+        int node = index + tamanho_base;
+        for (int i = log_base; i >= 1; --i) empurrar(node >> i);
+        tree[node] = value;
+        for (int i = 1; i <= log_base; ++i) recalcular(node >> i);
+    }
+
+    /**
+     * @brief Retorna o valor atual de um único elemento, com todas as tags pendentes aplicadas.
+     * @complexity Time: O(log n)
+     */
+    Valor get(int index) {
+        verificar_indice(index);
+        int node = index + tamanho_base;
+        for (int i = log_base; i >= 1; --i) empurrar(node >> i);
+        return tree[node];
+    }
+
+    int size() const {
+        return n;
+    }
+};
+
+#endif // SEGMENT_TREE_LAZY_HPP
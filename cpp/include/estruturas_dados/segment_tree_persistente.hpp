@@ -0,0 +1,225 @@
+#ifndef SEGMENT_TREE_PERSISTENTE_HPP
+#define SEGMENT_TREE_PERSISTENTE_HPP
+
+#include <vector>
+#include <cstddef>   // Para std::size_t
+#include <cstdint>   // Para std::uint32_t
+#include <limits>
+#include <stdexcept>
+#include "estruturas_dados/segment_tree.hpp" // Para os monoides
+
+/**
+ * @file segment_tree_persistente.hpp
+ * @brief Contém a implementação de uma Segment Tree persistente (versionada), em que cada
+ * atualização gera uma nova versão sem destruir as anteriores.
+ *
+ * @note Como esta é uma classe de template, toda a implementação está neste arquivo de cabeçalho.
+ */
+
+/**
+ * @class SegmentTreePersistente
+ * @brief Segment Tree persistente com cópia de caminho (path copying) e nós em um pool contíguo.
+ *
+ * Uma atualização copia apenas os O(log n) nós no caminho da raiz até a folha alterada; todos
+ * os outros nós são compartilhados com a versão anterior. Assim, n elementos e q atualizações
+ * ocupam O(n + q log n) nós, em vez de O(n * q) ao copiar a árvore inteira a cada versão.
+ *
+ * Os nós vivem em um único `std::vector` e referenciam os filhos por índices de 32 bits, o que
+ * reduz o tamanho de cada nó e dispensa uma alocação por nó. Como um nó é sempre criado depois
+ * dos seus filhos, os filhos têm índices menores que o pai, propriedade usada na compactação.
+ *
+ * Versões descartadas com `liberar_versao` continuam ocupando o pool até `coletar_lixo`, que
+ * marca os nós alcançáveis pelas versões vivas e compacta o pool, mantendo os identificadores
+ * das versões vivas.
+ *
+ * @tparam Monoide Tipo com `Valor`, `identidade()` e `combinar(a, b)` (ex: `MonoideSoma<long long>`).
+ */
+template <typename Monoide>
+class SegmentTreePersistente {
+public:
+    using Valor = typename Monoide::Valor;
+    using Versao = std::uint32_t; // Identificador de uma versão, estável entre coletas de lixo
+
+private:
+    static constexpr std::uint32_t NULO = std::numeric_limits<std::uint32_t>::max();
+
+    struct Node {
+        Valor valor;
+        std::uint32_t esquerda;
+        std::uint32_t direita;
+    };
+
+    std::vector<Node> pool;
+    std::vector<std::uint32_t> raizes; // raizes[v] é a raiz da versão v, ou NULO se foi liberada
+    int n;
+
+    std::uint32_t novo_no(const Valor& valor, std::uint32_t esquerda, std::uint32_t direita) {
+        if (pool.size() >= NULO) {
+            throw std::length_error("O pool de nós excedeu a capacidade de índices de 32 bits.");
+        }
+        pool.push_back({valor, esquerda, direita});
+        return static_cast<std::uint32_t>(pool.size() - 1);
+    }
+
+    std::uint32_t build_helper(const std::vector<Valor>& arr, int start, int end) {
+        if (start == end) {
+            return novo_no(arr[start], NULO, NULO);
+        }
+        int mid = start + (end - start) / 2;
+        std::uint32_t esq = build_helper(arr, start, mid);
+        std::uint32_t dir = build_helper(arr, mid + 1, end);
+        return novo_no(Monoide::combinar(pool[esq].valor, pool[dir].valor), esq, dir);
+    }
+
+    // Cria a cópia do caminho até 'index' e retorna a nova raiz da subárvore.
+    std::uint32_t update_helper(std::uint32_t node, int start, int end, int index, const Valor& value) {
+        if (start == end) {
+            return novo_no(value, NULO, NULO);
+        }
+        int mid = start + (end - start) / 2;
+        std::uint32_t esq = pool[node].esquerda;
+        std::uint32_t dir = pool[node].direita;
+        if (index <= mid) {
+            esq = update_helper(esq, start, mid, index, value);
+        } else {
+            dir = update_helper(dir, mid + 1, end, index, value);
+        }
+        return novo_no(Monoide::combinar(pool[esq].valor, pool[dir].valor), esq, dir);
+    }
+
+    Valor query_helper(std::uint32_t node, int start, int end, int q_start, int q_end) const {
+        if (q_start > end || q_end < start) {
+            return Monoide::identidade();
+        }
+        if (q_start <= start && end <= q_end) {
+            return pool[node].valor;
+        }
+        int mid = start + (end - start) / 2;
+        return Monoide::combinar(query_helper(pool[node].esquerda, start, mid, q_start, q_end),
+                                 query_helper(pool[node].direita, mid + 1, end, q_start, q_end));
+    }
+
+    std::uint32_t raiz_da_versao(Versao versao) const {
+        if (versao >= raizes.size() || raizes[versao] == NULO) {
+            throw std::invalid_argument("Versão inexistente ou já liberada.");
+        }
+        return raizes[versao];
+    }
+
+public:
+    /**
+     * @brief Constrói a versão 0 a partir de um vetor.
+     * @param arr O vetor de dados. Não precisa sobreviver à árvore.
+     * @complexity Time: O(n), Space: O(n)
+     */
+    explicit SegmentTreePersistente(const std::vector<Valor>& arr) : n(arr.size()) {
+        if (n == 0) {
+            throw std::invalid_argument("A Segment Tree persistente exige ao menos um elemento.");
+        }
+        pool.reserve(2 * n);
+        raizes.push_back(build_helper(arr, 0, n - 1));
+    }
+
+    /**
+     * @brief Cria uma nova versão igual a `versao`, exceto pelo elemento em `index`.
+     * @return O identificador da nova versão.
+     * @complexity Time: O(log n), Space: O(log n) novos nós.
+     */
+    Versao update(Versao versao, int index, const Valor& value) {
+        std::uint32_t raiz = raiz_da_versao(versao);
+        if (index < 0 || index >= n) {
+            throw std::out_of_range("Índice de atualização inválido.");
+        }
+        raizes.push_back(update_helper(raiz, 0, n - 1, index, value));
+        return static_cast<Versao>(raizes.size() - 1);
+    }
+
+    /**
+     * @brief Realiza uma consulta de agregação em [start, end] tal como estava na `versao`.
+     * @complexity Time: O(log n)
+     */
+    Valor query(Versao versao, int start, int end) const {
+        std::uint32_t raiz = raiz_da_versao(versao);
+        if (start < 0 || end >= n || start > end) {
+            throw std::out_of_range("Intervalo de consulta inválido.");
+        }
+        return query_helper(raiz, 0, n - 1, start, end);
+    }
+
+    /**
+     * @brief Marca uma versão como descartada. Seus nós exclusivos só são recuperados por `coletar_lixo`.
+     */
+    void liberar_versao(Versao versao) {
+        raiz_da_versao(versao);
+        raizes[versao] = NULO;
+    }
+
+    /**
+     * @brief Remove do pool os nós que não são alcançáveis por nenhuma versão viva.
+     *
+     * Marca os nós a partir das raizes vivas (cada nó compartilhado é visitado uma vez) e
+     * depois compacta o pool em uma única passada crescente: como os filhos sempre têm índice
+     * menor que o pai, seus novos índices já são conhecidos quando o pai é movido.
+     *
+     * @return O número de nós liberados.
+     * @complexity Time: O(tamanho do pool), Space: O(tamanho do pool) para as marcas e o mapa de índices.
+     */
+    std::size_t coletar_lixo() {
+        std::vector<bool> alcancavel(pool.size(), false);
+        std::vector<std::uint32_t> pilha;
+        for (std::uint32_t raiz : raizes) {
+            if (raiz != NULO) pilha.push_back(raiz);
+        }
+        while (!pilha.empty()) {
+            std::uint32_t node = pilha.back();
+            pilha.pop_back();
+            if (alcancavel[node]) continue;
+            alcancavel[node] = true;
+            if (pool[node].esquerda != NULO) {
+                pilha.push_back(pool[node].esquerda);
+                pilha.push_back(pool[node].direita);
+            }
+        }
+
+        std::vector<std::uint32_t> novo_indice(pool.size(), NULO);
+        std::uint32_t escrita = 0;
+        for (std::uint32_t node = 0; node < pool.size(); ++node) {
+            if (!alcancavel[node]) continue;
+            Node movido = pool[node];
+            if (movido.esquerda != NULO) {
+                movido.esquerda = novo_indice[movido.esquerda];
+                movido.direita = novo_indice[movido.direita];
+            }
+            pool[escrita] = movido;
+            novo_indice[node] = escrita++;
+        }
+
+        std::size_t liberados = pool.size() - escrita;
+        pool.resize(escrita);
+        pool.shrink_to_fit();
+        for (auto& raiz : raizes) {
+            if (raiz != NULO) raiz = novo_indice[raiz];
+        }
+        return liberados;
+    }
+
+    /**
+     * @brief Retorna o número de versões já criadas, incluindo as liberadas.
+     */
+    std::size_t num_versoes() const {
+        return raizes.size();
+    }
+
+    /**
+     * @brief Retorna o número de nós atualmente no pool.
+     */
+    std::size_t nos_alocados() const {
+        return pool.size();
+    }
+
+    int size() const {
+        return n;
+    }
+};
+
+#endif // SEGMENT_TREE_PERSISTENTE_HPP
@@ -0,0 +1,330 @@
+#ifndef SKIP_LIST_HPP
+#define SKIP_LIST_HPP
+
+#include "estruturas_dados/coletor_epocas.hpp"
+#include <atomic>
+#include <bit>       // Para std::countr_zero
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+/**
+ * @file skip_list.hpp
+ * @brief Contém a implementação de uma skip list concorrente e sem locks (lock-free), usada
+ * como mapa ordenado compartilhado entre várias threads.
+ *
+ * @note Como SkipListConcorrente é uma classe de template, toda a sua implementação está neste
+ * arquivo de cabeçalho.
+ */
+
+/**
+ * @class SkipListConcorrente
+ * @brief Mapa ordenado de chaves únicas em que várias threads inserem, removem, buscam e
+ * percorrem intervalos ao mesmo tempo, sem locks.
+ *
+ * Segue o algoritmo de Herlihy e Shavit (The Art of Multiprocessor Programming, cap. 14):
+ * - Cada nó tem uma torre de ponteiros `proximos`, ligados por CAS. O bit menos significativo
+ *   de cada ponteiro é a marca de remoção lógica daquele nível.
+ * - A remoção marca a torre de cima para baixo; marcar o nível 0 é o ponto de linearização.
+ *   Os nós marcados são desligados fisicamente por qualquer thread que passe por eles em `encontrar`.
+ * - A inserção liga o nível 0 (ponto de linearização) e depois os níveis superiores.
+ * - `contem` e `buscar` não escrevem nada nem recomeçam: apenas pulam os nós marcados, o que as
+ *   torna wait-free.
+ *
+ * A memória dos nós removidos é recuperada por um `ColetorEpocas`. Um nó só é aposentado depois
+ * que tanto o removedor quanto o inseridor (que pode ainda estar ligando os níveis superiores)
+ * terminaram de usá-lo e o desligaram de todos os níveis.
+ *
+ * Os níveis são sorteados com p = 1/2 por um gerador xorshift por thread, sem estado compartilhado.
+ *
+ * @tparam Chave Tipo da chave; precisa de `operator<` e `operator==`.
+ * @tparam Valor Tipo do valor, fixado na inserção.
+ */
+template <typename Chave, typename Valor>
+class SkipListConcorrente {
+public:
+    static constexpr int MAX_NIVEL = 32;
+
+private:
+    struct alignas(alignof(std::atomic<std::uintptr_t>)) No {
+        // Em uniões para que a cabeça seja um No de verdade sem exigir que Chave e Valor tenham
+        // construtor padrão: nela, os dois nunca são construídos nem lidos.
+        union { Chave chave; };
+        union { Valor valor; };
+        int altura;
+        // O removedor e o inseridor liberam uma referência cada; quem zera aposenta o nó.
+        std::atomic<int> referencias{2};
+
+        No(const Chave& c, const Valor& v, int a) : chave(c), valor(v), altura(a) {}
+        // Sentinela da cabeça.
+        explicit No(int a) : altura(a) {}
+        // Quem destrói chave e valor é destruir_no; a cabeça não os tem.
+        ~No() {}
+
+        // A torre fica logo após o nó, na mesma alocação.
+        std::atomic<std::uintptr_t>* proximos() {
+            return reinterpret_cast<std::atomic<std::uintptr_t>*>(this + 1);
+        }
+    };
+
+    static bool marcado(std::uintptr_t p) { return p & 1; }
+    static No* ponteiro(std::uintptr_t p) { return reinterpret_cast<No*>(p & ~std::uintptr_t(1)); }
+    static std::uintptr_t como_inteiro(No* p) { return reinterpret_cast<std::uintptr_t>(p); }
+
+    // Constrói o nó e a sua torre de `altura` ponteiros nulos numa única alocação.
+    template <typename... Argumentos>
+    static No* criar_torre(int altura, const Argumentos&... argumentos) {
+        void* memoria = ::operator new(sizeof(No) + altura * sizeof(std::atomic<std::uintptr_t>));
+        No* no;
+        try {
+            no = new (memoria) No(argumentos..., altura);
+        } catch (...) {
+            ::operator delete(memoria);
+            throw;
+        }
+        for (int i = 0; i < altura; ++i) new (&no->proximos()[i]) std::atomic<std::uintptr_t>(0);
+        return no;
+    }
+
+    static No* criar_no(const Chave& chave, const Valor& valor, int altura) {
+        return criar_torre(altura, chave, valor);
+    }
+
+    // Destrói a torre e o nó, na ordem inversa de criar_torre, e libera a alocação.
+    static void destruir_torre(No* no) {
+        for (int i = no->altura - 1; i >= 0; --i) no->proximos()[i].~atomic();
+        no->~No();
+        ::operator delete(static_cast<void*>(no));
+    }
+
+    static void destruir_no(void* memoria) {
+        No* no = static_cast<No*>(memoria);
+        no->valor.~Valor();
+        no->chave.~Chave();
+        destruir_torre(no);
+    }
+
+    No* cabeca; // Sentinela com torre de altura máxima, sem chave nem valor
+
+    std::atomic<std::size_t> contagem{0};
+    mutable ColetorEpocas coletor;
+
+    static int nivel_aleatorio() {
+        thread_local std::uint64_t estado = 0x9E3779B97F4A7C15ULL ^ reinterpret_cast<std::uintptr_t>(&estado);
+        estado ^= estado << 13;
+        estado ^= estado >> 7;
+        estado ^= estado << 17;
+        // Número de zeros à direita de um valor aleatório: P(nível >= k + 1) = 2^-k.
+        return 1 + std::countr_zero(estado | (std::uint64_t(1) << (MAX_NIVEL - 1)));
+    }
+
+    /**
+     * Preenche, para cada nível, o último nó com chave menor que `chave` (preds) e o seguinte (succs),
+     * desligando pelo caminho todos os nós marcados. Retorna true se succs[0] tem a chave procurada.
+     */
+    bool encontrar(const Chave& chave, No** preds, No** succs) const {
+    recomecar:
+        No* pred = cabeca;
+        No* atual = nullptr;
+        for (int nivel = MAX_NIVEL - 1; nivel >= 0; --nivel) {
+            atual = ponteiro(pred->proximos()[nivel].load(std::memory_order_acquire));
+            while (atual != nullptr) {
+                std::uintptr_t seguinte = atual->proximos()[nivel].load(std::memory_order_acquire);
+                while (marcado(seguinte)) {
+                    std::uintptr_t esperado = como_inteiro(atual);
+                    if (!pred->proximos()[nivel].compare_exchange_strong(esperado, seguinte & ~std::uintptr_t(1))) {
+                        goto recomecar; // 'pred' mudou ou também foi marcado
+                    }
+                    atual = ponteiro(seguinte);
+                    if (atual == nullptr) break;
+                    seguinte = atual->proximos()[nivel].load(std::memory_order_acquire);
+                }
+                if (atual == nullptr || !(atual->chave < chave)) break;
+                pred = atual;
+                atual = ponteiro(seguinte);
+            }
+            preds[nivel] = pred;
+            succs[nivel] = atual;
+        }
+        return atual != nullptr && atual->chave == chave;
+    }
+
+    // Primeiro nó não marcado com chave >= `chave`, ou nullptr. Apenas lê: pula os nós marcados
+    // em vez de desligá-los, então nunca recomeça.
+    No* primeiro_nao_menor(const Chave& chave) const {
+        No* pred = cabeca;
+        No* atual = nullptr;
+        for (int nivel = MAX_NIVEL - 1; nivel >= 0; --nivel) {
+            atual = ponteiro(pred->proximos()[nivel].load(std::memory_order_acquire));
+            while (atual != nullptr) {
+                std::uintptr_t seguinte = atual->proximos()[nivel].load(std::memory_order_acquire);
+                if (!marcado(seguinte)) {
+                    if (!(atual->chave < chave)) break;
+                    pred = atual;
+                }
+                atual = ponteiro(seguinte);
+            }
+        }
+        // No nível 0 os nós marcados também foram pulados: 'atual' é o primeiro nó presente >= chave.
+        return atual;
+    }
+
+    void soltar_referencia(No* no) {
+        if (no->referencias.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            coletor.aposentar(no, &SkipListConcorrente::destruir_no);
+        }
+    }
+
+public:
+    SkipListConcorrente() {
+        cabeca = criar_torre(MAX_NIVEL);
+    }
+
+    /**
+     * @brief Libera todos os nós. Nenhuma outra thread pode estar usando a lista.
+     */
+    ~SkipListConcorrente() {
+        // Sem concorrência, todo nó aposentado já foi desligado; os que restam no nível 0 estão vivos.
+        No* atual = ponteiro(cabeca->proximos()[0].load());
+        while (atual != nullptr) {
+            No* seguinte = ponteiro(atual->proximos()[0].load());
+            destruir_no(atual);
+            atual = seguinte;
+        }
+        destruir_torre(cabeca);
+    }
+
+    SkipListConcorrente(const SkipListConcorrente&) = delete;
+    SkipListConcorrente& operator=(const SkipListConcorrente&) = delete;
+
+    /**
+     * @brief Insere o par se a chave ainda não existir.
+     * @return true se inseriu, false se a chave já estava presente.
+     * @complexity Time: O(log n) esperado, lock-free.
+     */
+    bool inserir(const Chave& chave, const Valor& valor) {
+        auto guarda = coletor.proteger();
+        No* preds[MAX_NIVEL];
+        No* succs[MAX_NIVEL];
+        No* novo = nullptr;
+
+        // Nível 0: o nó passa a fazer parte do conjunto no CAS bem-sucedido.
+        while (true) {
+            if (encontrar(chave, preds, succs)) {
+                if (novo != nullptr) destruir_no(novo); // Nunca foi publicado
+                return false;
+            }
+            if (novo == nullptr) novo = criar_no(chave, valor, nivel_aleatorio());
+            for (int i = 0; i < novo->altura; ++i) {
+                novo->proximos()[i].store(como_inteiro(succs[i]), std::memory_order_relaxed);
+            }
+            std::uintptr_t esperado = como_inteiro(succs[0]);
+            if (preds[0]->proximos()[0].compare_exchange_strong(esperado, como_inteiro(novo), std::memory_order_release)) {
+                break;
+            }
+        }
+        contagem.fetch_add(1, std::memory_order_relaxed);
+
+        // Níveis superiores: desiste assim que um removedor marcar o nó.
+        for (int nivel = 1; nivel < novo->altura; ++nivel) {
+            while (true) {
+                std::uintptr_t proprio = novo->proximos()[nivel].load(std::memory_order_acquire);
+                if (marcado(proprio)) goto ligado;
+                if (ponteiro(proprio) != succs[nivel] &&
+                    !novo->proximos()[nivel].compare_exchange_strong(proprio, como_inteiro(succs[nivel]))) {
+                    continue; // Marcado neste meio tempo; verificado no início do laço
+                }
+                std::uintptr_t esperado = como_inteiro(succs[nivel]);
+                if (preds[nivel]->proximos()[nivel].compare_exchange_strong(esperado, como_inteiro(novo))) break;
+                encontrar(chave, preds, succs);
+                if (succs[0] != novo) goto ligado; // Removido (e desligado do nível 0) no meio tempo
+            }
+        }
+    ligado:
+        // Se foi removido enquanto ligava os níveis, pode ter ligado um nível depois que o removedor
+        // passou por ele: uma nova busca garante que foi desligado de todos antes de soltar o nó.
+        if (marcado(novo->proximos()[0].load(std::memory_order_acquire))) encontrar(chave, preds, succs);
+        soltar_referencia(novo);
+        return true;
+    }
+
+    /**
+     * @brief Remove a chave, se presente.
+     * @return true se esta chamada removeu a chave.
+     * @complexity Time: O(log n) esperado, lock-free.
+     */
+    bool remover(const Chave& chave) {
+        auto guarda = coletor.proteger();
+        No* preds[MAX_NIVEL];
+        No* succs[MAX_NIVEL];
+        if (!encontrar(chave, preds, succs)) return false;
+        No* alvo = succs[0];
+
+        for (int nivel = alvo->altura - 1; nivel >= 1; --nivel) {
+            std::uintptr_t seguinte = alvo->proximos()[nivel].load(std::memory_order_acquire);
+            while (!marcado(seguinte) && !alvo->proximos()[nivel].compare_exchange_weak(seguinte, seguinte | 1)) {
+            }
+        }
+        std::uintptr_t seguinte = alvo->proximos()[0].load(std::memory_order_acquire);
+        while (true) {
+            if (marcado(seguinte)) return false; // Outra thread removeu primeiro
+            if (alvo->proximos()[0].compare_exchange_weak(seguinte, seguinte | 1, std::memory_order_acq_rel)) break;
+        }
+        contagem.fetch_sub(1, std::memory_order_relaxed);
+        encontrar(chave, preds, succs); // Desliga fisicamente o nó de todos os níveis
+        soltar_referencia(alvo);
+        return true;
+    }
+
+    /**
+     * @brief Verifica se a chave está presente. Wait-free: não escreve e não recomeça.
+     * @complexity Time: O(log n) esperado.
+     */
+    bool contem(const Chave& chave) const {
+        auto guarda = coletor.proteger();
+        No* no = primeiro_nao_menor(chave);
+        return no != nullptr && no->chave == chave;
+    }
+
+    /**
+     * @brief Busca o valor associado à chave. Wait-free, como `contem`.
+     */
+    bool buscar(const Chave& chave, Valor& valor_encontrado) const {
+        auto guarda = coletor.proteger();
+        No* no = primeiro_nao_menor(chave);
+        if (no == nullptr || !(no->chave == chave)) return false;
+        valor_encontrado = no->valor;
+        return true;
+    }
+
+    /**
+     * @brief Chama `visitar(chave, valor)` para cada par com chave em [a, b], em ordem crescente.
+     *
+     * A varredura é fracamente consistente: cada par visitado estava presente em algum momento
+     * durante a chamada, e pares inseridos ou removidos concorrentemente podem ou não aparecer.
+     *
+     * @complexity Time: O(log n + k) esperado.
+     */
+    template <typename Funcao>
+    void percorrer_intervalo(const Chave& a, const Chave& b, Funcao&& visitar) const {
+        if (b < a) return;
+        auto guarda = coletor.proteger();
+        for (No* atual = primeiro_nao_menor(a); atual != nullptr;) {
+            std::uintptr_t seguinte = atual->proximos()[0].load(std::memory_order_acquire);
+            if (!marcado(seguinte)) {
+                if (b < atual->chave) return;
+                visitar(atual->chave, atual->valor);
+            }
+            atual = ponteiro(seguinte);
+        }
+    }
+
+    /**
+     * @brief Número de chaves presentes; exato apenas sem operações concorrentes.
+     */
+    std::size_t tamanho() const {
+        return contagem.load(std::memory_order_relaxed);
+    }
+};
+
+#endif // SKIP_LIST_HPP
@@ -0,0 +1,369 @@
+#ifndef TRIE_HPP
+#define TRIE_HPP
+
+#include "estruturas_dados/wavelet_tree.hpp" // Para BitVectorRankSelect
+#include <algorithm> // Para std::min
+#include <cstddef>
+#include <cstdint>
+#include <queue>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/**
+ * @file trie.hpp
+ * @brief Contém uma trie compactada (radix trie) para consultas de prefixo e autocompletar, e a
+ * sua versão congelada em representação LOUDS, mais compacta, para uso predominantemente de leitura.
+ *
+ * Em uma trie compactada, cada aresta guarda uma sequência de caracteres em vez de um único
+ * caractere, e nós com um único filho que não terminam chave não existem. Assim o número de nós
+ * é no máximo 2n - 1 para n chaves, independentemente do comprimento delas. Cada chave tem um peso
+ * (por exemplo, uma frequência) usado para ordenar as sugestões de `top_k`.
+ *
+ * As consultas são implementadas uma única vez em `ConsultasTrie`, sobre as operações de navegação
+ * que cada representação fornece.
+ */
+
+/**
+ * @class ConsultasTrie
+ * @brief Consultas comuns às duas representações da trie (CRTP).
+ *
+ * A classe derivada fornece: `NULO`, `raiz()`, `rotulo(no)`, `filho(no, c)`,
+ * `para_cada_filho(no, f)` (em ordem lexicográfica), `terminal(no)`, `peso(no)` e
+ * `peso_maximo(no)` (maior peso de uma chave na subárvore).
+ */
+template <typename Derivada>
+class ConsultasTrie {
+public:
+    /**
+     * @brief Busca o peso de uma chave.
+     * @return true se a chave está presente.
+     * @complexity Time: O(|chave|)
+     */
+    bool buscar(std::string_view chave, std::uint32_t& peso_encontrado) const {
+        std::uint32_t no = d().raiz();
+        std::size_t i = 0;
+        while (i < chave.size()) {
+            std::uint32_t f = d().filho(no, static_cast<unsigned char>(chave[i]));
+            if (f == Derivada::NULO) return false;
+            std::string_view r = d().rotulo(f);
+            if (chave.size() - i < r.size() || chave.compare(i, r.size(), r) != 0) return false;
+            i += r.size();
+            no = f;
+        }
+        if (!d().terminal(no)) return false;
+        peso_encontrado = d().peso(no);
+        return true;
+    }
+
+    bool contem(std::string_view chave) const {
+        std::uint32_t peso;
+        return buscar(chave, peso);
+    }
+
+    /**
+     * @brief Retorna o comprimento da maior chave que é prefixo de `texto`, ou -1 se nenhuma for.
+     *
+     * Útil para roteamento e tokenização: a chave vazia, se inserida, casa com comprimento 0.
+     *
+     * @complexity Time: O(|texto|)
+     */
+    long long longest_prefix_match(std::string_view texto) const {
+        std::uint32_t no = d().raiz();
+        long long melhor = d().terminal(no) ? 0 : -1;
+        std::size_t i = 0;
+        while (i < texto.size()) {
+            std::uint32_t f = d().filho(no, static_cast<unsigned char>(texto[i]));
+            if (f == Derivada::NULO) break;
+            std::string_view r = d().rotulo(f);
+            if (texto.size() - i < r.size() || texto.compare(i, r.size(), r) != 0) break;
+            i += r.size();
+            no = f;
+            if (d().terminal(no)) melhor = static_cast<long long>(i);
+        }
+        return melhor;
+    }
+
+    /**
+     * @brief Chama `visitar(chave, peso)` para cada chave que começa com `prefixo`, em ordem lexicográfica.
+     * @complexity Time: O(|prefixo| + tamanho total das chaves visitadas)
+     */
+    template <typename Funcao>
+    void prefix_iterate(std::string_view prefixo, Funcao&& visitar) const {
+        std::uint32_t no;
+        std::string caminho;
+        if (!descer_prefixo(prefixo, no, caminho)) return;
+        percorrer(no, caminho, visitar);
+    }
+
+    /**
+     * @brief Retorna as até k chaves de maior peso que começam com `prefixo`, em ordem decrescente
+     * de peso (empates em uma ordem determinística, mas não necessariamente lexicográfica).
+     *
+     * Busca pela melhor opção primeiro: uma fila de prioridade guarda subárvores, com prioridade
+     * igual ao maior peso dentro delas, e chaves já completas. Como nenhuma chave de uma subárvore
+     * supera a prioridade dela, a primeira chave retirada da fila é a de maior peso entre as
+     * restantes, e só são expandidas as subárvores que podem conter uma das k respostas.
+     *
+     * @complexity Time: O(|prefixo| + k * (grau * log + comprimento da chave)) no caso típico.
+     */
+    std::vector<std::pair<std::string, std::uint32_t>> top_k(std::string_view prefixo, std::size_t k) const {
+        std::vector<std::pair<std::string, std::uint32_t>> resultado;
+        std::uint32_t inicio;
+        std::string caminho;
+        if (k == 0 || !descer_prefixo(prefixo, inicio, caminho)) return resultado;
+
+        // Cada registro é um nó alcançado, com o registro do pai, para remontar as chaves só no fim.
+        struct Registro {
+            std::uint32_t no;
+            std::int32_t pai;
+        };
+        struct Item {
+            std::uint32_t prioridade;
+            bool eh_chave;
+            std::int32_t registro;
+            std::uint64_t ordem; // Desempate: ordem de inserção na fila
+        };
+        auto menor_prioridade = [](const Item& a, const Item& b) {
+            if (a.prioridade != b.prioridade) return a.prioridade < b.prioridade;
+            if (a.eh_chave != b.eh_chave) return !a.eh_chave; // Com o mesmo peso, chaves completas saem antes
+            return a.ordem > b.ordem;
+        };
+        std::vector<Registro> registros = {{inicio, -1}};
+        std::priority_queue<Item, std::vector<Item>, decltype(menor_prioridade)> fila(menor_prioridade);
+        std::uint64_t contador = 0;
+        fila.push({d().peso_maximo(inicio), false, 0, contador++});
+
+        while (!fila.empty() && resultado.size() < k) {
+            Item item = fila.top();
+            fila.pop();
+            std::uint32_t no = registros[item.registro].no;
+            if (item.eh_chave) {
+                resultado.push_back({remontar(registros, item.registro, caminho), item.prioridade});
+                continue;
+            }
+            if (d().terminal(no)) fila.push({d().peso(no), true, item.registro, contador++});
+            d().para_cada_filho(no, [&](std::uint32_t f) {
+                registros.push_back({f, item.registro});
+                fila.push({d().peso_maximo(f), false, static_cast<std::int32_t>(registros.size() - 1), contador++});
+            });
+        }
+        return resultado;
+    }
+
+protected:
+    const Derivada& d() const {
+        return static_cast<const Derivada&>(*this);
+    }
+
+    // Desce por `prefixo`. Em caso de sucesso, 'no' é o nó cuja subárvore tem exatamente as chaves
+    // com esse prefixo, e 'caminho' é o texto da raiz até 'no' (o prefixo mais o resto do último rótulo).
+    bool descer_prefixo(std::string_view prefixo, std::uint32_t& no, std::string& caminho) const {
+        no = d().raiz();
+        std::string_view resto; // Parte do último rótulo além do fim do prefixo
+        std::size_t i = 0;
+        while (i < prefixo.size()) {
+            std::uint32_t f = d().filho(no, static_cast<unsigned char>(prefixo[i]));
+            if (f == Derivada::NULO) return false;
+            std::string_view r = d().rotulo(f);
+            std::size_t comparar = std::min(r.size(), prefixo.size() - i);
+            if (prefixo.compare(i, comparar, r.substr(0, comparar)) != 0) return false;
+            i += comparar;
+            no = f;
+            resto = r.substr(comparar);
+        }
+        caminho.assign(prefixo);
+        caminho.append(resto);
+        return true;
+    }
+
+    template <typename Funcao>
+    void percorrer(std::uint32_t no, std::string& caminho, Funcao& visitar) const {
+        if (d().terminal(no)) visitar(static_cast<const std::string&>(caminho), d().peso(no));
+        d().para_cada_filho(no, [&](std::uint32_t f) {
+            std::size_t tamanho = caminho.size();
+            caminho.append(d().rotulo(f));
+            percorrer(f, caminho, visitar);
+            caminho.resize(tamanho);
+        });
+    }
+
+    template <typename Registro>
+    std::string remontar(const std::vector<Registro>& registros, std::int32_t registro, const std::string& base) const {
+        std::vector<std::string_view> partes;
+        for (std::int32_t r = registro; registros[r].pai != -1; r = registros[r].pai) {
+            partes.push_back(d().rotulo(registros[r].no));
+        }
+        std::string chave = base;
+        for (auto it = partes.rbegin(); it != partes.rend(); ++it) chave.append(*it);
+        return chave;
+    }
+};
+
+class TrieCongelada;
+
+/**
+ * @class RadixTrie
+ * @brief Trie compactada mutável, com nós em um pool contíguo e rótulos em um único buffer.
+ *
+ * Cada nó ocupa 28 bytes: o rótulo da aresta que chega a ele é um intervalo (início, tamanho) do
+ * buffer `rotulos`, e os filhos formam uma lista de irmãos ordenada pelo primeiro caractere.
+ * Dividir uma aresta apenas ajusta intervalos, sem copiar texto.
+ */
+class RadixTrie : public ConsultasTrie<RadixTrie> {
+public:
+    static constexpr std::uint32_t NULO = UINT32_MAX;
+
+    RadixTrie();
+
+    /**
+     * @brief Insere `chave` com o peso dado; se ela já existir, o peso é substituído.
+     * @throws std::length_error se o buffer de rótulos puder passar de 4 GiB (deslocamentos de
+     * 32 bits) ou o pool de nós, de 2^32 - 1 nós; nesse caso a trie não é alterada.
+     * @complexity Time: O(|chave| + soma dos graus no caminho)
+     */
+    void inserir(std::string_view chave, std::uint32_t peso = 0);
+
+    /**
+     * @brief Gera a representação LOUDS, somente leitura e mais compacta.
+     * @complexity Time: O(número de nós + tamanho dos rótulos)
+     */
+    TrieCongelada congelar() const;
+
+    std::size_t tamanho() const {
+        return num_chaves;
+    }
+
+    std::size_t num_nos() const {
+        return nos.size();
+    }
+
+    /**
+     * @brief Memória ocupada pelos nós e rótulos, em bytes (capacidade reservada incluída).
+     */
+    std::size_t memoria_bytes() const {
+        return nos.capacity() * sizeof(No) + rotulos.capacity();
+    }
+
+private:
+    friend class ConsultasTrie<RadixTrie>;
+
+    struct No {
+        std::uint32_t inicio_rotulo;
+        std::uint32_t tam_rotulo;
+        std::uint32_t primeiro_filho;
+        std::uint32_t proximo_irmao;
+        std::uint32_t peso;
+        std::uint32_t peso_maximo;
+        bool terminal;
+    };
+
+    std::vector<No> nos; // nos[0] é a raiz, com rótulo vazio
+    std::string rotulos;
+    std::size_t num_chaves;
+
+    std::uint32_t novo_no(std::uint32_t inicio, std::uint32_t tam);
+    void recalcular_peso_maximo(std::uint32_t no);
+
+    std::uint32_t raiz() const {
+        return 0;
+    }
+    std::string_view rotulo(std::uint32_t no) const {
+        return std::string_view(rotulos).substr(nos[no].inicio_rotulo, nos[no].tam_rotulo);
+    }
+    unsigned char primeiro_caractere(std::uint32_t no) const {
+        return static_cast<unsigned char>(rotulos[nos[no].inicio_rotulo]);
+    }
+    std::uint32_t filho(std::uint32_t no, unsigned char c) const {
+        for (std::uint32_t f = nos[no].primeiro_filho; f != NULO; f = nos[f].proximo_irmao) {
+            unsigned char p = primeiro_caractere(f);
+            if (p == c) return f;
+            if (p > c) break; // Irmãos ordenados
+        }
+        return NULO;
+    }
+    template <typename Funcao>
+    void para_cada_filho(std::uint32_t no, Funcao&& f) const {
+        for (std::uint32_t c = nos[no].primeiro_filho; c != NULO; c = nos[c].proximo_irmao) f(c);
+    }
+    bool terminal(std::uint32_t no) const {
+        return nos[no].terminal;
+    }
+    std::uint32_t peso(std::uint32_t no) const {
+        return nos[no].peso;
+    }
+    std::uint32_t peso_maximo(std::uint32_t no) const {
+        return nos[no].peso_maximo;
+    }
+};
+
+/**
+ * @class TrieCongelada
+ * @brief Trie compactada somente leitura em representação LOUDS (Level-Order Unary Degree Sequence).
+ *
+ * Os nós são numerados em ordem de nível (BFS). A forma da árvore é um único bitvector com
+ * "10" para uma super-raiz seguido, para cada nó, de um bit 1 por filho e um bit 0: cerca de
+ * 2 bits por nó, sem nenhum ponteiro. Os filhos de um nó têm números consecutivos, e o primeiro
+ * deles e o grau saem de duas chamadas de select0. Os rótulos ficam concatenados na mesma ordem,
+ * delimitados por um vetor de inícios, e um segundo bitvector marca os nós terminais, cujo rank
+ * indexa o vetor de pesos.
+ */
+class TrieCongelada : public ConsultasTrie<TrieCongelada> {
+public:
+    static constexpr std::uint32_t NULO = UINT32_MAX;
+
+    TrieCongelada() : num_chaves(0) {}
+
+    std::size_t tamanho() const {
+        return num_chaves;
+    }
+
+    /**
+     * @brief Memória ocupada pelos bitvectors, rótulos e vetores auxiliares, em bytes.
+     */
+    std::size_t memoria_bytes() const;
+
+private:
+    friend class RadixTrie;
+    friend class ConsultasTrie<TrieCongelada>;
+
+    BitVectorRankSelect louds;
+    BitVectorRankSelect terminais;
+    std::string rotulos;                 // Rótulos concatenados em ordem BFS
+    std::vector<std::uint32_t> inicio;   // Rótulo do nó v = rotulos[inicio[v], inicio[v + 1])
+    std::vector<std::uint32_t> pesos;    // Peso da chave do t-ésimo nó terminal
+    std::vector<std::uint32_t> maximos;  // Maior peso na subárvore de cada nó
+    std::size_t num_chaves;
+
+    // Intervalo [primeiro, fim) dos filhos de v.
+    std::pair<std::uint32_t, std::uint32_t> filhos(std::uint32_t v) const {
+        std::uint32_t primeiro = static_cast<std::uint32_t>(louds.select0(v) - v);
+        std::uint32_t fim = static_cast<std::uint32_t>(louds.select0(v + 1) - (v + 1));
+        return {primeiro, fim};
+    }
+
+    std::uint32_t raiz() const {
+        return 0;
+    }
+    std::string_view rotulo(std::uint32_t v) const {
+        return std::string_view(rotulos).substr(inicio[v], inicio[v + 1] - inicio[v]);
+    }
+    std::uint32_t filho(std::uint32_t v, unsigned char c) const;
+    template <typename Funcao>
+    void para_cada_filho(std::uint32_t v, Funcao&& f) const {
+        auto [primeiro, fim] = filhos(v);
+        for (std::uint32_t c = primeiro; c < fim; ++c) f(c);
+    }
+    bool terminal(std::uint32_t v) const {
+        return terminais.get(v);
+    }
+    std::uint32_t peso(std::uint32_t v) const {
+        return pesos[terminais.rank1(v)];
+    }
+    std::uint32_t peso_maximo(std::uint32_t v) const {
+        return maximos[v];
+    }
+};
+
+#endif // TRIE_HPP
@@ -0,0 +1,272 @@
+#ifndef WAVELET_TREE_HPP
+#define WAVELET_TREE_HPP
+
+#include <vector>
+#include <cstdint>
+#include <algorithm> // Para std::sort, std::unique, std::lower_bound
+#include <stdexcept>
+#include <unordered_map>
+
+/**
+ * @file wavelet_tree.hpp
+ * @brief Contém a implementação de uma Wavelet Matrix para estatísticas de ordem em intervalos
+ * de um array: k-ésimo menor, contagem de valores menores que x, frequência e número de
+ * valores distintos, todos sem ordenar subarrays.
+ *
+ * A Wavelet Matrix é a variante da Wavelet Tree que guarda um único bitvector por nível, em vez
+ * de um por nó, o que simplifica o layout e elimina ponteiros. As partes que não dependem do
+ * tipo dos valores (bitvector e a matriz sobre códigos inteiros) são implementadas em
+ * wavelet_tree.cpp; o template `WaveletMatrix<T>` apenas comprime os valores para códigos.
+ */
+
+/**
+ * @class BitVectorRankSelect
+ * @brief Bitvector estático com rank em O(1) e select em O(log n).
+ *
+ * Os bits ficam em palavras de 64 bits e, para cada palavra, guarda-se o número de bits 1
+ * anteriores a ela. rank soma esse acumulado ao popcount da palavra parcial; select faz uma
+ * busca binária nos acumulados e termina dentro de uma única palavra. Para encurtar essa busca,
+ * guarda-se também a palavra de cada AMOSTRA_SELECT-ésimo bit 1 (e bit 0), que limita a busca
+ * binária a poucas palavras quando os bits estão bem distribuídos.
+ */
+class BitVectorRankSelect {
+private:
+    std::vector<std::uint64_t> palavras;
+    std::vector<std::uint32_t> acumulado; // acumulado[w] = número de bits 1 em palavras[0, w)
+    std::vector<std::uint32_t> amostras1; // amostras1[j] = palavra que contém o (j * AMOSTRA_SELECT)-ésimo bit 1
+    std::vector<std::uint32_t> amostras0; // O mesmo para os bits 0
+    std::size_t n;
+
+    static constexpr std::size_t AMOSTRA_SELECT = 512;
+
+public:
+    BitVectorRankSelect() : n(0) {}
+
+    /**
+     * @brief Constrói o bitvector a partir de um vetor de bits (0 ou 1).
+     * @complexity Time: O(n)
+     */
+    explicit BitVectorRankSelect(const std::vector<std::uint8_t>& bits);
+
+    bool get(std::size_t i) const {
+        return (palavras[i >> 6] >> (i & 63)) & 1;
+    }
+
+    /**
+     * @brief Número de bits 1 em [0, i).
+     */
+    std::size_t rank1(std::size_t i) const;
+
+    /**
+     * @brief Número de bits 0 em [0, i).
+     */
+    std::size_t rank0(std::size_t i) const {
+        return i - rank1(i);
+    }
+
+    /**
+     * @brief Posição do k-ésimo bit 1 (base 0). Exige k < rank1(size()).
+     */
+    std::size_t select1(std::size_t k) const;
+
+    /**
+     * @brief Posição do k-ésimo bit 0 (base 0). Exige k < rank0(size()).
+     */
+    std::size_t select0(std::size_t k) const;
+
+    std::size_t size() const {
+        return n;
+    }
+
+    /**
+     * @brief Memória ocupada pelo bitvector e pelos índices auxiliares, em bytes.
+     */
+    std::size_t memoria_bytes() const {
+        return palavras.size() * sizeof(std::uint64_t) +
+               (acumulado.size() + amostras1.size() + amostras0.size()) * sizeof(std::uint32_t);
+    }
+};
+
+/**
+ * @class WaveletMatrixCodigos
+ * @brief Wavelet Matrix sobre códigos inteiros em [0, sigma).
+ *
+ * No nível do bit b (do mais significativo para o menos), a sequência atual é particionada
+ * de forma estável: os elementos com bit b igual a 0 vêm antes dos com bit 1. O bitvector do
+ * nível registra esse bit e `zeros[nivel]` diz onde começam os uns. Toda consulta desce
+ * os níveis mapeando um intervalo [l, r) com duas chamadas de rank por nível.
+ *
+ * Todos os intervalos desta classe são semiabertos [l, r).
+ */
+class WaveletMatrixCodigos {
+private:
+    std::vector<BitVectorRankSelect> niveis; // niveis[0] corresponde ao bit mais significativo
+    std::vector<std::size_t> zeros;
+    std::size_t n;
+    int bits;
+
+    // Mapeia a posição i do nível 'nivel' para o nível seguinte, seguindo o ramo 'bit'.
+    std::size_t descer(int nivel, std::size_t i, bool bit) const {
+        return bit ? zeros[nivel] + niveis[nivel].rank1(i) : niveis[nivel].rank0(i);
+    }
+
+public:
+    WaveletMatrixCodigos() : n(0), bits(0) {}
+
+    /**
+     * @brief Constrói a matriz. Todos os códigos devem ser menores que `sigma`.
+     * @complexity Time: O(n log sigma), Space: O(n log sigma) bits.
+     */
+    WaveletMatrixCodigos(const std::vector<std::uint32_t>& codigos, std::uint32_t sigma);
+
+    /**
+     * @brief Retorna o código na posição i.
+     */
+    std::uint32_t acessar(std::size_t i) const;
+
+    /**
+     * @brief Retorna o k-ésimo menor código (base 0) em [l, r).
+     */
+    std::uint32_t k_esimo_menor(std::size_t l, std::size_t r, std::size_t k) const;
+
+    /**
+     * @brief Conta os códigos menores que `c` em [l, r).
+     */
+    std::size_t contar_menores(std::size_t l, std::size_t r, std::uint32_t c) const;
+
+    /**
+     * @brief Conta as ocorrências do código `c` em [0, i).
+     */
+    std::size_t rank(std::uint32_t c, std::size_t i) const;
+
+    /**
+     * @brief Posição da k-ésima ocorrência (base 0) do código `c`, ou `size()` se não existir.
+     */
+    std::size_t select(std::uint32_t c, std::size_t k) const;
+
+    std::size_t size() const {
+        return n;
+    }
+};
+
+/**
+ * @class WaveletMatrix
+ * @brief Estatísticas de ordem em intervalos de um array estático, em O(log sigma) por consulta.
+ *
+ * Os valores são comprimidos para códigos 0..sigma-1 preservando a ordem, de modo que o custo
+ * depende do número de valores distintos, não da magnitude deles. Para contar valores distintos,
+ * uma segunda matriz é construída sobre `anterior[i] + 1`, onde `anterior[i]` é a última posição
+ * antes de i com o mesmo valor (ou -1): os distintos em [l, r] são exatamente as posições cujo
+ * anterior é menor que l.
+ *
+ * Todos os intervalos da interface pública são fechados [l, r], como na `SegmentTree`.
+ *
+ * @tparam T Tipo dos valores; precisa de `operator<`, `operator==` e `std::hash`.
+ */
+template <typename T>
+class WaveletMatrix {
+private:
+    std::vector<T> valores; // Valores distintos em ordem crescente; o código de um valor é seu índice
+    WaveletMatrixCodigos matriz;
+    WaveletMatrixCodigos anteriores;
+
+    void verificar_intervalo(int l, int r) const {
+        if (l < 0 || r >= static_cast<int>(matriz.size()) || l > r) {
+            throw std::out_of_range("Intervalo de consulta inválido.");
+        }
+    }
+
+    // Número de códigos cujos valores são menores que x.
+    std::uint32_t codigo_limite(const T& x) const {
+        return static_cast<std::uint32_t>(std::lower_bound(valores.begin(), valores.end(), x) - valores.begin());
+    }
+
+public:
+    /**
+     * @brief Constrói as estruturas a partir de um array.
+     * @complexity Time: O(n log n) (compressão) + O(n log sigma), Space: O(n log sigma) bits.
+     */
+    explicit WaveletMatrix(const std::vector<T>& arr) : valores(arr) {
+        std::sort(valores.begin(), valores.end());
+        valores.erase(std::unique(valores.begin(), valores.end()), valores.end());
+
+        std::vector<std::uint32_t> codigos(arr.size());
+        std::vector<std::uint32_t> anterior(arr.size());
+        std::unordered_map<T, std::uint32_t> ultima_posicao; // Guarda posição + 1; 0 significa "nenhuma"
+        for (std::size_t i = 0; i < arr.size(); ++i) {
+            codigos[i] = codigo_limite(arr[i]);
+            std::uint32_t& ultima = ultima_posicao[arr[i]];
+            anterior[i] = ultima;
+            ultima = static_cast<std::uint32_t>(i + 1);
+        }
+        matriz = WaveletMatrixCodigos(codigos, static_cast<std::uint32_t>(valores.size()));
+        anteriores = WaveletMatrixCodigos(anterior, static_cast<std::uint32_t>(arr.size() + 1));
+    }
+
+    /**
+     * @brief Retorna o valor na posição i.
+     * @complexity Time: O(log sigma)
+     */
+    T acessar(int i) const {
+        verificar_intervalo(i, i);
+        return valores[matriz.acessar(i)];
+    }
+
+    /**
+     * @brief Retorna o k-ésimo menor valor (base 0) em [l, r].
+     * @complexity Time: O(log sigma)
+     */
+    T k_esimo_menor(int l, int r, int k) const {
+        verificar_intervalo(l, r);
+        if (k < 0 || k > r - l) {
+            throw std::out_of_range("k fora do intervalo.");
+        }
+        return valores[matriz.k_esimo_menor(l, r + 1, k)];
+    }
+
+    /**
+     * @brief Conta os valores estritamente menores que x em [l, r].
+     * @complexity Time: O(log sigma)
+     */
+    int contar_menores(int l, int r, const T& x) const {
+        verificar_intervalo(l, r);
+        return static_cast<int>(matriz.contar_menores(l, r + 1, codigo_limite(x)));
+    }
+
+    /**
+     * @brief Conta quantas vezes x aparece em [l, r].
+     * @complexity Time: O(log sigma)
+     */
+    int contar_ocorrencias(int l, int r, const T& x) const {
+        verificar_intervalo(l, r);
+        std::uint32_t c = codigo_limite(x);
+        if (c == valores.size() || !(valores[c] == x)) return 0;
+        return static_cast<int>(matriz.rank(c, r + 1) - matriz.rank(c, l));
+    }
+
+    /**
+     * @brief Conta os valores distintos em [l, r].
+     * @complexity Time: O(log n)
+     */
+    int contar_distintos(int l, int r) const {
+        verificar_intervalo(l, r);
+        return static_cast<int>(anteriores.contar_menores(l, r + 1, static_cast<std::uint32_t>(l + 1)));
+    }
+
+    /**
+     * @brief Retorna a posição da k-ésima ocorrência (base 0) de x no array, ou -1 se não existir.
+     * @complexity Time: O(log sigma log n)
+     */
+    int select(const T& x, int k) const {
+        std::uint32_t c = codigo_limite(x);
+        if (k < 0 || c == valores.size() || !(valores[c] == x)) return -1;
+        std::size_t pos = matriz.select(c, k);
+        return pos == matriz.size() ? -1 : static_cast<int>(pos);
+    }
+
+    int size() const {
+        return static_cast<int>(matriz.size());
+    }
+};
+
+#endif // WAVELET_TREE_HPP
@@ -0,0 +1,826 @@
+#ifndef LRU_CACHE_HPP
+#define LRU_CACHE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional> // Para std::hash
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @file lru_cache.hpp
+ * @brief Contém a implementação de um cache com capacidade medida em peso (por exemplo, bytes),
+ * expiração por TTL e contadores de acertos, falhas e despejos, com política de despejo LRU
+ * (Least Recently Used) ou W-TinyLFU, e de uma variante concorrente dividida em fragmentos.
+ *
+ * @note Como estas são classes de template, toda a implementação está neste arquivo de cabeçalho.
+ */
+
+/**
+ * @struct EstatisticasCache
+ * @brief Contadores acumulados desde a criação do cache.
+ */
+struct EstatisticasCache {
+    std::uint64_t acertos = 0;
+    std::uint64_t falhas = 0;
+    std::uint64_t despejos = 0;   // Entradas removidas para liberar capacidade
+    std::uint64_t expiracoes = 0; // Entradas descartadas por TTL vencido
+
+    double taxa_de_acerto() const {
+        std::uint64_t total = acertos + falhas;
+        return total ? static_cast<double>(acertos) / total : 0.0;
+    }
+
+    EstatisticasCache& operator+=(const EstatisticasCache& outras) {
+        acertos += outras.acertos;
+        falhas += outras.falhas;
+        despejos += outras.despejos;
+        expiracoes += outras.expiracoes;
+        return *this;
+    }
+};
+
+/**
+ * @brief Peso padrão das entradas: 1, de modo que a capacidade conta entradas.
+ *
+ * Para limitar o cache em bytes, passe um functor que retorne o tamanho da entrada, por exemplo
+ * `sizeof(Chave) + valor.size()`.
+ */
+struct PesoUnitario {
+    template <typename Chave, typename Valor>
+    std::size_t operator()(const Chave&, const Valor&) const {
+        return 1;
+    }
+};
+
+/**
+ * @brief Finalizador do MurmurHash3 (fmix64): espalha os bits de `h`.
+ *
+ * `std::hash` de inteiros é a identidade; o índice do cache usa os bits baixos e a escolha do
+ * fragmento usa os altos, então ambos precisam depender de todos os bits da chave.
+ */
+inline std::uint64_t misturar_hash(std::uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+/**
+ * @class SketchContagemMinima
+ * @brief Estimador de frequência de acessos (count-min sketch) com contadores de 4 bits e
+ * envelhecimento periódico, usado como filtro de admissão da política W-TinyLFU.
+ *
+ * Cada palavra de 64 bits guarda 16 contadores. Uma chave tem um contador em cada uma de 4
+ * linhas e a estimativa é o menor deles. As 4 palavras de uma chave ficam no mesmo bloco de 64
+ * bytes (8 palavras), de modo que cada operação toca uma só linha de cache. Os contadores
+ * saturam em 15. Depois de `10 * largura` incrementos, todos os contadores são divididos por 2,
+ * de modo que a frequência reflete o passado recente.
+ */
+class SketchContagemMinima {
+private:
+    std::vector<std::uint64_t> tabela;
+    std::size_t mascara_blocos = 0;
+    std::size_t amostras = 0;
+    std::size_t limite_amostras = 0;
+
+    // Posição do contador da linha 'linha': cada linha tem duas palavras próprias no bloco,
+    // escolhidas pelos bits 0-3 de 'h'; os bits 24-39 escolhem o contador dentro da palavra e os
+    // bits altos, o bloco.
+    std::size_t bloco(std::uint64_t h) const {
+        return ((h >> 40) & mascara_blocos) << 3;
+    }
+
+    static std::size_t palavra(std::uint64_t h, int linha) {
+        return 2 * linha + ((h >> linha) & 1);
+    }
+
+    static int deslocamento(std::uint64_t h, int linha) {
+        return static_cast<int>((h >> (24 + 4 * linha)) & 0xf) << 2;
+    }
+
+public:
+    /**
+     * @param entradas Número de entradas esperado; a tabela tem uma palavra por entrada
+     * (arredondado para potência de 2).
+     */
+    explicit SketchContagemMinima(std::size_t entradas = 16) {
+        redimensionar(entradas);
+    }
+
+    /**
+     * @brief Refaz a tabela para `entradas` entradas esperadas, zerando os contadores.
+     */
+    void redimensionar(std::size_t entradas) {
+        std::size_t largura = std::bit_ceil(std::max<std::size_t>(entradas, 16));
+        tabela.assign(largura, 0);
+        mascara_blocos = largura / 8 - 1;
+        amostras = 0;
+        limite_amostras = 10 * largura;
+    }
+
+    std::size_t largura() const {
+        return tabela.size();
+    }
+
+    /**
+     * @brief Estimativa da frequência recente do hash `h`, entre 0 e 15.
+     */
+    int frequencia(std::uint64_t h) const {
+        const std::uint64_t* b = &tabela[bloco(h)];
+        int minimo = 15;
+        for (int linha = 0; linha < 4; ++linha) {
+            int c = static_cast<int>((b[palavra(h, linha)] >> deslocamento(h, linha)) & 0xf);
+            minimo = std::min(minimo, c);
+        }
+        return minimo;
+    }
+
+    /**
+     * @brief Registra um acesso ao hash `h`.
+     */
+    void incrementar(std::uint64_t h) {
+        std::uint64_t* b = &tabela[bloco(h)];
+        bool incrementou = false;
+        for (int linha = 0; linha < 4; ++linha) {
+            std::uint64_t& w = b[palavra(h, linha)];
+            int d = deslocamento(h, linha);
+            if (((w >> d) & 0xf) != 0xf) {
+                w += std::uint64_t(1) << d;
+                incrementou = true;
+            }
+        }
+        if (incrementou && ++amostras >= limite_amostras) envelhecer();
+    }
+
+    /**
+     * @brief Divide todos os contadores por 2.
+     */
+    void envelhecer() {
+        for (std::uint64_t& w : tabela) w = (w >> 1) & 0x7777777777777777ULL;
+        amostras /= 2;
+    }
+};
+
+/**
+ * @brief Política de despejo LRU: uma única lista, despejada a partir da menos recente.
+ */
+struct PoliticaLRU {};
+
+/**
+ * @brief Política W-TinyLFU (Einziger, Friedman e Manes): resiste a varreduras e favorece chaves
+ * frequentes.
+ *
+ * - Uma janela LRU com 1% da capacidade recebe as entradas novas.
+ * - O restante é um LRU segmentado: 80% para a região protegida e o resto para a de provação.
+ * - Ao sair da janela, uma entrada entra na provação como candidata e só fica no cache se a sua
+ *   frequência estimada no `SketchContagemMinima` for maior que a da vítima, a entrada menos
+ *   recente da provação.
+ * - Um acerto na provação promove a entrada para a região protegida, e o excesso da protegida
+ *   volta para a provação.
+ *
+ * Uma varredura de chaves únicas passa só pela janela e não desloca as entradas frequentes.
+ */
+struct PoliticaWTinyLFU {
+    static constexpr std::size_t PERCENTUAL_JANELA = 1;
+    static constexpr std::size_t PERCENTUAL_PROTEGIDA = 80;
+};
+
+template <typename Chave, typename Valor, typename Hash, typename Peso, typename Relogio, typename Politica>
+class LRUCacheConcorrente;
+
+/**
+ * @class LRUCache
+ * @brief Cache com lista duplamente encadeada intrusiva e índice hash de endereçamento aberto,
+ * com despejo LRU ou W-TinyLFU escolhido em tempo de compilação.
+ *
+ * As entradas ficam em um vetor e são encadeadas por índices de 32 bits, da mais recente para a
+ * menos recente; entradas removidas vão para uma lista livre e são reaproveitadas. O índice é
+ * uma tabela de sondagem linear com ocupação de até 1/2 e remoção por deslocamento para trás
+ * (sem lápides), que guarda junto de cada posição um fragmento do hash para descartar colisões
+ * sem acessar a entrada. Depois do aquecimento, inserções, despejos e remoções não alocam
+ * memória (exceto o que os próprios tipos `Chave` e `Valor` alocarem).
+ *
+ * Quando o peso total passa da capacidade, a política escolhe as entradas despejadas. Uma
+ * entrada cujo peso sozinho excede a capacidade não é armazenada. Com W-TinyLFU, uma entrada
+ * nova também pode ser recusada pelo filtro de admissão assim que sai da janela.
+ *
+ * @tparam Chave Tipo da chave; precisa ser construível por padrão e comparável com `==`.
+ * @tparam Valor Tipo do valor; precisa ser construível por padrão.
+ * @tparam Hash Função de hash das chaves.
+ * @tparam Peso Functor `(chave, valor) -> std::size_t` com o peso de cada entrada.
+ * @tparam Relogio Relógio usado pelo TTL, no formato de `std::chrono::steady_clock`.
+ * @tparam Politica `PoliticaLRU` ou `PoliticaWTinyLFU`.
+ */
+template <typename Chave, typename Valor, typename Hash = std::hash<Chave>, typename Peso = PesoUnitario,
+          typename Relogio = std::chrono::steady_clock, typename Politica = PoliticaLRU>
+class LRUCache {
+    static_assert(std::is_same_v<Politica, PoliticaLRU> || std::is_same_v<Politica, PoliticaWTinyLFU>,
+                  "Política de despejo desconhecida.");
+
+private:
+    template <typename, typename, typename, typename, typename, typename>
+    friend class LRUCacheConcorrente;
+
+    static constexpr bool TINY_LFU = std::is_same_v<Politica, PoliticaWTinyLFU>;
+    static constexpr std::uint32_t NENHUMA = std::numeric_limits<std::uint32_t>::max();
+    static constexpr std::int64_t SEM_EXPIRACAO = std::numeric_limits<std::int64_t>::max();
+
+    // Regiões da W-TinyLFU; a política LRU usa só a primeira.
+    enum Regiao : std::uint8_t { JANELA = 0, PROVACAO = 1, PROTEGIDA = 2 };
+    static constexpr int NUM_REGIOES = TINY_LFU ? 3 : 1;
+
+    struct Entrada {
+        Chave chave{};
+        Valor valor{};
+        std::uint64_t hash = 0;
+        std::int64_t expira = SEM_EXPIRACAO; // Em nanossegundos do Relogio
+        std::size_t peso = 0;
+        std::uint32_t anterior = NENHUMA; // Mais recente
+        std::uint32_t proximo = NENHUMA;  // Menos recente; encadeia também a lista livre
+        // Bit de referência (CLOCK): marcado por leituras que não reordenam a lista, na variante
+        // concorrente, e tratado como um acerto adiado quando o despejo chega à entrada.
+        std::uint8_t referenciada = 0;
+        std::uint8_t regiao = JANELA;
+    };
+
+    struct Posicao {
+        std::uint32_t entrada = NENHUMA;
+        std::uint32_t fragmento = 0;
+    };
+
+    struct Lista {
+        std::uint32_t mais_recente = NENHUMA;
+        std::uint32_t menos_recente = NENHUMA;
+        std::size_t peso = 0;
+    };
+
+    std::vector<Entrada> entradas;
+    std::uint32_t livres = NENHUMA;
+    std::vector<Posicao> indice;
+    std::size_t mascara;
+    Lista listas[NUM_REGIOES];
+    std::size_t num = 0;
+    std::size_t peso_atual = 0;
+    std::size_t cap;
+    std::size_t cap_janela = 0;
+    std::size_t cap_protegida = 0;
+    std::chrono::nanoseconds ttl_padrao;
+    Hash funcao_hash;
+    Peso funcao_peso;
+    EstatisticasCache stats;
+    SketchContagemMinima sketch; // Só usado pela W-TinyLFU
+
+    static std::uint32_t fragmento_de(std::uint64_t h) {
+        return static_cast<std::uint32_t>(h >> 24);
+    }
+
+    static std::int64_t agora() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(Relogio::now().time_since_epoch()).count();
+    }
+
+    std::uint64_t calcular_hash(const Chave& chave) const {
+        return misturar_hash(static_cast<std::uint64_t>(funcao_hash(chave)));
+    }
+
+    bool expirada(const Entrada& e) const {
+        return e.expira != SEM_EXPIRACAO && agora() >= e.expira;
+    }
+
+    // --- Índice ---
+
+    std::uint32_t localizar(const Chave& chave, std::uint64_t h) const {
+        std::uint32_t fragmento = fragmento_de(h);
+        for (std::size_t i = h & mascara;; i = (i + 1) & mascara) {
+            const Posicao& p = indice[i];
+            if (p.entrada == NENHUMA) return NENHUMA;
+            if (p.fragmento == fragmento && entradas[p.entrada].chave == chave) return p.entrada;
+        }
+    }
+
+    void indexar(std::uint32_t id, std::uint64_t h) {
+        std::size_t i = h & mascara;
+        while (indice[i].entrada != NENHUMA) i = (i + 1) & mascara;
+        indice[i] = {id, fragmento_de(h)};
+    }
+
+    void desindexar(std::uint32_t id) {
+        std::size_t i = entradas[id].hash & mascara;
+        while (indice[i].entrada != id) i = (i + 1) & mascara;
+        // Desloca para trás as entradas seguintes do mesmo agrupamento que podem ocupar 'i'.
+        for (std::size_t j = (i + 1) & mascara; indice[j].entrada != NENHUMA; j = (j + 1) & mascara) {
+            std::size_t casa = entradas[indice[j].entrada].hash & mascara;
+            // A entrada em 'j' pode ir para 'i' se 'casa' não estiver no intervalo circular (i, j].
+            if (((j - casa) & mascara) >= ((j - i) & mascara)) {
+                indice[i] = indice[j];
+                i = j;
+            }
+        }
+        indice[i].entrada = NENHUMA;
+    }
+
+    void redimensionar_indice(std::size_t tamanho) {
+        indice.assign(tamanho, Posicao());
+        mascara = tamanho - 1;
+        for (const Lista& lista : listas) {
+            for (std::uint32_t id = lista.mais_recente; id != NENHUMA; id = entradas[id].proximo) {
+                indexar(id, entradas[id].hash);
+            }
+        }
+    }
+
+    // --- Listas de recência ---
+
+    void desligar(std::uint32_t id) {
+        Entrada& e = entradas[id];
+        Lista& lista = listas[e.regiao];
+        if (e.anterior != NENHUMA) entradas[e.anterior].proximo = e.proximo;
+        else lista.mais_recente = e.proximo;
+        if (e.proximo != NENHUMA) entradas[e.proximo].anterior = e.anterior;
+        else lista.menos_recente = e.anterior;
+        lista.peso -= e.peso;
+    }
+
+    void ligar_no_inicio(std::uint32_t id, std::uint8_t regiao) {
+        Entrada& e = entradas[id];
+        Lista& lista = listas[regiao];
+        e.regiao = regiao;
+        e.anterior = NENHUMA;
+        e.proximo = lista.mais_recente;
+        if (lista.mais_recente != NENHUMA) entradas[lista.mais_recente].anterior = id;
+        else lista.menos_recente = id;
+        lista.mais_recente = id;
+        lista.peso += e.peso;
+    }
+
+    // Move a entrada para o início da lista da região indicada.
+    void mover(std::uint32_t id, std::uint8_t regiao) {
+        if (entradas[id].regiao == regiao && listas[regiao].mais_recente == id) return;
+        desligar(id);
+        ligar_no_inicio(id, regiao);
+    }
+
+    // Aplica um acesso à entrada: torna-a a mais recente e, na W-TinyLFU, conta a frequência e
+    // promove da provação para a protegida, devolvendo o excesso da protegida à provação.
+    void registrar_acesso(std::uint32_t id) {
+        if constexpr (TINY_LFU) {
+            sketch.incrementar(entradas[id].hash);
+            if (entradas[id].regiao != PROVACAO) {
+                mover(id, entradas[id].regiao);
+                return;
+            }
+            mover(id, PROTEGIDA);
+            while (listas[PROTEGIDA].peso > cap_protegida && listas[PROTEGIDA].menos_recente != id) {
+                mover(listas[PROTEGIDA].menos_recente, PROVACAO);
+            }
+        } else {
+            mover(id, JANELA);
+        }
+    }
+
+    // --- Entradas ---
+
+    std::uint32_t nova_entrada() {
+        if (livres != NENHUMA) {
+            std::uint32_t id = livres;
+            livres = entradas[id].proximo;
+            return id;
+        }
+        if (entradas.size() >= NENHUMA) throw std::length_error("O cache excedeu o número máximo de entradas.");
+        entradas.emplace_back();
+        return static_cast<std::uint32_t>(entradas.size() - 1);
+    }
+
+    void remover_entrada(std::uint32_t id) {
+        desindexar(id);
+        desligar(id);
+        Entrada& e = entradas[id];
+        peso_atual -= e.peso;
+        --num;
+        // Libera já os recursos da chave e do valor, em vez de esperar a reutilização.
+        e.chave = Chave();
+        e.valor = Valor();
+        e.referenciada = 0;
+        e.proximo = livres;
+        livres = id;
+    }
+
+    // Consome o bit de referência da entrada, aplicando o acesso adiado. Retorna se estava marcado.
+    bool consumir_referencia(std::uint32_t id) {
+        if (!entradas[id].referenciada) return false;
+        entradas[id].referenciada = 0;
+        registrar_acesso(id);
+        return true;
+    }
+
+    void despejar(std::uint32_t id) {
+        remover_entrada(id);
+        ++stats.despejos;
+    }
+
+    // Despeja até o peso total caber na capacidade.
+    void despejar_excesso() {
+        if constexpr (TINY_LFU) {
+            // O excesso da janela passa para a provação; as entradas movidas são as candidatas,
+            // da mais antiga ('candidata') para a mais nova.
+            std::uint32_t candidata = NENHUMA;
+            while (listas[JANELA].peso > cap_janela) {
+                std::uint32_t id = listas[JANELA].menos_recente;
+                if (consumir_referencia(id)) continue;
+                mover(id, PROVACAO);
+                if (candidata == NENHUMA) candidata = id;
+            }
+            while (peso_atual > cap) {
+                std::uint32_t vitima = listas[PROVACAO].menos_recente;
+                if (vitima == NENHUMA) vitima = listas[PROTEGIDA].menos_recente;
+                if (vitima == NENHUMA) vitima = listas[JANELA].menos_recente;
+                if (entradas[vitima].referenciada) {
+                    if (vitima == candidata) candidata = NENHUMA;
+                    consumir_referencia(vitima);
+                    continue;
+                }
+                if (candidata == NENHUMA || candidata == vitima) {
+                    if (candidata == vitima) candidata = entradas[candidata].anterior;
+                    despejar(vitima);
+                } else if (sketch.frequencia(entradas[candidata].hash) > sketch.frequencia(entradas[vitima].hash)) {
+                    despejar(vitima);
+                } else {
+                    // A candidata é recusada; a próxima é a que entrou logo depois dela.
+                    std::uint32_t proxima = entradas[candidata].anterior;
+                    despejar(candidata);
+                    candidata = proxima;
+                }
+            }
+        } else {
+            while (peso_atual > cap) {
+                std::uint32_t vitima = listas[JANELA].menos_recente;
+                if (!consumir_referencia(vitima)) despejar(vitima);
+            }
+        }
+    }
+
+    bool buscar_com_hash(const Chave& chave, Valor& valor, std::uint64_t h) {
+        std::uint32_t id = localizar(chave, h);
+        if (id == NENHUMA) {
+            if constexpr (TINY_LFU) sketch.incrementar(h);
+            ++stats.falhas;
+            return false;
+        }
+        if (expirada(entradas[id])) {
+            remover_entrada(id);
+            if constexpr (TINY_LFU) sketch.incrementar(h);
+            ++stats.expiracoes;
+            ++stats.falhas;
+            return false;
+        }
+        registrar_acesso(id);
+        valor = entradas[id].valor;
+        ++stats.acertos;
+        return true;
+    }
+
+    bool inserir_com_hash(const Chave& chave, Valor&& valor, std::chrono::nanoseconds ttl, std::uint64_t h) {
+        std::size_t peso = funcao_peso(chave, valor);
+        std::uint32_t id = localizar(chave, h);
+        if (peso > cap) {
+            // O valor antigo também deixa de valer.
+            if (id != NENHUMA) remover_entrada(id);
+            return false;
+        }
+        std::int64_t expira = ttl > std::chrono::nanoseconds::zero() ? agora() + ttl.count() : SEM_EXPIRACAO;
+        if (id != NENHUMA) {
+            Entrada& e = entradas[id];
+            // Religa a entrada para que o peso da sua lista seja atualizado.
+            std::uint8_t regiao = e.regiao;
+            desligar(id);
+            peso_atual = peso_atual - e.peso + peso;
+            e.valor = std::move(valor);
+            e.peso = peso;
+            e.expira = expira;
+            ligar_no_inicio(id, regiao);
+            registrar_acesso(id);
+        } else {
+            if (2 * (num + 1) > indice.size()) redimensionar_indice(2 * indice.size());
+            if constexpr (TINY_LFU) {
+                // Uma palavra do sketch por entrada; crescer zera as frequências.
+                if (num + 1 > sketch.largura()) sketch.redimensionar(2 * sketch.largura());
+                sketch.incrementar(h);
+            }
+            id = nova_entrada();
+            Entrada& e = entradas[id];
+            e.chave = chave;
+            e.valor = std::move(valor);
+            e.hash = h;
+            e.expira = expira;
+            e.peso = peso;
+            indexar(id, h);
+            ligar_no_inicio(id, JANELA);
+            ++num;
+            peso_atual += peso;
+        }
+        despejar_excesso();
+        return true;
+    }
+
+    bool remover_com_hash(const Chave& chave, std::uint64_t h) {
+        std::uint32_t id = localizar(chave, h);
+        if (id == NENHUMA) return false;
+        remover_entrada(id);
+        return true;
+    }
+
+public:
+    /**
+     * @brief Cria um cache vazio.
+     * @param capacidade Peso total máximo das entradas (número de entradas, com `PesoUnitario`).
+     * @param ttl Tempo de vida padrão das entradas; zero significa que não expiram.
+     * @throws std::invalid_argument se a capacidade for zero.
+     */
+    explicit LRUCache(std::size_t capacidade, std::chrono::nanoseconds ttl = std::chrono::nanoseconds::zero(),
+                      Hash hash = Hash(), Peso peso = Peso())
+        : cap(capacidade), ttl_padrao(ttl), funcao_hash(std::move(hash)), funcao_peso(std::move(peso)) {
+        if (capacidade == 0) throw std::invalid_argument("A capacidade do cache deve ser positiva.");
+        indice.assign(16, Posicao());
+        mascara = indice.size() - 1;
+        if constexpr (TINY_LFU) {
+            cap_janela = std::max<std::size_t>(1, capacidade * Politica::PERCENTUAL_JANELA / 100);
+            cap_protegida = (capacidade - std::min(cap_janela, capacidade)) * Politica::PERCENTUAL_PROTEGIDA / 100;
+        }
+    }
+
+    /**
+     * @brief Busca a chave; em caso de acerto, copia o valor para `valor` e registra o acesso.
+     * Uma entrada expirada é removida e conta como falha.
+     * @complexity Time: O(1) esperado
+     */
+    bool buscar(const Chave& chave, Valor& valor) {
+        return buscar_com_hash(chave, valor, calcular_hash(chave));
+    }
+
+    /**
+     * @brief Verifica se a chave está no cache e não expirou, sem registrar acesso nem alterar os
+     * contadores.
+     */
+    bool contem(const Chave& chave) const {
+        std::uint32_t id = localizar(chave, calcular_hash(chave));
+        return id != NENHUMA && !expirada(entradas[id]);
+    }
+
+    /**
+     * @brief Insere ou atualiza a entrada, registrando o acesso, e despeja entradas até o peso
+     * total caber na capacidade.
+     * @param ttl Tempo de vida desta entrada; zero significa que não expira.
+     * @return false se o peso da entrada sozinho exceder a capacidade; nesse caso ela não é
+     * armazenada e um valor antigo para a mesma chave é removido.
+     * @complexity Time: O(1) amortizado
+     */
+    bool inserir(const Chave& chave, Valor valor, std::chrono::nanoseconds ttl) {
+        return inserir_com_hash(chave, std::move(valor), ttl, calcular_hash(chave));
+    }
+
+    bool inserir(const Chave& chave, Valor valor) {
+        return inserir(chave, std::move(valor), ttl_padrao);
+    }
+
+    /**
+     * @brief Remove a entrada da chave, se existir.
+     */
+    bool remover(const Chave& chave) {
+        return remover_com_hash(chave, calcular_hash(chave));
+    }
+
+    /**
+     * @brief Remove todas as entradas, mantendo a memória reservada e os contadores.
+     */
+    void limpar() {
+        for (const Lista& lista : listas) {
+            while (lista.mais_recente != NENHUMA) remover_entrada(lista.mais_recente);
+        }
+    }
+
+    std::size_t tamanho() const {
+        return num;
+    }
+
+    bool vazio() const {
+        return num == 0;
+    }
+
+    std::size_t peso_total() const {
+        return peso_atual;
+    }
+
+    std::size_t capacidade() const {
+        return cap;
+    }
+
+    EstatisticasCache estatisticas() const {
+        return stats;
+    }
+};
+
+/**
+ * @brief Cache com a política W-TinyLFU; veja `PoliticaWTinyLFU`.
+ */
+template <typename Chave, typename Valor, typename Hash = std::hash<Chave>, typename Peso = PesoUnitario,
+          typename Relogio = std::chrono::steady_clock>
+using CacheWTinyLFU = LRUCache<Chave, Valor, Hash, Peso, Relogio, PoliticaWTinyLFU>;
+
+/**
+ * @class LRUCacheConcorrente
+ * @brief Cache para várias threads, dividido em fragmentos independentes.
+ *
+ * A chave é direcionada a um fragmento pelos bits altos do seu hash, e cada fragmento é um
+ * `LRUCache` com uma fração da capacidade protegido por um `std::shared_mutex`. Um acerto só
+ * precisa da trava compartilhada: em vez de reordenar as listas, a leitura marca atomicamente o
+ * bit de referência da entrada (CLOCK), e o despejo, que roda com a trava exclusiva, aplica o
+ * acesso adiado quando chega a uma entrada marcada (uma segunda chance, no LRU; a contagem de
+ * frequência e a promoção, na W-TinyLFU). Assim, leituras concorrentes do mesmo fragmento não se
+ * serializam. Inserções, remoções e a limpeza de entradas expiradas usam a trava exclusiva.
+ *
+ * @tparam Chave, Valor, Hash, Peso, Relogio, Politica Como em `LRUCache`.
+ */
+template <typename Chave, typename Valor, typename Hash = std::hash<Chave>, typename Peso = PesoUnitario,
+          typename Relogio = std::chrono::steady_clock, typename Politica = PoliticaLRU>
+class LRUCacheConcorrente {
+private:
+    using Cache = LRUCache<Chave, Valor, Hash, Peso, Relogio, Politica>;
+
+    struct alignas(64) Fragmento {
+        mutable std::shared_mutex trava;
+        Cache cache;
+        // Acertos e falhas vistos com a trava compartilhada; os demais ficam no próprio cache.
+        std::atomic<std::uint64_t> acertos{0};
+        std::atomic<std::uint64_t> falhas{0};
+
+        Fragmento(std::size_t capacidade, std::chrono::nanoseconds ttl, const Hash& hash, const Peso& peso)
+            : cache(capacidade, ttl, hash, peso) {}
+    };
+
+    std::vector<std::unique_ptr<Fragmento>> fragmentos;
+    int deslocamento; // 64 - log2(número de fragmentos)
+    Hash funcao_hash;
+
+    std::uint64_t calcular_hash(const Chave& chave) const {
+        return misturar_hash(static_cast<std::uint64_t>(funcao_hash(chave)));
+    }
+
+    Fragmento& fragmento_de(std::uint64_t h) const {
+        return *fragmentos[deslocamento == 64 ? 0 : h >> deslocamento];
+    }
+
+public:
+    /**
+     * @brief Cria um cache vazio.
+     * @param capacidade Peso total máximo, dividido igualmente entre os fragmentos.
+     * @param num_fragmentos Número de fragmentos, arredondado para potência de 2; 0 usa quatro
+     * vezes `std::thread::hardware_concurrency()`.
+     * @param ttl Tempo de vida padrão das entradas; zero significa que não expiram.
+     * @throws std::invalid_argument se a capacidade for zero.
+     */
+    explicit LRUCacheConcorrente(std::size_t capacidade, std::size_t num_fragmentos = 0,
+                                 std::chrono::nanoseconds ttl = std::chrono::nanoseconds::zero(), Hash hash = Hash(),
+                                 Peso peso = Peso())
+        : funcao_hash(hash) {
+        if (capacidade == 0) throw std::invalid_argument("A capacidade do cache deve ser positiva.");
+        if (num_fragmentos == 0) num_fragmentos = 4 * std::max(1u, std::thread::hardware_concurrency());
+        num_fragmentos = std::bit_ceil(std::min(num_fragmentos, capacidade));
+        if (num_fragmentos > capacidade) num_fragmentos /= 2;
+        deslocamento = 64 - std::countr_zero(num_fragmentos);
+        std::size_t por_fragmento = (capacidade + num_fragmentos - 1) / num_fragmentos;
+        for (std::size_t i = 0; i < num_fragmentos; ++i) {
+            fragmentos.push_back(std::make_unique<Fragmento>(por_fragmento, ttl, hash, peso));
+        }
+    }
+
+    /**
+     * @brief Busca a chave, copiando o valor para `valor` em caso de acerto.
+     * @complexity Time: O(1) esperado, com a trava compartilhada do fragmento.
+     */
+    bool buscar(const Chave& chave, Valor& valor) {
+        std::uint64_t h = calcular_hash(chave);
+        Fragmento& f = fragmento_de(h);
+        {
+            std::shared_lock<std::shared_mutex> trava(f.trava);
+            std::uint32_t id = f.cache.localizar(chave, h);
+            if (id == Cache::NENHUMA) {
+                f.falhas.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            auto& e = f.cache.entradas[id];
+            if (!f.cache.expirada(e)) {
+                std::atomic_ref<std::uint8_t> referenciada(e.referenciada);
+                // Evita escrever na linha de cache de uma entrada quente que já está marcada.
+                if (!referenciada.load(std::memory_order_relaxed)) referenciada.store(1, std::memory_order_relaxed);
+                valor = e.valor;
+                f.acertos.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+        // Entrada expirada: remove com a trava exclusiva (se ainda estiver lá).
+        std::unique_lock<std::shared_mutex> trava(f.trava);
+        return f.cache.buscar_com_hash(chave, valor, h);
+    }
+
+    /**
+     * @brief Verifica se a chave está no cache e não expirou, sem marcar a entrada.
+     */
+    bool contem(const Chave& chave) const {
+        std::uint64_t h = calcular_hash(chave);
+        Fragmento& f = fragmento_de(h);
+        std::shared_lock<std::shared_mutex> trava(f.trava);
+        std::uint32_t id = f.cache.localizar(chave, h);
+        return id != Cache::NENHUMA && !f.cache.expirada(f.cache.entradas[id]);
+    }
+
+    /**
+     * @brief Insere ou atualiza a entrada; veja `LRUCache::inserir`.
+     */
+    bool inserir(const Chave& chave, Valor valor, std::chrono::nanoseconds ttl) {
+        std::uint64_t h = calcular_hash(chave);
+        Fragmento& f = fragmento_de(h);
+        std::unique_lock<std::shared_mutex> trava(f.trava);
+        return f.cache.inserir_com_hash(chave, std::move(valor), ttl, h);
+    }
+
+    bool inserir(const Chave& chave, Valor valor) {
+        std::uint64_t h = calcular_hash(chave);
+        Fragmento& f = fragmento_de(h);
+        std::unique_lock<std::shared_mutex> trava(f.trava);
+        return f.cache.inserir_com_hash(chave, std::move(valor), f.cache.ttl_padrao, h);
+    }
+
+    bool remover(const Chave& chave) {
+        std::uint64_t h = calcular_hash(chave);
+        Fragmento& f = fragmento_de(h);
+        std::unique_lock<std::shared_mutex> trava(f.trava);
+        return f.cache.remover_com_hash(chave, h);
+    }
+
+    void limpar() {
+        for (auto& f : fragmentos) {
+            std::unique_lock<std::shared_mutex> trava(f->trava);
+            f->cache.limpar();
+        }
+    }
+
+    /**
+     * @brief Número de entradas. Com outras threads alterando o cache, é apenas uma aproximação.
+     */
+    std::size_t tamanho() const {
+        std::size_t total = 0;
+        for (const auto& f : fragmentos) {
+            std::shared_lock<std::shared_mutex> trava(f->trava);
+            total += f->cache.tamanho();
+        }
+        return total;
+    }
+
+    std::size_t peso_total() const {
+        std::size_t total = 0;
+        for (const auto& f : fragmentos) {
+            std::shared_lock<std::shared_mutex> trava(f->trava);
+            total += f->cache.peso_total();
+        }
+        return total;
+    }
+
+    std::size_t num_fragmentos() const {
+        return fragmentos.size();
+    }
+
+    /**
+     * @brief Soma dos contadores de todos os fragmentos.
+     */
+    EstatisticasCache estatisticas() const {
+        EstatisticasCache total;
+        for (const auto& f : fragmentos) {
+            std::shared_lock<std::shared_mutex> trava(f->trava);
+            total += f->cache.estatisticas();
+            total.acertos += f->acertos.load(std::memory_order_relaxed);
+            total.falhas += f->falhas.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+};
+
+/**
+ * @brief Cache concorrente com a política W-TinyLFU em cada fragmento.
+ */
+template <typename Chave, typename Valor, typename Hash = std::hash<Chave>, typename Peso = PesoUnitario,
+          typename Relogio = std::chrono::steady_clock>
+using CacheWTinyLFUConcorrente = LRUCacheConcorrente<Chave, Valor, Hash, Peso, Relogio, PoliticaWTinyLFU>;
+
+#endif // LRU_CACHE_HPP
@@ -1,14 +1,113 @@
 #ifndef RABIN_KARP_HPP
 #define RABIN_KARP_HPP
 
+#include <cstdint>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 /**
  * @file rabin_karp.hpp
- * @brief Contém a implementação do algoritmo Rabin-Karp para busca de padrões em texto.
+ * @brief Contém a implementação do algoritmo Rabin-Karp para busca de padrões em texto: a busca
+ * de um padrão, a de vários padrões de mesmo comprimento numa única passada e um buscador que
+ * recebe o texto em pedaços (um fluxo de logs, por exemplo) sem perder ocorrências que cruzem
+ * a fronteira entre dois pedaços.
  */
 
+// Módulo do hash: o primo de Mersenne 2^61 - 1. Com ele, a redução de um produto de 122 bits é
+// uma soma da metade alta com a baixa, e duas janelas diferentes colidem com probabilidade de
+// cerca de P / 2^61 para uma base sorteada.
+constexpr std::uint64_t RABIN_KARP_MODULO = (std::uint64_t(1) << 61) - 1;
+
+/**
+ * @struct OcorrenciaPadrao
+ * @brief Uma ocorrência: a posição (base 0) em que começa no texto e o índice do padrão na lista
+ * passada ao buscador.
+ */
+struct OcorrenciaPadrao {
+    std::uint64_t posicao;
+    std::size_t padrao;
+
+    bool operator==(const OcorrenciaPadrao&) const = default;
+};
+
+/**
+ * @class RabinKarpFluxo
+ * @brief Busca um ou mais padrões de mesmo comprimento P num texto recebido em pedaços de
+ * qualquer tamanho.
+ *
+ * Guarda entre uma chamada e outra o hash da janela atual e os últimos P caracteres vistos, de
+ * modo que uma ocorrência que comece num pedaço e termine no seguinte é encontrada normalmente,
+ * e as posições são contadas desde o início do fluxo. Cada janela custa uma multiplicação modular;
+ * com vários padrões, o hash passa antes por um filtro de bits e só então pela tabela hash dos
+ * padrões. Toda coincidência de hash é confirmada caractere a caractere.
+ *
+ * A base do hash é sorteada uma vez por processo, para que nenhuma entrada preparada de antemão
+ * provoque colisões em massa.
+ */
+class RabinKarpFluxo {
+public:
+    /**
+     * @brief Prepara a busca de um padrão.
+     * @throws std::invalid_argument se o padrão for vazio.
+     */
+    explicit RabinKarpFluxo(const std::string& padrao);
+
+    /**
+     * @brief Prepara a busca de vários padrões, todos do mesmo comprimento. Padrões repetidos
+     * são relatados separadamente, cada um com o seu índice.
+     * @throws std::invalid_argument se a lista for vazia, se algum padrão for vazio ou se os
+     * comprimentos forem diferentes.
+     * @complexity Time: O(k P) para k padrões; Space: O(k P)
+     */
+    explicit RabinKarpFluxo(const std::vector<std::string>& padroes);
+
+    /**
+     * @brief Processa o próximo pedaço do texto e acrescenta a `saida` as ocorrências que
+     * terminam nele, em ordem de posição (e de índice do padrão, na mesma posição).
+     * @complexity Time: O(n + z P) esperado, para um pedaço de n caracteres e z ocorrências.
+     */
+    void alimentar(std::string_view pedaco, std::vector<OcorrenciaPadrao>& saida);
+
+    /**
+     * @brief Como a outra sobrecarga, mas retorna as ocorrências num vetor novo.
+     */
+    std::vector<OcorrenciaPadrao> alimentar(std::string_view pedaco) {
+        std::vector<OcorrenciaPadrao> saida;
+        alimentar(pedaco, saida);
+        return saida;
+    }
+
+    /**
+     * @brief Número de caracteres processados desde a construção ou o último `reiniciar`.
+     */
+    std::uint64_t processados() const {
+        return total;
+    }
+
+    /**
+     * @brief Volta ao início de um fluxo novo, mantendo os padrões.
+     */
+    void reiniciar();
+
+private:
+    std::vector<std::string> padroes;
+    std::size_t m; // Comprimento comum dos padrões
+    std::uint64_t base;
+    std::uint64_t remover[256]; // remover[c] = p - (c * base^(m - 1) mod p): somado, tira c da janela
+    std::unordered_map<std::uint64_t, std::vector<std::size_t>> por_hash;
+    std::vector<std::uint64_t> filtro; // Um bit por valor de (hash & mascara_filtro)
+    std::uint64_t mascara_filtro;
+    std::uint64_t hash_unico; // Com um só hash distinto, o filtro e a tabela são dispensados
+
+    std::uint64_t hash_janela; // Parcialmente reduzido: menor que 2^61 + 2^9
+    std::string cauda; // Os últimos min(m, total) caracteres antes do pedaço atual
+    std::uint64_t total;
+
+    bool confere(const std::string& padrao, std::string_view pedaco, std::size_t fim) const;
+};
+
 /**
  * @brief Encontra todas as ocorrências de um padrão em um texto usando o algoritmo Rabin-Karp.
  *
@@ -18,6 +117,8 @@
  * para confirmar a correspondência e descartar colisões de hash (falsos positivos).
  * A eficiência do algoritmo vem do uso de uma técnica de "rolling hash", que permite
  * calcular o hash da próxima janela em tempo constante, O(1), a partir da janela anterior.
+ * O hash é módulo 2^61 - 1, então colisões são raríssimas e quase toda verificação é de uma
+ * ocorrência verdadeira.
  *
  * @param texto A string na qual a busca será realizada.
  * @param padrao A string padrão a ser procurada.
@@ -26,11 +127,21 @@
  *
  * @complexity
  * - Time:
- * - Average/Best Case: O(T + P), onde T é o comprimento do texto e P é o comprimento do padrão.
- * - Worst Case: O(T * P), ocorre em caso de múltiplas colisões de hash (spurious hits).
- * - Space: O(k), onde k é o número de ocorrências encontradas para armazenar o resultado.
- * O espaço auxiliar do algoritmo em si é O(1).
+ * - Average/Best Case: O(T + P + z P), onde T é o comprimento do texto, P o do padrão e z o
+ * número de ocorrências.
+ * - Worst Case: O(T * P), só quando o padrão ocorre em quase todas as posições.
+ * - Space: O(z) para armazenar o resultado; o espaço auxiliar do algoritmo em si é O(P).
  */
 std::vector<int> rabin_karp(const std::string& texto, const std::string& padrao);
 
-#endif // RABIN_KARP_HPP
\ No newline at end of file
+/**
+ * @brief Encontra, numa única passada pelo texto, todas as ocorrências de vários padrões de
+ * mesmo comprimento.
+ * @return As ocorrências em ordem de posição (e de índice do padrão, na mesma posição).
+ * @throws std::invalid_argument se a lista for vazia, se algum padrão for vazio ou se os
+ * comprimentos forem diferentes.
+ * @complexity Time: O(T + k P + z P) esperado, para k padrões; Space: O(k P + z)
+ */
+std::vector<OcorrenciaPadrao> rabin_karp_multiplo(const std::string& texto, const std::vector<std::string>& padroes);
+
+#endif // RABIN_KARP_HPP
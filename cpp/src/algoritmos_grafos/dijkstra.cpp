@@ -1,4 +1,5 @@
 #include "algoritmos_grafos/dijkstra.hpp"
+#include "estruturas_dados/heap.hpp"
 
 std::vector<long long> dijkstra(const GrafoPonderado& grafo, int origem) {
     int V = grafo.size();
@@ -7,25 +8,18 @@ std::vector<long long> dijkstra(const GrafoPonderado& grafo, int origem) {
     const long long INF = std::numeric_limits<long long>::max();
     std::vector<long long> dist(V, INF);
 
-    // Fila de prioridade (min-heap) para armazenar pares {distância, vértice}
-    // std::greater torna a fila uma min-heap.
-    using ParDistVertice = std::pair<long long, int>;
-    std::priority_queue<ParDistVertice, std::vector<ParDistVertice>, std::greater<ParDistVertice>> pq;
+    // Heap 4-ário indexado por vértice: cada vértice aparece no máximo uma vez e, quando um
+    // caminho melhor é encontrado, sua chave é diminuída no lugar (decrease-key), em vez de
+    // empilhar uma entrada duplicada que depois teria de ser descartada.
+    HeapIndexado<long long, 4> heap(V);
 
-    // Inicializa a distância da origem como 0 e a insere na fila.
+    // Inicializa a distância da origem como 0 e a insere no heap.
     dist[origem] = 0;
-    pq.push({0, origem});
+    heap.push(origem, 0);
 
-    while (!pq.empty()) {
-        // Extrai o vértice com a menor distância da fila.
-        long long d_u = pq.top().first;
-        int u = pq.top().second;
-        pq.pop();
-
-        // Otimização: se já encontramos um caminho mais curto para 'u', ignoramos.
-        if (d_u > dist[u]) {
-            continue;
-        }
+    while (!heap.empty()) {
+        // Extrai o vértice com a menor distância; ela já é definitiva.
+        int u = heap.pop();
 
         // Itera sobre todos os vizinhos 'v' de 'u'.
         for (const auto& aresta : grafo[u]) {
@@ -34,9 +28,10 @@ std::vector<long long> dijkstra(const GrafoPonderado& grafo, int origem) {
 
             // Relaxamento da aresta: se um caminho mais curto para 'v' for encontrado...
             if (dist[u] + peso < dist[v]) {
-                // ...atualiza a distância e insere na fila.
+                // ...atualiza a distância e insere 'v' no heap ou melhora a sua chave.
                 dist[v] = dist[u] + peso;
-                pq.push({dist[v], v});
+                if (heap.contem(v)) heap.decrease_key(v, dist[v]);
+                else heap.push(v, dist[v]);
             }
         }
     }
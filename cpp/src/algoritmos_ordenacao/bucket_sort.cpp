@@ -0,0 +1,7 @@
+/**
+ * @file bucket_sort.cpp
+ * @brief Arquivo de implementação para o bucket_sort.
+ *
+ * @note Como bucket_sort é uma função de template, toda a sua implementação está no arquivo de
+ * cabeçalho (bucket_sort.hpp).
+ */
\ No newline at end of file
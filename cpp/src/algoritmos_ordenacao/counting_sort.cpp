@@ -0,0 +1,7 @@
+/**
+ * @file counting_sort.cpp
+ * @brief Arquivo de implementação para o counting_sort.
+ *
+ * @note Como counting_sort é uma função de template, toda a sua implementação está no arquivo de
+ * cabeçalho (counting_sort.hpp).
+ */
\ No newline at end of file
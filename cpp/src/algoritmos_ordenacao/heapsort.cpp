@@ -0,0 +1,7 @@
+/**
+ * @file heapsort.cpp
+ * @brief Arquivo de implementação para o Heapsort.
+ *
+ * @note Como heapsort é uma função de template, toda a sua implementação está no arquivo de
+ * cabeçalho (heapsort.hpp).
+ */
\ No newline at end of file
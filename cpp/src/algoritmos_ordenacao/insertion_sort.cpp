@@ -0,0 +1,7 @@
+/**
+ * @file insertion_sort.cpp
+ * @brief Arquivo de implementação para o Insertion Sort.
+ *
+ * @note Como insertion_sort é uma função de template, toda a sua implementação está no arquivo de
+ * cabeçalho (insertion_sort.hpp).
+ */
\ No newline at end of file
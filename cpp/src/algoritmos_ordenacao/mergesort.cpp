@@ -0,0 +1,7 @@
+/**
+ * @file mergesort.cpp
+ * @brief Arquivo de implementação para o Mergesort.
+ *
+ * @note Como mergesort e as suas variantes são funções de template, toda a sua implementação está
+ * no arquivo de cabeçalho (mergesort.hpp).
+ */
\ No newline at end of file
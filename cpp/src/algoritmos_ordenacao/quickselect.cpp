@@ -0,0 +1,7 @@
+/**
+ * @file quickselect.cpp
+ * @brief Arquivo de implementação para o Quickselect.
+ *
+ * @note Como quickselect e as suas variantes são funções de template, toda a sua implementação
+ * está no arquivo de cabeçalho (quickselect.hpp).
+ */
\ No newline at end of file
@@ -0,0 +1,7 @@
+/**
+ * @file quicksort.cpp
+ * @brief Arquivo de implementação para o Quicksort.
+ *
+ * @note Como quicksort e as suas variantes são funções de template, toda a sua implementação está
+ * no arquivo de cabeçalho (quicksort.hpp).
+ */
\ No newline at end of file
@@ -0,0 +1,7 @@
+/**
+ * @file radix_sort.cpp
+ * @brief Arquivo de implementação para o Radix Sort.
+ *
+ * @note Como radix_sort e as suas variantes são funções de template, toda a sua implementação está
+ * no arquivo de cabeçalho (radix_sort.hpp).
+ */
\ No newline at end of file
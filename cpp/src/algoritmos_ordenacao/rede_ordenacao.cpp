@@ -0,0 +1,7 @@
+/**
+ * @file rede_ordenacao.cpp
+ * @brief Arquivo de implementação para as redes de ordenação.
+ *
+ * @note Como ordenar_rede e ordenar_pequeno são funções de template, toda a sua implementação está
+ * no arquivo de cabeçalho (rede_ordenacao.hpp).
+ */
\ No newline at end of file
@@ -0,0 +1,413 @@
+/**
+ * @file b_tree.cpp
+ * @brief Arquivo de implementação para a B-tree em disco (`BTreeEmDisco`): abertura e mapeamento
+ * do arquivo, metas duplicadas com soma de verificação, alocação de páginas com lista de livres,
+ * cópia na escrita e confirmação das transações.
+ *
+ * @note Como BPlusTree é uma classe de template, toda a sua implementação está no arquivo
+ * de cabeçalho (b_tree.hpp).
+ */
+
+#include "estruturas_dados/b_tree.hpp"
+#include <algorithm>
+#include <cstddef> // Para offsetof
+#include <cstdint> // Para SIZE_MAX
+#include <cstring>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define BTREE_DISCO_POSIX 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static constexpr std::uint64_t MAGICO = 0x4254524545445331ULL; // "BTREEDS1"
+static constexpr std::uint32_t TIPO_LISTA_LIVRE = 3;
+static constexpr std::uint64_t PRIMEIRA_PAGINA_DADOS = 2; // Páginas 0 e 1 são as metas
+
+// Superbloco gravado nas páginas 0 e 1, alternadamente.
+struct MetaBTreeDisco {
+    std::uint64_t magico;
+    std::uint64_t geracao;
+    std::uint64_t raiz;
+    std::uint64_t num_paginas;
+    std::uint64_t lista_livre; // Primeira página da lista de livres, ou 0
+    std::uint64_t num_elementos;
+    std::uint64_t niveis;
+    std::uint64_t soma;        // FNV-1a dos campos anteriores
+};
+
+// Página da lista de livres: uma lista encadeada de páginas, cada uma com vários identificadores.
+struct PaginaListaLivre {
+    std::uint32_t tipo;
+    std::uint32_t num;
+    std::uint64_t proxima;
+    std::uint64_t ids[(BTreeEmDisco::TAMANHO_PAGINA - 16) / sizeof(std::uint64_t)];
+};
+
+static constexpr std::size_t IDS_POR_PAGINA = sizeof(PaginaListaLivre::ids) / sizeof(std::uint64_t);
+
+static std::uint64_t soma_verificacao(const MetaBTreeDisco& meta) {
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&meta);
+    std::uint64_t h = 1469598103934665603ULL;
+    for (std::size_t i = 0; i < offsetof(MetaBTreeDisco, soma); ++i) {
+        h = (h ^ bytes[i]) * 1099511628211ULL;
+    }
+    return h;
+}
+
+static const MetaBTreeDisco* meta_valida(const unsigned char* pagina) {
+    const MetaBTreeDisco* meta = reinterpret_cast<const MetaBTreeDisco*>(pagina);
+    if (meta->magico != MAGICO || meta->soma != soma_verificacao(*meta)) return nullptr;
+    return meta;
+}
+
+static std::size_t tamanho_mapa_valido(std::uint64_t tamanho) {
+    if (tamanho > SIZE_MAX) {
+        throw std::invalid_argument("O tamanho máximo do mapeamento não cabe no espaço de endereçamento.");
+    }
+    return static_cast<std::size_t>(tamanho);
+}
+
+BTreeEmDisco::BTreeEmDisco(const std::string& caminho, std::uint64_t tamanho_maximo_mapa)
+    : descritor(-1), base(nullptr), tamanho_mapa(tamanho_mapa_valido(tamanho_maximo_mapa)), paginas_arquivo(0),
+      geracao(0), raiz(0), num_paginas(0), num_elementos(0), niveis(1), alterada(false), niveis_fixados(0) {
+    abrir(caminho);
+}
+
+BTreeEmDisco::~BTreeEmDisco() {
+    // Sem confirmar(): as páginas da transação em andamento nunca são apontadas por uma meta, e o
+    // arquivo fica na última versão confirmada.
+#ifdef BTREE_DISCO_POSIX
+    for (std::uint64_t pagina : paginas_fixadas) munlock(endereco(pagina), TAMANHO_PAGINA);
+    munmap(base, tamanho_mapa);
+    close(descritor);
+#endif
+}
+
+void BTreeEmDisco::abrir(const std::string& caminho) {
+#ifdef BTREE_DISCO_POSIX
+    descritor = open(caminho.c_str(), O_RDWR | O_CREAT, 0644);
+    if (descritor < 0) {
+        throw std::runtime_error("Não foi possível abrir o arquivo da B-tree.");
+    }
+    struct stat info;
+    void* mapa = MAP_FAILED;
+    if (fstat(descritor, &info) == 0 && static_cast<std::uint64_t>(info.st_size) <= tamanho_mapa) {
+        // Reserva todo o espaço de uma vez: o arquivo cresce por baixo do mapeamento sem movê-lo.
+        mapa = mmap(nullptr, tamanho_mapa, PROT_READ | PROT_WRITE, MAP_SHARED, descritor, 0);
+    }
+    if (mapa == MAP_FAILED) {
+        close(descritor);
+        throw std::runtime_error("Não foi possível mapear o arquivo da B-tree.");
+    }
+    base = static_cast<unsigned char*>(mapa);
+    paginas_arquivo = static_cast<std::uint64_t>(info.st_size) / TAMANHO_PAGINA;
+
+    if (info.st_size == 0) {
+        inicializar_arquivo();
+        return;
+    }
+
+    const MetaBTreeDisco* meta = nullptr;
+    if (paginas_arquivo >= PRIMEIRA_PAGINA_DADOS) {
+        const MetaBTreeDisco* m0 = meta_valida(endereco(0));
+        const MetaBTreeDisco* m1 = meta_valida(endereco(1));
+        meta = (m0 && (!m1 || m0->geracao > m1->geracao)) ? m0 : m1;
+    }
+    if (meta == nullptr || meta->num_paginas > paginas_arquivo) {
+        munmap(base, tamanho_mapa);
+        close(descritor);
+        throw std::runtime_error("Arquivo de B-tree inválido ou corrompido.");
+    }
+    geracao = meta->geracao;
+    raiz = meta->raiz;
+    num_paginas = meta->num_paginas;
+    num_elementos = meta->num_elementos;
+    niveis = static_cast<int>(meta->niveis);
+    ler_lista_livre(meta->lista_livre);
+#else
+    (void)caminho;
+    throw std::runtime_error("BTreeEmDisco requer mmap (POSIX).");
+#endif
+}
+
+void BTreeEmDisco::inicializar_arquivo() {
+    num_paginas = PRIMEIRA_PAGINA_DADOS;
+    raiz = alocar();
+    PaginaFolha* f = folha(raiz);
+    f->tipo = TIPO_FOLHA;
+    f->num = 0;
+    niveis = 1;
+    confirmar();
+}
+
+void BTreeEmDisco::ler_lista_livre(std::uint64_t primeira) {
+    for (std::uint64_t pagina = primeira; pagina != 0;) {
+        const PaginaListaLivre* lista = reinterpret_cast<const PaginaListaLivre*>(endereco(pagina));
+        disponiveis.insert(disponiveis.end(), lista->ids, lista->ids + lista->num);
+        // A própria página da lista pertence à versão confirmada: fica livre na próxima confirmação.
+        pendentes.push_back(pagina);
+        pagina = lista->proxima;
+    }
+}
+
+void BTreeEmDisco::garantir_paginas_no_arquivo(std::uint64_t paginas) {
+    if (paginas <= paginas_arquivo) return;
+    std::uint64_t maximo = tamanho_mapa / TAMANHO_PAGINA;
+    if (paginas > maximo) {
+        throw std::length_error("O arquivo da B-tree excedeu o tamanho máximo do mapeamento.");
+    }
+    std::uint64_t novo = std::min(maximo, std::max<std::uint64_t>({paginas, 2 * paginas_arquivo, 16}));
+#ifdef BTREE_DISCO_POSIX
+    if (ftruncate(descritor, static_cast<off_t>(novo * TAMANHO_PAGINA)) != 0) {
+        throw std::runtime_error("Não foi possível aumentar o arquivo da B-tree.");
+    }
+#endif
+    paginas_arquivo = novo;
+}
+
+void BTreeEmDisco::sincronizar(std::vector<std::uint64_t> paginas) {
+#ifdef BTREE_DISCO_POSIX
+    // Um msync por sequência de páginas consecutivas; o resto do mapa não foi tocado.
+    std::sort(paginas.begin(), paginas.end());
+    bool ok = true;
+    for (std::size_t i = 0; ok && i < paginas.size();) {
+        std::uint64_t inicio = paginas[i], fim = inicio + 1;
+        for (++i; i < paginas.size() && paginas[i] <= fim; ++i) fim = paginas[i] + 1;
+        ok = msync(endereco(inicio), (fim - inicio) * TAMANHO_PAGINA, MS_SYNC) == 0;
+    }
+#ifdef __APPLE__
+    ok = ok && fsync(descritor) == 0;
+#else
+    ok = ok && fdatasync(descritor) == 0; // Também persiste o novo tamanho do arquivo
+#endif
+    if (!ok) {
+        throw std::runtime_error("Falha ao sincronizar o arquivo da B-tree.");
+    }
+#else
+    (void)paginas;
+#endif
+}
+
+std::uint64_t BTreeEmDisco::alocar() {
+    std::uint64_t pagina;
+    if (!disponiveis.empty()) {
+        pagina = disponiveis.back();
+        disponiveis.pop_back();
+    } else {
+        garantir_paginas_no_arquivo(num_paginas + 1);
+        pagina = num_paginas++;
+    }
+    if (pagina >= nova_na_transacao.size()) {
+        nova_na_transacao.resize(std::max<std::size_t>(pagina + 1, 2 * nova_na_transacao.size()));
+    }
+    nova_na_transacao[pagina] = true;
+    novas.push_back(pagina);
+    alterada = true;
+    return pagina;
+}
+
+std::uint64_t BTreeEmDisco::copiar_se_necessario(std::uint64_t pagina) {
+    if (pagina < nova_na_transacao.size() && nova_na_transacao[pagina]) return pagina;
+    std::uint64_t copia = alocar();
+    std::memcpy(endereco(copia), endereco(pagina), TAMANHO_PAGINA);
+    pendentes.push_back(pagina);
+    return copia;
+}
+
+std::uint64_t BTreeEmDisco::gravar_lista_livre() {
+    // As páginas que guardam a lista saem das próprias livres (ou do fim do arquivo),
+    // e cada uma retirada das livres é uma entrada a menos para guardar.
+    std::vector<std::uint64_t> paginas_lista;
+    while (paginas_lista.size() * IDS_POR_PAGINA < disponiveis.size() + pendentes.size()) {
+        paginas_lista.push_back(alocar());
+    }
+
+    std::size_t k = 0;
+    auto proximo_id = [&]() { return k < disponiveis.size() ? disponiveis[k++] : pendentes[k++ - disponiveis.size()]; };
+    const std::size_t total = disponiveis.size() + pendentes.size();
+    for (std::size_t i = 0; i < paginas_lista.size(); ++i) {
+        PaginaListaLivre* lista = reinterpret_cast<PaginaListaLivre*>(endereco(paginas_lista[i]));
+        lista->tipo = TIPO_LISTA_LIVRE;
+        lista->num = static_cast<std::uint32_t>(std::min(IDS_POR_PAGINA, total - k));
+        lista->proxima = (i + 1 < paginas_lista.size()) ? paginas_lista[i + 1] : 0;
+        for (std::uint32_t j = 0; j < lista->num; ++j) lista->ids[j] = proximo_id();
+    }
+
+    // Liberadas nesta transação passam a ser reutilizáveis; a nova lista fica para a próxima.
+    disponiveis.insert(disponiveis.end(), pendentes.begin(), pendentes.end());
+    pendentes = paginas_lista;
+    return paginas_lista.empty() ? 0 : paginas_lista[0];
+}
+
+void BTreeEmDisco::confirmar() {
+    if (!alterada) return;
+    std::uint64_t lista_livre = gravar_lista_livre();
+
+    // 1. Todas as páginas novas chegam ao disco antes de qualquer meta apontar para elas. Só elas
+    // foram escritas nesta transação (cópia na escrita), então as demais não precisam de msync.
+    sincronizar(novas);
+
+    // 2. A nova versão sobrescreve a meta mais antiga; a outra continua válida até aqui.
+    MetaBTreeDisco meta{MAGICO, geracao + 1, raiz, num_paginas, lista_livre, num_elementos,
+              static_cast<std::uint64_t>(niveis), 0};
+    meta.soma = soma_verificacao(meta);
+    std::memcpy(endereco(meta.geracao % 2), &meta, sizeof(meta));
+    sincronizar({0, 1}); // Páginas das metas
+    geracao = meta.geracao;
+
+    for (std::uint64_t pagina : novas) nova_na_transacao[pagina] = false;
+    novas.clear();
+    alterada = false;
+    atualizar_paginas_fixadas();
+}
+
+BTreeEmDisco::ResultadoInsercao BTreeEmDisco::inserir_helper(std::uint64_t pagina, Chave chave, Valor valor, bool& inserido) {
+    if (eh_folha(pagina)) {
+        const PaginaFolha* original = folha(pagina);
+        int num = static_cast<int>(original->num);
+        int pos = contar_chaves_menores(original->chaves, num, chave);
+        bool existe = pos < num && original->chaves[pos] == chave;
+        inserido = !existe;
+        if (existe && original->valores[pos] == valor) return {pagina};
+
+        pagina = copiar_se_necessario(pagina);
+        PaginaFolha* f = folha(pagina);
+        if (existe) {
+            f->valores[pos] = valor;
+            return {pagina};
+        }
+        if (num < CHAVES_POR_PAGINA) {
+            std::memmove(f->chaves + pos + 1, f->chaves + pos, (num - pos) * sizeof(Chave));
+            std::memmove(f->valores + pos + 1, f->valores + pos, (num - pos) * sizeof(Valor));
+            f->chaves[pos] = chave;
+            f->valores[pos] = valor;
+            ++f->num;
+            return {pagina};
+        }
+
+        // Folha cheia: monta a sequência com o novo par e divide ao meio.
+        Chave chaves[CHAVES_POR_PAGINA + 1];
+        Valor valores[CHAVES_POR_PAGINA + 1];
+        std::copy(f->chaves, f->chaves + pos, chaves);
+        std::copy(f->valores, f->valores + pos, valores);
+        chaves[pos] = chave;
+        valores[pos] = valor;
+        std::copy(f->chaves + pos, f->chaves + num, chaves + pos + 1);
+        std::copy(f->valores + pos, f->valores + num, valores + pos + 1);
+
+        std::uint64_t direita = alocar();
+        PaginaFolha* d = folha(direita);
+        int metade = (CHAVES_POR_PAGINA + 1) / 2;
+        f->num = metade;
+        std::copy(chaves, chaves + metade, f->chaves);
+        std::copy(valores, valores + metade, f->valores);
+        d->tipo = TIPO_FOLHA;
+        d->num = CHAVES_POR_PAGINA + 1 - metade;
+        std::copy(chaves + metade, chaves + CHAVES_POR_PAGINA + 1, d->chaves);
+        std::copy(valores + metade, valores + CHAVES_POR_PAGINA + 1, d->valores);
+        return {pagina, direita, d->chaves[0]};
+    }
+
+    const PaginaInterna* original = interna(pagina);
+    int idx = indice_filho(original, chave);
+    std::uint64_t filho_original = original->filhos[idx];
+    ResultadoInsercao filho = inserir_helper(filho_original, chave, valor, inserido);
+    if (filho.pagina == filho_original && filho.direita == 0) return {pagina};
+
+    pagina = copiar_se_necessario(pagina);
+    PaginaInterna* p = interna(pagina);
+    p->filhos[idx] = filho.pagina;
+    if (filho.direita == 0) return {pagina};
+
+    int num = static_cast<int>(p->num);
+    if (num < CHAVES_POR_PAGINA) {
+        std::memmove(p->chaves + idx + 1, p->chaves + idx, (num - idx) * sizeof(Chave));
+        std::memmove(p->filhos + idx + 2, p->filhos + idx + 1, (num - idx) * sizeof(std::uint64_t));
+        p->chaves[idx] = filho.separador;
+        p->filhos[idx + 1] = filho.direita;
+        ++p->num;
+        return {pagina};
+    }
+
+    // Página interna cheia: divide, e a chave do meio sobe para o pai.
+    Chave chaves[CHAVES_POR_PAGINA + 1];
+    std::uint64_t filhos[CHAVES_POR_PAGINA + 2];
+    std::copy(p->chaves, p->chaves + idx, chaves);
+    chaves[idx] = filho.separador;
+    std::copy(p->chaves + idx, p->chaves + num, chaves + idx + 1);
+    std::copy(p->filhos, p->filhos + idx + 1, filhos);
+    filhos[idx + 1] = filho.direita;
+    std::copy(p->filhos + idx + 1, p->filhos + num + 1, filhos + idx + 2);
+
+    std::uint64_t direita = alocar();
+    PaginaInterna* d = interna(direita);
+    int meio = (CHAVES_POR_PAGINA + 1) / 2;
+    p->num = meio;
+    std::copy(chaves, chaves + meio, p->chaves);
+    std::copy(filhos, filhos + meio + 1, p->filhos);
+    d->tipo = TIPO_INTERNA;
+    d->num = CHAVES_POR_PAGINA - meio;
+    std::copy(chaves + meio + 1, chaves + CHAVES_POR_PAGINA + 1, d->chaves);
+    std::copy(filhos + meio + 1, filhos + CHAVES_POR_PAGINA + 2, d->filhos);
+    return {pagina, direita, chaves[meio]};
+}
+
+void BTreeEmDisco::inserir(Chave chave, Valor valor) {
+    bool inserido = false;
+    ResultadoInsercao resultado = inserir_helper(raiz, chave, valor, inserido);
+    raiz = resultado.pagina;
+    if (resultado.direita != 0) {
+        std::uint64_t nova_raiz = alocar();
+        PaginaInterna* p = interna(nova_raiz);
+        p->tipo = TIPO_INTERNA;
+        p->num = 1;
+        p->chaves[0] = resultado.separador;
+        p->filhos[0] = raiz;
+        p->filhos[1] = resultado.direita;
+        raiz = nova_raiz;
+        ++niveis;
+    }
+    if (inserido) ++num_elementos;
+}
+
+bool BTreeEmDisco::buscar(Chave chave, Valor& valor_encontrado) const {
+    std::uint64_t pagina = raiz;
+    while (!eh_folha(pagina)) {
+        const PaginaInterna* p = interna(pagina);
+        pagina = p->filhos[indice_filho(p, chave)];
+    }
+    const PaginaFolha* f = folha(pagina);
+    int pos = contar_chaves_menores(f->chaves, static_cast<int>(f->num), chave);
+    if (pos == static_cast<int>(f->num) || f->chaves[pos] != chave) return false;
+    valor_encontrado = f->valores[pos];
+    return true;
+}
+
+std::size_t BTreeEmDisco::fixar_paginas_quentes(int niveis_superiores) {
+    niveis_fixados = niveis_superiores;
+    atualizar_paginas_fixadas();
+    return paginas_fixadas.size();
+}
+
+void BTreeEmDisco::atualizar_paginas_fixadas() {
+#ifdef BTREE_DISCO_POSIX
+    // A cópia na escrita move a raiz e o caminho alterado, então o conjunto é recalculado.
+    for (std::uint64_t pagina : paginas_fixadas) munlock(endereco(pagina), TAMANHO_PAGINA);
+    paginas_fixadas.clear();
+    std::vector<std::uint64_t> nivel = {raiz}, proximo;
+    for (int d = 0; d < niveis_fixados && !nivel.empty(); ++d) {
+        proximo.clear();
+        for (std::uint64_t pagina : nivel) {
+            if (mlock(endereco(pagina), TAMANHO_PAGINA) == 0) paginas_fixadas.push_back(pagina);
+            if (!eh_folha(pagina)) {
+                const PaginaInterna* p = interna(pagina);
+                proximo.insert(proximo.end(), p->filhos, p->filhos + p->num + 1);
+            }
+        }
+        nivel.swap(proximo);
+    }
+#endif
+}
@@ -0,0 +1,102 @@
+#include "estruturas_dados/coletor_epocas.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+// Intervalo, em aposentadorias, entre tentativas de avançar a época e liberar o limbo.
+static constexpr std::size_t APOSENTADORIAS_POR_COLETA = 64;
+
+// --- Registro de índices de thread ---
+
+static std::atomic<bool> indices_ocupados[ColetorEpocas::MAX_THREADS];
+
+struct RegistroThread {
+    int indice = -1;
+    ~RegistroThread() {
+        if (indice >= 0) indices_ocupados[indice].store(false, std::memory_order_release);
+    }
+};
+
+int indice_da_thread() {
+    thread_local RegistroThread registro;
+    if (registro.indice < 0) {
+        for (int i = 0; i < ColetorEpocas::MAX_THREADS; ++i) {
+            if (!indices_ocupados[i].load(std::memory_order_relaxed) &&
+                !indices_ocupados[i].exchange(true, std::memory_order_acquire)) {
+                registro.indice = i;
+                break;
+            }
+        }
+        if (registro.indice < 0) {
+            throw std::runtime_error("Número máximo de threads do coletor de épocas excedido.");
+        }
+    }
+    return registro.indice;
+}
+
+// --- ColetorEpocas ---
+
+ColetorEpocas::~ColetorEpocas() {
+    for (EntradaThread& entrada : entradas) {
+        for (const Aposentado& a : entrada.limbo) a.destruir(a.ponteiro);
+    }
+}
+
+ColetorEpocas::Guarda ColetorEpocas::proteger() {
+    int indice = indice_da_thread();
+    EntradaThread& entrada = entradas[indice];
+    if (entrada.aninhamento++ == 0) {
+        int maior = maior_indice.load(std::memory_order_relaxed);
+        while (maior <= indice && !maior_indice.compare_exchange_weak(maior, indice + 1)) {
+        }
+        // Anuncia a época e confirma que ela ainda é a global; senão a época poderia ter avançado
+        // duas vezes entre a leitura e o anúncio, liberando algo que esta thread ainda vai ler.
+        std::uint64_t epoca = epoca_global.load();
+        while (true) {
+            entrada.anunciada.store(2 * epoca + 1);
+            std::uint64_t atual = epoca_global.load();
+            if (atual == epoca) break;
+            epoca = atual;
+        }
+    }
+    return Guarda(this, indice);
+}
+
+void ColetorEpocas::sair(int indice) {
+    EntradaThread& entrada = entradas[indice];
+    if (--entrada.aninhamento == 0) {
+        entrada.anunciada.store(0, std::memory_order_release);
+    }
+}
+
+void ColetorEpocas::aposentar(void* ponteiro, void (*destruir)(void*)) {
+    EntradaThread& entrada = entradas[indice_da_thread()];
+    entrada.limbo.push_back({ponteiro, destruir, epoca_global.load()});
+    if (entrada.limbo.size() % APOSENTADORIAS_POR_COLETA == 0) {
+        tentar_avancar();
+        liberar_antigos(entrada);
+    }
+}
+
+void ColetorEpocas::tentar_avancar() {
+    std::uint64_t epoca = epoca_global.load();
+    int maior = maior_indice.load();
+    for (int i = 0; i < maior; ++i) {
+        std::uint64_t anunciada = entradas[i].anunciada.load();
+        if ((anunciada & 1) && (anunciada >> 1) != epoca) return; // Alguém ainda está na época anterior
+    }
+    epoca_global.compare_exchange_strong(epoca, epoca + 1);
+}
+
+void ColetorEpocas::liberar_antigos(EntradaThread& entrada) {
+    std::uint64_t epoca = epoca_global.load();
+    auto fim = std::partition(entrada.limbo.begin(), entrada.limbo.end(),
+                              [epoca](const Aposentado& a) { return a.epoca + 2 > epoca; });
+    for (auto it = fim; it != entrada.limbo.end(); ++it) it->destruir(it->ponteiro);
+    entrada.limbo.erase(fim, entrada.limbo.end());
+}
+
+std::size_t ColetorEpocas::pendentes() const {
+    std::size_t total = 0;
+    for (const EntradaThread& entrada : entradas) total += entrada.limbo.size();
+    return total;
+}
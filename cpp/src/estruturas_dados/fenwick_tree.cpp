@@ -0,0 +1,7 @@
+/**
+ * @file fenwick_tree.cpp
+ * @brief Arquivo de implementação para a Fenwick Tree.
+ *
+ * @note Como FenwickTree, FenwickTreeIntervalo e FenwickTree2D são classes de template, toda
+ * a sua implementação está no arquivo de cabeçalho (fenwick_tree.hpp).
+ */
\ No newline at end of file
@@ -0,0 +1,7 @@
+/**
+ * @file fila.cpp
+ * @brief Arquivo de implementação para as filas concorrentes.
+ *
+ * @note Como FilaSPSC, FilaMPMC e FilaBloqueante são classes de template, toda a sua
+ * implementação está no arquivo de cabeçalho (fila.hpp).
+ */
\ No newline at end of file
@@ -0,0 +1,7 @@
+/**
+ * @file heap.cpp
+ * @brief Arquivo de implementação para o HeapIndexado e o PairingHeap.
+ *
+ * @note Como HeapIndexado e PairingHeap são classes de template, toda a sua implementação está
+ * no arquivo de cabeçalho (heap.hpp).
+ */
\ No newline at end of file
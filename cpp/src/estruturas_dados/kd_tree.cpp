@@ -0,0 +1,7 @@
+/**
+ * @file kd_tree.cpp
+ * @brief Arquivo de implementação para a KD-tree.
+ *
+ * @note Como KDTree é uma classe de template, toda a sua implementação está no arquivo de
+ * cabeçalho (kd_tree.hpp).
+ */
\ No newline at end of file
@@ -0,0 +1,7 @@
+/**
+ * @file lista_encadeada_dupla.cpp
+ * @brief Arquivo de implementação para a ListaEncadeadaDupla.
+ *
+ * @note Como ListaEncadeadaDupla é uma classe de template, toda a sua implementação está no arquivo de
+ * cabeçalho (lista_encadeada_dupla.hpp).
+ */
\ No newline at end of file
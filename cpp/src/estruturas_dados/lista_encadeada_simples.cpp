@@ -0,0 +1,7 @@
+/**
+ * @file lista_encadeada_simples.cpp
+ * @brief Arquivo de implementação para a ListaEncadeadaSimples.
+ *
+ * @note Como ListaEncadeadaSimples é uma classe de template, toda a sua implementação está no arquivo de
+ * cabeçalho (lista_encadeada_simples.hpp).
+ */
\ No newline at end of file
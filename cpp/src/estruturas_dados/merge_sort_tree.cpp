@@ -0,0 +1,7 @@
+/**
+ * @file merge_sort_tree.cpp
+ * @brief Arquivo de implementação para a Merge Sort Tree.
+ *
+ * @note Como MergeSortTree é uma classe de template, toda a sua implementação
+ * está no arquivo de cabeçalho (merge_sort_tree.hpp).
+ */
\ No newline at end of file
@@ -0,0 +1,7 @@
+/**
+ * @file pilha.cpp
+ * @brief Arquivo de implementação para a pilha concorrente.
+ *
+ * @note Como PilhaConcorrente é uma classe de template, toda a sua implementação está no
+ * arquivo de cabeçalho (pilha.hpp). A recuperação de memória está em coletor_epocas.cpp.
+ */
\ No newline at end of file
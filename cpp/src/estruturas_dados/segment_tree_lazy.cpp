@@ -0,0 +1,7 @@
+/**
+ * @file segment_tree_lazy.cpp
+ * @brief Arquivo de implementação para a Segment Tree com propagação preguiçosa.
+ *
+ * @note Como SegmentTreeLazy é uma classe de template, toda a sua implementação
+ * está no arquivo de cabeçalho (segment_tree_lazy.hpp).
+ */
\ No newline at end of file
@@ -0,0 +1,7 @@
+/**
+ * @file segment_tree_persistente.cpp
+ * @brief Arquivo de implementação para a Segment Tree persistente.
+ *
+ * @note Como SegmentTreePersistente é uma classe de template, toda a sua implementação
+ * está no arquivo de cabeçalho (segment_tree_persistente.hpp).
+ */
\ No newline at end of file
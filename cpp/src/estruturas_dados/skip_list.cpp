@@ -0,0 +1,7 @@
+/**
+ * @file skip_list.cpp
+ * @brief Arquivo de implementação para a skip list concorrente.
+ *
+ * @note Como SkipListConcorrente é uma classe de template, toda a sua implementação está no
+ * arquivo de cabeçalho (skip_list.hpp). A recuperação de memória está em coletor_epocas.cpp.
+ */
\ No newline at end of file
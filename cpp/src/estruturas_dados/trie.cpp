@@ -0,0 +1,143 @@
+#include "estruturas_dados/trie.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+// --- RadixTrie ---
+
+RadixTrie::RadixTrie() : num_chaves(0) {
+    nos.push_back({0, 0, NULO, NULO, 0, 0, false});
+}
+
+std::uint32_t RadixTrie::novo_no(std::uint32_t inicio, std::uint32_t tam) {
+    nos.push_back({inicio, tam, NULO, NULO, 0, 0, false});
+    return static_cast<std::uint32_t>(nos.size() - 1);
+}
+
+void RadixTrie::recalcular_peso_maximo(std::uint32_t no) {
+    std::uint32_t maximo = nos[no].terminal ? nos[no].peso : 0;
+    for (std::uint32_t f = nos[no].primeiro_filho; f != NULO; f = nos[f].proximo_irmao) {
+        maximo = std::max(maximo, nos[f].peso_maximo);
+    }
+    nos[no].peso_maximo = maximo;
+}
+
+void RadixTrie::inserir(std::string_view chave, std::uint32_t peso) {
+    // Os rótulos são endereçados por deslocamentos de 32 bits, e uma inserção cria no máximo dois
+    // nós e acrescenta no máximo |chave| caracteres: os limites são conferidos antes de qualquer
+    // alteração.
+    if (chave.size() > UINT32_MAX - rotulos.size()) {
+        throw std::length_error("O buffer de rótulos excedeu a capacidade de deslocamentos de 32 bits.");
+    }
+    if (nos.size() + 2 > NULO) {
+        throw std::length_error("O pool de nós excedeu a capacidade de índices de 32 bits.");
+    }
+    std::vector<std::uint32_t> caminho; // Nós cujo peso máximo pode ter mudado
+    std::uint32_t no = raiz();
+    std::size_t i = 0;
+    while (true) {
+        caminho.push_back(no);
+        if (i == chave.size()) break;
+
+        // Procura o filho que começa com chave[i], lembrando o irmão anterior para inserir em ordem.
+        unsigned char c = static_cast<unsigned char>(chave[i]);
+        std::uint32_t anterior = NULO, f = nos[no].primeiro_filho;
+        while (f != NULO && primeiro_caractere(f) < c) {
+            anterior = f;
+            f = nos[f].proximo_irmao;
+        }
+
+        if (f == NULO || primeiro_caractere(f) != c) {
+            // Nenhuma aresta compartilha o próximo caractere: o resto da chave vira uma folha.
+            std::uint32_t folha = novo_no(static_cast<std::uint32_t>(rotulos.size()), static_cast<std::uint32_t>(chave.size() - i));
+            rotulos.append(chave.substr(i));
+            nos[folha].proximo_irmao = f;
+            (anterior == NULO ? nos[no].primeiro_filho : nos[anterior].proximo_irmao) = folha;
+            no = folha;
+            caminho.push_back(no);
+            break;
+        }
+
+        std::string_view r = rotulo(f);
+        std::size_t comum = 0;
+        while (comum < r.size() && i + comum < chave.size() && r[comum] == chave[i + comum]) ++comum;
+        i += comum;
+        if (comum == r.size()) {
+            no = f;
+            continue;
+        }
+
+        // A chave diverge no meio do rótulo: um nó intermediário assume o trecho comum.
+        std::uint32_t meio = novo_no(nos[f].inicio_rotulo, static_cast<std::uint32_t>(comum));
+        nos[f].inicio_rotulo += static_cast<std::uint32_t>(comum);
+        nos[f].tam_rotulo -= static_cast<std::uint32_t>(comum);
+        nos[meio].proximo_irmao = nos[f].proximo_irmao;
+        nos[meio].primeiro_filho = f;
+        nos[meio].peso_maximo = nos[f].peso_maximo;
+        nos[f].proximo_irmao = NULO;
+        (anterior == NULO ? nos[no].primeiro_filho : nos[anterior].proximo_irmao) = meio;
+        no = meio;
+        // A próxima iteração termina em 'meio' (chave esgotada) ou cria a folha irmã de 'f'.
+    }
+
+    if (!nos[no].terminal) {
+        nos[no].terminal = true;
+        ++num_chaves;
+    }
+    nos[no].peso = peso;
+    for (auto it = caminho.rbegin(); it != caminho.rend(); ++it) recalcular_peso_maximo(*it);
+}
+
+TrieCongelada RadixTrie::congelar() const {
+    // Os rótulos congelados são os trechos vivos de `rotulos`, nunca mais longos que ele; a
+    // conferência apenas protege os deslocamentos de 32 bits de `inicio`.
+    if (rotulos.size() > UINT32_MAX) {
+        throw std::length_error("O buffer de rótulos excedeu a capacidade de deslocamentos de 32 bits.");
+    }
+    TrieCongelada congelada;
+    congelada.num_chaves = num_chaves;
+
+    // Percorre em ordem de nível; os filhos de cada nó ficam consecutivos, em ordem lexicográfica.
+    std::vector<std::uint32_t> ordem = {raiz()};
+    std::vector<std::uint8_t> bits_louds = {1, 0}; // Super-raiz
+    std::vector<std::uint8_t> bits_terminais;
+    congelada.inicio.reserve(nos.size() + 1);
+    congelada.maximos.reserve(nos.size());
+    congelada.rotulos.reserve(rotulos.size());
+    for (std::size_t k = 0; k < ordem.size(); ++k) {
+        std::uint32_t v = ordem[k];
+        congelada.inicio.push_back(static_cast<std::uint32_t>(congelada.rotulos.size()));
+        congelada.rotulos.append(rotulo(v));
+        congelada.maximos.push_back(nos[v].peso_maximo);
+        bits_terminais.push_back(nos[v].terminal);
+        if (nos[v].terminal) congelada.pesos.push_back(nos[v].peso);
+        for (std::uint32_t f = nos[v].primeiro_filho; f != NULO; f = nos[f].proximo_irmao) {
+            ordem.push_back(f);
+            bits_louds.push_back(1);
+        }
+        bits_louds.push_back(0);
+    }
+    congelada.inicio.push_back(static_cast<std::uint32_t>(congelada.rotulos.size()));
+    congelada.louds = BitVectorRankSelect(bits_louds);
+    congelada.terminais = BitVectorRankSelect(bits_terminais);
+    return congelada;
+}
+
+// --- TrieCongelada ---
+
+std::uint32_t TrieCongelada::filho(std::uint32_t v, unsigned char c) const {
+    // Busca binária pelo primeiro caractere do rótulo entre os filhos consecutivos.
+    auto [lo, hi] = filhos(v);
+    while (lo < hi) {
+        std::uint32_t meio = lo + (hi - lo) / 2;
+        unsigned char p = static_cast<unsigned char>(rotulos[inicio[meio]]);
+        if (p == c) return meio;
+        if (p < c) lo = meio + 1;
+        else hi = meio;
+    }
+    return NULO;
+}
+
+std::size_t TrieCongelada::memoria_bytes() const {
+    return louds.memoria_bytes() + terminais.memoria_bytes() + rotulos.capacity() +
+           (inicio.capacity() + pesos.capacity() + maximos.capacity()) * sizeof(std::uint32_t);
+}
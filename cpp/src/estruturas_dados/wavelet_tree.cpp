@@ -0,0 +1,162 @@
+#include "estruturas_dados/wavelet_tree.hpp"
+#include <bit> // Para std::popcount, std::countr_zero, std::bit_width
+
+// --- BitVectorRankSelect ---
+
+BitVectorRankSelect::BitVectorRankSelect(const std::vector<std::uint8_t>& bits) : n(bits.size()) {
+    // Uma palavra extra garante que rank1(n) nunca leia fora do vetor.
+    palavras.assign(n / 64 + 1, 0);
+    for (std::size_t i = 0; i < n; ++i) {
+        if (bits[i]) palavras[i >> 6] |= std::uint64_t(1) << (i & 63);
+    }
+    acumulado.assign(palavras.size() + 1, 0);
+    for (std::size_t w = 0; w < palavras.size(); ++w) {
+        acumulado[w + 1] = acumulado[w] + std::popcount(palavras[w]);
+        // Registra a palavra de cada múltiplo de AMOSTRA_SELECT que cai dentro dela.
+        std::size_t zeros_ate = (w + 1) * 64 - acumulado[w + 1];
+        while (amostras1.size() * AMOSTRA_SELECT < acumulado[w + 1]) amostras1.push_back(w);
+        while (amostras0.size() * AMOSTRA_SELECT < zeros_ate) amostras0.push_back(w);
+    }
+}
+
+std::size_t BitVectorRankSelect::rank1(std::size_t i) const {
+    std::uint64_t mascara = (std::uint64_t(1) << (i & 63)) - 1;
+    return acumulado[i >> 6] + std::popcount(palavras[i >> 6] & mascara);
+}
+
+// Posição do k-ésimo bit 1 dentro de uma palavra.
+static std::size_t select_na_palavra(std::uint64_t palavra, std::size_t k) {
+    for (std::size_t i = 0; i < k; ++i) {
+        palavra &= palavra - 1; // Apaga o bit 1 menos significativo
+    }
+    return std::countr_zero(palavra);
+}
+
+std::size_t BitVectorRankSelect::select1(std::size_t k) const {
+    // Maior palavra w com acumulado[w] <= k, entre as palavras das duas amostras vizinhas.
+    std::size_t j = k / AMOSTRA_SELECT;
+    std::size_t lo = amostras1[j];
+    std::size_t hi = (j + 1 < amostras1.size()) ? amostras1[j + 1] : palavras.size() - 1;
+    while (lo < hi) {
+        std::size_t mid = lo + (hi - lo + 1) / 2;
+        if (acumulado[mid] <= k) lo = mid;
+        else hi = mid - 1;
+    }
+    return lo * 64 + select_na_palavra(palavras[lo], k - acumulado[lo]);
+}
+
+std::size_t BitVectorRankSelect::select0(std::size_t k) const {
+    // Mesmo procedimento sobre o número de zeros antes de cada palavra (lo * 64 - acumulado[lo]).
+    std::size_t j = k / AMOSTRA_SELECT;
+    std::size_t lo = amostras0[j];
+    std::size_t hi = (j + 1 < amostras0.size()) ? amostras0[j + 1] : palavras.size() - 1;
+    while (lo < hi) {
+        std::size_t mid = lo + (hi - lo + 1) / 2;
+        if (mid * 64 - acumulado[mid] <= k) lo = mid;
+        else hi = mid - 1;
+    }
+    return lo * 64 + select_na_palavra(~palavras[lo], k - (lo * 64 - acumulado[lo]));
+}
+
+// --- WaveletMatrixCodigos ---
+
+WaveletMatrixCodigos::WaveletMatrixCodigos(const std::vector<std::uint32_t>& codigos, std::uint32_t sigma)
+    : n(codigos.size()), bits(sigma > 1 ? std::bit_width(sigma - 1) : 1) {
+    niveis.resize(bits);
+    zeros.resize(bits);
+
+    std::vector<std::uint32_t> atual = codigos;
+    std::vector<std::uint32_t> proximo(n);
+    std::vector<std::uint8_t> bits_nivel(n);
+    for (int nivel = 0; nivel < bits; ++nivel) {
+        int b = bits - 1 - nivel;
+        std::size_t z = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            bits_nivel[i] = (atual[i] >> b) & 1;
+            z += !bits_nivel[i];
+        }
+        niveis[nivel] = BitVectorRankSelect(bits_nivel);
+        zeros[nivel] = z;
+
+        // Partição estável: zeros primeiro, depois uns.
+        std::size_t pos_zero = 0, pos_um = z;
+        for (std::size_t i = 0; i < n; ++i) {
+            if (bits_nivel[i]) proximo[pos_um++] = atual[i];
+            else proximo[pos_zero++] = atual[i];
+        }
+        atual.swap(proximo);
+    }
+}
+
+std::uint32_t WaveletMatrixCodigos::acessar(std::size_t i) const {
+    std::uint32_t c = 0;
+    for (int nivel = 0; nivel < bits; ++nivel) {
+        bool bit = niveis[nivel].get(i);
+        c = (c << 1) | bit;
+        i = descer(nivel, i, bit);
+    }
+    return c;
+}
+
+std::uint32_t WaveletMatrixCodigos::k_esimo_menor(std::size_t l, std::size_t r, std::size_t k) const {
+    std::uint32_t c = 0;
+    for (int nivel = 0; nivel < bits; ++nivel) {
+        std::size_t zeros_l = niveis[nivel].rank0(l);
+        std::size_t zeros_r = niveis[nivel].rank0(r);
+        std::size_t zeros_intervalo = zeros_r - zeros_l;
+        if (k < zeros_intervalo) {
+            c <<= 1;
+            l = zeros_l;
+            r = zeros_r;
+        } else {
+            c = (c << 1) | 1;
+            k -= zeros_intervalo;
+            l = zeros[nivel] + (l - zeros_l);
+            r = zeros[nivel] + (r - zeros_r);
+        }
+    }
+    return c;
+}
+
+std::size_t WaveletMatrixCodigos::contar_menores(std::size_t l, std::size_t r, std::uint32_t c) const {
+    if (bits < 32 && c >= (std::uint32_t(1) << bits)) return r - l;
+    std::size_t contagem = 0;
+    for (int nivel = 0; nivel < bits && l < r; ++nivel) {
+        bool bit = (c >> (bits - 1 - nivel)) & 1;
+        if (bit) {
+            // Todos que têm 0 neste bit (e o mesmo prefixo) são menores que c.
+            contagem += niveis[nivel].rank0(r) - niveis[nivel].rank0(l);
+        }
+        l = descer(nivel, l, bit);
+        r = descer(nivel, r, bit);
+    }
+    return contagem;
+}
+
+std::size_t WaveletMatrixCodigos::rank(std::uint32_t c, std::size_t i) const {
+    std::size_t l = 0, r = i;
+    for (int nivel = 0; nivel < bits && l < r; ++nivel) {
+        bool bit = (c >> (bits - 1 - nivel)) & 1;
+        l = descer(nivel, l, bit);
+        r = descer(nivel, r, bit);
+    }
+    return r - l;
+}
+
+std::size_t WaveletMatrixCodigos::select(std::uint32_t c, std::size_t k) const {
+    if (k >= rank(c, n)) return n;
+
+    // Desce até o último nível para achar onde começa o bloco do código c...
+    std::size_t pos = 0;
+    for (int nivel = 0; nivel < bits; ++nivel) {
+        pos = descer(nivel, pos, (c >> (bits - 1 - nivel)) & 1);
+    }
+    pos += k;
+
+    // ...e sobe desfazendo cada partição com select.
+    for (int nivel = bits - 1; nivel >= 0; --nivel) {
+        bool bit = (c >> (bits - 1 - nivel)) & 1;
+        pos = bit ? niveis[nivel].select1(pos - zeros[nivel]) : niveis[nivel].select0(pos);
+    }
+    return pos;
+}
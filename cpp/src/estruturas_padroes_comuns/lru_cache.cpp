@@ -0,0 +1,7 @@
+/**
+ * @file lru_cache.cpp
+ * @brief Arquivo de implementação para o LRUCache e o LRUCacheConcorrente.
+ *
+ * @note Como LRUCache e LRUCacheConcorrente são classes de template, toda a sua implementação está
+ * no arquivo de cabeçalho (lru_cache.hpp).
+ */
\ No newline at end of file
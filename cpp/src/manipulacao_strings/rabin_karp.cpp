@@ -1,61 +1,145 @@
 #include "manipulacao_strings/rabin_karp.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <random>
+#include <stdexcept>
 
-std::vector<int> rabin_karp(const std::string& texto, const std::string& padrao) {
-    int T = texto.length();
-    int P = padrao.length();
-    std::vector<int> ocorrencias;
+// a * b mod 2^61 - 1, para a < 2^63 e b < 2^61, reduzido só até ficar abaixo de 2^61 + 8: como
+// 2^61 ≡ 1, os bits acima do 61º do produto são somados aos de baixo. A subtração final, que
+// tornaria o valor canônico, fica fora da cadeia de dependências do hash rolante (veja canonico).
+static std::uint64_t mulmod_parcial(std::uint64_t a, std::uint64_t b) {
+#if defined(__SIZEOF_INT128__)
+    const unsigned __int128 produto = static_cast<unsigned __int128>(a) * b;
+    const std::uint64_t r = (static_cast<std::uint64_t>(produto) & RABIN_KARP_MODULO) + static_cast<std::uint64_t>(produto >> 61);
+#else
+    // Sem inteiros de 128 bits: a e b em metades de 31 bits, com 2^62 ≡ 2 e 2^61 ≡ 1.
+    const std::uint64_t mascara31 = (std::uint64_t(1) << 31) - 1, mascara30 = (std::uint64_t(1) << 30) - 1;
+    const std::uint64_t a_alto = a >> 31, a_baixo = a & mascara31, b_alto = b >> 31, b_baixo = b & mascara31;
+    const std::uint64_t meio = a_baixo * b_alto + a_alto * b_baixo;
+    const std::uint64_t r = ((a_alto * b_alto) << 1) + (meio >> 30) + ((meio & mascara30) << 31) + a_baixo * b_baixo;
+#endif
+    return (r & RABIN_KARP_MODULO) + (r >> 61);
+}
 
-    if (P == 0 || T == 0 || P > T) {
-        return ocorrencias; // Retorna vetor vazio para casos de borda
-    }
+// O representante em [0, p) de um valor parcialmente reduzido (menor que 2p).
+static std::uint64_t canonico(std::uint64_t x) {
+    return x >= RABIN_KARP_MODULO ? x - RABIN_KARP_MODULO : x;
+}
+
+// Um passo do hash rolante sobre valores parcialmente reduzidos: soma `remover` (que tira o
+// caractere que sai da janela), desloca a janela e acrescenta o caractere que entra.
+static std::uint64_t rolar(std::uint64_t hash, std::uint64_t remover, std::uint64_t base, unsigned char entrando) {
+    return mulmod_parcial(hash + remover, base) + entrando;
+}
 
-    // Constantes para o cálculo do hash
-    const int d = 256; // Número de caracteres no alfabeto de entrada
-    const int q = 101; // Um número primo para o módulo
+// A base do hash, sorteada uma vez por processo em [2^8, p - 1).
+static std::uint64_t base_sorteada() {
+    static const std::uint64_t base = [] {
+        std::random_device semente;
+        std::mt19937_64 gerador((static_cast<std::uint64_t>(semente()) << 32) ^ semente());
+        return std::uniform_int_distribution<std::uint64_t>(256, RABIN_KARP_MODULO - 2)(gerador);
+    }();
+    return base;
+}
 
-    long long hash_p = 0; // hash para o padrão
-    long long hash_t = 0; // hash para a janela atual do texto
-    long long h = 1;
+RabinKarpFluxo::RabinKarpFluxo(const std::string& padrao) : RabinKarpFluxo(std::vector<std::string>{padrao}) {}
 
-    // O valor de h será pow(d, P-1) % q
-    for (int i = 0; i < P - 1; i++) {
-        h = (h * d) % q;
+RabinKarpFluxo::RabinKarpFluxo(const std::vector<std::string>& padroes)
+    : padroes(padroes), m(padroes.empty() ? 0 : padroes[0].size()), base(base_sorteada()) {
+    if (padroes.empty()) throw std::invalid_argument("A lista de padrões não pode ser vazia.");
+    for (const std::string& padrao : padroes) {
+        if (padrao.empty()) throw std::invalid_argument("Os padrões não podem ser vazios.");
+        if (padrao.size() != m) throw std::invalid_argument("Todos os padrões devem ter o mesmo comprimento.");
     }
 
-    // Calcula o valor de hash do padrão e da primeira janela do texto
-    for (int i = 0; i < P; i++) {
-        hash_p = (d * hash_p + padrao[i]) % q;
-        hash_t = (d * hash_t + texto[i]) % q;
+    std::uint64_t potencia = 1; // base^(m - 1)
+    for (std::size_t i = 1; i < m; ++i) potencia = canonico(mulmod_parcial(potencia, base));
+    for (unsigned c = 0; c < 256; ++c) remover[c] = RABIN_KARP_MODULO - canonico(mulmod_parcial(c, potencia));
+
+    for (std::size_t i = 0; i < padroes.size(); ++i) {
+        std::uint64_t hash = 0;
+        for (char c : padroes[i]) hash = rolar(hash, 0, base, static_cast<unsigned char>(c));
+        hash = canonico(hash);
+        por_hash[hash].push_back(i);
+        hash_unico = hash;
     }
+    // Cerca de 64 bits do filtro por padrão: a maioria das janelas para no filtro, sem
+    // consultar a tabela hash.
+    const std::size_t bits = std::bit_ceil(std::max<std::size_t>(64, por_hash.size() * 64));
+    filtro.assign(bits / 64, 0);
+    mascara_filtro = bits - 1;
+    for (const auto& [hash, indices] : por_hash) filtro[(hash & mascara_filtro) >> 6] |= std::uint64_t(1) << (hash & 63);
+    reiniciar();
+}
 
-    // Desliza a janela do padrão sobre o texto
-    for (int i = 0; i <= T - P; i++) {
-        // Compara os hashes da janela atual do texto e do padrão.
-        if (hash_p == hash_t) {
-            // Se os hashes correspondem, verifica caractere por caractere
-            // para garantir que não é uma colisão (falso positivo).
-            bool match = true;
-            for (int j = 0; j < P; j++) {
-                if (texto[i + j] != padrao[j]) {
-                    match = false;
-                    break;
-                }
-            }
-            if (match) {
-                ocorrencias.push_back(i);
-            }
-        }
+void RabinKarpFluxo::reiniciar() {
+    hash_janela = 0;
+    cauda.clear();
+    total = 0;
+}
+
+// Confere o padrão contra a janela que termina na posição `fim` (exclusiva) do pedaço; o
+// começo da janela pode estar na cauda do pedaço anterior.
+bool RabinKarpFluxo::confere(const std::string& padrao, std::string_view pedaco, std::size_t fim) const {
+    if (fim >= m) return std::memcmp(pedaco.data() + (fim - m), padrao.data(), m) == 0;
+    const std::size_t da_cauda = m - fim;
+    return std::memcmp(cauda.data() + (cauda.size() - da_cauda), padrao.data(), da_cauda) == 0 &&
+           std::memcmp(pedaco.data(), padrao.data() + da_cauda, fim) == 0;
+}
 
-        // Calcula o hash para a próxima janela do texto (rolling hash)
-        if (i < T - P) {
-            // Remove o dígito/caractere da esquerda e adiciona o da direita
-            hash_t = (d * (hash_t - texto[i] * h) + texto[i + P]) % q;
-            
-            // Podemos obter um valor de hash negativo, então o ajustamos
-            if (hash_t < 0) {
-                hash_t = (hash_t + q);
-            }
+void RabinKarpFluxo::alimentar(std::string_view pedaco, std::vector<OcorrenciaPadrao>& saida) {
+    const std::size_t n = pedaco.size();
+    const bool unico = por_hash.size() == 1;
+    auto candidato = [&](std::uint64_t hash) {
+        hash = canonico(hash);
+        if (unico) return hash == hash_unico;
+        return ((filtro[(hash & mascara_filtro) >> 6] >> (hash & 63)) & 1) && por_hash.count(hash);
+    };
+    auto relatar = [&](std::uint64_t hash, std::size_t fim) {
+        for (std::size_t indice : por_hash.find(canonico(hash))->second) {
+            if (confere(padroes[indice], pedaco, fim)) saida.push_back({total + fim - m, indice});
         }
+    };
+
+    // Enquanto o caractere que sai da janela ainda está na cauda (ou a janela não encheu).
+    const std::size_t inicio_rapido = std::min(n, m);
+    std::size_t k = 0;
+    for (; k < inicio_rapido; ++k) {
+        const std::uint64_t vistos = total + k;
+        const std::uint64_t saindo = vistos >= m ? remover[static_cast<unsigned char>(cauda[cauda.size() + k - m])] : 0;
+        hash_janela = rolar(hash_janela, saindo, base, static_cast<unsigned char>(pedaco[k]));
+        if (vistos + 1 >= m && candidato(hash_janela)) relatar(hash_janela, k + 1);
+    }
+    // Daqui em diante, a janela inteira está no pedaço.
+    const unsigned char* texto = reinterpret_cast<const unsigned char*>(pedaco.data());
+    std::uint64_t hash = hash_janela;
+    for (; k < n; ++k) {
+        hash = rolar(hash, remover[texto[k - m]], base, texto[k]);
+        if (candidato(hash)) relatar(hash, k + 1);
+    }
+    hash_janela = hash;
+
+    if (n >= m) {
+        cauda.assign(pedaco.substr(n - m));
+    } else {
+        cauda.append(pedaco);
+        if (cauda.size() > m) cauda.erase(0, cauda.size() - m);
+    }
+    total += n;
+}
+
+std::vector<int> rabin_karp(const std::string& texto, const std::string& padrao) {
+    std::vector<int> ocorrencias;
+    if (padrao.empty() || padrao.size() > texto.size()) {
+        return ocorrencias; // Retorna vetor vazio para casos de borda
+    }
+    for (const OcorrenciaPadrao& ocorrencia : RabinKarpFluxo(padrao).alimentar(texto)) {
+        ocorrencias.push_back(static_cast<int>(ocorrencia.posicao));
     }
     return ocorrencias;
-}
\ No newline at end of file
+}
+
+std::vector<OcorrenciaPadrao> rabin_karp_multiplo(const std::string& texto, const std::vector<std::string>& padroes) {
+    return RabinKarpFluxo(padroes).alimentar(texto);
+}
@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+#include "algoritmos_ordenacao/bucket_sort.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+// Gera n valores da distribuição pedida; as não uniformes exercitam a recursão adaptativa.
+template <typename T>
+static std::vector<T> gerar_bucket(const std::string& distribuicao, std::size_t n, std::mt19937_64& gerador) {
+    std::vector<T> v(n);
+    std::uniform_real_distribution<T> uniforme(-1000, 1000);
+    std::normal_distribution<T> normal(5, 0.001);
+    std::exponential_distribution<T> exponencial(1);
+    for (auto& x : v) {
+        if (distribuicao == "uniforme") {
+            x = uniforme(gerador);
+        } else if (distribuicao == "normal_estreita") {
+            x = normal(gerador);
+        } else if (distribuicao == "exponencial_extrema") {
+            // Magnitudes de 1e-30 a 1e30: cada nível só separa uma parte, até cair no quicksort.
+            x = static_cast<T>(std::pow(10.0, uniforme(gerador) * 0.03)) * (gerador() % 2 ? 1 : -1);
+        } else if (distribuicao == "poucos_distintos") {
+            x = static_cast<T>(gerador() % 5) * T(0.5);
+        } else {
+            x = exponencial(gerador);
+        }
+    }
+    return v;
+}
+
+template <typename T>
+static void conferir_bucket(std::vector<T> v, unsigned threads) {
+    std::vector<T> esperado = v;
+    std::sort(esperado.begin(), esperado.end());
+    if (threads == 0) {
+        bucket_sort(v);
+    } else {
+        bucket_sort_paralelo(v, threads);
+    }
+    ASSERT_EQ(v, esperado) << "threads = " << threads;
+}
+
+// Suíte de testes para o Bucket Sort
+TEST(BucketSortTest, TesteSequencial) {
+    std::mt19937_64 gerador(42);
+    for (std::string distribuicao : {"uniforme", "normal_estreita", "exponencial_extrema", "poucos_distintos", "exponencial"}) {
+        for (std::size_t n : {0, 1, 2, 100, 257, 5000, 200000}) {
+            conferir_bucket(gerar_bucket<double>(distribuicao, n, gerador), 0);
+            conferir_bucket(gerar_bucket<float>(distribuicao, n, gerador), 0);
+        }
+    }
+}
+
+TEST(BucketSortTest, TesteParaleloInPlace) {
+    std::mt19937_64 gerador(7);
+    for (std::string distribuicao : {"uniforme", "normal_estreita", "exponencial_extrema", "poucos_distintos", "exponencial"}) {
+        for (unsigned threads : {2u, 3u, 5u}) {
+            // Tamanhos que não são múltiplos do bloco, para passar pelo transbordo.
+            conferir_bucket(gerar_bucket<double>(distribuicao, 400003, gerador), threads);
+            conferir_bucket(gerar_bucket<float>(distribuicao, 300001, gerador), threads);
+        }
+    }
+}
+
+TEST(BucketSortTest, TesteValoresEspeciais) {
+    const double infinito = std::numeric_limits<double>::infinity();
+    std::mt19937_64 gerador(3);
+    for (unsigned threads : {0u, 4u}) {
+        // Infinitos: a largura da faixa não é finita e a ordenação cai no quicksort.
+        std::vector<double> v = gerar_bucket<double>("uniforme", 300000, gerador);
+        v[10] = infinito;
+        v[20] = -infinito;
+        v[30] = std::numeric_limits<double>::max();
+        conferir_bucket(v, threads);
+        // Todos iguais.
+        conferir_bucket(std::vector<double>(300000, 2.5), threads);
+
+        v[40] = std::nan("");
+        if (threads == 0) {
+            EXPECT_THROW(bucket_sort(v), std::invalid_argument);
+        } else {
+            EXPECT_THROW(bucket_sort_paralelo(v, threads), std::invalid_argument);
+        }
+    }
+}
+
+TEST(BucketSortTest, TesteZerosComOsDoisSinais) {
+    for (unsigned threads : {0u, 4u}) {
+        for (std::size_t n : {std::size_t(12), std::size_t(300000)}) {
+            // -1.0, -0.0, +0.0 e 1.0 alternados: os zeros dos dois sinais são iguais para a ordem,
+            // então podem sair em qualquer ordem entre eles, mas todos entre os negativos e os
+            // positivos, e nenhum perde o sinal.
+            const double valores[] = {-1.0, -0.0, 0.0, 1.0};
+            std::vector<double> v(n);
+            for (std::size_t i = 0; i < n; ++i) v[i] = valores[i % 4];
+            const std::size_t quarto = n / 4;
+            if (threads == 0) {
+                bucket_sort(v);
+            } else {
+                bucket_sort_paralelo(v, threads);
+            }
+            std::size_t zeros_negativos = 0;
+            for (std::size_t i = 0; i < n; ++i) {
+                if (i < quarto) {
+                    ASSERT_EQ(v[i], -1.0) << i;
+                } else if (i < 3 * quarto) {
+                    ASSERT_EQ(v[i], 0.0) << i;
+                    zeros_negativos += std::signbit(v[i]);
+                } else {
+                    ASSERT_EQ(v[i], 1.0) << i;
+                }
+            }
+            EXPECT_EQ(zeros_negativos, quarto) << "threads = " << threads << ", n = " << n;
+        }
+    }
+}
+
+TEST(BucketSortTest, TesteNaNEmVetorPequeno) {
+    // Abaixo de BUCKET_SORT_LIMIAR_QUICKSORT, o NaN também é rejeitado antes do quicksort.
+    for (std::size_t n : {std::size_t(1), std::size_t(5), BUCKET_SORT_LIMIAR_QUICKSORT}) {
+        std::vector<double> v(n);
+        for (std::size_t i = 0; i < n; ++i) v[i] = static_cast<double>(n - i);
+        v[n / 2] = std::nan("");
+        std::vector<float> f(v.begin(), v.end());
+        EXPECT_THROW(bucket_sort(v), std::invalid_argument) << n;
+        EXPECT_THROW(bucket_sort_paralelo(v, 4), std::invalid_argument) << n;
+        EXPECT_THROW(bucket_sort(f), std::invalid_argument) << n;
+    }
+}
@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+#include "algoritmos_ordenacao/counting_sort.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+// Registro com uma chave de faixa pequena e a posição original, para conferir a estabilidade.
+struct RegistroContagem {
+    std::uint16_t status;
+    std::uint32_t posicao;
+    std::string corpo;
+
+    bool operator==(const RegistroContagem&) const = default;
+};
+
+// Suíte de testes para o Counting Sort
+TEST(CountingSortTest, TesteChavesSequencialEParalelo) {
+    std::mt19937_64 gerador(42);
+    for (std::size_t n : {0, 1, 2, 100, 5000, 300000}) {
+        std::vector<std::int32_t> v(n);
+        for (auto& x : v) x = static_cast<std::int32_t>(gerador() % 1000) - 500;
+        std::vector<std::int32_t> esperado = v;
+        std::sort(esperado.begin(), esperado.end());
+        for (unsigned threads : {1u, 3u, 8u}) {
+            std::vector<std::int32_t> w = v;
+            counting_sort_paralelo(w, threads);
+            EXPECT_EQ(w, esperado) << "n = " << n << ", threads = " << threads;
+        }
+        counting_sort(v);
+        EXPECT_EQ(v, esperado);
+    }
+    // Extremos do tipo, todos iguais e chaves de 8 bits.
+    std::vector<std::int64_t> extremos = {std::numeric_limits<std::int64_t>::max(), std::numeric_limits<std::int64_t>::max() - 3,
+                                          std::numeric_limits<std::int64_t>::max() - 1};
+    counting_sort(extremos);
+    EXPECT_TRUE(std::is_sorted(extremos.begin(), extremos.end()));
+    std::vector<std::uint8_t> bytes(100000), iguais(1000, 7);
+    for (auto& x : bytes) x = static_cast<std::uint8_t>(gerador());
+    std::vector<std::uint8_t> bytes_esperado = bytes;
+    std::sort(bytes_esperado.begin(), bytes_esperado.end());
+    counting_sort_paralelo(bytes, 2);
+    EXPECT_EQ(bytes, bytes_esperado);
+    counting_sort(iguais);
+    EXPECT_EQ(iguais, std::vector<std::uint8_t>(1000, 7));
+}
+
+TEST(CountingSortTest, TesteFaixaGrandeDemais) {
+    std::vector<std::int64_t> v = {0, static_cast<std::int64_t>(COUNTING_SORT_FAIXA_MAXIMA)};
+    EXPECT_THROW(counting_sort(v), std::invalid_argument);
+    v = {0, static_cast<std::int64_t>(COUNTING_SORT_FAIXA_MAXIMA) - 1, 5};
+    counting_sort(v);
+    EXPECT_EQ(v, (std::vector<std::int64_t>{0, 5, static_cast<std::int64_t>(COUNTING_SORT_FAIXA_MAXIMA) - 1}));
+}
+
+TEST(CountingSortTest, TesteEstabilidadeComCarga) {
+    std::mt19937_64 gerador(7);
+    const std::size_t n = 200000;
+    std::vector<RegistroContagem> registros(n);
+    std::vector<std::uint16_t> chaves(n);
+    std::vector<std::uint32_t> valores(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto status = static_cast<std::uint16_t>(100 + gerador() % 500);
+        registros[i] = {status, static_cast<std::uint32_t>(i), std::to_string(i)};
+        chaves[i] = status;
+        valores[i] = static_cast<std::uint32_t>(i);
+    }
+    std::vector<RegistroContagem> esperado = registros;
+    std::stable_sort(esperado.begin(), esperado.end(), [](const auto& a, const auto& b) { return a.status < b.status; });
+
+    for (unsigned threads : {1u, 4u}) {
+        std::vector<RegistroContagem> v = registros;
+        counting_sort_paralelo_por_chave(v, [](const RegistroContagem& r) { return r.status; }, threads);
+        EXPECT_EQ(v, esperado);
+        std::vector<std::uint16_t> k = chaves;
+        std::vector<std::uint32_t> p = valores;
+        counting_sort_com_valores(k, p, threads);
+        for (std::size_t i = 0; i < n; ++i) {
+            ASSERT_EQ(k[i], esperado[i].status);
+            ASSERT_EQ(p[i], esperado[i].posicao);
+        }
+    }
+    std::vector<RegistroContagem> v = registros;
+    counting_sort_por_chave(v, [](const RegistroContagem& r) { return r.status; });
+    EXPECT_EQ(v, esperado);
+
+    std::vector<std::uint32_t> curto(3);
+    EXPECT_THROW(counting_sort_com_valores(chaves, curto), std::invalid_argument);
+}
@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+#include "algoritmos_ordenacao/heapsort.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Suíte de testes para o Heapsort
+TEST(HeapsortTest, TesteAleatorios) {
+    std::mt19937_64 gerador(42);
+    for (std::size_t n : {0, 1, 2, 3, 10, 1000, 50000}) {
+        std::vector<int> v(n);
+        for (auto& x : v) x = static_cast<int>(gerador() % 1000) - 500;
+        std::vector<int> esperado = v;
+        std::sort(esperado.begin(), esperado.end());
+        heapsort(v);
+        EXPECT_EQ(v, esperado);
+        std::sort(esperado.begin(), esperado.end(), std::greater<>());
+        heapsort(v.begin(), v.end(), std::greater<>());
+        EXPECT_EQ(v, esperado);
+    }
+}
+
+TEST(HeapsortTest, TesteStrings) {
+    std::vector<std::string> v = {"pera", "uva", "abacate", "maçã", "banana", "uva", ""};
+    std::vector<std::string> esperado = v;
+    std::sort(esperado.begin(), esperado.end());
+    heapsort(v);
+    EXPECT_EQ(v, esperado);
+}
+
+TEST(HeapsortTest, TesteParcial) {
+    std::mt19937_64 gerador(7);
+    for (std::size_t n : {0, 1, 5, 1000, 100000}) {
+        std::vector<std::int64_t> original(n);
+        for (auto& x : original) x = static_cast<std::int64_t>(gerador() % 5000);
+        std::vector<std::int64_t> ordenado = original;
+        std::sort(ordenado.begin(), ordenado.end());
+        for (std::size_t k : {std::size_t(0), std::size_t(1), std::size_t(10), n / 2, n, n + 3}) {
+            std::vector<std::int64_t> v = original;
+            partial_sort(v, k);
+            const auto m = static_cast<std::ptrdiff_t>(std::min(k, n));
+            EXPECT_TRUE(std::equal(v.begin(), v.begin() + m, ordenado.begin())) << "n = " << n << ", k = " << k;
+            // O resto é uma permutação do que sobrou.
+            std::sort(v.begin() + m, v.end());
+            EXPECT_EQ(v, ordenado);
+        }
+    }
+    std::vector<int> v = {5, 1, 4, 2, 3};
+    heapsort_parcial(v.begin(), v.begin() + 2, v.end(), std::greater<>());
+    EXPECT_EQ(v[0], 5);
+    EXPECT_EQ(v[1], 4);
+}
+
+TEST(HeapsortTest, TesteTopKEmLotes) {
+    std::mt19937_64 gerador(3);
+    std::vector<double> todos;
+    AcumuladorTopK<double> maiores(1000);
+    AcumuladorTopK<double, std::greater<>> menores(10);
+    EXPECT_THROW(maiores.limiar(), std::out_of_range);
+    for (int lote = 0; lote < 50; ++lote) {
+        std::vector<double> valores(1 + gerador() % 5000);
+        for (auto& x : valores) x = static_cast<double>(gerador() % 100000) / 7;
+        todos.insert(todos.end(), valores.begin(), valores.end());
+        maiores.adicionar(valores);
+        menores.adicionar(valores.begin(), valores.end());
+    }
+    menores.adicionar(-1.0);
+
+    std::vector<double> ordenado = todos;
+    std::sort(ordenado.begin(), ordenado.end(), std::greater<>());
+    EXPECT_EQ(maiores.tamanho(), 1000u);
+    EXPECT_EQ(maiores.resultado(), std::vector<double>(ordenado.begin(), ordenado.begin() + 1000));
+    EXPECT_EQ(maiores.limiar(), ordenado[999]);
+    EXPECT_EQ(top_k(todos, 1000), maiores.resultado());
+
+    std::vector<double> esperado_menores = {-1.0};
+    esperado_menores.insert(esperado_menores.end(), ordenado.rbegin(), ordenado.rbegin() + 9);
+    EXPECT_EQ(menores.resultado(), esperado_menores);
+
+    // k maior que o fluxo e k = 0.
+    EXPECT_EQ(top_k(std::vector<int>{3, 1, 2}, 10), (std::vector<int>{3, 2, 1}));
+    AcumuladorTopK<std::string> nenhum(0);
+    nenhum.adicionar("a");
+    EXPECT_EQ(nenhum.tamanho(), 0u);
+    EXPECT_TRUE(nenhum.resultado().empty());
+}
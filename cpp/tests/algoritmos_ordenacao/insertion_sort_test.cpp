@@ -0,0 +1,43 @@
+#include <gtest/gtest.h>
+#include "algoritmos_ordenacao/insertion_sort.hpp"
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+// Suíte de testes para o Insertion Sort
+TEST(InsertionSortTest, TesteAleatorios) {
+    std::mt19937_64 gerador(42);
+    for (std::size_t n : {0, 1, 2, 5, 64, 500}) {
+        std::vector<int> v(n);
+        for (auto& x : v) x = static_cast<int>(gerador() % 100);
+        std::vector<int> esperado = v;
+        std::sort(esperado.begin(), esperado.end());
+        insertion_sort(v);
+        EXPECT_EQ(v, esperado);
+    }
+}
+
+TEST(InsertionSortTest, TesteEstabilidade) {
+    std::vector<std::pair<int, char>> v = {{2, 'a'}, {1, 'b'}, {2, 'c'}, {1, 'd'}, {0, 'e'}, {2, 'f'}};
+    insertion_sort(v, [](const auto& a, const auto& b) { return a.first < b.first; });
+    std::vector<std::pair<int, char>> esperado = {{0, 'e'}, {1, 'b'}, {1, 'd'}, {2, 'a'}, {2, 'c'}, {2, 'f'}};
+    EXPECT_EQ(v, esperado);
+}
+
+TEST(InsertionSortTest, TesteSemDesvios) {
+    std::mt19937_64 gerador(7);
+    for (std::size_t n : {0, 1, 2, 7, 33}) {
+        std::vector<long> v(n);
+        for (auto& x : v) x = static_cast<long>(gerador() % 10) - 5;
+        std::vector<long> esperado = v;
+        std::sort(esperado.begin(), esperado.end());
+        insertion_sort_sem_desvios(v.begin(), v.end());
+        EXPECT_EQ(v, esperado);
+    }
+    // Também é estável.
+    std::vector<std::pair<int, char>> v = {{2, 'a'}, {1, 'b'}, {2, 'c'}, {1, 'd'}, {0, 'e'}, {2, 'f'}};
+    insertion_sort_sem_desvios(v.begin(), v.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+    std::vector<std::pair<int, char>> esperado = {{0, 'e'}, {1, 'b'}, {1, 'd'}, {2, 'a'}, {2, 'c'}, {2, 'f'}};
+    EXPECT_EQ(v, esperado);
+}
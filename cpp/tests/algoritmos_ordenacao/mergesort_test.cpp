@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+#include "algoritmos_ordenacao/mergesort.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+struct RegistroMergesort {
+    std::uint32_t chave;
+    std::uint32_t ordem;
+    bool operator==(const RegistroMergesort&) const = default;
+};
+
+static bool por_chave(const RegistroMergesort& a, const RegistroMergesort& b) {
+    return a.chave < b.chave;
+}
+
+// Chaves com muitas repetições; `ordem` guarda a posição original para conferir a estabilidade.
+static std::vector<RegistroMergesort> registros(std::size_t n, std::uint32_t distintas, std::mt19937_64& gerador) {
+    std::vector<RegistroMergesort> v(n);
+    for (std::uint32_t i = 0; i < n; ++i) v[i] = {static_cast<std::uint32_t>(gerador() % distintas), i};
+    return v;
+}
+
+static std::string caminho_temporario(const std::string& nome) {
+    std::filesystem::path caminho = std::filesystem::temp_directory_path() / nome;
+    std::filesystem::remove(caminho);
+    return caminho.string();
+}
+
+// Suíte de testes para o Mergesort
+TEST(MergesortTest, TesteSequencialEstavel) {
+    std::mt19937_64 gerador(42);
+    for (std::size_t n : {0, 1, 2, 31, 32, 33, 1000, 100000}) {
+        std::vector<RegistroMergesort> v = registros(n, 50, gerador);
+        std::vector<RegistroMergesort> esperado = v;
+        std::stable_sort(esperado.begin(), esperado.end(), por_chave);
+        mergesort(v, por_chave);
+        EXPECT_EQ(v, esperado) << "n = " << n;
+    }
+    std::vector<std::string> s = {"uva", "pera", "abacate", "uva", "banana", ""};
+    std::vector<std::string> esperado = s;
+    std::sort(esperado.begin(), esperado.end(), std::greater<>());
+    mergesort(s.begin(), s.end(), std::greater<>());
+    EXPECT_EQ(s, esperado);
+}
+
+TEST(MergesortTest, TesteParaleloEstavel) {
+    std::mt19937_64 gerador(7);
+    // 7 threads: número que não é potência de 2, para exercitar as folhas vazias da árvore.
+    for (unsigned threads : {2u, 4u, 7u}) {
+        for (std::uint32_t distintas : {3u, 1000u, 1u << 30}) {
+            std::vector<RegistroMergesort> v = registros(300000, distintas, gerador);
+            std::vector<RegistroMergesort> esperado = v;
+            std::stable_sort(esperado.begin(), esperado.end(), por_chave);
+            mergesort_paralelo(v, por_chave, threads);
+            ASSERT_EQ(v, esperado) << threads << " threads, " << distintas << " chaves distintas";
+        }
+    }
+    // Blocos em que todos os elementos de um vêm antes dos de outro (entrada invertida).
+    std::vector<std::int64_t> v(200000);
+    for (std::size_t i = 0; i < v.size(); ++i) v[i] = static_cast<std::int64_t>(v.size() - i);
+    mergesort_paralelo(v, std::less<>(), 5);
+    EXPECT_TRUE(std::is_sorted(v.begin(), v.end()));
+}
+
+TEST(MergesortTest, TesteDividirSequencias) {
+    std::mt19937_64 gerador(3);
+    std::vector<std::vector<int>> blocos(5);
+    std::vector<std::pair<const int*, const int*>> sequencias;
+    for (auto& b : blocos) {
+        b.resize(gerador() % 50);
+        for (auto& x : b) x = static_cast<int>(gerador() % 10);
+        std::sort(b.begin(), b.end());
+        sequencias.push_back({b.data(), b.data() + b.size()});
+    }
+    std::less<> comp;
+    std::size_t total = 0;
+    for (const auto& b : blocos) total += b.size();
+    std::vector<std::size_t> anterior(blocos.size(), 0);
+    for (std::size_t posto = 0; posto <= total; ++posto) {
+        std::vector<std::size_t> divisao = dividir_sequencias(sequencias, posto, comp);
+        std::size_t soma = 0;
+        for (std::size_t i = 0; i < blocos.size(); ++i) {
+            soma += divisao[i];
+            // Cada posto seguinte acrescenta exatamente um elemento a uma das sequências.
+            EXPECT_GE(divisao[i], anterior[i]);
+        }
+        EXPECT_EQ(soma, posto);
+        anterior = divisao;
+    }
+}
+
+TEST(MergesortTest, TesteExternoBinarioEmVariasPassadas) {
+    std::mt19937_64 gerador(11);
+    std::vector<std::uint64_t> dados(200000);
+    for (auto& x : dados) x = gerador();
+    const std::string entrada = caminho_temporario("mergesort_externo_entrada.bin");
+    const std::string saida = caminho_temporario("mergesort_externo_saida.bin");
+    {
+        std::ofstream arquivo(entrada, std::ios::binary);
+        arquivo.write(reinterpret_cast<const char*>(dados.data()), dados.size() * sizeof(std::uint64_t));
+    }
+    // 64 KB por sequência dá ~50 sequências; com 4 vias são necessárias várias passadas.
+    OpcoesOrdenacaoExterna opcoes;
+    opcoes.memoria_bytes = 64 << 10;
+    opcoes.max_vias = 4;
+    mergesort_externo<std::uint64_t>(entrada, saida, opcoes);
+
+    std::vector<std::uint64_t> resultado(dados.size());
+    std::ifstream arquivo(saida, std::ios::binary);
+    arquivo.read(reinterpret_cast<char*>(resultado.data()), resultado.size() * sizeof(std::uint64_t));
+    EXPECT_EQ(static_cast<std::size_t>(arquivo.gcount()), dados.size() * sizeof(std::uint64_t));
+    std::sort(dados.begin(), dados.end());
+    EXPECT_EQ(resultado, dados);
+    EXPECT_EQ(std::filesystem::file_size(saida), dados.size() * sizeof(std::uint64_t));
+    std::filesystem::remove(entrada);
+    std::filesystem::remove(saida);
+}
+
+TEST(MergesortTest, TesteExternoLinhasEstavel) {
+    std::mt19937_64 gerador(5);
+    const std::string caminho = caminho_temporario("mergesort_externo_linhas.txt");
+    std::vector<std::string> linhas(30000);
+    {
+        std::ofstream arquivo(caminho);
+        for (std::size_t i = 0; i < linhas.size(); ++i) {
+            linhas[i] = std::to_string(gerador() % 100) + " evento " + std::to_string(i);
+            arquivo << linhas[i] << '\n';
+        }
+    }
+    // Ordena pelo primeiro campo; os empates devem manter a ordem do arquivo. A saída é o próprio
+    // arquivo de entrada.
+    auto por_campo = [](const std::string& a, const std::string& b) {
+        return std::stoi(a.substr(0, a.find(' '))) < std::stoi(b.substr(0, b.find(' ')));
+    };
+    OpcoesOrdenacaoExterna opcoes;
+    opcoes.memoria_bytes = 256 << 10;
+    opcoes.max_vias = 3;
+    mergesort_externo<std::string>(caminho, caminho, opcoes, por_campo);
+
+    std::stable_sort(linhas.begin(), linhas.end(), por_campo);
+    std::ifstream arquivo(caminho);
+    std::vector<std::string> resultado;
+    for (std::string linha; std::getline(arquivo, linha);) resultado.push_back(linha);
+    EXPECT_EQ(resultado, linhas);
+    std::filesystem::remove(caminho);
+
+    // Arquivo vazio e arquivo inexistente.
+    const std::string vazio = caminho_temporario("mergesort_externo_vazio.txt");
+    std::ofstream(vazio).close();
+    mergesort_externo<std::string>(vazio, vazio);
+    EXPECT_EQ(std::filesystem::file_size(vazio), 0u);
+    std::filesystem::remove(vazio);
+    EXPECT_THROW(mergesort_externo<std::string>(vazio, vazio), std::runtime_error);
+}
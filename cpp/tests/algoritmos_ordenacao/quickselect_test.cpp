@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+#include "algoritmos_ordenacao/quickselect.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+// Confere a semântica de nth_element: *k no lugar certo, nada maior antes e nada menor depois.
+template <typename T, typename Comparador = std::less<>>
+void conferir_particao(const std::vector<T>& v, std::size_t k, const std::vector<T>& ordenado, Comparador comp = {}) {
+    ASSERT_FALSE(comp(v[k], ordenado[k]) || comp(ordenado[k], v[k])) << "k = " << k;
+    for (std::size_t i = 0; i < k; ++i) ASSERT_FALSE(comp(v[k], v[i]));
+    for (std::size_t i = k + 1; i < v.size(); ++i) ASSERT_FALSE(comp(v[i], v[k]));
+}
+
+// Suíte de testes para o Quickselect
+TEST(QuickselectTest, TesteContraOrdenacao) {
+    std::mt19937_64 gerador(42);
+    for (std::size_t n : {1, 2, 5, 17, 600, 601, 5000, 200000}) {
+        for (std::uint64_t distintos : {std::uint64_t(3), std::uint64_t(1) << 40}) {
+            std::vector<std::int64_t> original(n);
+            for (auto& x : original) x = static_cast<std::int64_t>(gerador() % distintos);
+            std::vector<std::int64_t> ordenado = original;
+            std::sort(ordenado.begin(), ordenado.end());
+            for (std::size_t k : {std::size_t(0), n / 2, n - 1, static_cast<std::size_t>(gerador() % n)}) {
+                std::vector<std::int64_t> v = original;
+                EXPECT_EQ(quickselect(v, k), ordenado[k]);
+                conferir_particao(v, k, ordenado);
+            }
+        }
+    }
+    std::vector<int> vazio;
+    EXPECT_THROW(quickselect(vazio, 0), std::out_of_range);
+}
+
+TEST(QuickselectTest, TesteEntradasComPadroes) {
+    const std::size_t n = 100000;
+    std::vector<int> crescente(n), decrescente(n), orgao(n), iguais(n, 7);
+    std::iota(crescente.begin(), crescente.end(), 0);
+    std::iota(decrescente.rbegin(), decrescente.rend(), 0);
+    for (std::size_t i = 0; i < n; ++i) orgao[i] = static_cast<int>(std::min(i, n - 1 - i));
+    for (const auto& original : {crescente, decrescente, orgao, iguais}) {
+        std::vector<int> ordenado = original;
+        std::sort(ordenado.begin(), ordenado.end());
+        for (std::size_t k : {std::size_t(0), n / 3, n - 1}) {
+            std::vector<int> v = original;
+            quickselect(v.begin(), v.begin() + static_cast<std::ptrdiff_t>(k), v.end());
+            conferir_particao(v, k, ordenado);
+        }
+    }
+    // Comparador decrescente e strings.
+    std::vector<std::string> s = {"d", "a", "c", "e", "b"};
+    EXPECT_EQ(quickselect(s, 1, std::greater<>()), "d");
+}
+
+TEST(QuickselectTest, TesteSelecaoLinear) {
+    std::mt19937_64 gerador(3);
+    std::less<> comp;
+    for (std::size_t n : {1, 16, 17, 100, 10000}) {
+        std::vector<int> original(n);
+        for (auto& x : original) x = static_cast<int>(gerador() % 50);
+        std::vector<int> ordenado = original;
+        std::sort(ordenado.begin(), ordenado.end());
+        for (std::size_t k = 0; k < n; k += n / 7 + 1) {
+            std::vector<int> v = original;
+            selecao_linear(v.begin(), v.begin() + static_cast<std::ptrdiff_t>(k), v.end(), comp);
+            conferir_particao(v, k, ordenado);
+        }
+    }
+}
+
+TEST(QuickselectTest, TesteMultiSelect) {
+    std::mt19937_64 gerador(9);
+    const std::size_t n = 100000;
+    std::vector<double> latencias(n);
+    std::exponential_distribution<double> exponencial(0.01);
+    for (auto& x : latencias) x = exponencial(gerador);
+    std::vector<double> ordenado = latencias;
+    std::sort(ordenado.begin(), ordenado.end());
+
+    // p50, p90, p99 e p999 fora de ordem, com um posto repetido.
+    std::vector<std::size_t> postos = {n * 99 / 100, n / 2, n * 999 / 1000, n * 9 / 10, n / 2, 0, n - 1};
+    std::vector<double> v = latencias;
+    std::vector<double> resultado = multi_select(v, postos);
+    ASSERT_EQ(resultado.size(), postos.size());
+    for (std::size_t i = 0; i < postos.size(); ++i) EXPECT_EQ(resultado[i], ordenado[postos[i]]);
+    // O vetor fica particionado entre os postos.
+    std::vector<std::size_t> crescentes = {0, n / 2, n * 9 / 10, n * 99 / 100, n * 999 / 1000, n - 1};
+    for (std::size_t i = 0; i + 1 < crescentes.size(); ++i) {
+        auto inicio = v.begin() + static_cast<std::ptrdiff_t>(crescentes[i]);
+        auto fim = v.begin() + static_cast<std::ptrdiff_t>(crescentes[i + 1]);
+        EXPECT_LE(*std::max_element(inicio, fim), *fim);
+        EXPECT_GE(*std::min_element(inicio, fim), *inicio);
+    }
+    EXPECT_THROW(multi_select(v, {n}), std::out_of_range);
+}
+
+TEST(QuickselectTest, TesteParticaoParalela) {
+    std::mt19937_64 gerador(5);
+    for (unsigned threads : {1u, 3u, 8u}) {
+        std::vector<int> v(10007);
+        for (auto& x : v) x = static_cast<int>(gerador() % 1000);
+        std::vector<int> ordenado = v;
+        std::sort(ordenado.begin(), ordenado.end());
+        auto menor_que_300 = [](int x) { return x < 300; };
+        std::size_t m = particionar_paralelo(v.data(), v.size(), menor_que_300, threads);
+        EXPECT_EQ(m, static_cast<std::size_t>(std::count_if(ordenado.begin(), ordenado.end(), menor_que_300)));
+        EXPECT_TRUE(std::is_partitioned(v.begin(), v.end(), menor_que_300));
+        EXPECT_EQ(static_cast<std::size_t>(std::partition_point(v.begin(), v.end(), menor_que_300) - v.begin()), m);
+        std::sort(v.begin(), v.end());
+        EXPECT_EQ(v, ordenado);
+    }
+}
+
+TEST(QuickselectTest, TesteQuickselectParalelo) {
+    // Acima do limiar, para passar pelas partições paralelas.
+    std::mt19937_64 gerador(1);
+    const std::size_t n = QUICKSELECT_LIMIAR_PARALELO + 12345;
+    std::vector<std::uint32_t> v(n);
+    for (auto& x : v) x = static_cast<std::uint32_t>(gerador() % 100000);
+    std::vector<std::uint32_t> w = v;
+    const std::size_t k = n * 99 / 100;
+    std::nth_element(w.begin(), w.begin() + static_cast<std::ptrdiff_t>(k), w.end());
+    EXPECT_EQ(quickselect_paralelo(v, k, std::less<>(), 4), w[k]);
+    for (std::size_t i = 0; i < n; i += 997) {
+        if (i < k) {
+            ASSERT_LE(v[i], v[k]);
+        } else {
+            ASSERT_GE(v[i], v[k]);
+        }
+    }
+}
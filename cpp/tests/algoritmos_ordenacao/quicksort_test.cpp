@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+#include "algoritmos_ordenacao/quicksort.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+// Gera as distribuições que exercitam cada caminho: aleatória, ordenada, invertida, "órgão"
+// (sobe e desce), poucos valores distintos, todos iguais e ordenada com ruído.
+std::vector<std::vector<std::int64_t>> distribuicoes(std::size_t n, std::mt19937_64& gerador) {
+    std::vector<std::vector<std::int64_t>> casos;
+    std::vector<std::int64_t> v(n);
+    for (auto& x : v) x = static_cast<std::int64_t>(gerador());
+    casos.push_back(v);
+    std::iota(v.begin(), v.end(), -static_cast<std::int64_t>(n / 2));
+    casos.push_back(v);
+    std::reverse(v.begin(), v.end());
+    casos.push_back(v);
+    for (std::size_t i = 0; i < n; ++i) v[i] = static_cast<std::int64_t>(std::min(i, n - 1 - i));
+    casos.push_back(v);
+    for (auto& x : v) x = static_cast<std::int64_t>(gerador() % 4);
+    casos.push_back(v);
+    casos.push_back(std::vector<std::int64_t>(n, 5));
+    std::iota(v.begin(), v.end(), 0);
+    for (std::size_t k = 0; k < n / 100 + 1 && n > 0; ++k) std::swap(v[gerador() % n], v[gerador() % n]);
+    casos.push_back(v);
+    return casos;
+}
+
+// Suíte de testes para o Quicksort
+TEST(QuicksortTest, TesteDistribuicoes) {
+    std::mt19937_64 gerador(42);
+    for (std::size_t n : {0, 1, 2, 3, 23, 24, 25, 128, 129, 1000, 100000}) {
+        for (auto v : distribuicoes(n, gerador)) {
+            std::vector<std::int64_t> esperado = v;
+            std::sort(esperado.begin(), esperado.end());
+            std::vector<std::int64_t> w = v;
+            quicksort(v);
+            EXPECT_EQ(v, esperado) << "n = " << n;
+            // Comparador próprio: mesmo resultado pelo caminho com desvios.
+            quicksort(w, [](std::int64_t a, std::int64_t b) { return a < b; });
+            EXPECT_EQ(w, esperado) << "n = " << n;
+        }
+    }
+}
+
+TEST(QuicksortTest, TesteComparadoresETipos) {
+    std::mt19937_64 gerador(7);
+    std::vector<double> d(50000);
+    std::normal_distribution<double> normal(0.0, 1.0);
+    for (auto& x : d) x = std::round(normal(gerador) * 100) / 100; // Muitas repetições
+    std::vector<double> esperado = d;
+    std::sort(esperado.begin(), esperado.end(), std::greater<>());
+    quicksort(d, std::greater<>());
+    EXPECT_EQ(d, esperado);
+
+    std::vector<std::string> s(20000);
+    for (auto& x : s) x = std::to_string(gerador() % 5000);
+    std::vector<std::string> s_esperado = s;
+    std::sort(s_esperado.begin(), s_esperado.end());
+    quicksort(s.begin(), s.end());
+    EXPECT_EQ(s, s_esperado);
+
+    // Registros por um campo, forçando a partição em blocos.
+    struct Registro {
+        std::uint32_t chave;
+        std::uint32_t id;
+    };
+    std::vector<Registro> r(30000);
+    for (std::uint32_t i = 0; i < r.size(); ++i) r[i] = {static_cast<std::uint32_t>(gerador() % 1000), i};
+    quicksort_em_blocos(r.begin(), r.end(), [](const Registro& a, const Registro& b) { return a.chave < b.chave; });
+    EXPECT_TRUE(std::is_sorted(r.begin(), r.end(), [](const Registro& a, const Registro& b) { return a.chave < b.chave; }));
+    std::vector<bool> visto(r.size(), false);
+    for (const auto& x : r) visto[x.id] = true;
+    EXPECT_TRUE(std::all_of(visto.begin(), visto.end(), [](bool b) { return b; }));
+}
+
+TEST(QuicksortTest, TesteAdversarioDeMcIlroy) {
+    // O adversário decide o valor de cada elemento só quando ele é comparado, sempre de modo a
+    // tornar o pivô um extremo. Sem a troca para o Heapsort, isso custaria ~n^2/2 comparações.
+    const int n = 100000;
+    const int gas = n;
+    std::vector<int> valor(n, gas);
+    int congelados = 0, candidato = 0;
+    std::size_t comparacoes = 0;
+    auto comp = [&](int x, int y) {
+        ++comparacoes;
+        if (valor[x] == gas && valor[y] == gas) {
+            if (x == candidato) {
+                valor[x] = congelados++;
+            } else {
+                valor[y] = congelados++;
+            }
+        }
+        if (valor[x] == gas) {
+            candidato = x;
+        } else if (valor[y] == gas) {
+            candidato = y;
+        }
+        return valor[x] < valor[y];
+    };
+    std::vector<int> indices(n);
+    std::iota(indices.begin(), indices.end(), 0);
+    quicksort(indices, comp);
+    EXPECT_TRUE(std::is_sorted(indices.begin(), indices.end(), [&](int x, int y) { return valor[x] < valor[y]; }));
+    EXPECT_LT(comparacoes, static_cast<std::size_t>(4 * n * std::log2(n)));
+}
+
+TEST(QuicksortTest, TesteEntradasOrdenadasSaoLineares) {
+    const std::size_t n = 100000;
+    std::size_t comparacoes = 0;
+    auto contar = [&](int a, int b) {
+        ++comparacoes;
+        return a < b;
+    };
+    std::vector<int> v(n);
+    std::iota(v.begin(), v.end(), 0);
+    quicksort(v, contar);
+    EXPECT_LT(comparacoes, 4 * n);
+    std::reverse(v.begin(), v.end());
+    comparacoes = 0;
+    quicksort(v, contar);
+    EXPECT_TRUE(std::is_sorted(v.begin(), v.end()));
+    EXPECT_LT(comparacoes, 4 * n);
+    std::fill(v.begin(), v.end(), 1);
+    comparacoes = 0;
+    quicksort(v, contar);
+    EXPECT_LT(comparacoes, 4 * n);
+}
@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+#include "algoritmos_ordenacao/radix_sort.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+template <typename T>
+std::vector<T> aleatorios(std::size_t n, std::mt19937_64& gerador) {
+    std::vector<T> v(n);
+    for (auto& x : v) x = static_cast<T>(gerador());
+    return v;
+}
+
+template <typename T>
+void conferir_com_std_sort(std::vector<T> v) {
+    std::vector<T> esperado = v;
+    std::sort(esperado.begin(), esperado.end());
+    radix_sort(v);
+    EXPECT_EQ(v, esperado);
+}
+
+// Suíte de testes para o Radix Sort
+TEST(RadixSortTest, TesteInteirosDeTodosOsTamanhos) {
+    std::mt19937_64 gerador(42);
+    for (std::size_t n : {0, 1, 2, 63, 64, 1000, 100000}) {
+        conferir_com_std_sort(aleatorios<std::uint8_t>(n, gerador));
+        conferir_com_std_sort(aleatorios<std::int16_t>(n, gerador));
+        conferir_com_std_sort(aleatorios<std::int32_t>(n, gerador));
+        conferir_com_std_sort(aleatorios<std::uint32_t>(n, gerador));
+        conferir_com_std_sort(aleatorios<std::int64_t>(n, gerador));
+        conferir_com_std_sort(aleatorios<std::uint64_t>(n, gerador));
+    }
+    // Extremos e dígitos constantes: valores pequenos, todos iguais, só negativos.
+    conferir_com_std_sort(std::vector<std::int64_t>{std::numeric_limits<std::int64_t>::max(), -1, 0,
+                                                    std::numeric_limits<std::int64_t>::min(), 1});
+    std::vector<std::uint32_t> pequenos(5000);
+    for (auto& x : pequenos) x = static_cast<std::uint32_t>(gerador() % 100);
+    conferir_com_std_sort(pequenos);
+    conferir_com_std_sort(std::vector<std::int32_t>(1000, -7));
+    std::vector<std::int32_t> negativos(3000);
+    for (auto& x : negativos) x = -static_cast<std::int32_t>(gerador() % 1000000) - 1;
+    conferir_com_std_sort(negativos);
+    // Dígitos de 8 bits em chaves de 32 bits.
+    std::vector<std::int32_t> v = aleatorios<std::int32_t>(10000, gerador), esperado = v;
+    std::sort(esperado.begin(), esperado.end());
+    radix_sort<std::int32_t, 8>(v);
+    EXPECT_EQ(v, esperado);
+}
+
+TEST(RadixSortTest, TestePontoFlutuante) {
+    std::mt19937_64 gerador(7);
+    std::normal_distribution<double> normal(0.0, 1e6);
+    std::vector<double> d(50000);
+    for (auto& x : d) x = normal(gerador);
+    d.insert(d.end(), {0.0, -0.0, std::numeric_limits<double>::infinity(), -std::numeric_limits<double>::infinity(),
+                       std::numeric_limits<double>::denorm_min(), -std::numeric_limits<double>::denorm_min()});
+    conferir_com_std_sort(d);
+    std::vector<float> f(50000);
+    for (auto& x : f) x = static_cast<float>(normal(gerador));
+    conferir_com_std_sort(f);
+
+    // -0.0 antes de +0.0, e NaN positivo depois de +inf.
+    std::vector<double> especiais = {0.0, std::numeric_limits<double>::quiet_NaN(), -0.0, 1.0,
+                                     std::numeric_limits<double>::infinity()};
+    radix_sort(especiais);
+    EXPECT_TRUE(std::signbit(especiais[0]));
+    EXPECT_FALSE(std::signbit(especiais[1]));
+    EXPECT_EQ(especiais[3], std::numeric_limits<double>::infinity());
+    EXPECT_TRUE(std::isnan(especiais[4]));
+}
+
+TEST(RadixSortTest, TesteChaveEValorEstaveis) {
+    std::mt19937_64 gerador(3);
+    const std::size_t n = 20000;
+    std::vector<std::uint16_t> chaves(n);
+    std::vector<std::string> valores(n);
+    std::vector<std::pair<std::uint16_t, std::string>> referencia(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        chaves[i] = static_cast<std::uint16_t>(gerador() % 500);
+        valores[i] = std::to_string(i);
+        referencia[i] = {chaves[i], valores[i]};
+    }
+    std::stable_sort(referencia.begin(), referencia.end(),
+                     [](const auto& a, const auto& b) { return a.first < b.first; });
+    radix_sort_com_valores(chaves, valores);
+    for (std::size_t i = 0; i < n; ++i) {
+        ASSERT_EQ(chaves[i], referencia[i].first);
+        ASSERT_EQ(valores[i], referencia[i].second);
+    }
+    std::vector<int> curto(3);
+    std::vector<int> longo(4);
+    EXPECT_THROW(radix_sort_com_valores(curto, longo), std::invalid_argument);
+
+    // Registros de 16 bytes ordenados por uma chave float, com índice para conferir a estabilidade.
+    struct Registro {
+        float chave;
+        std::uint32_t indice;
+        std::uint64_t carga;
+    };
+    std::vector<Registro> registros(n);
+    for (std::size_t i = 0; i < n; ++i) registros[i] = {static_cast<float>(gerador() % 1000) - 500.0f, static_cast<std::uint32_t>(i), i * 3};
+    auto esperado = registros;
+    std::stable_sort(esperado.begin(), esperado.end(), [](const Registro& a, const Registro& b) { return a.chave < b.chave; });
+    radix_sort_por_chave(registros, [](const Registro& r) { return r.chave; });
+    for (std::size_t i = 0; i < n; ++i) {
+        ASSERT_EQ(registros[i].indice, esperado[i].indice);
+        ASSERT_EQ(registros[i].carga, esperado[i].carga);
+    }
+}
+
+TEST(RadixSortTest, TesteParalelo) {
+    std::mt19937_64 gerador(11);
+    for (unsigned threads : {1u, 2u, 3u, 4u}) {
+        std::vector<std::int64_t> v = aleatorios<std::int64_t>(300000, gerador), esperado = v;
+        std::sort(esperado.begin(), esperado.end());
+        radix_sort_paralelo(v, threads);
+        ASSERT_EQ(v, esperado) << threads << " threads";
+    }
+    // Estabilidade entre blocos de threads diferentes, e dígitos constantes.
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> pares(400000);
+    for (std::uint32_t i = 0; i < pares.size(); ++i) pares[i] = {static_cast<std::uint32_t>(gerador() % 3000), i};
+    auto esperado = pares;
+    std::stable_sort(esperado.begin(), esperado.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+    radix_sort_paralelo_por_chave(pares, [](const auto& p) { return p.first; }, 4);
+    EXPECT_EQ(pares, esperado);
+
+    std::vector<float> f(300000);
+    for (auto& x : f) x = static_cast<float>(static_cast<std::int64_t>(gerador() % 2000001) - 1000000) / 7.0f;
+    std::vector<float> fe = f;
+    std::sort(fe.begin(), fe.end());
+    radix_sort_paralelo(f, 3);
+    EXPECT_EQ(f, fe);
+}
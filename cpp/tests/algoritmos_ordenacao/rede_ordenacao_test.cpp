@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+#include "algoritmos_ordenacao/rede_ordenacao.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+// Os conjuntos de instruções que este processador consegue executar.
+static std::vector<ConjuntoInstrucoes> conjuntos_testaveis() {
+    std::vector<ConjuntoInstrucoes> conjuntos = {ConjuntoInstrucoes::Escalar};
+    if (conjunto_instrucoes_disponivel() != ConjuntoInstrucoes::Escalar) conjuntos.push_back(ConjuntoInstrucoes::Sse42);
+    if (conjunto_instrucoes_disponivel() == ConjuntoInstrucoes::Avx2) conjuntos.push_back(ConjuntoInstrucoes::Avx2);
+    return conjuntos;
+}
+
+// Todos os tamanhos de 0 a 64, com valores espalhados, repetidos e nos extremos do tipo.
+template <typename T>
+static void conferir_rede(std::mt19937_64& gerador) {
+    for (ConjuntoInstrucoes conjunto : conjuntos_testaveis()) {
+        for (std::size_t n = 0; n <= REDE_ORDENACAO_MAXIMO; ++n) {
+            for (int distribuicao = 0; distribuicao < 3; ++distribuicao) {
+                std::vector<T> v(n);
+                for (auto& x : v) {
+                    const std::uint64_t r = gerador();
+                    if (distribuicao == 0) {
+                        x = std::is_floating_point_v<T> ? static_cast<T>(static_cast<std::int64_t>(r) / 1e9) : static_cast<T>(r);
+                    } else if (distribuicao == 1) {
+                        x = static_cast<T>(static_cast<int>(r % 5) - 2);
+                    } else {
+                        x = r % 2 ? std::numeric_limits<T>::max() : std::numeric_limits<T>::lowest();
+                    }
+                }
+                std::vector<T> esperado = v;
+                std::sort(esperado.begin(), esperado.end());
+                ordenar_rede(v.data(), n, conjunto);
+                ASSERT_EQ(v, esperado) << "n = " << n << ", conjunto = " << static_cast<int>(conjunto);
+            }
+        }
+    }
+}
+
+// Suíte de testes para as redes de ordenação
+TEST(RedeOrdenacaoTest, TesteTodosOsTamanhosETipos) {
+    std::mt19937_64 gerador(42);
+    conferir_rede<std::int32_t>(gerador);
+    conferir_rede<std::uint32_t>(gerador);
+    conferir_rede<std::int64_t>(gerador);
+    conferir_rede<std::uint64_t>(gerador);
+    conferir_rede<float>(gerador);
+    conferir_rede<double>(gerador);
+
+    std::vector<int> grande(REDE_ORDENACAO_MAXIMO + 1);
+    EXPECT_THROW(ordenar_rede(grande.data(), grande.size()), std::invalid_argument);
+}
+
+TEST(RedeOrdenacaoTest, TestePontoFlutuante) {
+    const double infinito = std::numeric_limits<double>::infinity();
+    for (ConjuntoInstrucoes conjunto : conjuntos_testaveis()) {
+        std::vector<double> v = {3.5, -0.0, infinito, -1e-300, 0.0, -infinito, -2.25, 1e-310, -3.5, 7.0, 0.0, -0.0};
+        ordenar_rede(v.data(), v.size(), conjunto);
+        EXPECT_TRUE(std::is_sorted(v.begin(), v.end()));
+        EXPECT_EQ(v.front(), -infinito);
+        EXPECT_EQ(v.back(), infinito);
+        // A codificação coloca -0.0 antes de +0.0 (a inserção, que é estável, mantém a ordem original).
+        if (conjunto != ConjuntoInstrucoes::Escalar) {
+            EXPECT_TRUE(std::signbit(v[4]) && std::signbit(v[5]) && !std::signbit(v[6]) && !std::signbit(v[7]));
+        }
+    }
+}
+
+TEST(RedeOrdenacaoTest, TesteOrdenarPequeno) {
+    std::mt19937_64 gerador(3);
+    for (std::size_t n : {0, 1, 5, 8, 13, 40, 64, 65, 100}) {
+        std::vector<std::int64_t> original(n);
+        for (auto& x : original) x = static_cast<std::int64_t>(gerador() % 1000);
+
+        // Rede (ou inserção, fora dos limites) em ordem crescente e decrescente.
+        std::vector<std::int64_t> v = original, esperado = original;
+        std::less<> menor;
+        ordenar_pequeno(v.begin(), v.end(), menor);
+        std::sort(esperado.begin(), esperado.end());
+        EXPECT_EQ(v, esperado);
+        v = original;
+        std::greater<std::int64_t> maior;
+        ordenar_pequeno_estavel(v.begin(), v.end(), maior);
+        std::sort(esperado.begin(), esperado.end(), maior);
+        EXPECT_EQ(v, esperado);
+
+        // Iteradores não contíguos e tipos sem rede caem na inserção.
+        std::deque<std::int64_t> d(original.begin(), original.end());
+        ordenar_pequeno(d.begin(), d.end(), menor);
+        EXPECT_TRUE(std::is_sorted(d.begin(), d.end()));
+        std::vector<std::string> s;
+        for (auto x : original) s.push_back(std::to_string(x));
+        ordenar_pequeno(s.begin(), s.end(), menor);
+        EXPECT_TRUE(std::is_sorted(s.begin(), s.end()));
+    }
+}
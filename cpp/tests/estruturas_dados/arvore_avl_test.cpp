@@ -1,6 +1,9 @@
 #include <gtest/gtest.h>
 #include "estruturas_dados/arvore_avl.hpp"
 #include <vector>
+#include <set>
+#include <random>
+#include <iterator>
 
 // Suíte de testes para a Árvore AVL
 TEST(ArvoreAVLTest, TesteInsercaoSimplesEBusca) {
@@ -106,4 +109,149 @@ TEST(ArvoreAVLTest, TesteRemocaoComRotacao) {
     std::vector<int> esperado = {10, 12, 15, 20, 25};
     EXPECT_EQ(arvore.in_order_traversal(), esperado);
     EXPECT_FALSE(arvore.buscar(5));
+}
+
+TEST(ArvoreAVLTest, TesteEstatisticasDeOrdem) {
+    ArvoreAVL<int> arvore;
+    for (int val : {50, 20, 70, 10, 30, 60, 80, 25}) {
+        arvore.inserir(val);
+    }
+    // Ordenado: 10, 20, 25, 30, 50, 60, 70, 80
+
+    EXPECT_EQ(arvore.tamanho(), 8u);
+    EXPECT_EQ(arvore.k_esimo(0), 10);
+    EXPECT_EQ(arvore.k_esimo(3), 30);
+    EXPECT_EQ(arvore.k_esimo(7), 80);
+    EXPECT_THROW(arvore.k_esimo(8), std::out_of_range);
+
+    EXPECT_EQ(arvore.rank(10), 0u);
+    EXPECT_EQ(arvore.rank(30), 3u);
+    EXPECT_EQ(arvore.rank(55), 5u); // Chave ausente
+    EXPECT_EQ(arvore.rank(100), 8u);
+
+    EXPECT_EQ(arvore.contar_intervalo(20, 60), 5u); // 20, 25, 30, 50, 60
+    EXPECT_EQ(arvore.contar_intervalo(21, 29), 1u);
+    EXPECT_EQ(arvore.contar_intervalo(61, 69), 0u);
+    EXPECT_EQ(arvore.contar_intervalo(60, 20), 0u);
+
+    arvore.remover(25);
+    EXPECT_EQ(arvore.tamanho(), 7u);
+    EXPECT_EQ(arvore.k_esimo(2), 30);
+}
+
+TEST(ArvoreAVLTest, TesteIteradorELowerBound) {
+    ArvoreAVL<int> arvore;
+    EXPECT_TRUE(arvore.begin() == arvore.end());
+
+    std::vector<int> valores = {9, 5, 10, 0, 6, 11, -1, 1, 2};
+    for (int val : valores) {
+        arvore.inserir(val);
+    }
+    std::sort(valores.begin(), valores.end());
+
+    std::vector<int> percorrido(arvore.begin(), arvore.end());
+    EXPECT_EQ(percorrido, valores);
+
+    auto it = arvore.lower_bound(3);
+    ASSERT_TRUE(it != arvore.end());
+    EXPECT_EQ(*it, 5);
+    ++it;
+    EXPECT_EQ(*it, 6);
+
+    EXPECT_EQ(*arvore.lower_bound(6), 6);
+    EXPECT_EQ(*arvore.lower_bound(-10), -1);
+    EXPECT_TRUE(arvore.lower_bound(12) == arvore.end());
+}
+
+TEST(ArvoreAVLTest, TesteSplitEJoin) {
+    ArvoreAVL<int> arvore;
+    for (int i = 0; i < 100; ++i) {
+        arvore.inserir(i);
+    }
+
+    ArvoreAVL<int> maiores = arvore.split(40);
+    EXPECT_EQ(arvore.tamanho(), 40u);
+    EXPECT_EQ(maiores.tamanho(), 60u);
+    EXPECT_EQ(arvore.k_esimo(39), 39);
+    EXPECT_EQ(maiores.k_esimo(0), 40);
+    EXPECT_FALSE(arvore.buscar(40));
+    EXPECT_TRUE(maiores.buscar(40));
+
+    // Junção com intervalos sobrepostos é rejeitada.
+    ArvoreAVL<int> sobreposta;
+    sobreposta.inserir(10);
+    EXPECT_THROW(arvore.join(sobreposta), std::invalid_argument);
+
+    arvore.join(maiores);
+    EXPECT_EQ(maiores.tamanho(), 0u);
+    EXPECT_EQ(arvore.tamanho(), 100u);
+    std::vector<int> esperado(100);
+    for (int i = 0; i < 100; ++i) esperado[i] = i;
+    EXPECT_EQ(arvore.in_order_traversal(), esperado);
+}
+
+TEST(ArvoreAVLTest, TesteRemoverIntervalo) {
+    ArvoreAVL<int> arvore;
+    for (int i = 0; i < 50; ++i) {
+        arvore.inserir(2 * i); // 0, 2, ..., 98
+    }
+
+    EXPECT_EQ(arvore.remover_intervalo(10, 20), 6u); // 10, 12, 14, 16, 18, 20
+    EXPECT_EQ(arvore.tamanho(), 44u);
+    EXPECT_FALSE(arvore.buscar(10));
+    EXPECT_FALSE(arvore.buscar(20));
+    EXPECT_TRUE(arvore.buscar(8));
+    EXPECT_TRUE(arvore.buscar(22));
+
+    EXPECT_EQ(arvore.remover_intervalo(21, 21), 0u);
+    EXPECT_EQ(arvore.remover_intervalo(-5, 200), 44u);
+    EXPECT_EQ(arvore.tamanho(), 0u);
+}
+
+TEST(ArvoreAVLTest, TesteAleatorioContraStdSet) {
+    std::mt19937 gerador(42);
+    std::uniform_int_distribution<int> dist(0, 499);
+    ArvoreAVL<int> arvore;
+    std::set<int> referencia;
+
+    for (int op = 0; op < 3000; ++op) {
+        int x = dist(gerador);
+        switch (op % 5) {
+            case 0: case 1: case 2:
+                arvore.inserir(x);
+                referencia.insert(x);
+                break;
+            case 3:
+                arvore.remover(x);
+                referencia.erase(x);
+                break;
+            default: {
+                int y = x + dist(gerador) % 20;
+                arvore.remover_intervalo(x, y);
+                referencia.erase(referencia.lower_bound(x), referencia.upper_bound(y));
+                break;
+            }
+        }
+
+        ASSERT_EQ(arvore.tamanho(), referencia.size());
+        int a = dist(gerador), b = dist(gerador);
+        EXPECT_EQ(arvore.rank(a), static_cast<std::size_t>(std::distance(referencia.begin(), referencia.lower_bound(a))));
+        if (a <= b) {
+            EXPECT_EQ(arvore.contar_intervalo(a, b),
+                      static_cast<std::size_t>(std::distance(referencia.lower_bound(a), referencia.upper_bound(b))));
+        }
+    }
+
+    std::vector<int> esperado(referencia.begin(), referencia.end());
+    EXPECT_EQ(std::vector<int>(arvore.begin(), arvore.end()), esperado);
+
+    // Divide e reúne em vários pontos preservando a ordem.
+    ArvoreAVL<int> direita = arvore.split(250);
+    ArvoreAVL<int> meio = arvore.split(100);
+    meio.join(direita);
+    arvore.join(meio);
+    EXPECT_EQ(arvore.in_order_traversal(), esperado);
+    for (std::size_t k = 0; k < esperado.size(); ++k) {
+        ASSERT_EQ(arvore.k_esimo(k), esperado[k]);
+    }
 }
\ No newline at end of file
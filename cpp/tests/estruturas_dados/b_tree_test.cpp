@@ -0,0 +1,270 @@
+#include <gtest/gtest.h>
+#include "estruturas_dados/b_tree.hpp"
+#include <cstdint>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+// Suíte de testes para a BPlusTree
+TEST(BPlusTreeTest, TesteInserirBuscarEAtualizar) {
+    BPlusTree<int, std::string> arvore;
+    arvore.inserir(10, "dez");
+    arvore.inserir(5, "cinco");
+    arvore.inserir(20, "vinte");
+
+    std::string valor;
+    EXPECT_TRUE(arvore.buscar(5, valor));
+    EXPECT_EQ(valor, "cinco");
+    EXPECT_FALSE(arvore.buscar(7, valor));
+    EXPECT_EQ(arvore.tamanho(), 3u);
+
+    arvore.inserir(5, "CINCO"); // Atualiza sem aumentar o tamanho
+    EXPECT_TRUE(arvore.buscar(5, valor));
+    EXPECT_EQ(valor, "CINCO");
+    EXPECT_EQ(arvore.tamanho(), 3u);
+
+    EXPECT_TRUE(arvore.remover(10));
+    EXPECT_FALSE(arvore.remover(10));
+    EXPECT_FALSE(arvore.contem(10));
+    EXPECT_EQ(arvore.tamanho(), 2u);
+}
+
+TEST(BPlusTreeTest, TesteAleatorioContraStdMap) {
+    // Capacidade pequena para exercitar divisões, empréstimos e fusões em vários níveis.
+    std::mt19937 gerador(11);
+    BPlusTree<std::int32_t, int, 4> arvore;
+    std::map<std::int32_t, int> referencia;
+    for (int op = 0; op < 20000; ++op) {
+        std::int32_t chave = static_cast<std::int32_t>(gerador() % 2000) - 1000;
+        if (gerador() % 3 != 0) {
+            arvore.inserir(chave, op);
+            referencia[chave] = op;
+        } else {
+            ASSERT_EQ(arvore.remover(chave), referencia.erase(chave) == 1);
+        }
+        ASSERT_EQ(arvore.tamanho(), referencia.size());
+    }
+
+    for (std::int32_t chave = -1001; chave <= 1001; ++chave) {
+        int valor = -1;
+        auto it = referencia.find(chave);
+        ASSERT_EQ(arvore.buscar(chave, valor), it != referencia.end());
+        if (it != referencia.end()) {
+            ASSERT_EQ(valor, it->second);
+        }
+    }
+
+    // A iteração segue as folhas encadeadas em ordem crescente.
+    auto it_ref = referencia.begin();
+    for (auto it = arvore.begin(); it != arvore.end(); ++it, ++it_ref) {
+        ASSERT_EQ(it.chave(), it_ref->first);
+        ASSERT_EQ(it.valor(), it_ref->second);
+    }
+    EXPECT_EQ(it_ref, referencia.end());
+
+    // Remover tudo deve voltar a uma única folha vazia.
+    while (!referencia.empty()) {
+        ASSERT_TRUE(arvore.remover(referencia.begin()->first));
+        referencia.erase(referencia.begin());
+    }
+    EXPECT_EQ(arvore.tamanho(), 0u);
+    EXPECT_EQ(arvore.altura(), 1);
+    EXPECT_EQ(arvore.begin(), arvore.end());
+}
+
+TEST(BPlusTreeTest, TesteCargaOrdenadaEVarreduraDeIntervalo) {
+    std::vector<std::pair<std::int64_t, std::int64_t>> dados;
+    for (std::int64_t i = 0; i < 10000; ++i) dados.push_back({3 * i, i});
+    BPlusTree<std::int64_t, std::int64_t> arvore = BPlusTree<std::int64_t, std::int64_t>::carregar_ordenado(dados);
+    EXPECT_EQ(arvore.tamanho(), dados.size());
+    EXPECT_EQ(arvore.altura(), 3); // 10000 chaves com até 32 por nó
+
+    std::int64_t valor = 0;
+    EXPECT_TRUE(arvore.buscar(2997, valor));
+    EXPECT_EQ(valor, 999);
+    EXPECT_FALSE(arvore.contem(2998));
+
+    std::vector<std::int64_t> visitados;
+    arvore.percorrer_intervalo(100, 130, [&](std::int64_t chave, std::int64_t) { visitados.push_back(chave); });
+    EXPECT_EQ(visitados, (std::vector<std::int64_t>{102, 105, 108, 111, 114, 117, 120, 123, 126, 129}));
+
+    std::int64_t total = 0;
+    arvore.percorrer_intervalo(-50, 1000000, [&](std::int64_t, std::int64_t) { ++total; });
+    EXPECT_EQ(total, 10000);
+
+    EXPECT_EQ(arvore.lower_bound(4).chave(), 6);
+    EXPECT_EQ(arvore.lower_bound(30000), arvore.end());
+
+    // A árvore carregada em lote continua válida para inserções e remoções.
+    for (std::int64_t i = 0; i < 10000; i += 2) ASSERT_TRUE(arvore.remover(3 * i));
+    arvore.inserir(1, -1);
+    EXPECT_EQ(arvore.tamanho(), 5001u);
+    EXPECT_EQ(arvore.begin().chave(), 1);
+    EXPECT_EQ((++arvore.begin()).chave(), 3);
+}
+
+TEST(BPlusTreeTest, TesteCargaOrdenadaRejeitaChavesForaDeOrdem) {
+    std::vector<std::pair<int, int>> dados = {{1, 0}, {3, 0}, {3, 0}};
+    EXPECT_THROW((BPlusTree<int, int>::carregar_ordenado(dados)), std::invalid_argument);
+    EXPECT_EQ((BPlusTree<int, int>::carregar_ordenado({})).tamanho(), 0u);
+}
+
+TEST(BPlusTreeTest, TesteBuscaNoNoComSIMD) {
+    std::vector<std::int32_t> chaves = {-7, -2, 0, 4, 4, 9, 15, 20, 21, 30, 31};
+    for (std::int32_t x : {-10, -7, -1, 4, 5, 21, 31, 100}) {
+        int menores = 0, menores_ou_iguais = 0;
+        for (std::int32_t c : chaves) {
+            menores += c < x;
+            menores_ou_iguais += c <= x;
+        }
+        EXPECT_EQ(contar_chaves_menores(chaves.data(), static_cast<int>(chaves.size()), x), menores);
+        EXPECT_EQ(contar_chaves_menores_ou_iguais(chaves.data(), static_cast<int>(chaves.size()), x), menores_ou_iguais);
+    }
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <filesystem>
+#include <fstream>
+
+// Suíte de testes para a BTreeEmDisco
+static std::string caminho_temporario(const std::string& nome) {
+    std::filesystem::path caminho = std::filesystem::temp_directory_path() / nome;
+    std::filesystem::remove(caminho);
+    return caminho.string();
+}
+
+TEST(BTreeEmDiscoTest, TesteInserirBuscarEReabrir) {
+    std::string caminho = caminho_temporario("b_tree_disco_reabrir.db");
+    std::mt19937_64 gerador(5);
+    std::map<std::int64_t, std::int64_t> referencia;
+    {
+        BTreeEmDisco arvore(caminho);
+        for (int i = 0; i < 50000; ++i) {
+            std::int64_t chave = static_cast<std::int64_t>(gerador() % 200000) - 100000;
+            arvore.inserir(chave, i);
+            referencia[chave] = i;
+            if (i % 10000 == 0) arvore.confirmar();
+        }
+        EXPECT_EQ(arvore.tamanho(), referencia.size());
+        EXPECT_EQ(arvore.altura(), 3);
+        arvore.confirmar();
+    }
+
+    BTreeEmDisco arvore(caminho);
+    ASSERT_EQ(arvore.tamanho(), referencia.size());
+    for (std::int64_t chave = -100500; chave < 100500; chave += 7) {
+        std::int64_t valor = -1;
+        auto it = referencia.find(chave);
+        ASSERT_EQ(arvore.buscar(chave, valor), it != referencia.end());
+        if (it != referencia.end()) {
+            ASSERT_EQ(valor, it->second);
+        }
+    }
+
+    std::vector<std::pair<std::int64_t, std::int64_t>> visitados, esperados;
+    arvore.percorrer_intervalo(-5000, 20000, [&](std::int64_t c, std::int64_t v) { visitados.push_back({c, v}); });
+    for (auto it = referencia.lower_bound(-5000); it != referencia.end() && it->first <= 20000; ++it) {
+        esperados.push_back(*it);
+    }
+    EXPECT_EQ(visitados, esperados);
+
+    std::size_t total = 0;
+    arvore.percorrer_intervalo(INT64_MIN, INT64_MAX, [&](std::int64_t, std::int64_t) { ++total; });
+    EXPECT_EQ(total, referencia.size());
+    std::filesystem::remove(caminho);
+}
+
+TEST(BTreeEmDiscoTest, TesteMetaCorrompidaVoltaParaVersaoAnterior) {
+    std::string caminho = caminho_temporario("b_tree_disco_queda.db");
+    {
+        BTreeEmDisco arvore(caminho);
+        for (int i = 0; i < 1000; ++i) arvore.inserir(i, i);
+        arvore.confirmar();
+        for (int i = 1000; i < 2000; ++i) arvore.inserir(i, i);
+        arvore.inserir(0, -1);
+        arvore.confirmar();
+    }
+
+    // Simula uma queda durante a gravação da última meta: a página 0 ou 1 com a maior geração
+    // fica com lixo. Com 3 confirmações (criação, 1000 e 2000 chaves), a última está na página 1.
+    {
+        std::fstream arquivo(caminho, std::ios::in | std::ios::out | std::ios::binary);
+        arquivo.seekp(BTreeEmDisco::TAMANHO_PAGINA + 8);
+        arquivo.write("lixo", 4);
+    }
+
+    BTreeEmDisco arvore(caminho);
+    EXPECT_EQ(arvore.tamanho(), 1000u);
+    std::int64_t valor = 0;
+    EXPECT_TRUE(arvore.buscar(0, valor));
+    EXPECT_EQ(valor, 0);
+    EXPECT_TRUE(arvore.buscar(999, valor));
+    EXPECT_FALSE(arvore.buscar(1000, valor));
+
+    // A versão recuperada continua utilizável.
+    arvore.inserir(5000, 1);
+    arvore.confirmar();
+    EXPECT_TRUE(arvore.buscar(5000, valor));
+    std::filesystem::remove(caminho);
+}
+
+TEST(BTreeEmDiscoTest, TesteFecharSemConfirmarDescarta) {
+    std::string caminho = caminho_temporario("b_tree_disco_descartar.db");
+    {
+        BTreeEmDisco arvore(caminho);
+        for (int i = 0; i < 3000; ++i) arvore.inserir(i, i);
+        arvore.confirmar();
+        for (int i = 3000; i < 6000; ++i) arvore.inserir(i, i);
+        arvore.inserir(7, -7);
+    } // Sem confirmar(): a segunda leva é descartada.
+
+    BTreeEmDisco arvore(caminho);
+    EXPECT_EQ(arvore.tamanho(), 3000u);
+    std::int64_t valor = 0;
+    EXPECT_TRUE(arvore.buscar(7, valor));
+    EXPECT_EQ(valor, 7);
+    EXPECT_FALSE(arvore.buscar(3000, valor));
+
+    // As páginas escritas pela transação descartada podem ser alocadas de novo sem conflito.
+    for (int i = 3000; i < 6000; ++i) arvore.inserir(i, 2 * i);
+    arvore.confirmar();
+    EXPECT_EQ(arvore.tamanho(), 6000u);
+    EXPECT_TRUE(arvore.buscar(5999, valor));
+    EXPECT_EQ(valor, 11998);
+    std::filesystem::remove(caminho);
+}
+
+TEST(BTreeEmDiscoTest, TesteArquivoCurtoNaoEReinicializado) {
+    std::string caminho = caminho_temporario("b_tree_disco_curto.db");
+    {
+        std::ofstream arquivo(caminho, std::ios::binary);
+        arquivo << "dados de outra aplicação";
+    }
+    EXPECT_THROW(BTreeEmDisco{caminho}, std::runtime_error);
+    EXPECT_EQ(std::filesystem::file_size(caminho), std::string("dados de outra aplicação").size());
+    std::filesystem::remove(caminho);
+}
+
+TEST(BTreeEmDiscoTest, TestePaginasLiberadasSaoReutilizadas) {
+    std::string caminho = caminho_temporario("b_tree_disco_livres.db");
+    BTreeEmDisco arvore(caminho);
+    for (int i = 0; i < 20000; ++i) arvore.inserir(i, 0);
+    arvore.confirmar();
+    std::uint64_t paginas = arvore.paginas_usadas();
+
+    // Cada rodada copia o caminho de todas as folhas; sem reutilização, o arquivo cresceria sem parar.
+    for (int rodada = 1; rodada <= 20; ++rodada) {
+        for (int i = 0; i < 20000; i += 50) arvore.inserir(i, rodada);
+        arvore.confirmar();
+    }
+    EXPECT_LE(arvore.paginas_usadas(), 3 * paginas);
+    EXPECT_GT(arvore.paginas_livres(), 0u);
+
+    std::int64_t valor = 0;
+    EXPECT_TRUE(arvore.buscar(100, valor));
+    EXPECT_EQ(valor, 20);
+    EXPECT_LE(arvore.fixar_paginas_quentes(2), arvore.paginas_usadas());
+    std::filesystem::remove(caminho);
+}
+#endif
@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include "estruturas_dados/fenwick_tree.hpp"
+#include <random>
+#include <vector>
+
+// Suíte de testes para a FenwickTree
+TEST(FenwickTreeTest, TesteSomasDePrefixoEIntervalo) {
+    std::vector<int> arr = {1, 3, 5, 7, 9, 11};
+    FenwickTree<int> ft(arr);
+
+    EXPECT_EQ(ft.prefix_sum(-1), 0);
+    EXPECT_EQ(ft.prefix_sum(0), 1);
+    EXPECT_EQ(ft.prefix_sum(5), 36);
+    EXPECT_EQ(ft.range_sum(1, 3), 15);
+
+    ft.add(2, 1); // 5 -> 6
+    EXPECT_EQ(ft.range_sum(0, 5), 37);
+    EXPECT_EQ(ft.range_sum(2, 2), 6);
+
+    EXPECT_THROW(ft.add(6, 1), std::out_of_range);
+    EXPECT_THROW(ft.range_sum(3, 2), std::out_of_range);
+    EXPECT_THROW(ft.prefix_sum(6), std::out_of_range);
+}
+
+TEST(FenwickTreeTest, TesteConstrucaoLinearIgualAIncremental) {
+    std::mt19937 gerador(3);
+    for (int n : {1, 2, 7, 16, 33, 100}) {
+        std::vector<long long> arr(n);
+        for (auto& x : arr) x = static_cast<long long>(gerador() % 100) - 50;
+        FenwickTree<long long> linear(arr);
+        FenwickTree<long long> incremental(n);
+        for (int i = 0; i < n; ++i) incremental.add(i, arr[i]);
+
+        long long prefixo = 0;
+        for (int i = 0; i < n; ++i) {
+            prefixo += arr[i];
+            ASSERT_EQ(linear.prefix_sum(i), prefixo);
+            ASSERT_EQ(incremental.prefix_sum(i), prefixo);
+        }
+    }
+}
+
+TEST(FenwickTreeTest, TesteLowerBound) {
+    std::vector<int> arr = {2, 0, 3, 1, 0, 4}; // Prefixos: 2, 2, 5, 6, 6, 10
+    FenwickTree<int> ft(arr);
+
+    EXPECT_EQ(ft.lower_bound(0), 0);
+    EXPECT_EQ(ft.lower_bound(1), 0);
+    EXPECT_EQ(ft.lower_bound(2), 0);
+    EXPECT_EQ(ft.lower_bound(3), 2);
+    EXPECT_EQ(ft.lower_bound(6), 3);
+    EXPECT_EQ(ft.lower_bound(7), 5);
+    EXPECT_EQ(ft.lower_bound(10), 5);
+    EXPECT_EQ(ft.lower_bound(11), 6); // Nenhum prefixo alcança o alvo
+
+    FenwickTree<int> vazia(0);
+    EXPECT_EQ(vazia.lower_bound(1), 0);
+}
+
+// Suíte de testes para a FenwickTreeIntervalo
+TEST(FenwickTreeIntervaloTest, TesteSomaEmIntervaloContraReferencia) {
+    std::mt19937 gerador(11);
+    const int n = 40;
+    std::vector<long long> referencia(n);
+    for (auto& x : referencia) x = gerador() % 20;
+    FenwickTreeIntervalo<long long> ft(referencia);
+
+    for (int op = 0; op < 1000; ++op) {
+        int l = gerador() % n;
+        int r = gerador() % n;
+        if (l > r) std::swap(l, r);
+        if (op % 2 == 0) {
+            long long d = static_cast<long long>(gerador() % 21) - 10;
+            ft.add_range(l, r, d);
+            for (int i = l; i <= r; ++i) referencia[i] += d;
+        } else {
+            long long esperado = 0;
+            for (int i = l; i <= r; ++i) esperado += referencia[i];
+            ASSERT_EQ(ft.range_sum(l, r), esperado);
+        }
+    }
+    for (int i = 0; i < n; ++i) {
+        EXPECT_EQ(ft.get(i), referencia[i]);
+    }
+    EXPECT_THROW(ft.add_range(0, n, 1), std::out_of_range);
+}
+
+// Suíte de testes para a FenwickTree2D
+TEST(FenwickTree2DTest, TesteRetangulosContraReferencia) {
+    std::mt19937 gerador(21);
+    const int linhas = 9, colunas = 13;
+    std::vector<std::vector<int>> grade(linhas, std::vector<int>(colunas));
+    for (auto& linha : grade) {
+        for (auto& x : linha) x = gerador() % 10;
+    }
+    FenwickTree2D<int> ft(grade);
+
+    for (int op = 0; op < 500; ++op) {
+        int l1 = gerador() % linhas, l2 = gerador() % linhas;
+        int c1 = gerador() % colunas, c2 = gerador() % colunas;
+        if (l1 > l2) std::swap(l1, l2);
+        if (c1 > c2) std::swap(c1, c2);
+        if (op % 3 == 0) {
+            int d = static_cast<int>(gerador() % 7) - 3;
+            ft.add(l1, c1, d);
+            grade[l1][c1] += d;
+        } else {
+            int esperado = 0;
+            for (int i = l1; i <= l2; ++i) {
+                for (int j = c1; j <= c2; ++j) esperado += grade[i][j];
+            }
+            ASSERT_EQ(ft.range_sum(l1, c1, l2, c2), esperado);
+        }
+    }
+
+    EXPECT_THROW(ft.add(linhas, 0, 1), std::out_of_range);
+    EXPECT_THROW(ft.range_sum(1, 1, 0, 0), std::out_of_range);
+    EXPECT_THROW(FenwickTree2D<int>(std::vector<std::vector<int>>{{1, 2}, {3}}), std::invalid_argument);
+}
\ No newline at end of file
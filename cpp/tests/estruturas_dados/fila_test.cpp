@@ -0,0 +1,196 @@
+#include <gtest/gtest.h>
+#include "estruturas_dados/fila.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Suíte de testes para a FilaSPSC
+TEST(FilaSPSCTest, TesteOperacoesBasicasELotes) {
+    EXPECT_THROW(FilaSPSC<int>(0), std::invalid_argument);
+    FilaSPSC<std::string> fila(3);
+    EXPECT_EQ(fila.capacidade(), 4u);
+
+    std::string s;
+    EXPECT_FALSE(fila.pop(s));
+    // Várias voltas pelo buffer circular.
+    for (int volta = 0; volta < 5; ++volta) {
+        for (int i = 0; i < 4; ++i) EXPECT_TRUE(fila.push(std::to_string(volta * 10 + i)));
+        EXPECT_FALSE(fila.push("cheia"));
+        EXPECT_EQ(fila.tamanho_aproximado(), 4u);
+        for (int i = 0; i < 4; ++i) {
+            ASSERT_TRUE(fila.pop(s));
+            EXPECT_EQ(s, std::to_string(volta * 10 + i));
+        }
+        EXPECT_FALSE(fila.pop(s));
+    }
+
+    const std::string itens[6] = {"a", "b", "c", "d", "e", "f"};
+    EXPECT_EQ(fila.push_lote(itens, 6), 4u); // Só cabem quatro
+    std::string saida[6];
+    EXPECT_EQ(fila.pop_lote(saida, 3), 3u);
+    EXPECT_EQ(saida[0], "a");
+    EXPECT_EQ(saida[2], "c");
+    EXPECT_EQ(fila.push_lote(itens + 4, 2), 2u);
+    EXPECT_EQ(fila.pop_lote(saida, 6), 3u);
+    EXPECT_EQ(saida[0], "d");
+    EXPECT_EQ(saida[2], "f");
+}
+
+TEST(FilaSPSCTest, TesteProdutorEConsumidorPreservamOrdem) {
+    FilaSPSC<int> fila(64);
+    const int total = 200000;
+    std::thread produtor([&] {
+        int buffer[16];
+        for (int i = 0; i < total;) {
+            if (i % 3 == 0) {
+                // Alterna inserções isoladas e em lote.
+                int k = std::min(16, total - i);
+                for (int j = 0; j < k; ++j) buffer[j] = i + j;
+                std::size_t inseridos = fila.push_lote(buffer, k);
+                if (inseridos == 0) std::this_thread::yield();
+                i += static_cast<int>(inseridos);
+            } else if (fila.push(i)) {
+                ++i;
+            } else {
+                std::this_thread::yield(); // Fila cheia: cede a vez ao consumidor
+            }
+        }
+    });
+    int esperado = 0;
+    int buffer[8];
+    while (esperado < total) {
+        std::size_t k = fila.pop_lote(buffer, 8);
+        if (k == 0) std::this_thread::yield();
+        for (std::size_t j = 0; j < k; ++j) ASSERT_EQ(buffer[j], esperado++);
+    }
+    produtor.join();
+}
+
+// Suíte de testes para a FilaMPMC
+TEST(FilaMPMCTest, TesteOperacoesBasicasELotes) {
+    FilaMPMC<int> fila(4);
+    int x;
+    EXPECT_FALSE(fila.pop(x));
+    int itens[6] = {1, 2, 3, 4, 5, 6};
+    EXPECT_EQ(fila.push_lote(itens, 6), 4u);
+    EXPECT_FALSE(fila.push(7));
+    EXPECT_EQ(fila.tamanho_aproximado(), 4u);
+
+    int saida[6];
+    EXPECT_EQ(fila.pop_lote(saida, 2), 2u);
+    EXPECT_EQ(saida[0], 1);
+    EXPECT_EQ(saida[1], 2);
+    EXPECT_TRUE(fila.push(7));
+    EXPECT_EQ(fila.pop_lote(saida, 6), 3u);
+    EXPECT_EQ(saida[0], 3);
+    EXPECT_EQ(saida[2], 7);
+    EXPECT_EQ(fila.pop_lote(saida, 6), 0u);
+}
+
+TEST(FilaMPMCTest, TesteVariosProdutoresEConsumidores) {
+    // Cada elemento precisa sair exatamente uma vez, e os de um mesmo produtor em ordem.
+    FilaMPMC<long long> fila(128);
+    const int produtores = 4, consumidores = 4, por_produtor = 50000;
+    std::atomic<int> consumidos{0};
+    std::vector<std::vector<int>> vistos(consumidores, std::vector<int>(produtores * por_produtor, 0));
+    std::atomic<bool> fora_de_ordem{false};
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < produtores; ++p) {
+        threads.emplace_back([&, p] {
+            long long lote[4];
+            for (int i = 0; i < por_produtor;) {
+                if (p % 2 == 0) {
+                    if (fila.push(static_cast<long long>(p) * por_produtor + i)) ++i;
+                    else std::this_thread::yield();
+                } else {
+                    int k = std::min(4, por_produtor - i);
+                    for (int j = 0; j < k; ++j) lote[j] = static_cast<long long>(p) * por_produtor + i + j;
+                    std::size_t inseridos = fila.push_lote(lote, k);
+                    if (inseridos == 0) std::this_thread::yield();
+                    i += static_cast<int>(inseridos);
+                }
+            }
+        });
+    }
+    for (int c = 0; c < consumidores; ++c) {
+        threads.emplace_back([&, c] {
+            std::vector<long long> ultimo(produtores, -1);
+            long long lote[3];
+            while (consumidos.load() < produtores * por_produtor) {
+                std::size_t k = (c % 2 == 0) ? fila.pop_lote(lote, 3) : fila.pop(lote[0]);
+                if (k == 0) std::this_thread::yield();
+                for (std::size_t j = 0; j < k; ++j) {
+                    int p = static_cast<int>(lote[j] / por_produtor);
+                    if (lote[j] <= ultimo[p]) fora_de_ordem = true;
+                    ultimo[p] = lote[j];
+                    ++vistos[c][lote[j]];
+                }
+                consumidos += static_cast<int>(k);
+            }
+        });
+    }
+    for (auto& t : threads) t.join();
+
+    EXPECT_FALSE(fora_de_ordem.load());
+    for (int i = 0; i < produtores * por_produtor; ++i) {
+        int vezes = 0;
+        for (int c = 0; c < consumidores; ++c) vezes += vistos[c][i];
+        ASSERT_EQ(vezes, 1) << "elemento " << i;
+    }
+}
+
+// Suíte de testes para a FilaBloqueante
+TEST(FilaBloqueanteTest, TestePipelineComFechamento) {
+    // Produtores mais rápidos que a capacidade forçam os dois lados a dormir.
+    FilaBloqueante<int> fila(8);
+    const int produtores = 3, consumidores = 2, por_produtor = 20000;
+    std::atomic<long long> soma{0};
+    std::atomic<int> recebidos{0};
+
+    std::vector<std::thread> prods, conss;
+    for (int p = 0; p < produtores; ++p) {
+        prods.emplace_back([&] {
+            for (int i = 1; i <= por_produtor; ++i) ASSERT_TRUE(fila.push(i));
+        });
+    }
+    for (int c = 0; c < consumidores; ++c) {
+        conss.emplace_back([&] {
+            int x;
+            while (fila.pop(x)) {
+                soma += x;
+                ++recebidos;
+            }
+        });
+    }
+    for (auto& t : prods) t.join();
+    fila.fechar();
+    for (auto& t : conss) t.join();
+
+    EXPECT_EQ(recebidos.load(), produtores * por_produtor);
+    EXPECT_EQ(soma.load(), static_cast<long long>(produtores) * por_produtor * (por_produtor + 1) / 2);
+    EXPECT_TRUE(fila.esta_fechada());
+    EXPECT_FALSE(fila.push(1));
+    EXPECT_FALSE(fila.try_push(1));
+}
+
+TEST(FilaBloqueanteTest, TesteSobreFilaSPSC) {
+    FilaBloqueante<int, FilaSPSC<int>> fila(2);
+    int x;
+    EXPECT_FALSE(fila.try_pop(x));
+    std::thread consumidor([&] {
+        for (int esperado = 0; esperado < 10000; ++esperado) {
+            ASSERT_TRUE(fila.pop(x));
+            ASSERT_EQ(x, esperado);
+        }
+        EXPECT_FALSE(fila.pop(x)); // Acorda quando a fila é fechada
+    });
+    for (int i = 0; i < 10000; ++i) fila.push(i);
+    // Dá tempo para o consumidor esvaziar a fila e dormir antes do fechamento.
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    fila.fechar();
+    consumidor.join();
+}
@@ -0,0 +1,159 @@
+#include <gtest/gtest.h>
+#include "estruturas_dados/heap.hpp"
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+// Executa operações aleatórias em um HeapIndexado e em um std::set de pares {prioridade, id}.
+template <int Aridade>
+static void comparar_heap_indexado_com_set(unsigned semente) {
+    const int capacidade = 300;
+    std::mt19937 gerador(semente);
+    HeapIndexado<int, Aridade> heap(capacidade);
+    std::set<std::pair<int, int>> referencia;
+    std::vector<int> atual(capacidade, 0);
+
+    for (int op = 0; op < 20000; ++op) {
+        int id = gerador() % capacidade;
+        int tipo = gerador() % 4;
+        if (tipo == 0 && !heap.contem(id)) {
+            atual[id] = gerador() % 1000;
+            heap.push(id, atual[id]);
+            referencia.insert({atual[id], id});
+        } else if (tipo == 1 && heap.contem(id)) {
+            int nova = atual[id] - static_cast<int>(gerador() % 50);
+            heap.decrease_key(id, nova);
+            referencia.erase({atual[id], id});
+            atual[id] = nova;
+            referencia.insert({nova, id});
+        } else if (tipo == 2 && heap.contem(id)) {
+            heap.erase(id);
+            referencia.erase({atual[id], id});
+        } else if (tipo == 3 && !heap.empty()) {
+            // Empates podem sair em qualquer ordem; basta a prioridade ser a mínima.
+            ASSERT_EQ(heap.top_prioridade(), referencia.begin()->first);
+            int topo = heap.pop();
+            ASSERT_EQ(atual[topo], referencia.begin()->first);
+            ASSERT_TRUE(referencia.erase({atual[topo], topo}));
+        }
+        ASSERT_EQ(heap.size(), referencia.size());
+    }
+}
+
+// Suíte de testes para o HeapIndexado
+TEST(HeapIndexadoTest, TesteOperacoesBasicas) {
+    HeapIndexado<int> heap(5);
+    EXPECT_TRUE(heap.empty());
+    heap.push(3, 30);
+    heap.push(1, 10);
+    heap.push(4, 40);
+    EXPECT_EQ(heap.top(), 1);
+    EXPECT_EQ(heap.prioridade(4), 40);
+
+    heap.decrease_key(4, 5);
+    EXPECT_EQ(heap.top(), 4);
+    heap.erase(1);
+    EXPECT_FALSE(heap.contem(1));
+    EXPECT_EQ(heap.pop(), 4);
+    EXPECT_EQ(heap.pop(), 3);
+    EXPECT_TRUE(heap.empty());
+
+    EXPECT_THROW(heap.pop(), std::out_of_range);
+    EXPECT_THROW(heap.top(), std::out_of_range);
+    EXPECT_THROW(heap.push(5, 1), std::out_of_range);
+    heap.push(0, 7);
+    EXPECT_THROW(heap.push(0, 8), std::invalid_argument);
+    EXPECT_THROW(heap.decrease_key(0, 9), std::invalid_argument);
+    EXPECT_THROW(heap.decrease_key(2, 1), std::invalid_argument);
+    EXPECT_THROW(heap.erase(2), std::invalid_argument);
+}
+
+TEST(HeapIndexadoTest, TesteAleatorioContraSetVariasAridades) {
+    comparar_heap_indexado_com_set<2>(1);
+    comparar_heap_indexado_com_set<4>(2);
+    comparar_heap_indexado_com_set<8>(3);
+}
+
+TEST(HeapIndexadoTest, TesteHeapifyEComparadorDeMaximo) {
+    std::mt19937 gerador(37);
+    for (int n : {0, 1, 2, 5, 17, 1000}) {
+        std::vector<int> prioridades(n);
+        for (auto& p : prioridades) p = gerador() % 100;
+        HeapIndexado<int, 4, std::greater<int>> heap(prioridades);
+        ASSERT_EQ(heap.size(), static_cast<std::size_t>(n));
+
+        std::vector<int> esperado = prioridades;
+        std::sort(esperado.rbegin(), esperado.rend());
+        for (int i = 0; i < n; ++i) {
+            ASSERT_EQ(heap.top_prioridade(), esperado[i]);
+            int id = heap.pop();
+            ASSERT_EQ(prioridades[id], esperado[i]);
+        }
+    }
+}
+
+// Suíte de testes para o PairingHeap
+TEST(PairingHeapTest, TesteAleatorioComHandles) {
+    std::mt19937 gerador(38);
+    PairingHeap<std::pair<int, int>> heap;
+    std::set<std::pair<int, int>> referencia;
+    std::vector<PairingHeap<std::pair<int, int>>::Handle> handles;
+    std::vector<bool> presente;
+
+    for (int op = 0; op < 20000; ++op) {
+        int tipo = gerador() % 4;
+        if (tipo == 0 || handles.empty()) {
+            std::pair<int, int> valor{static_cast<int>(gerador() % 1000), static_cast<int>(handles.size())};
+            handles.push_back(heap.push(valor));
+            presente.push_back(true);
+            referencia.insert(valor);
+        } else if (tipo == 3) {
+            if (heap.empty()) continue;
+            auto topo = heap.top();
+            ASSERT_EQ(topo, *referencia.begin());
+            heap.pop();
+            referencia.erase(referencia.begin());
+            presente[topo.second] = false;
+        } else {
+            std::size_t i = gerador() % handles.size();
+            if (!presente[i]) continue;
+            auto valor = handles[i].valor();
+            referencia.erase(valor);
+            if (tipo == 1) {
+                valor.first -= gerador() % 100;
+                heap.decrease_key(handles[i], valor);
+                referencia.insert(valor);
+            } else {
+                heap.erase(handles[i]);
+                presente[i] = false;
+            }
+        }
+        ASSERT_EQ(heap.size(), referencia.size());
+    }
+    EXPECT_THROW(heap.decrease_key(heap.push({2000, -1}), {3000, -1}), std::invalid_argument);
+}
+
+TEST(PairingHeapTest, TesteMergeEHeapVazio) {
+    PairingHeap<int> a, b;
+    EXPECT_THROW(a.top(), std::out_of_range);
+    EXPECT_THROW(a.pop(), std::out_of_range);
+
+    auto h = b.push(50);
+    for (int x : {5, 3, 9}) a.push(x);
+    for (int x : {4, 8}) b.push(x);
+    a.merge(b);
+    EXPECT_TRUE(b.empty());
+    EXPECT_EQ(a.size(), 6u);
+
+    // O handle criado em 'b' continua válido em 'a'.
+    a.decrease_key(h, 1);
+    std::vector<int> saida;
+    while (!a.empty()) {
+        saida.push_back(a.top());
+        a.pop();
+    }
+    EXPECT_EQ(saida, (std::vector<int>{1, 3, 4, 5, 8, 9}));
+}
@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+#include "estruturas_dados/kd_tree.hpp"
+#include <algorithm>
+#include <random>
+#include <vector>
+
+// Compara os resultados da árvore com uma busca exaustiva sobre os mesmos pontos.
+template <typename Arvore>
+static std::vector<typename Arvore::Distancia> distancias_forca_bruta(const std::vector<typename Arvore::Ponto>& pontos,
+                                                                      const typename Arvore::Ponto& q) {
+    std::vector<typename Arvore::Distancia> dist;
+    for (const auto& p : pontos) {
+        typename Arvore::Distancia soma = 0;
+        for (std::size_t d = 0; d < p.size(); ++d) {
+            typename Arvore::Distancia diff = static_cast<typename Arvore::Distancia>(p[d]) - q[d];
+            soma += diff * diff;
+        }
+        dist.push_back(soma);
+    }
+    return dist;
+}
+
+// Suíte de testes para a KDTree
+TEST(KDTreeTest, TesteCasosBasicos) {
+    KDTree<double, 2> vazia(std::vector<KDTree<double, 2>::Ponto>{});
+    EXPECT_EQ(vazia.tamanho(), 0u);
+    EXPECT_TRUE(vazia.k_vizinhos({0, 0}, 3).empty());
+    EXPECT_TRUE(vazia.vizinhos_no_raio({0, 0}, 10).empty());
+
+    KDTree<double, 2> arvore({{0, 0}, {1, 0}, {0, 2}, {5, 5}, {-3, 1}});
+    auto vizinhos = arvore.k_vizinhos({0.9, 0.1}, 2);
+    ASSERT_EQ(vizinhos.size(), 2u);
+    EXPECT_EQ(vizinhos[0].indice, 1u);
+    EXPECT_EQ(vizinhos[1].indice, 0u);
+    EXPECT_EQ(arvore.k_vizinhos({0, 0}, 10).size(), 5u);
+    EXPECT_TRUE(arvore.k_vizinhos({0, 0}, 0).empty());
+
+    // O raio é inclusivo.
+    auto no_raio = arvore.vizinhos_no_raio({0, 0}, 2);
+    ASSERT_EQ(no_raio.size(), 3u);
+    EXPECT_EQ(no_raio[2].indice, 2u);
+    EXPECT_DOUBLE_EQ(no_raio[2].distancia2, 4.0);
+
+    EXPECT_THROW(arvore.k_vizinhos({0, 0}, -1), std::invalid_argument);
+    EXPECT_THROW(arvore.vizinhos_no_raio({0, 0}, -1), std::invalid_argument);
+}
+
+TEST(KDTreeTest, TesteAleatorioContraForcaBruta) {
+    // Coordenadas inteiras tornam as distâncias exatas, inclusive no caminho SIMD.
+    using Arvore = KDTree<float, 3, 8>;
+    std::mt19937 gerador(36);
+    for (int n : {1, 7, 8, 9, 100, 2000}) {
+        std::vector<Arvore::Ponto> pontos(n);
+        for (auto& p : pontos) {
+            for (auto& c : p) c = static_cast<float>(gerador() % 50);
+        }
+        Arvore arvore(pontos);
+        ASSERT_EQ(arvore.tamanho(), static_cast<std::size_t>(n));
+
+        for (int consulta = 0; consulta < 50; ++consulta) {
+            Arvore::Ponto q;
+            for (auto& c : q) c = static_cast<float>(gerador() % 60) - 5;
+            std::vector<float> dist = distancias_forca_bruta<Arvore>(pontos, q);
+            std::vector<float> ordenadas = dist;
+            std::sort(ordenadas.begin(), ordenadas.end());
+
+            int k = 1 + gerador() % 12;
+            auto vizinhos = arvore.k_vizinhos(q, k);
+            ASSERT_EQ(vizinhos.size(), std::min<std::size_t>(k, n));
+            for (std::size_t i = 0; i < vizinhos.size(); ++i) {
+                ASSERT_EQ(vizinhos[i].distancia2, ordenadas[i]);
+                ASSERT_EQ(vizinhos[i].distancia2, dist[vizinhos[i].indice]);
+            }
+
+            float raio = static_cast<float>(gerador() % 15);
+            auto no_raio = arvore.vizinhos_no_raio(q, raio);
+            std::vector<std::size_t> esperados;
+            for (int i = 0; i < n; ++i) {
+                if (dist[i] <= raio * raio) esperados.push_back(i);
+            }
+            std::vector<std::size_t> obtidos;
+            for (const auto& v : no_raio) obtidos.push_back(v.indice);
+            std::sort(obtidos.begin(), obtidos.end());
+            ASSERT_EQ(obtidos, esperados);
+        }
+    }
+}
+
+TEST(KDTreeTest, TesteTiposInteirosEDuplicatas) {
+    // Muitos pontos repetidos exercitam cortes em que a mediana se repete dos dois lados.
+    using Arvore = KDTree<int, 2, 4>;
+    std::mt19937 gerador(7);
+    std::vector<Arvore::Ponto> pontos(500);
+    for (auto& p : pontos) p = {static_cast<int>(gerador() % 4), static_cast<int>(gerador() % 3) * 1000};
+    Arvore arvore(pontos);
+
+    for (int consulta = 0; consulta < 30; ++consulta) {
+        Arvore::Ponto q = {static_cast<int>(gerador() % 6) - 1, static_cast<int>(gerador() % 3000)};
+        std::vector<long long> dist = distancias_forca_bruta<Arvore>(pontos, q);
+        std::sort(dist.begin(), dist.end());
+        auto vizinhos = arvore.k_vizinhos(q, 40);
+        ASSERT_EQ(vizinhos.size(), 40u);
+        for (std::size_t i = 0; i < vizinhos.size(); ++i) ASSERT_EQ(vizinhos[i].distancia2, dist[i]);
+    }
+}
+
+TEST(KDTreeTest, TesteEmpatesOrdenadosPeloIndice) {
+    // Poucas posições distintas: o k-ésimo vizinho quase sempre empata com vários outros, e os
+    // escolhidos precisam ser os de menor índice, qualquer que seja a ordem do percurso.
+    using Arvore = KDTree<int, 2, 4>;
+    std::mt19937 gerador(11);
+    std::vector<Arvore::Ponto> pontos(400);
+    for (auto& p : pontos) p = {static_cast<int>(gerador() % 5), static_cast<int>(gerador() % 5)};
+    Arvore arvore(pontos);
+
+    for (int consulta = 0; consulta < 40; ++consulta) {
+        Arvore::Ponto q = {static_cast<int>(gerador() % 7) - 1, static_cast<int>(gerador() % 7) - 1};
+        std::vector<long long> dist = distancias_forca_bruta<Arvore>(pontos, q);
+        std::vector<std::pair<long long, std::size_t>> esperado;
+        for (std::size_t i = 0; i < pontos.size(); ++i) esperado.push_back({dist[i], i});
+        std::sort(esperado.begin(), esperado.end());
+        for (int k : {1, 7, 33, 150}) {
+            auto vizinhos = arvore.k_vizinhos(q, k);
+            ASSERT_EQ(vizinhos.size(), static_cast<std::size_t>(k));
+            for (int i = 0; i < k; ++i) {
+                ASSERT_EQ(vizinhos[i].distancia2, esperado[i].first) << "k = " << k << ", i = " << i;
+                ASSERT_EQ(vizinhos[i].indice, esperado[i].second) << "k = " << k << ", i = " << i;
+            }
+        }
+    }
+}
+
+TEST(KDTreeTest, TesteLotesIguaisAsConsultasIndividuais) {
+    using Arvore = KDTree<double, 4>;
+    std::mt19937 gerador(11);
+    std::uniform_real_distribution<double> uniforme(0.0, 1.0);
+    std::vector<Arvore::Ponto> pontos(3000), consultas(500);
+    for (auto& p : pontos) {
+        for (auto& c : p) c = uniforme(gerador);
+    }
+    for (auto& p : consultas) {
+        for (auto& c : p) c = uniforme(gerador);
+    }
+    Arvore arvore(pontos);
+
+    const int k = 5;
+    for (unsigned threads : {1u, 4u}) {
+        auto lote = arvore.k_vizinhos_lote(consultas, k, threads);
+        auto lote_raio = arvore.vizinhos_no_raio_lote(consultas, 0.2, threads);
+        ASSERT_EQ(lote.size(), consultas.size() * k);
+        ASSERT_EQ(lote_raio.size(), consultas.size());
+        for (std::size_t i = 0; i < consultas.size(); ++i) {
+            auto individual = arvore.k_vizinhos(consultas[i], k);
+            for (int j = 0; j < k; ++j) {
+                ASSERT_EQ(lote[i * k + j].indice, individual[j].indice);
+                ASSERT_EQ(lote[i * k + j].distancia2, individual[j].distancia2);
+            }
+            auto raio = arvore.vizinhos_no_raio(consultas[i], 0.2);
+            ASSERT_EQ(lote_raio[i].size(), raio.size());
+            for (std::size_t j = 0; j < raio.size(); ++j) ASSERT_EQ(lote_raio[i][j].indice, raio[j].indice);
+        }
+    }
+
+    // Com menos pontos que k, cada consulta ocupa apenas n posições.
+    Arvore pequena(std::vector<Arvore::Ponto>(pontos.begin(), pontos.begin() + 3));
+    EXPECT_EQ(pequena.k_vizinhos_lote(consultas, k).size(), consultas.size() * 3);
+}
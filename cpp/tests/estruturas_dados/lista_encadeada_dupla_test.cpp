@@ -0,0 +1,158 @@
+#include <gtest/gtest.h>
+#include "estruturas_dados/lista_encadeada_dupla.hpp"
+#include <algorithm>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+template <typename Lista, typename T>
+void esperar_igual(const Lista& lista, const std::vector<T>& esperado) {
+    ASSERT_EQ(lista.tamanho(), esperado.size());
+    std::vector<T> obtido(lista.begin(), lista.end());
+    EXPECT_EQ(obtido, esperado);
+    // Percorre também de trás para frente.
+    std::vector<T> reverso;
+    for (auto it = lista.end(); it != lista.begin();) reverso.push_back(*--it);
+    EXPECT_TRUE(std::equal(reverso.rbegin(), reverso.rend(), esperado.begin(), esperado.end()));
+}
+
+// Suíte de testes para a ListaEncadeadaDupla
+TEST(ListaEncadeadaDuplaTest, TesteOperacoesBasicas) {
+    ListaEncadeadaDupla<std::string, 4> lista;
+    EXPECT_TRUE(lista.vazia());
+    EXPECT_EQ(lista.begin(), lista.end());
+
+    for (int i = 0; i < 6; ++i) lista.push_back(std::to_string(i));
+    lista.push_front("a");
+    lista.push_front("b");
+    EXPECT_EQ(lista.front(), "b");
+    EXPECT_EQ(lista.back(), "5");
+    lista.pop_back();
+    lista.pop_front();
+    auto it = lista.inserir(std::next(lista.begin(), 3), "x");
+    EXPECT_EQ(*it, "x");
+    EXPECT_EQ(*lista.remover(it), "2");
+    esperar_igual(lista, std::vector<std::string>{"a", "0", "1", "2", "3", "4"});
+
+    ListaEncadeadaDupla<std::string, 4> copia = lista;
+    copia.push_back("5");
+    EXPECT_EQ(lista.tamanho(), 6u);
+    ListaEncadeadaDupla<std::string, 4> movida = std::move(copia);
+    movida.push_back("6"); // A sentinela da lista movida precisa estar religada
+    esperar_igual(movida, std::vector<std::string>{"a", "0", "1", "2", "3", "4", "5", "6"});
+    EXPECT_TRUE(copia.vazia());
+
+    ListaEncadeadaDupla<std::unique_ptr<int>> ponteiros;
+    for (int i = 0; i < 100; ++i) ponteiros.push_back(std::make_unique<int>(i));
+    EXPECT_EQ(*ponteiros.back(), 99);
+}
+
+TEST(ListaEncadeadaDuplaTest, TesteOperacoesAleatoriasContraList) {
+    std::mt19937 gerador(39);
+    ListaEncadeadaDupla<int, 8> lista;
+    std::list<int> referencia;
+
+    for (int passo = 0; passo < 20000; ++passo) {
+        std::size_t n = referencia.size();
+        std::size_t k = gerador() % (n + 1);
+        auto it = lista.begin();
+        auto ref = referencia.begin();
+        // Chega à posição pelo lado mais próximo, exercitando os dois sentidos.
+        if (k <= n / 2) {
+            std::advance(it, k);
+            std::advance(ref, k);
+        } else {
+            it = lista.end();
+            ref = referencia.end();
+            for (std::size_t j = n; j > k; --j) --it, --ref;
+        }
+
+        if (gerador() % 5 < 3 || k == n) {
+            int valor = static_cast<int>(gerador());
+            ASSERT_EQ(*lista.inserir(it, valor), valor);
+            referencia.insert(ref, valor);
+        } else {
+            auto seguinte = lista.remover(it);
+            auto ref_seguinte = referencia.erase(ref);
+            ASSERT_EQ(seguinte == lista.end(), ref_seguinte == referencia.end());
+            if (ref_seguinte != referencia.end()) {
+                ASSERT_EQ(*seguinte, *ref_seguinte);
+            }
+        }
+        if (passo % 500 == 0) esperar_igual(lista, std::vector<int>(referencia.begin(), referencia.end()));
+    }
+    esperar_igual(lista, std::vector<int>(referencia.begin(), referencia.end()));
+    while (!lista.vazia()) lista.pop_back();
+    EXPECT_EQ(lista.pool_de_nos()->nos_em_uso(), 0u);
+}
+
+TEST(ListaEncadeadaDuplaTest, TesteInsercaoOrdenada) {
+    std::mt19937 gerador(11);
+    ListaEncadeadaDupla<int, 16> lista;
+    std::vector<int> esperado;
+    for (int i = 0; i < 5000; ++i) {
+        int x = static_cast<int>(gerador() % 1000);
+        EXPECT_EQ(*lista.inserir_ordenado(x), x);
+        esperado.insert(std::upper_bound(esperado.begin(), esperado.end(), x), x);
+    }
+    esperar_igual(lista, esperado);
+}
+
+TEST(ListaEncadeadaDuplaTest, TesteSplice) {
+    using Lista = ListaEncadeadaDupla<int, 4>;
+    auto pool = std::make_shared<Lista::Pool>();
+    Lista a(pool), b(pool), c;
+    for (int i = 0; i < 10; ++i) a.push_back(i);
+    for (int i = 100; i < 106; ++i) b.push_back(i);
+    const int* endereco = &b.back();
+
+    // Lista inteira, no meio de um nó: os elementos de 'b' não mudam de endereço.
+    a.splice(std::next(a.begin(), 2), b);
+    EXPECT_TRUE(b.vazia());
+    EXPECT_EQ(&*std::next(a.begin(), 7), endereco);
+    esperar_igual(a, std::vector<int>{0, 1, 100, 101, 102, 103, 104, 105, 2, 3, 4, 5, 6, 7, 8, 9});
+
+    // Intervalo [1, 13) de 'a' para o fim de 'b'.
+    b.push_back(-1);
+    b.splice(b.end(), a, std::next(a.begin(), 1), std::next(a.begin(), 13));
+    esperar_igual(a, std::vector<int>{0, 7, 8, 9});
+    esperar_igual(b, std::vector<int>{-1, 1, 100, 101, 102, 103, 104, 105, 2, 3, 4, 5, 6});
+
+    // Intervalo dentro de um único nó e intervalo vazio.
+    a.splice(a.begin(), b, std::next(b.begin(), 2), std::next(b.begin(), 3));
+    a.splice(a.begin(), b, b.begin(), b.begin());
+    esperar_igual(a, std::vector<int>{100, 0, 7, 8, 9});
+    EXPECT_EQ(b.tamanho(), 12u);
+
+    // Pools diferentes.
+    EXPECT_THROW(a.splice(a.end(), c, c.begin(), c.end()), std::invalid_argument);
+    c.push_back(42);
+    a.splice(a.end(), c);
+    EXPECT_TRUE(c.vazia());
+    EXPECT_EQ(a.back(), 42);
+}
+
+TEST(ListaEncadeadaDuplaTest, TesteSpliceEntrePoolsNoMeio) {
+    // Pools diferentes movem elemento a elemento; no meio de nós cheios, as inserções dividem o
+    // nó da posição várias vezes, e a ordem de 'b' precisa ser mantida.
+    using Lista = ListaEncadeadaDupla<int, 4>;
+    Lista a, b;
+    std::vector<int> esperado;
+    for (int i = 0; i < 12; ++i) a.push_back(100 + i);
+    for (int i = 0; i < 9; ++i) b.push_back(i);
+    esperado.assign(a.begin(), a.end());
+    esperado.insert(esperado.begin() + 5, b.begin(), b.end());
+
+    a.splice(std::next(a.begin(), 5), b);
+    EXPECT_TRUE(b.vazia());
+    esperar_igual(a, esperado);
+
+    // No início da lista também.
+    for (int i = 0; i < 6; ++i) b.push_back(-i);
+    esperado.insert(esperado.begin(), b.begin(), b.end());
+    a.splice(a.begin(), b);
+    esperar_igual(a, esperado);
+}
@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+#include "estruturas_dados/lista_encadeada_simples.hpp"
+#include <algorithm>
+#include <forward_list>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+template <typename Lista, typename T>
+void esperar_igual(const Lista& lista, const std::vector<T>& esperado) {
+    ASSERT_EQ(lista.tamanho(), esperado.size());
+    std::vector<T> obtido(lista.begin(), lista.end());
+    EXPECT_EQ(obtido, esperado);
+}
+
+// Suíte de testes para a ListaEncadeadaSimples
+TEST(ListaEncadeadaSimplesTest, TesteOperacoesBasicas) {
+    ListaEncadeadaSimples<std::string, 4> lista;
+    EXPECT_TRUE(lista.vazia());
+    EXPECT_EQ(lista.begin(), lista.end());
+
+    for (int i = 0; i < 10; ++i) lista.push_back(std::to_string(i));
+    lista.push_front("-1");
+    EXPECT_EQ(lista.front(), "-1");
+    EXPECT_EQ(lista.back(), "9");
+
+    auto it = lista.inserir_apos(lista.begin(), "x"); // Nó cheio: divide
+    EXPECT_EQ(*it, "x");
+    it = lista.remover_apos(it);
+    EXPECT_EQ(*it, "1");
+    lista.pop_front();
+    esperar_igual(lista, std::vector<std::string>{"x", "1", "2", "3", "4", "5", "6", "7", "8", "9"});
+
+    // Cópia independente e movimentação.
+    ListaEncadeadaSimples<std::string, 4> copia = lista;
+    copia.push_back("10");
+    EXPECT_EQ(lista.tamanho(), 10u);
+    ListaEncadeadaSimples<std::string, 4> movida = std::move(copia);
+    movida.push_back("11"); // O último nó precisa ter sido transferido
+    EXPECT_EQ(movida.back(), "11");
+    EXPECT_EQ(movida.tamanho(), 12u);
+
+    // Elementos só movíveis.
+    ListaEncadeadaSimples<std::unique_ptr<int>> ponteiros;
+    for (int i = 0; i < 100; ++i) ponteiros.push_front(std::make_unique<int>(i));
+    EXPECT_EQ(*ponteiros.front(), 99);
+    lista.limpar();
+    EXPECT_TRUE(lista.vazia());
+}
+
+TEST(ListaEncadeadaSimplesTest, TesteOperacoesAleatoriasContraForwardList) {
+    std::mt19937 gerador(39);
+    ListaEncadeadaSimples<int, 8> lista;
+    std::forward_list<int> referencia;
+    std::size_t n = 0;
+
+    for (int passo = 0; passo < 20000; ++passo) {
+        // Posição aleatória em [antes_do_inicio, último].
+        std::size_t k = n ? gerador() % (n + 1) : 0;
+        auto it = lista.antes_do_inicio();
+        auto ref = referencia.before_begin();
+        for (std::size_t j = 0; j < k; ++j, ++it, ++ref) {}
+
+        if (gerador() % 5 < 3 || n == 0 || k == n) {
+            int valor = static_cast<int>(gerador());
+            auto novo = lista.inserir_apos(it, valor);
+            ASSERT_EQ(*novo, valor);
+            referencia.insert_after(ref, valor);
+            ++n;
+        } else {
+            auto seguinte = lista.remover_apos(it);
+            auto ref_seguinte = referencia.erase_after(ref);
+            ASSERT_EQ(seguinte == lista.end(), ref_seguinte == referencia.end());
+            if (ref_seguinte != referencia.end()) {
+                ASSERT_EQ(*seguinte, *ref_seguinte);
+            }
+            --n;
+        }
+        if (passo % 500 == 0) {
+            esperar_igual(lista, std::vector<int>(referencia.begin(), referencia.end()));
+            if (n) {
+                ASSERT_EQ(lista.back(), *std::next(referencia.before_begin(), n));
+            }
+        }
+    }
+    while (!lista.vazia()) lista.pop_front();
+    EXPECT_EQ(lista.pool_de_nos()->nos_em_uso(), 0u);
+}
+
+TEST(ListaEncadeadaSimplesTest, TesteInsercaoOrdenadaEReusoDoPool) {
+    std::mt19937 gerador(7);
+    ListaEncadeadaSimples<int, 16> lista;
+    std::vector<int> esperado;
+    for (int i = 0; i < 5000; ++i) {
+        int x = static_cast<int>(gerador() % 1000);
+        EXPECT_EQ(*lista.inserir_ordenado(x), x);
+        esperado.insert(std::upper_bound(esperado.begin(), esperado.end(), x), x);
+    }
+    esperar_igual(lista, esperado);
+    EXPECT_EQ(lista.back(), esperado.back());
+
+    // Ordem decrescente com comparador próprio.
+    ListaEncadeadaSimples<int, 4> decrescente;
+    for (int x : {3, 1, 4, 1, 5, 9, 2, 6}) decrescente.inserir_ordenado(x, std::greater<int>());
+    esperar_igual(decrescente, std::vector<int>{9, 6, 5, 4, 3, 2, 1, 1});
+
+    // Depois de esvaziar, novas inserções reutilizam os nós do pool.
+    std::size_t reservados = lista.pool_de_nos()->nos_reservados();
+    lista.limpar();
+    EXPECT_EQ(lista.pool_de_nos()->nos_em_uso(), 0u);
+    for (int x : esperado) lista.push_back(x);
+    EXPECT_EQ(lista.pool_de_nos()->nos_reservados(), reservados);
+}
+
+TEST(ListaEncadeadaSimplesTest, TesteSplice) {
+    auto pool = std::make_shared<ListaEncadeadaSimples<int, 4>::Pool>();
+    ListaEncadeadaSimples<int, 4> a(pool), b(pool), c;
+    for (int i = 0; i < 10; ++i) a.push_back(i);
+    for (int i = 100; i < 106; ++i) b.push_back(i);
+    const int* endereco = &b.front();
+
+    // No meio de um nó: divide o nó e religa os nós de 'b' sem mover elementos.
+    a.splice_apos(std::next(a.begin(), 1), b);
+    EXPECT_TRUE(b.vazia());
+    EXPECT_EQ(&*std::next(a.begin(), 2), endereco);
+    esperar_igual(a, std::vector<int>{0, 1, 100, 101, 102, 103, 104, 105, 2, 3, 4, 5, 6, 7, 8, 9});
+
+    // No fim, e depois de volta para uma lista vazia, atualizando o último nó.
+    b.push_back(200);
+    a.splice_apos(std::next(a.begin(), 15), b);
+    EXPECT_EQ(a.back(), 200);
+    b.splice_apos(b.antes_do_inicio(), a);
+    EXPECT_TRUE(a.vazia());
+    EXPECT_EQ(b.tamanho(), 17u);
+    b.push_back(201);
+    EXPECT_EQ(b.back(), 201);
+
+    // Pools diferentes: os elementos são movidos um a um.
+    for (int i = 0; i < 3; ++i) c.push_back(-i);
+    b.splice_apos(b.antes_do_inicio(), c);
+    EXPECT_TRUE(c.vazia());
+    EXPECT_EQ(b.tamanho(), 21u);
+    EXPECT_EQ(b.front(), 0);
+    EXPECT_EQ(*std::next(b.begin(), 2), -2);
+    EXPECT_EQ(*std::next(b.begin(), 3), 0);
+}
@@ -0,0 +1,52 @@
+#include <gtest/gtest.h>
+#include "estruturas_dados/merge_sort_tree.hpp"
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+// Suíte de testes para a MergeSortTree
+TEST(MergeSortTreeTest, TesteConsultasBasicas) {
+    std::vector<int> arr = {5, 1, 4, 1, 9, 2, 6, 5, 3};
+    MergeSortTree<int> mst(arr);
+
+    EXPECT_EQ(mst.contar_menores(1, 5, 4), 3); // [1, 4, 1, 9, 2]
+    EXPECT_EQ(mst.contar_menores(0, 8, 100), 9);
+    EXPECT_EQ(mst.contar_menores(0, 8, 1), 0);
+    EXPECT_EQ(mst.k_esimo_menor(1, 5, 0), 1);
+    EXPECT_EQ(mst.k_esimo_menor(1, 5, 3), 4);
+    EXPECT_EQ(mst.k_esimo_menor(0, 8, 8), 9);
+    EXPECT_EQ(mst.k_esimo_menor(4, 4, 0), 9);
+
+    EXPECT_THROW(mst.contar_menores(3, 2, 0), std::out_of_range);
+    EXPECT_THROW(mst.k_esimo_menor(0, 1, 2), std::out_of_range);
+}
+
+TEST(MergeSortTreeTest, TesteTiposNaoInteiros) {
+    std::vector<std::string> arr = {"pera", "uva", "abacaxi", "banana", "caju"};
+    MergeSortTree<std::string> mst(arr);
+    EXPECT_EQ(mst.contar_menores(0, 4, "c"), 2);
+    EXPECT_EQ(mst.k_esimo_menor(1, 3, 0), "abacaxi");
+}
+
+TEST(MergeSortTreeTest, TesteAleatorioContraIngenuo) {
+    std::mt19937 gerador(77);
+    for (int n : {1, 2, 3, 17, 64, 100}) {
+        std::vector<int> arr(n);
+        for (auto& x : arr) x = gerador() % 30;
+        MergeSortTree<int> mst(arr);
+
+        for (int q = 0; q < 200; ++q) {
+            int l = gerador() % n;
+            int r = gerador() % n;
+            if (l > r) std::swap(l, r);
+            std::vector<int> sub(arr.begin() + l, arr.begin() + r + 1);
+            std::sort(sub.begin(), sub.end());
+
+            int x = gerador() % 35;
+            ASSERT_EQ(mst.contar_menores(l, r, x), std::lower_bound(sub.begin(), sub.end(), x) - sub.begin());
+            int k = gerador() % sub.size();
+            ASSERT_EQ(mst.k_esimo_menor(l, r, k), sub[k]);
+        }
+    }
+}
\ No newline at end of file
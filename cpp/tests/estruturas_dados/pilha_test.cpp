@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+#include "estruturas_dados/pilha.hpp"
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Suíte de testes para a PilhaConcorrente
+TEST(PilhaConcorrenteTest, TesteOrdemLIFO) {
+    PilhaConcorrente<std::string> pilha;
+    std::string s;
+    EXPECT_TRUE(pilha.empty());
+    EXPECT_FALSE(pilha.pop(s));
+
+    pilha.push("a");
+    pilha.push(std::string("b"));
+    pilha.push("c");
+    EXPECT_FALSE(pilha.empty());
+    for (const char* esperado : {"c", "b", "a"}) {
+        ASSERT_TRUE(pilha.pop(s));
+        EXPECT_EQ(s, esperado);
+    }
+    EXPECT_FALSE(pilha.pop(s));
+
+    // Elementos só movíveis e nós que sobram na destruição.
+    PilhaConcorrente<std::unique_ptr<int>> ponteiros;
+    ponteiros.push(std::make_unique<int>(1));
+    ponteiros.push(std::make_unique<int>(2));
+    std::unique_ptr<int> p;
+    ASSERT_TRUE(ponteiros.pop(p));
+    EXPECT_EQ(*p, 2);
+}
+
+TEST(PilhaConcorrenteTest, TesteEmpilharEDesempilharConcorrentes) {
+    // Todos empilham e desempilham ao mesmo tempo, reaproveitando endereços liberados; cada
+    // elemento precisa sair exatamente uma vez.
+    PilhaConcorrente<int> pilha;
+    const int threads = 4, por_thread = 50000;
+    std::vector<std::vector<int>> retirados(threads);
+
+    std::vector<std::thread> trabalhadoras;
+    for (int t = 0; t < threads; ++t) {
+        trabalhadoras.emplace_back([&, t] {
+            int x;
+            for (int i = 0; i < por_thread; ++i) {
+                pilha.push(t * por_thread + i);
+                if (i % 2 == 1 && pilha.pop(x)) retirados[t].push_back(x);
+            }
+        });
+    }
+    for (auto& th : trabalhadoras) th.join();
+
+    std::vector<int> vezes(threads * por_thread, 0);
+    for (const auto& r : retirados) {
+        for (int x : r) ++vezes[x];
+    }
+    int x;
+    while (pilha.pop(x)) ++vezes[x];
+    for (int i = 0; i < threads * por_thread; ++i) ASSERT_EQ(vezes[i], 1) << "elemento " << i;
+}
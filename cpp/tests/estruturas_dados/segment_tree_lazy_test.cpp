@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+#include "estruturas_dados/segment_tree_lazy.hpp"
+#include <random>
+#include <vector>
+
+// Suíte de testes para a SegmentTreeLazy
+TEST(SegmentTreeLazyTest, TesteSomaComSomaEmIntervalo) {
+    std::vector<long long> arr = {1, 3, 5, 7, 9, 11};
+    SegmentTreeLazy<MonoideSoma<long long>, AcaoSomar<MonoideSoma<long long>>> st(arr);
+
+    EXPECT_EQ(st.query(0, 5), 36);
+    st.apply(1, 3, 10); // {1, 13, 15, 17, 9, 11}
+    EXPECT_EQ(st.query(0, 5), 66);
+    EXPECT_EQ(st.query(2, 4), 41);
+    EXPECT_EQ(st.get(3), 17);
+
+    st.apply(0, 5, -1);
+    EXPECT_EQ(st.query(0, 5), 60);
+    EXPECT_EQ(st.query(0, 0), 0);
+}
+
+TEST(SegmentTreeLazyTest, TesteMinimoComAtribuicaoEmIntervalo) {
+    std::vector<int> arr = {2, 5, 1, 8, 3, 9};
+    SegmentTreeLazy<MonoideMinimo<int>, AcaoAtribuir<MonoideMinimo<int>>> st(arr);
+
+    EXPECT_EQ(st.query(0, 5), 1);
+    st.apply(1, 3, 6); // {2, 6, 6, 6, 3, 9}
+    EXPECT_EQ(st.query(1, 3), 6);
+    EXPECT_EQ(st.query(0, 5), 2);
+    st.apply(0, 1, 7); // {7, 7, 6, 6, 3, 9}
+    EXPECT_EQ(st.query(0, 2), 6);
+    EXPECT_EQ(st.get(0), 7);
+}
+
+TEST(SegmentTreeLazyTest, TesteSomaComAtribuicaoEmIntervalo) {
+    std::vector<long long> arr = {1, 2, 3, 4, 5};
+    SegmentTreeLazy<MonoideSoma<long long>, AcaoAtribuir<MonoideSoma<long long>>> st(arr);
+
+    st.apply(1, 3, 10); // {1, 10, 10, 10, 5}
+    EXPECT_EQ(st.query(0, 4), 36);
+    st.update(2, 0);    // {1, 10, 0, 10, 5}
+    EXPECT_EQ(st.query(1, 3), 20);
+}
+
+TEST(SegmentTreeLazyTest, TesteAfimMisturandoSomaEAtribuicao) {
+    using Monoide = MonoideSoma<long long>;
+    using Acao = AcaoAfim<Monoide>;
+    std::mt19937 gerador(123);
+    const int n = 45;
+    std::vector<long long> referencia(n);
+    for (auto& v : referencia) v = gerador() % 10;
+    SegmentTreeLazy<Monoide, Acao> st(referencia);
+
+    for (int op = 0; op < 500; ++op) {
+        int l = gerador() % n;
+        int r = gerador() % n;
+        if (l > r) std::swap(l, r);
+        switch (gerador() % 4) {
+            case 0: { // Somar
+                long long d = static_cast<long long>(gerador() % 11) - 5;
+                st.apply(l, r, {1, d});
+                for (int i = l; i <= r; ++i) referencia[i] += d;
+                break;
+            }
+            case 1: { // Atribuir
+                long long v = gerador() % 20;
+                st.apply(l, r, {0, v});
+                for (int i = l; i <= r; ++i) referencia[i] = v;
+                break;
+            }
+            case 2: { // Transformação afim genérica
+                st.apply(l, r, {2, 1});
+                for (int i = l; i <= r; ++i) referencia[i] = 2 * referencia[i] + 1;
+                // Mantém os valores pequenos
+                st.apply(0, n - 1, {0, 3});
+                for (auto& v : referencia) v = 3;
+                break;
+            }
+            default: {
+                long long esperado = 0;
+                for (int i = l; i <= r; ++i) esperado += referencia[i];
+                ASSERT_EQ(st.query(l, r), esperado);
+            }
+        }
+    }
+    for (int i = 0; i < n; ++i) {
+        EXPECT_EQ(st.get(i), referencia[i]);
+    }
+}
+
+TEST(SegmentTreeLazyTest, TesteMaximoComSomaContraReferencia) {
+    using Monoide = MonoideMaximo<int>;
+    std::mt19937 gerador(99);
+    const int n = 33;
+    std::vector<int> referencia(n);
+    for (auto& v : referencia) v = gerador() % 100;
+    SegmentTreeLazy<Monoide, AcaoSomar<Monoide>> st(referencia);
+
+    for (int op = 0; op < 1000; ++op) {
+        int l = gerador() % n;
+        int r = gerador() % n;
+        if (l > r) std::swap(l, r);
+        if (op % 2 == 0) {
+            int d = static_cast<int>(gerador() % 21) - 10;
+            st.apply(l, r, d);
+            for (int i = l; i <= r; ++i) referencia[i] += d;
+        } else {
+            int esperado = referencia[l];
+            for (int i = l; i <= r; ++i) esperado = std::max(esperado, referencia[i]);
+            ASSERT_EQ(st.query(l, r), esperado);
+        }
+    }
+}
+
+TEST(SegmentTreeLazyTest, TesteCasosDeBorda) {
+    std::vector<int> arr = {10};
+    SegmentTreeLazy<MonoideSoma<int>, AcaoSomar<MonoideSoma<int>>> st(arr);
+    st.apply(0, 0, 5);
+    EXPECT_EQ(st.query(0, 0), 15);
+
+    EXPECT_THROW(st.query(0, 1), std::out_of_range);
+    EXPECT_THROW(st.apply(-1, 0, 1), std::out_of_range);
+    EXPECT_THROW(st.apply(1, 0, 1), std::out_of_range);
+    EXPECT_THROW(st.update(1, 5), std::out_of_range);
+    EXPECT_THROW(st.get(1), std::out_of_range);
+}
\ No newline at end of file
@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+#include "estruturas_dados/segment_tree_persistente.hpp"
+#include <random>
+#include <vector>
+
+// Suíte de testes para a SegmentTreePersistente
+TEST(SegmentTreePersistenteTest, TesteVersoesIndependentes) {
+    std::vector<int> arr = {1, 3, 5, 7, 9, 11};
+    SegmentTreePersistente<MonoideSoma<int>> st(arr);
+
+    auto v1 = st.update(0, 2, 6);  // {1, 3, 6, 7, 9, 11}
+    auto v2 = st.update(v1, 0, 0); // {0, 3, 6, 7, 9, 11}
+    auto v3 = st.update(0, 5, 0);  // Ramificação a partir da versão 0: {1, 3, 5, 7, 9, 0}
+
+    EXPECT_EQ(st.query(0, 0, 5), 36);
+    EXPECT_EQ(st.query(v1, 0, 5), 37);
+    EXPECT_EQ(st.query(v2, 0, 5), 36);
+    EXPECT_EQ(st.query(v2, 0, 2), 9);
+    EXPECT_EQ(st.query(v3, 0, 5), 25);
+    EXPECT_EQ(st.query(v3, 1, 3), 15);
+    EXPECT_EQ(st.num_versoes(), 4u);
+}
+
+TEST(SegmentTreePersistenteTest, TesteMemoriaPorAtualizacao) {
+    const int n = 1024;
+    std::vector<long long> arr(n, 1);
+    SegmentTreePersistente<MonoideSoma<long long>> st(arr);
+    EXPECT_EQ(st.nos_alocados(), static_cast<std::size_t>(2 * n - 1));
+
+    SegmentTreePersistente<MonoideSoma<long long>>::Versao v = 0;
+    for (int i = 0; i < 100; ++i) {
+        v = st.update(v, i, 2);
+    }
+    // Cada atualização cria exatamente altura + 1 = 11 nós.
+    EXPECT_EQ(st.nos_alocados(), static_cast<std::size_t>(2 * n - 1 + 100 * 11));
+    EXPECT_EQ(st.query(v, 0, n - 1), n + 100);
+}
+
+TEST(SegmentTreePersistenteTest, TesteColetaDeLixo) {
+    std::mt19937 gerador(5);
+    const int n = 50;
+    std::vector<long long> base(n);
+    for (auto& x : base) x = gerador() % 100;
+    SegmentTreePersistente<MonoideMinimo<long long>> st(base);
+
+    // Guarda uma cópia de referência de cada versão.
+    std::vector<std::vector<long long>> referencia = {base};
+    for (int i = 0; i < 200; ++i) {
+        auto origem = static_cast<SegmentTreePersistente<MonoideMinimo<long long>>::Versao>(gerador() % referencia.size());
+        int idx = gerador() % n;
+        long long val = gerador() % 100;
+        auto nova = st.update(origem, idx, val);
+        ASSERT_EQ(nova, referencia.size());
+        referencia.push_back(referencia[origem]);
+        referencia.back()[idx] = val;
+    }
+
+    // Libera as versões pares, inclusive a 0.
+    for (std::size_t v = 0; v < referencia.size(); v += 2) {
+        st.liberar_versao(static_cast<SegmentTreePersistente<MonoideMinimo<long long>>::Versao>(v));
+    }
+    std::size_t antes = st.nos_alocados();
+    std::size_t liberados = st.coletar_lixo();
+    EXPECT_GT(liberados, 0u);
+    EXPECT_EQ(st.nos_alocados(), antes - liberados);
+
+    for (std::size_t v = 0; v < referencia.size(); ++v) {
+        auto versao = static_cast<SegmentTreePersistente<MonoideMinimo<long long>>::Versao>(v);
+        if (v % 2 == 0) {
+            EXPECT_THROW(st.query(versao, 0, n - 1), std::invalid_argument);
+            continue;
+        }
+        for (int l = 0; l < n; l += 7) {
+            int r = std::min(n - 1, l + 9);
+            long long esperado = referencia[v][l];
+            for (int i = l; i <= r; ++i) esperado = std::min(esperado, referencia[v][i]);
+            ASSERT_EQ(st.query(versao, l, r), esperado);
+        }
+    }
+
+    // Continua funcionando após a compactação.
+    auto nova = st.update(1, 0, -1);
+    EXPECT_EQ(st.query(nova, 0, n - 1), -1);
+    EXPECT_EQ(st.coletar_lixo(), 0u);
+}
+
+TEST(SegmentTreePersistenteTest, TesteCasosDeBorda) {
+    std::vector<int> arr = {10};
+    SegmentTreePersistente<MonoideSoma<int>> st(arr);
+    auto v1 = st.update(0, 0, 20);
+    EXPECT_EQ(st.query(0, 0, 0), 10);
+    EXPECT_EQ(st.query(v1, 0, 0), 20);
+
+    EXPECT_THROW(st.query(0, 0, 1), std::out_of_range);
+    EXPECT_THROW(st.query(0, 1, 0), std::out_of_range);
+    EXPECT_THROW(st.update(0, 1, 5), std::out_of_range);
+    EXPECT_THROW(st.query(7, 0, 0), std::invalid_argument);
+    EXPECT_THROW(SegmentTreePersistente<MonoideSoma<int>>(std::vector<int>{}), std::invalid_argument);
+}
\ No newline at end of file
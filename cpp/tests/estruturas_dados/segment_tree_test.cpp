@@ -1,6 +1,9 @@
 #include <gtest/gtest.h>
 #include "estruturas_dados/segment_tree.hpp"
 #include <limits>
+#include <memory>
+#include <random>
+#include <string>
 
 // Suíte de testes para a Segment Tree
 TEST(SegmentTreeTest, TesteSomaDeIntervalo) {
@@ -78,4 +81,109 @@ TEST(SegmentTreeTest, TesteCasosDeBorda) {
     EXPECT_THROW(st.query(-1, 0), std::out_of_range);
     EXPECT_THROW(st.query(1, 0), std::out_of_range);
     EXPECT_THROW(st.update(1, 5), std::out_of_range);
+}
+
+// Suíte de testes para a SegmentTreeMonoide
+TEST(SegmentTreeMonoideTest, TesteSomaMinimoMaximo) {
+    std::vector<int> arr = {2, 5, 1, 8, 3, 9};
+    SegmentTreeMonoide<MonoideSoma<int>> soma(arr);
+    SegmentTreeMonoide<MonoideMinimo<int>> minimo(arr);
+    SegmentTreeMonoide<MonoideMaximo<int>> maximo(arr);
+
+    EXPECT_EQ(soma.query(0, 5), 28);
+    EXPECT_EQ(soma.query(1, 3), 14);
+    EXPECT_EQ(minimo.query(1, 4), 1);
+    EXPECT_EQ(minimo.query(3, 5), 3);
+    EXPECT_EQ(maximo.query(0, 3), 8);
+
+    soma.update(2, 6);
+    minimo.update(2, 10);
+    EXPECT_EQ(soma.query(0, 5), 33);
+    EXPECT_EQ(minimo.query(0, 5), 2);
+    EXPECT_EQ(soma.get(2), 6);
+}
+
+TEST(SegmentTreeMonoideTest, TesteNaoDependeDoVetorOriginal) {
+    std::unique_ptr<SegmentTreeMonoide<MonoideSoma<long long>>> st;
+    {
+        std::vector<long long> temporario = {1, 2, 3, 4, 5};
+        st = std::make_unique<SegmentTreeMonoide<MonoideSoma<long long>>>(temporario);
+    } // 'temporario' é destruído aqui
+    EXPECT_EQ(st->query(0, 4), 15);
+    st->update(4, 10);
+    EXPECT_EQ(st->query(3, 4), 14);
+}
+
+// Concatenação de strings não é comutativa: garante que a ordem dos operandos é preservada.
+struct MonoideConcatenacao {
+    using Valor = std::string;
+    static Valor identidade() { return ""; }
+    static Valor combinar(const Valor& a, const Valor& b) { return a + b; }
+};
+
+TEST(SegmentTreeMonoideTest, TesteMonoideNaoComutativo) {
+    std::vector<std::string> arr = {"a", "b", "c", "d", "e"};
+    SegmentTreeMonoide<MonoideConcatenacao> st(arr);
+    EXPECT_EQ(st.query(0, 4), "abcde");
+    EXPECT_EQ(st.query(1, 3), "bcd");
+    st.update(2, "X");
+    EXPECT_EQ(st.query(0, 4), "abXde");
+}
+
+TEST(SegmentTreeMonoideTest, TesteUpdateManyContraReferencia) {
+    std::mt19937 gerador(7);
+    const int n = 37; // Tamanho que não é potência de dois
+    std::vector<long long> referencia(n);
+    for (auto& v : referencia) v = gerador() % 100;
+    SegmentTreeMonoide<MonoideSoma<long long>> st(referencia);
+
+    for (int rodada = 0; rodada < 50; ++rodada) {
+        std::vector<std::pair<int, long long>> lote;
+        int k = 1 + gerador() % 10;
+        for (int i = 0; i < k; ++i) {
+            int idx = gerador() % n;
+            long long val = gerador() % 100;
+            lote.push_back({idx, val});
+            referencia[idx] = val; // A última ocorrência prevalece
+        }
+        st.update_many(lote);
+
+        for (int l = 0; l < n; l += 3) {
+            for (int r = l; r < n; r += 5) {
+                long long esperado = 0;
+                for (int i = l; i <= r; ++i) esperado += referencia[i];
+                ASSERT_EQ(st.query(l, r), esperado);
+            }
+        }
+    }
+}
+
+TEST(SegmentTreeMonoideTest, TesteCasosDeBorda) {
+    std::vector<int> arr = {10};
+    SegmentTreeMonoide<MonoideSoma<int>> st(arr);
+    EXPECT_EQ(st.query(0, 0), 10);
+    st.update_many({{0, 20}});
+    EXPECT_EQ(st.query(0, 0), 20);
+
+    EXPECT_THROW(st.query(0, 1), std::out_of_range);
+    EXPECT_THROW(st.query(-1, 0), std::out_of_range);
+    EXPECT_THROW(st.query(1, 0), std::out_of_range);
+    EXPECT_THROW(st.update(1, 5), std::out_of_range);
+    EXPECT_THROW(st.update_many({{1, 5}}), std::out_of_range);
+
+    SegmentTreeMonoide<MonoideMinimo<int>> vazia(0);
+    EXPECT_EQ(vazia.size(), 0);
+    EXPECT_THROW(vazia.query(0, 0), std::out_of_range);
+}
+
+TEST(SegmentTreeMonoideTest, TesteLoteInvalidoNaoAltera) {
+    std::vector<int> arr = {1, 2, 3, 4, 5};
+    SegmentTreeMonoide<MonoideSoma<int>> st(arr);
+    // O índice inválido vem depois de atualizações válidas: nenhuma delas pode ser aplicada.
+    EXPECT_THROW(st.update_many({{0, 100}, {3, 100}, {5, 7}, {4, 100}}), std::out_of_range);
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_EQ(st.get(i), arr[i]);
+    }
+    EXPECT_EQ(st.query(0, 4), 15);
+    EXPECT_EQ(st.query(0, 1), 3);
 }
\ No newline at end of file
@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+#include "estruturas_dados/skip_list.hpp"
+#include <atomic>
+#include <random>
+#include <set>
+#include <thread>
+#include <vector>
+
+// Suíte de testes para a SkipListConcorrente
+TEST(SkipListConcorrenteTest, TesteOperacoesBasicas) {
+    SkipListConcorrente<int, std::string> lista;
+    EXPECT_TRUE(lista.inserir(5, "cinco"));
+    EXPECT_TRUE(lista.inserir(1, "um"));
+    EXPECT_TRUE(lista.inserir(9, "nove"));
+    EXPECT_FALSE(lista.inserir(5, "outro")); // Chave repetida
+
+    std::string valor;
+    EXPECT_TRUE(lista.buscar(5, valor));
+    EXPECT_EQ(valor, "cinco");
+    EXPECT_TRUE(lista.contem(1));
+    EXPECT_FALSE(lista.contem(2));
+    EXPECT_EQ(lista.tamanho(), 3u);
+
+    EXPECT_TRUE(lista.remover(5));
+    EXPECT_FALSE(lista.remover(5));
+    EXPECT_FALSE(lista.contem(5));
+    EXPECT_EQ(lista.tamanho(), 2u);
+}
+
+TEST(SkipListConcorrenteTest, TesteSequencialContraStdSet) {
+    std::mt19937 gerador(21);
+    SkipListConcorrente<int, int> lista;
+    std::set<int> referencia;
+    for (int op = 0; op < 20000; ++op) {
+        int chave = gerador() % 1000;
+        if (gerador() % 2) {
+            ASSERT_EQ(lista.inserir(chave, -chave), referencia.insert(chave).second);
+        } else {
+            ASSERT_EQ(lista.remover(chave), referencia.erase(chave) == 1);
+        }
+    }
+    for (int chave = 0; chave < 1000; ++chave) {
+        ASSERT_EQ(lista.contem(chave), referencia.count(chave) == 1);
+    }
+
+    std::vector<int> visitados, esperados;
+    lista.percorrer_intervalo(100, 300, [&](int chave, int valor) {
+        EXPECT_EQ(valor, -chave);
+        visitados.push_back(chave);
+    });
+    for (auto it = referencia.lower_bound(100); it != referencia.end() && *it <= 300; ++it) esperados.push_back(*it);
+    EXPECT_EQ(visitados, esperados);
+}
+
+TEST(SkipListConcorrenteTest, TesteInsercoesConcorrentesDisjuntas) {
+    SkipListConcorrente<int, int> lista;
+    const int threads = 4, por_thread = 5000;
+    std::vector<std::thread> trabalhadoras;
+    for (int t = 0; t < threads; ++t) {
+        trabalhadoras.emplace_back([&, t] {
+            // Chaves intercaladas entre as threads, para disputar os mesmos predecessores.
+            for (int i = 0; i < por_thread; ++i) lista.inserir(i * threads + t, t);
+            for (int i = 0; i < por_thread; i += 2) lista.remover(i * threads + t);
+        });
+    }
+    for (auto& th : trabalhadoras) th.join();
+
+    EXPECT_EQ(lista.tamanho(), static_cast<std::size_t>(threads * por_thread / 2));
+    int anterior = -1;
+    std::size_t total = 0;
+    lista.percorrer_intervalo(0, threads * por_thread, [&](int chave, int valor) {
+        EXPECT_LT(anterior, chave);
+        EXPECT_EQ(valor, chave % threads);
+        EXPECT_EQ((chave / threads) % 2, 1);
+        anterior = chave;
+        ++total;
+    });
+    EXPECT_EQ(total, lista.tamanho());
+}
+
+TEST(SkipListConcorrenteTest, TesteOperacoesConcorrentesNasMesmasChaves) {
+    // Para cada chave, inserções bem-sucedidas menos remoções bem-sucedidas deve ser 0 ou 1,
+    // e igual à presença final da chave.
+    SkipListConcorrente<int, int> lista;
+    const int threads = 4, chaves = 64, operacoes = 20000;
+    std::vector<std::atomic<int>> saldo(chaves);
+    std::vector<std::thread> trabalhadoras;
+    for (int t = 0; t < threads; ++t) {
+        trabalhadoras.emplace_back([&, t] {
+            std::mt19937 gerador(100 + t);
+            for (int i = 0; i < operacoes; ++i) {
+                int chave = gerador() % chaves;
+                switch (gerador() % 3) {
+                    case 0: if (lista.inserir(chave, chave)) saldo[chave].fetch_add(1); break;
+                    case 1: if (lista.remover(chave)) saldo[chave].fetch_sub(1); break;
+                    default: lista.contem(chave); break;
+                }
+            }
+        });
+    }
+    for (auto& th : trabalhadoras) th.join();
+
+    std::size_t presentes = 0;
+    for (int chave = 0; chave < chaves; ++chave) {
+        ASSERT_TRUE(saldo[chave] == 0 || saldo[chave] == 1);
+        ASSERT_EQ(lista.contem(chave), saldo[chave] == 1);
+        presentes += saldo[chave];
+    }
+    EXPECT_EQ(lista.tamanho(), presentes);
+}
@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+#include "estruturas_dados/trie.hpp"
+#include <algorithm>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+// Verifica as consultas de uma trie (mutável ou congelada) contra um std::map de referência.
+template <typename Trie>
+static void verificar_contra_referencia(const Trie& trie, const std::map<std::string, std::uint32_t>& referencia,
+                                        const std::vector<std::string>& consultas) {
+    ASSERT_EQ(trie.tamanho(), referencia.size());
+    for (const std::string& consulta : consultas) {
+        std::uint32_t peso = 0;
+        auto it = referencia.find(consulta);
+        ASSERT_EQ(trie.buscar(consulta, peso), it != referencia.end()) << consulta;
+        if (it != referencia.end()) {
+            ASSERT_EQ(peso, it->second);
+        }
+
+        long long esperado = -1;
+        for (std::size_t tam = 0; tam <= consulta.size(); ++tam) {
+            if (referencia.count(consulta.substr(0, tam))) esperado = static_cast<long long>(tam);
+        }
+        ASSERT_EQ(trie.longest_prefix_match(consulta), esperado) << consulta;
+
+        for (std::size_t tam : {consulta.size() / 3, consulta.size()}) {
+            std::string prefixo = consulta.substr(0, tam);
+            std::vector<std::pair<std::string, std::uint32_t>> visitados, esperados;
+            trie.prefix_iterate(prefixo, [&](const std::string& chave, std::uint32_t p) { visitados.push_back({chave, p}); });
+            for (auto r = referencia.lower_bound(prefixo); r != referencia.end() && r->first.compare(0, tam, prefixo) == 0; ++r) {
+                esperados.push_back(*r);
+            }
+            ASSERT_EQ(visitados, esperados) << prefixo;
+
+            // Os pesos do top-k devem ser os k maiores entre as chaves com o prefixo.
+            auto top = trie.top_k(prefixo, 5);
+            std::vector<std::uint32_t> pesos_esperados;
+            for (auto& e : esperados) pesos_esperados.push_back(e.second);
+            std::sort(pesos_esperados.rbegin(), pesos_esperados.rend());
+            pesos_esperados.resize(std::min<std::size_t>(5, pesos_esperados.size()));
+            ASSERT_EQ(top.size(), pesos_esperados.size());
+            for (std::size_t i = 0; i < top.size(); ++i) {
+                ASSERT_EQ(top[i].second, pesos_esperados[i]);
+                ASSERT_EQ(referencia.at(top[i].first), top[i].second);
+                ASSERT_EQ(top[i].first.compare(0, tam, prefixo), 0);
+            }
+        }
+    }
+}
+
+// Suíte de testes para a RadixTrie e a TrieCongelada
+TEST(RadixTrieTest, TesteOperacoesBasicas) {
+    RadixTrie trie;
+    trie.inserir("romane", 1);
+    trie.inserir("romanus", 2);
+    trie.inserir("romulus", 3);
+    trie.inserir("rubens", 4);
+    trie.inserir("ruber", 5);
+    trie.inserir("rom", 6);
+
+    EXPECT_EQ(trie.tamanho(), 6u);
+    EXPECT_TRUE(trie.contem("rom"));
+    EXPECT_FALSE(trie.contem("roma"));
+    EXPECT_FALSE(trie.contem("r"));
+    EXPECT_EQ(trie.longest_prefix_match("romanesco"), 6);
+    EXPECT_EQ(trie.longest_prefix_match("ruby"), -1);
+    EXPECT_EQ(trie.longest_prefix_match("romulus!"), 7);
+    EXPECT_EQ(trie.longest_prefix_match("romeu"), 3);
+    EXPECT_LE(trie.num_nos(), 2 * trie.tamanho());
+
+    std::vector<std::string> com_rom;
+    trie.prefix_iterate("roma", [&](const std::string& chave, std::uint32_t) { com_rom.push_back(chave); });
+    EXPECT_EQ(com_rom, (std::vector<std::string>{"romane", "romanus"}));
+
+    auto top = trie.top_k("r", 3);
+    ASSERT_EQ(top.size(), 3u);
+    EXPECT_EQ(top[0], (std::pair<std::string, std::uint32_t>{"rom", 6}));
+    EXPECT_EQ(top[1], (std::pair<std::string, std::uint32_t>{"ruber", 5}));
+    EXPECT_EQ(top[2], (std::pair<std::string, std::uint32_t>{"rubens", 4}));
+
+    trie.inserir("rom", 0); // Atualiza o peso
+    EXPECT_EQ(trie.tamanho(), 6u);
+    EXPECT_EQ(trie.top_k("ro", 1)[0].first, "romulus");
+
+    TrieCongelada congelada = trie.congelar();
+    EXPECT_EQ(congelada.tamanho(), 6u);
+    EXPECT_EQ(congelada.longest_prefix_match("romeu"), 3);
+    EXPECT_EQ(congelada.top_k("ro", 1)[0].first, "romulus");
+    EXPECT_TRUE(congelada.top_k("x", 3).empty());
+}
+
+TEST(RadixTrieTest, TesteChaveVaziaEBytesAltos) {
+    RadixTrie trie;
+    trie.inserir("", 7);
+    trie.inserir("\xC3\xA9t\xC3\xA9", 1); // "été" em UTF-8
+    trie.inserir("abc", 2);
+    EXPECT_EQ(trie.longest_prefix_match("xyz"), 0);
+    TrieCongelada congelada = trie.congelar();
+    EXPECT_TRUE(congelada.contem(""));
+    EXPECT_TRUE(congelada.contem("\xC3\xA9t\xC3\xA9"));
+
+    // A ordem lexicográfica compara bytes sem sinal, como std::string.
+    std::vector<std::string> todas;
+    congelada.prefix_iterate("", [&](const std::string& chave, std::uint32_t) { todas.push_back(chave); });
+    EXPECT_EQ(todas, (std::vector<std::string>{"", "abc", "\xC3\xA9t\xC3\xA9"}));
+}
+
+TEST(RadixTrieTest, TesteAleatorioContraStdMap) {
+    std::mt19937 gerador(9);
+    auto palavra = [&](int max_tam) {
+        std::string s(gerador() % max_tam, ' ');
+        for (char& c : s) c = static_cast<char>('a' + gerador() % 3); // Alfabeto pequeno: muitos prefixos comuns
+        return s;
+    };
+
+    RadixTrie trie;
+    std::map<std::string, std::uint32_t> referencia;
+    for (int i = 0; i < 3000; ++i) {
+        std::string chave = palavra(12);
+        std::uint32_t peso = gerador() % 100000;
+        trie.inserir(chave, peso);
+        referencia[chave] = peso;
+    }
+    std::vector<std::string> consultas;
+    for (int i = 0; i < 100; ++i) consultas.push_back(palavra(14));
+    for (int i = 0; i < 50; ++i) consultas.push_back(std::next(referencia.begin(), gerador() % referencia.size())->first);
+
+    verificar_contra_referencia(trie, referencia, consultas);
+    TrieCongelada congelada = trie.congelar();
+    verificar_contra_referencia(congelada, referencia, consultas);
+    EXPECT_LT(congelada.memoria_bytes(), trie.memoria_bytes());
+}
@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+#include "estruturas_dados/wavelet_tree.hpp"
+#include <algorithm>
+#include <random>
+#include <set>
+#include <vector>
+
+// Suíte de testes para o BitVectorRankSelect
+TEST(BitVectorRankSelectTest, TesteRankESelect) {
+    std::mt19937 gerador(1);
+    std::vector<std::uint8_t> bits(300);
+    for (auto& b : bits) b = gerador() % 3 == 0;
+    BitVectorRankSelect bv(bits);
+
+    std::size_t uns = 0;
+    std::vector<std::size_t> pos_uns, pos_zeros;
+    for (std::size_t i = 0; i <= bits.size(); ++i) {
+        ASSERT_EQ(bv.rank1(i), uns);
+        ASSERT_EQ(bv.rank0(i), i - uns);
+        if (i < bits.size()) {
+            EXPECT_EQ(bv.get(i), bits[i] == 1);
+            (bits[i] ? pos_uns : pos_zeros).push_back(i);
+            uns += bits[i];
+        }
+    }
+    for (std::size_t k = 0; k < pos_uns.size(); ++k) ASSERT_EQ(bv.select1(k), pos_uns[k]);
+    for (std::size_t k = 0; k < pos_zeros.size(); ++k) ASSERT_EQ(bv.select0(k), pos_zeros[k]);
+}
+
+TEST(BitVectorRankSelectTest, TesteSelectComAmostrasEmVetorGrande) {
+    // Densidades diferentes para que as amostras de select caiam em palavras próximas e distantes.
+    std::mt19937 gerador(2);
+    for (int densidade : {2, 50}) {
+        std::vector<std::uint8_t> bits(200000);
+        for (auto& b : bits) b = gerador() % densidade == 0;
+        BitVectorRankSelect bv(bits);
+        std::size_t uns = 0, zeros = 0;
+        for (std::size_t i = 0; i < bits.size(); ++i) {
+            if (bits[i]) ASSERT_EQ(bv.select1(uns++), i);
+            else ASSERT_EQ(bv.select0(zeros++), i);
+        }
+    }
+}
+
+// Suíte de testes para a WaveletMatrix
+TEST(WaveletMatrixTest, TesteConsultasBasicas) {
+    std::vector<int> arr = {5, 1, 4, 1, 9, 2, 6, 5, 3};
+    WaveletMatrix<int> wm(arr);
+
+    for (int i = 0; i < static_cast<int>(arr.size()); ++i) {
+        EXPECT_EQ(wm.acessar(i), arr[i]);
+    }
+    // [1, 4, 1, 9, 2] ordenado: 1, 1, 2, 4, 9
+    EXPECT_EQ(wm.k_esimo_menor(1, 5, 0), 1);
+    EXPECT_EQ(wm.k_esimo_menor(1, 5, 2), 2);
+    EXPECT_EQ(wm.k_esimo_menor(1, 5, 4), 9);
+    EXPECT_EQ(wm.contar_menores(1, 5, 4), 3);
+    EXPECT_EQ(wm.contar_menores(0, 8, 100), 9);
+    EXPECT_EQ(wm.contar_menores(0, 8, 0), 0);
+    EXPECT_EQ(wm.contar_ocorrencias(0, 8, 5), 2);
+    EXPECT_EQ(wm.contar_ocorrencias(1, 6, 5), 0);
+    EXPECT_EQ(wm.contar_ocorrencias(0, 8, 7), 0);
+    EXPECT_EQ(wm.contar_distintos(0, 8), 7);
+    EXPECT_EQ(wm.contar_distintos(1, 3), 2);
+    EXPECT_EQ(wm.select(1, 0), 1);
+    EXPECT_EQ(wm.select(1, 1), 3);
+    EXPECT_EQ(wm.select(1, 2), -1);
+    EXPECT_EQ(wm.select(8, 0), -1);
+
+    EXPECT_THROW(wm.k_esimo_menor(2, 1, 0), std::out_of_range);
+    EXPECT_THROW(wm.k_esimo_menor(0, 2, 3), std::out_of_range);
+    EXPECT_THROW(wm.contar_menores(0, 9, 1), std::out_of_range);
+}
+
+TEST(WaveletMatrixTest, TesteAleatorioContraIngenuo) {
+    std::mt19937 gerador(2024);
+    const int n = 200;
+    std::vector<long long> arr(n);
+    for (auto& x : arr) x = static_cast<long long>(gerador() % 40) - 20;
+    WaveletMatrix<long long> wm(arr);
+
+    for (int q = 0; q < 500; ++q) {
+        int l = gerador() % n;
+        int r = gerador() % n;
+        if (l > r) std::swap(l, r);
+        std::vector<long long> sub(arr.begin() + l, arr.begin() + r + 1);
+        std::sort(sub.begin(), sub.end());
+
+        int k = gerador() % sub.size();
+        ASSERT_EQ(wm.k_esimo_menor(l, r, k), sub[k]);
+
+        long long x = static_cast<long long>(gerador() % 50) - 25;
+        ASSERT_EQ(wm.contar_menores(l, r, x), std::lower_bound(sub.begin(), sub.end(), x) - sub.begin());
+        ASSERT_EQ(wm.contar_ocorrencias(l, r, x), std::count(sub.begin(), sub.end(), x));
+        ASSERT_EQ(wm.contar_distintos(l, r), static_cast<int>(std::set<long long>(sub.begin(), sub.end()).size()));
+    }
+}
+
+TEST(WaveletMatrixTest, TesteValorUnicoEUmElemento) {
+    WaveletMatrix<int> iguais(std::vector<int>(10, 7));
+    EXPECT_EQ(iguais.k_esimo_menor(0, 9, 5), 7);
+    EXPECT_EQ(iguais.contar_menores(0, 9, 7), 0);
+    EXPECT_EQ(iguais.contar_menores(0, 9, 8), 10);
+    EXPECT_EQ(iguais.contar_distintos(3, 8), 1);
+    EXPECT_EQ(iguais.select(7, 9), 9);
+
+    WaveletMatrix<int> um(std::vector<int>{42});
+    EXPECT_EQ(um.acessar(0), 42);
+    EXPECT_EQ(um.contar_distintos(0, 0), 1);
+}
\ No newline at end of file
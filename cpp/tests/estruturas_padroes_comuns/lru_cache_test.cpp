@@ -0,0 +1,311 @@
+#include <gtest/gtest.h>
+#include "estruturas_padroes_comuns/lru_cache.hpp"
+#include <atomic>
+#include <chrono>
+#include <list>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+// Relógio controlado pelos testes de TTL.
+struct RelogioFalso {
+    using duration = std::chrono::nanoseconds;
+    using rep = duration::rep;
+    using period = duration::period;
+    using time_point = std::chrono::time_point<RelogioFalso>;
+    static constexpr bool is_steady = true;
+
+    static inline duration atual{0};
+    static time_point now() { return time_point(atual); }
+};
+
+struct PesoTamanho {
+    std::size_t operator()(int, const std::string& valor) const { return valor.size(); }
+};
+
+// Suíte de testes para o LRUCache
+TEST(LRUCacheTest, TesteOrdemDeDespejo) {
+    EXPECT_THROW((LRUCache<int, int>(0)), std::invalid_argument);
+    LRUCache<int, std::string> cache(3);
+    std::string v;
+    cache.inserir(1, "um");
+    cache.inserir(2, "dois");
+    cache.inserir(3, "tres");
+    EXPECT_TRUE(cache.buscar(1, v)); // 1 passa a ser a mais recente
+    EXPECT_EQ(v, "um");
+    cache.inserir(4, "quatro");      // Despeja 2
+    EXPECT_FALSE(cache.contem(2));
+    EXPECT_TRUE(cache.contem(3));
+    cache.inserir(3, "TRES");        // Atualiza e promove 3
+    cache.inserir(5, "cinco");       // Despeja 1
+    EXPECT_FALSE(cache.contem(1));
+    EXPECT_TRUE(cache.buscar(3, v));
+    EXPECT_EQ(v, "TRES");
+    EXPECT_EQ(cache.tamanho(), 3u);
+
+    EXPECT_TRUE(cache.remover(4));
+    EXPECT_FALSE(cache.remover(4));
+    EXPECT_FALSE(cache.buscar(4, v));
+
+    EstatisticasCache s = cache.estatisticas();
+    EXPECT_EQ(s.acertos, 2u);
+    EXPECT_EQ(s.falhas, 1u);
+    EXPECT_EQ(s.despejos, 2u);
+    cache.limpar();
+    EXPECT_TRUE(cache.vazio());
+}
+
+TEST(LRUCacheTest, TesteOperacoesAleatoriasContraModelo) {
+    // Modelo: std::list em ordem de recência e unordered_map para a posição de cada chave.
+    const std::size_t capacidade = 200;
+    LRUCache<int, int> cache(capacidade);
+    std::list<std::pair<int, int>> ordem;
+    std::unordered_map<int, std::list<std::pair<int, int>>::iterator> posicoes;
+    std::mt19937 gerador(40);
+
+    for (int passo = 0; passo < 200000; ++passo) {
+        int chave = static_cast<int>(gerador() % 500);
+        int operacao = static_cast<int>(gerador() % 10);
+        auto it = posicoes.find(chave);
+        if (operacao < 5) {
+            int v = -1;
+            bool achou = cache.buscar(chave, v);
+            ASSERT_EQ(achou, it != posicoes.end());
+            if (achou) {
+                ASSERT_EQ(v, it->second->second);
+                ordem.splice(ordem.begin(), ordem, it->second);
+            }
+        } else if (operacao < 9) {
+            int valor = static_cast<int>(gerador());
+            cache.inserir(chave, valor);
+            if (it != posicoes.end()) ordem.erase(it->second);
+            ordem.emplace_front(chave, valor);
+            posicoes[chave] = ordem.begin();
+            if (ordem.size() > capacidade) {
+                posicoes.erase(ordem.back().first);
+                ordem.pop_back();
+            }
+        } else {
+            ASSERT_EQ(cache.remover(chave), it != posicoes.end());
+            if (it != posicoes.end()) {
+                ordem.erase(it->second);
+                posicoes.erase(it);
+            }
+        }
+        ASSERT_EQ(cache.tamanho(), ordem.size());
+    }
+    for (int chave = 0; chave < 500; ++chave) ASSERT_EQ(cache.contem(chave), posicoes.count(chave) == 1);
+}
+
+TEST(LRUCacheTest, TestePesoETTL) {
+    // Capacidade em bytes do valor.
+    LRUCache<int, std::string, std::hash<int>, PesoTamanho, RelogioFalso> cache(10, 100ns);
+    cache.inserir(1, "aaaa");
+    cache.inserir(2, "bbbb");
+    EXPECT_EQ(cache.peso_total(), 8u);
+    cache.inserir(3, "ccc"); // 11 bytes: despeja 1
+    EXPECT_FALSE(cache.contem(1));
+    EXPECT_EQ(cache.peso_total(), 7u);
+    EXPECT_FALSE(cache.inserir(4, std::string(11, 'x'))); // Maior que a capacidade
+    EXPECT_FALSE(cache.contem(4));
+    cache.inserir(2, "b"); // Atualizar o valor ajusta o peso
+    EXPECT_EQ(cache.peso_total(), 4u);
+
+    // TTL padrão de 100 ns e um TTL próprio maior para a chave 5.
+    RelogioFalso::atual = 1000ns;
+    cache.inserir(5, "e", 1000ns);
+    cache.inserir(6, "f");
+    RelogioFalso::atual = 1099ns;
+    EXPECT_TRUE(cache.contem(6));
+    RelogioFalso::atual = 1100ns;
+    std::string v;
+    EXPECT_FALSE(cache.contem(6));
+    EXPECT_FALSE(cache.buscar(6, v));
+    EXPECT_TRUE(cache.buscar(5, v));
+    EXPECT_EQ(v, "e");
+    EXPECT_EQ(cache.estatisticas().expiracoes, 1u);
+
+    // TTL zero: não expira.
+    cache.inserir(7, "g", 0ns);
+    RelogioFalso::atual = 1000000ns;
+    EXPECT_TRUE(cache.contem(7));
+    RelogioFalso::atual = 0ns;
+}
+
+// Suíte de testes para o LRUCacheConcorrente
+TEST(LRUCacheConcorrenteTest, TesteSegundaChance) {
+    // Com um só fragmento, uma entrada lida antes do despejo sobrevive a ele.
+    LRUCacheConcorrente<int, int> cache(3, 1);
+    EXPECT_EQ(cache.num_fragmentos(), 1u);
+    int v;
+    cache.inserir(1, 10);
+    cache.inserir(2, 20);
+    cache.inserir(3, 30);
+    EXPECT_TRUE(cache.buscar(1, v));
+    cache.inserir(4, 40); // 1 ganha segunda chance; 2 é despejada
+    EXPECT_TRUE(cache.contem(1));
+    EXPECT_FALSE(cache.contem(2));
+    EXPECT_FALSE(cache.buscar(2, v));
+    EstatisticasCache s = cache.estatisticas();
+    EXPECT_EQ(s.acertos, 1u);
+    EXPECT_EQ(s.falhas, 1u);
+    EXPECT_EQ(s.despejos, 1u);
+}
+
+TEST(LRUCacheConcorrenteTest, TesteLeiturasEEscritasConcorrentes) {
+    // O valor de cada chave é sempre 3 * chave; leituras nunca podem ver outro valor.
+    const std::size_t capacidade = 1000;
+    LRUCacheConcorrente<int, long long> cache(capacidade, 8);
+    const int threads = 4, operacoes = 50000;
+    std::atomic<bool> errado{false};
+    std::atomic<long long> buscas{0};
+
+    std::vector<std::thread> trabalhadoras;
+    for (int t = 0; t < threads; ++t) {
+        trabalhadoras.emplace_back([&, t] {
+            std::mt19937 gerador(t);
+            long long v;
+            for (int i = 0; i < operacoes; ++i) {
+                int chave = static_cast<int>(gerador() % 3000);
+                if (cache.buscar(chave, v)) {
+                    if (v != 3LL * chave) errado = true;
+                } else {
+                    cache.inserir(chave, 3LL * chave);
+                }
+                if (i % 100 == 0) cache.remover(chave + 1);
+                ++buscas;
+            }
+        });
+    }
+    for (auto& th : trabalhadoras) th.join();
+
+    EXPECT_FALSE(errado.load());
+    EXPECT_LE(cache.tamanho(), capacidade);
+    EstatisticasCache s = cache.estatisticas();
+    EXPECT_EQ(s.acertos + s.falhas, static_cast<std::uint64_t>(buscas.load()));
+    EXPECT_GT(s.acertos, 0u);
+}
+
+// Suíte de testes para o SketchContagemMinima
+TEST(SketchContagemMinimaTest, TesteContagemSaturacaoEEnvelhecimento) {
+    SketchContagemMinima sketch(64);
+    EXPECT_EQ(sketch.largura(), 64u);
+    std::uint64_t a = misturar_hash(1), b = misturar_hash(2);
+    EXPECT_EQ(sketch.frequencia(a), 0);
+    for (int i = 0; i < 5; ++i) sketch.incrementar(a);
+    sketch.incrementar(b);
+    EXPECT_EQ(sketch.frequencia(a), 5); // Nunca subestima; com poucas chaves, é exato
+    EXPECT_EQ(sketch.frequencia(b), 1);
+    for (int i = 0; i < 20; ++i) sketch.incrementar(a);
+    EXPECT_EQ(sketch.frequencia(a), 15);
+    sketch.envelhecer();
+    EXPECT_EQ(sketch.frequencia(a), 7);
+    EXPECT_EQ(sketch.frequencia(b), 0);
+
+    // O envelhecimento automático acontece a cada 10 * largura incrementos.
+    SketchContagemMinima pequeno(16);
+    for (int i = 0; i < 159; ++i) pequeno.incrementar(misturar_hash(1000 + i % 40));
+    int antes = pequeno.frequencia(misturar_hash(1000));
+    pequeno.incrementar(misturar_hash(1000));
+    EXPECT_LE(pequeno.frequencia(misturar_hash(1000)), (antes + 1) / 2);
+}
+
+// Suíte de testes para o CacheWTinyLFU
+TEST(CacheWTinyLFUTest, TesteResisteAVarredura) {
+    // 50 chaves quentes acessadas várias vezes e depois uma varredura de 10000 chaves únicas:
+    // o LRU perde todas as quentes, a W-TinyLFU mantém quase todas.
+    LRUCache<int, int> lru(100);
+    CacheWTinyLFU<int, int> tiny(100);
+    auto acessar = [](auto& cache, int chave) {
+        int v;
+        if (!cache.buscar(chave, v)) cache.inserir(chave, chave);
+    };
+    for (int rodada = 0; rodada < 5; ++rodada) {
+        for (int chave = 0; chave < 50; ++chave) {
+            acessar(lru, chave);
+            acessar(tiny, chave);
+        }
+    }
+    for (int chave = 1000; chave < 11000; ++chave) {
+        acessar(lru, chave);
+        acessar(tiny, chave);
+    }
+    int quentes_lru = 0, quentes_tiny = 0;
+    for (int chave = 0; chave < 50; ++chave) {
+        quentes_lru += lru.contem(chave);
+        quentes_tiny += tiny.contem(chave);
+    }
+    EXPECT_EQ(quentes_lru, 0);
+    EXPECT_GE(quentes_tiny, 45);
+    EXPECT_LE(tiny.tamanho(), 100u);
+}
+
+TEST(CacheWTinyLFUTest, TesteOperacoesAleatorias) {
+    // O valor de cada chave é sempre 5 * chave + versão; a capacidade nunca é excedida e
+    // entradas removidas não reaparecem.
+    CacheWTinyLFU<int, long long, std::hash<int>, PesoUnitario, RelogioFalso> cache(64, 0ns);
+    std::unordered_map<int, long long> ultimo_valor;
+    std::mt19937 gerador(41);
+    for (int passo = 0; passo < 100000; ++passo) {
+        int chave = static_cast<int>(gerador() % 300);
+        int operacao = static_cast<int>(gerador() % 10);
+        long long v;
+        if (operacao < 6) {
+            if (cache.buscar(chave, v)) {
+                ASSERT_EQ(v, ultimo_valor.at(chave));
+            }
+        } else if (operacao < 9) {
+            v = 5LL * chave + passo;
+            ASSERT_TRUE(cache.inserir(chave, v));
+            ultimo_valor[chave] = v;
+        } else {
+            cache.remover(chave);
+            ASSERT_FALSE(cache.contem(chave));
+        }
+        ASSERT_LE(cache.tamanho(), 64u);
+    }
+    EstatisticasCache s = cache.estatisticas();
+    EXPECT_GT(s.acertos, 0u);
+    EXPECT_GT(s.despejos, 0u);
+
+    // TTL também vale para a W-TinyLFU.
+    cache.inserir(-1, 7, 10ns);
+    RelogioFalso::atual = 10ns;
+    long long v;
+    EXPECT_FALSE(cache.buscar(-1, v));
+    RelogioFalso::atual = 0ns;
+    cache.limpar();
+    EXPECT_TRUE(cache.vazio());
+}
+
+TEST(CacheWTinyLFUTest, TesteConcorrente) {
+    CacheWTinyLFUConcorrente<int, long long> cache(1000, 4);
+    std::atomic<bool> errado{false};
+    std::vector<std::thread> trabalhadoras;
+    for (int t = 0; t < 4; ++t) {
+        trabalhadoras.emplace_back([&, t] {
+            std::mt19937 gerador(100 + t);
+            long long v;
+            for (int i = 0; i < 50000; ++i) {
+                // Metade dos acessos em 200 chaves quentes, metade espalhada.
+                int chave = (i % 2) ? static_cast<int>(gerador() % 200) : static_cast<int>(gerador() % 100000);
+                if (cache.buscar(chave, v)) {
+                    if (v != 3LL * chave) errado = true;
+                } else {
+                    cache.inserir(chave, 3LL * chave);
+                }
+            }
+        });
+    }
+    for (auto& th : trabalhadoras) th.join();
+    EXPECT_FALSE(errado.load());
+    EXPECT_LE(cache.tamanho(), 1000u);
+    // As chaves quentes sobrevivem ao tráfego espalhado.
+    int quentes = 0;
+    for (int chave = 0; chave < 200; ++chave) quentes += cache.contem(chave);
+    EXPECT_GE(quentes, 150);
+}
@@ -1,5 +1,9 @@
 #include <gtest/gtest.h>
 #include "manipulacao_strings/rabin_karp.hpp"
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 // Suíte de testes para o algoritmo Rabin-Karp
 TEST(RabinKarpTest, TestePadraoNoInicio) {
@@ -54,4 +58,75 @@ TEST(RabinKarpTest, TesteCasoComplexo) {
     std::string padrao = "ACAAD";
     std::vector<int> esperados = {13};
     EXPECT_EQ(rabin_karp(texto, padrao), esperados);
-}
\ No newline at end of file
+}
+
+// Todas as ocorrências de todos os padrões, por comparação direta.
+static std::vector<OcorrenciaPadrao> buscar_ingenuo(const std::string& texto, const std::vector<std::string>& padroes) {
+    std::vector<OcorrenciaPadrao> ocorrencias;
+    const std::size_t m = padroes[0].size();
+    for (std::size_t i = 0; i + m <= texto.size(); ++i) {
+        for (std::size_t j = 0; j < padroes.size(); ++j) {
+            if (texto.compare(i, m, padroes[j]) == 0) ocorrencias.push_back({i, j});
+        }
+    }
+    return ocorrencias;
+}
+
+TEST(RabinKarpTest, TesteTextoLongoRepetitivo) {
+    // Alfabeto de 2 letras: com o módulo antigo (101), quase toda janela colidia.
+    std::mt19937_64 gerador(42);
+    std::string texto(200000, 'a');
+    for (auto& c : texto) c = "ab"[gerador() % 2];
+    const std::string padrao = texto.substr(5000, 12);
+    std::vector<int> esperados;
+    for (const auto& ocorrencia : buscar_ingenuo(texto, {padrao})) esperados.push_back(static_cast<int>(ocorrencia.posicao));
+    EXPECT_EQ(rabin_karp(texto, padrao), esperados);
+    EXPECT_FALSE(esperados.empty());
+
+    // Bytes acima de 127 e nulos também fazem parte do alfabeto.
+    std::string binario = std::string("\xff\x00\x80", 3) + "x" + std::string("\xff\x00\x80", 3);
+    EXPECT_EQ(rabin_karp(binario, std::string("\xff\x00\x80", 3)), (std::vector<int>{0, 4}));
+}
+
+TEST(RabinKarpTest, TesteMultiplosPadroes) {
+    std::mt19937_64 gerador(7);
+    std::string texto(100000, 'a');
+    for (auto& c : texto) c = "abcd"[gerador() % 4];
+    std::vector<std::string> padroes;
+    for (int i = 0; i < 300; ++i) padroes.push_back(texto.substr(gerador() % (texto.size() - 8), 8));
+    padroes.push_back("zzzzzzzz");   // Nunca ocorre
+    padroes.push_back(padroes[0]);   // Repetido: relatado com os dois índices
+    EXPECT_EQ(rabin_karp_multiplo(texto, padroes), buscar_ingenuo(texto, padroes));
+
+    EXPECT_THROW(rabin_karp_multiplo(texto, {}), std::invalid_argument);
+    EXPECT_THROW(rabin_karp_multiplo(texto, {"abc", "ab"}), std::invalid_argument);
+    EXPECT_THROW(rabin_karp_multiplo(texto, {""}), std::invalid_argument);
+}
+
+TEST(RabinKarpTest, TesteFluxoEmPedacos) {
+    std::mt19937_64 gerador(3);
+    std::string texto(50000, 'a');
+    for (auto& c : texto) c = "ab"[gerador() % 2];
+    for (std::size_t m : {1, 2, 7, 64}) {
+        std::vector<std::string> padroes = {texto.substr(100, m), texto.substr(777, m), std::string(m, 'a')};
+        const std::vector<OcorrenciaPadrao> esperado = buscar_ingenuo(texto, padroes);
+        RabinKarpFluxo fluxo(padroes);
+        for (int rodada = 0; rodada < 2; ++rodada) {
+            // Pedaços de 0 a 2m caracteres, muitos menores que o padrão.
+            std::vector<OcorrenciaPadrao> obtido;
+            for (std::size_t i = 0; i < texto.size();) {
+                const std::size_t tamanho = std::min(texto.size() - i, static_cast<std::size_t>(gerador() % (2 * m + 1)));
+                fluxo.alimentar(std::string_view(texto).substr(i, tamanho), obtido);
+                i += tamanho;
+            }
+            EXPECT_EQ(obtido, esperado) << "m = " << m;
+            EXPECT_EQ(fluxo.processados(), texto.size());
+            fluxo.reiniciar();
+        }
+    }
+    // Um pedaço grande só, e a ocorrência que cruza a fronteira entre dois pedaços.
+    RabinKarpFluxo fluxo("fronteira");
+    EXPECT_TRUE(fluxo.alimentar("...fron").empty());
+    EXPECT_EQ(fluxo.alimentar("teira..."), (std::vector<OcorrenciaPadrao>{{3, 0}}));
+    EXPECT_THROW(RabinKarpFluxo(""), std::invalid_argument);
+}